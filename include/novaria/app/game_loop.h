@@ -1,5 +1,7 @@
 #pragma once
 
+#include "core/tick_scheduler.h"
+
 #include <functional>
 
 namespace novaria::app {
@@ -10,7 +12,13 @@ public:
     using UpdateFn = std::function<void(double)>;
     using RenderFn = std::function<void(float)>;
 
+    explicit GameLoop(const core::TickSchedulerSettings& settings = {});
+
     void Run(const PumpEventsFn& pump_events, const UpdateFn& update, const RenderFn& render);
+    core::TickSchedulerStats SchedulerStats() const;
+
+private:
+    core::TickScheduler scheduler_;
 };
 
 }  // namespace novaria::app
@@ -5,6 +5,7 @@
 #include "world/world_service.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace novaria::app {
 
@@ -71,6 +72,8 @@ public:
 
 private:
     LocalPlayerState state_{};
+    std::vector<sim::GameplayPickupEvent> pickup_event_scratch_;
+    wire::ByteWriter command_payload_writer_;
 };
 
 }  // namespace novaria::app
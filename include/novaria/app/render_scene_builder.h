@@ -2,8 +2,12 @@
 
 #include "app/player_controller.h"
 #include "platform/render_scene.h"
+#include "sim/ecs_runtime.h"
+#include "sim/entity_interpolation.h"
 #include "world/world_service.h"
 
+#include <vector>
+
 namespace novaria::app {
 
 class RenderSceneBuilder final {
@@ -13,7 +17,9 @@ public:
         int viewport_width,
         int viewport_height,
         const world::IWorldService& world_service,
-        float daylight_factor) const;
+        float daylight_factor,
+        const std::vector<sim::InterpolatedEntityState>& remote_players,
+        const std::vector<sim::ecs::ReplicatedEntitySnapshot>& replicated_entities) const;
 };
 
 }  // namespace novaria::app
@@ -18,6 +18,7 @@ struct GameConfig final {
     int net_udp_local_port = 0;
     std::string net_udp_remote_host = "127.0.0.1";
     int net_udp_remote_port = 0;
+    int net_interpolation_delay_ms = 100;
 };
 
 class ConfigLoader final {
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace novaria::core {
+
+enum class StatusCode : std::uint8_t {
+    Ok = 0,
+    NotInitialized = 1,
+    InvalidArgument = 2,
+    NotFound = 3,
+    MalformedPayload = 4,
+    WouldBlock = 5,
+    SystemError = 6,
+    ScriptError = 7,
+    Unavailable = 8,
+};
+
+class [[nodiscard]] Status final {
+public:
+    constexpr Status() = default;
+
+    static constexpr Status Ok() {
+        return Status{};
+    }
+    static constexpr Status Error(StatusCode code, const char* detail) {
+        return Status(code, detail, 0);
+    }
+    static constexpr Status SystemError(const char* detail, int system_error_code) {
+        return Status(StatusCode::SystemError, detail, system_error_code);
+    }
+
+    constexpr bool IsOk() const {
+        return code_ == StatusCode::Ok;
+    }
+    constexpr explicit operator bool() const {
+        return IsOk();
+    }
+    constexpr StatusCode Code() const {
+        return code_;
+    }
+    constexpr const char* Detail() const {
+        return detail_;
+    }
+    constexpr int SystemErrorCode() const {
+        return system_error_code_;
+    }
+
+    std::string Message() const;
+
+private:
+    constexpr Status(StatusCode code, const char* detail, int system_error_code)
+        : code_(code), system_error_code_(system_error_code), detail_(detail != nullptr ? detail : "") {}
+
+    StatusCode code_ = StatusCode::Ok;
+    int system_error_code_ = 0;
+    const char* detail_ = "";
+};
+
+const char* StatusCodeName(StatusCode code);
+
+}  // namespace novaria::core
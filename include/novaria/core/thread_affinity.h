@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace novaria::core {
+
+std::size_t HardwareThreadCount();
+bool PinCurrentThreadToCore(std::size_t core_index, std::string& out_error);
+
+}  // namespace novaria::core
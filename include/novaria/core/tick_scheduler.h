@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace novaria::core {
+
+struct TickSchedulerSettings final {
+    double tick_interval_seconds = 1.0 / 60.0;
+    std::uint32_t max_catch_up_ticks = 15;
+    std::chrono::microseconds spin_wait{2000};
+    bool fast_forward = false;
+};
+
+struct TickSchedulerStats final {
+    std::uint64_t tick_count = 0;
+    std::uint64_t catch_up_tick_count = 0;
+    std::uint64_t skipped_tick_count = 0;
+    std::uint64_t overrun_count = 0;
+    double last_tick_ms = 0.0;
+    double mean_tick_ms = 0.0;
+    double max_tick_ms = 0.0;
+    double last_lateness_ms = 0.0;
+    double mean_lateness_ms = 0.0;
+    double max_lateness_ms = 0.0;
+};
+
+class TickScheduler final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void SetSettings(const TickSchedulerSettings& settings);
+    const TickSchedulerSettings& Settings() const;
+    Clock::duration TickInterval() const;
+    void Start(Clock::time_point now);
+    bool TryBeginTick(Clock::time_point now);
+    void EndTick(Clock::time_point now);
+    void WaitForNextTick() const;
+    float InterpolationAlpha(Clock::time_point now) const;
+    Clock::time_point NextTickDeadline() const;
+    TickSchedulerStats Stats() const;
+    void ResetStats();
+
+private:
+    TickSchedulerSettings settings_{};
+    Clock::duration tick_interval_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(TickSchedulerSettings{}.tick_interval_seconds));
+    Clock::time_point next_tick_deadline_{};
+    Clock::time_point tick_begin_time_{};
+    bool tick_active_ = false;
+    std::uint64_t tick_count_ = 0;
+    std::uint64_t catch_up_tick_count_ = 0;
+    std::uint64_t skipped_tick_count_ = 0;
+    std::uint64_t overrun_count_ = 0;
+    Clock::duration last_tick_duration_{};
+    Clock::duration total_tick_duration_{};
+    Clock::duration max_tick_duration_{};
+    Clock::duration last_lateness_{};
+    Clock::duration total_lateness_{};
+    Clock::duration max_lateness_{};
+};
+
+}  // namespace novaria::core
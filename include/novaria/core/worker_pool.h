@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace novaria::core {
+
+class WorkerPool final {
+public:
+    static constexpr std::size_t kMaxWorkers = 16;
+
+    WorkerPool() = default;
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+    ~WorkerPool();
+
+    bool Start(std::size_t worker_count, std::string& out_error);
+    void Stop();
+    std::size_t WorkerCount() const;
+    bool Busy() const;
+    void Dispatch(std::size_t job_count, std::function<void(std::size_t)> job);
+    void Wait();
+
+private:
+    void WorkerLoop(std::uint64_t observed_generation);
+    void RunJobs();
+
+    std::vector<std::thread> workers_;
+    mutable std::mutex mutex_;
+    std::condition_variable work_ready_;
+    std::condition_variable work_done_;
+    std::function<void(std::size_t)> job_;
+    std::size_t job_count_ = 0;
+    std::atomic<std::size_t> next_job_index_{0};
+    std::size_t active_worker_count_ = 0;
+    std::uint64_t generation_ = 0;
+    bool busy_ = false;
+    bool stopping_ = false;
+};
+
+}  // namespace novaria::core
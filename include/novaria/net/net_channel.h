@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace novaria::net {
+
+enum class NetChannel : std::uint8_t {
+    Control = 0,
+    Command = 1,
+    EntityState = 2,
+    ChunkStream = 3,
+};
+
+inline constexpr std::size_t kNetChannelCount = 4;
+
+struct NetChannelBudget final {
+    std::size_t send_budget_bytes_per_tick = 0;
+    std::size_t receive_queue_limit = 0;
+};
+
+struct NetCongestionSettings final {
+    bool enabled = true;
+    std::size_t initial_window_bytes_per_tick = 8U * 1024U;
+    std::size_t min_window_bytes_per_tick = 1024;
+    std::size_t max_window_bytes_per_tick = 256U * 1024U;
+    std::size_t additive_increase_bytes = 1024;
+    std::uint64_t loss_recovery_ticks = 8;
+    std::uint64_t in_flight_timeout_ticks = 60;
+};
+
+struct NetChannelSettings final {
+    std::array<NetChannelBudget, kNetChannelCount> channels = {
+        NetChannelBudget{.send_budget_bytes_per_tick = 0, .receive_queue_limit = 0},
+        NetChannelBudget{.send_budget_bytes_per_tick = 16U * 1024U, .receive_queue_limit = 1024},
+        NetChannelBudget{.send_budget_bytes_per_tick = 32U * 1024U, .receive_queue_limit = 1024},
+        NetChannelBudget{.send_budget_bytes_per_tick = 24U * 1024U, .receive_queue_limit = 1024},
+    };
+    std::size_t max_chunk_stream_datagram_bytes = 8U * 1024U;
+    std::size_t max_entity_state_datagram_bytes = 1200;
+    std::size_t max_queued_chunk_payloads = 4096;
+    NetCongestionSettings congestion{};
+
+    const NetChannelBudget& Budget(NetChannel channel) const {
+        return channels[static_cast<std::size_t>(channel)];
+    }
+};
+
+struct NetChannelDiagnostics final {
+    std::uint64_t sent_datagram_count = 0;
+    std::uint64_t sent_byte_count = 0;
+    std::uint64_t budget_deferred_count = 0;
+    std::size_t queued_send_count = 0;
+    std::uint64_t send_queue_full_drop_count = 0;
+    std::size_t pending_receive_count = 0;
+    std::uint64_t receive_queue_full_drop_count = 0;
+};
+
+struct NetChunkStreamFlowDiagnostics final {
+    std::size_t congestion_window_bytes_per_tick = 0;
+    std::uint64_t congestion_loss_event_count = 0;
+    std::size_t in_flight_batch_count = 0;
+    std::size_t in_flight_chunk_count = 0;
+    std::size_t remote_receive_window_chunks = 0;
+    std::uint64_t receive_window_deferred_count = 0;
+    std::uint64_t reported_lost_batch_count = 0;
+    std::uint64_t timed_out_batch_count = 0;
+    std::uint64_t feedback_sent_count = 0;
+    std::uint64_t feedback_received_count = 0;
+};
+
+const char* NetChannelName(NetChannel channel);
+bool ValidateNetChannelSettings(const NetChannelSettings& settings, std::string& out_error);
+
+}  // namespace novaria::net
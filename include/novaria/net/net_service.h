@@ -1,8 +1,11 @@
 #pragma once
 
 #include "core/tick_context.h"
+#include "net/net_channel.h"
 #include "wire/byte_io.h"
+#include "wire/small_byte_buffer.h"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -19,7 +22,35 @@ enum class NetSessionState : std::uint8_t {
 struct PlayerCommand final {
     std::uint32_t player_id = 0;
     std::uint32_t command_id = 0;
-    wire::ByteBuffer payload;
+    wire::SmallByteBuffer payload;
+    std::uint32_t sequence = 0;
+    std::uint64_t target_tick = 0;
+};
+
+// Recipient id for entity states every peer receives; other ids address one player's interest-filtered delta.
+inline constexpr std::uint32_t kBroadcastEntityStateRecipient = 0;
+
+struct EntityStateBatch final {
+    std::uint64_t tick_index = 0;
+    std::vector<wire::ByteBuffer> entity_states;
+};
+
+inline constexpr std::size_t kNetMessageKindSlotCount = 6;
+inline constexpr std::array<std::size_t, 7> kNetDatagramSizeBucketUpperBounds = {
+    64, 128, 256, 512, 1024, 1200, 1472,
+};
+inline constexpr std::size_t kNetDatagramSizeBucketCount = kNetDatagramSizeBucketUpperBounds.size() + 1;
+
+struct NetMessageKindTraffic final {
+    std::uint64_t sent_packet_count = 0;
+    std::uint64_t sent_byte_count = 0;
+    std::uint64_t received_packet_count = 0;
+    std::uint64_t received_byte_count = 0;
+};
+
+struct NetPlayerCommandDrops final {
+    std::uint32_t player_id = 0;
+    std::size_t dropped_queue_full_count = 0;
 };
 
 struct NetDiagnosticsSnapshot final {
@@ -38,9 +69,11 @@ struct NetDiagnosticsSnapshot final {
     std::size_t dropped_command_count = 0;
     std::size_t dropped_command_disconnected_count = 0;
     std::size_t dropped_command_queue_full_count = 0;
+    std::size_t dropped_command_player_queue_full_count = 0;
     std::size_t dropped_remote_chunk_payload_count = 0;
     std::size_t dropped_remote_chunk_payload_disconnected_count = 0;
     std::size_t dropped_remote_chunk_payload_queue_full_count = 0;
+    std::size_t dropped_remote_entity_state_count = 0;
     std::size_t unsent_command_count = 0;
     std::size_t unsent_command_disconnected_count = 0;
     std::size_t unsent_command_self_suppressed_count = 0;
@@ -49,6 +82,34 @@ struct NetDiagnosticsSnapshot final {
     std::size_t unsent_snapshot_disconnected_count = 0;
     std::size_t unsent_snapshot_self_suppressed_count = 0;
     std::size_t unsent_snapshot_send_failure_count = 0;
+    std::size_t unsent_entity_state_count = 0;
+    std::size_t redundant_command_send_count = 0;
+    std::size_t duplicate_command_count = 0;
+    std::size_t lost_command_count = 0;
+    std::size_t unacked_command_overflow_count = 0;
+    std::size_t evicted_command_stream_count = 0;
+    std::uint64_t impairment_dropped_datagram_count = 0;
+    std::uint64_t impairment_duplicated_datagram_count = 0;
+    std::uint64_t impairment_reordered_datagram_count = 0;
+    std::size_t impairment_queued_datagram_count = 0;
+    std::uint64_t rtt_sample_count = 0;
+    std::uint64_t last_rtt_microseconds = 0;
+    std::uint64_t smoothed_rtt_microseconds = 0;
+    std::uint64_t rtt_variance_microseconds = 0;
+    std::uint64_t min_rtt_microseconds = 0;
+    std::uint64_t heartbeat_received_count = 0;
+    std::uint64_t heartbeat_lost_count = 0;
+    double estimated_loss_rate = 0.0;
+    bool tick_clock_synced = false;
+    std::uint64_t tick_clock_sample_count = 0;
+    std::uint64_t tick_clock_resync_count = 0;
+    double remote_tick_offset = 0.0;
+    double one_way_delay_ticks = 0.0;
+    std::array<NetMessageKindTraffic, kNetMessageKindSlotCount> traffic_by_kind{};
+    std::array<std::uint64_t, kNetDatagramSizeBucketCount> sent_datagram_size_histogram{};
+    std::array<NetChannelDiagnostics, kNetChannelCount> channels{};
+    NetChunkStreamFlowDiagnostics chunk_stream_flow{};
+    std::vector<NetPlayerCommandDrops> player_command_drops{};
 };
 
 class INetService {
@@ -63,12 +124,17 @@ public:
     virtual NetSessionState SessionState() const = 0;
     virtual NetDiagnosticsSnapshot DiagnosticsSnapshot() const = 0;
     virtual void Tick(const core::TickContext& tick_context) = 0;
-    virtual void SubmitLocalCommand(const PlayerCommand& command) = 0;
-    virtual std::vector<PlayerCommand> ConsumeRemoteCommands() = 0;
-    virtual std::vector<wire::ByteBuffer> ConsumeRemoteChunkPayloads() = 0;
+    virtual std::uint32_t SubmitLocalCommand(PlayerCommand command) = 0;
+    virtual void ConsumeRemoteCommands(std::vector<PlayerCommand>& out_commands) = 0;
+    virtual void ConsumeRemoteChunkPayloads(std::vector<wire::ByteBuffer>& out_payloads) = 0;
+    virtual void ConsumeRemoteEntityStates(std::vector<EntityStateBatch>& out_batches) = 0;
     virtual void PublishWorldSnapshot(
         std::uint64_t tick_index,
         const std::vector<wire::ByteBuffer>& encoded_dirty_chunks) = 0;
+    virtual void PublishEntityStates(
+        std::uint64_t tick_index,
+        const std::vector<wire::ByteBuffer>& encoded_entity_states,
+        const std::vector<std::uint32_t>& recipient_player_ids) = 0;
 };
 
 }  // namespace novaria::net
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "net/udp_transport.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace novaria::net {
+
+struct NetworkImpairmentSettings final {
+    bool enabled = false;
+    std::uint64_t seed = 1;
+    std::uint32_t latency_ms = 0;
+    std::uint32_t jitter_ms = 0;
+    double loss_rate = 0.0;
+    double burst_enter_rate = 0.0;
+    double burst_exit_rate = 1.0;
+    double burst_loss_rate = 1.0;
+    double duplicate_rate = 0.0;
+    double reorder_rate = 0.0;
+    std::uint32_t reorder_delay_ms = 20;
+    std::uint64_t bandwidth_bytes_per_second = 0;
+    std::size_t max_queued_bytes = 1U << 20;
+};
+
+struct NetworkImpairmentDiagnostics final {
+    std::uint64_t submitted_datagram_count = 0;
+    std::uint64_t delivered_datagram_count = 0;
+    std::uint64_t dropped_loss_count = 0;
+    std::uint64_t dropped_burst_loss_count = 0;
+    std::uint64_t dropped_queue_full_count = 0;
+    std::uint64_t duplicated_datagram_count = 0;
+    std::uint64_t reordered_datagram_count = 0;
+    std::uint64_t bandwidth_delayed_datagram_count = 0;
+    std::uint64_t burst_enter_count = 0;
+    std::size_t queued_datagram_count = 0;
+    std::size_t queued_bytes = 0;
+};
+
+struct ImpairedDatagram final {
+    UdpEndpoint endpoint{};
+    std::string payload;
+};
+
+bool ValidateNetworkImpairmentSettings(const NetworkImpairmentSettings& settings, std::string& out_error);
+
+class NetworkImpairment final {
+public:
+    void Configure(const NetworkImpairmentSettings& settings);
+    const NetworkImpairmentSettings& Settings() const;
+    bool IsEnabled() const;
+    void Reset();
+
+    void Submit(std::uint64_t now_microseconds, const UdpEndpoint& endpoint, std::string_view payload);
+    bool PopDue(std::uint64_t now_microseconds, ImpairedDatagram& out_datagram);
+    bool HasQueued() const;
+    NetworkImpairmentDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    struct ScheduledDatagram final {
+        std::uint64_t release_microseconds = 0;
+        std::uint64_t order = 0;
+        ImpairedDatagram datagram;
+    };
+
+    struct LaterRelease final {
+        bool operator()(const ScheduledDatagram& lhs, const ScheduledDatagram& rhs) const;
+    };
+
+    std::uint64_t NextRandom();
+    double NextUnit();
+    bool ShouldDrop();
+    std::uint64_t SampleDelayMicroseconds();
+    void Schedule(std::uint64_t release_microseconds, const UdpEndpoint& endpoint, std::string_view payload);
+
+    NetworkImpairmentSettings settings_{};
+    std::uint64_t random_state_ = 0;
+    bool in_burst_ = false;
+    std::uint64_t link_free_microseconds_ = 0;
+    std::uint64_t next_order_ = 0;
+    std::vector<ScheduledDatagram> queue_;
+    NetworkImpairmentDiagnostics diagnostics_{};
+};
+
+}  // namespace novaria::net
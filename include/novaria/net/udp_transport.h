@@ -1,7 +1,12 @@
 #pragma once
 
+#include "core/status.h"
+#include "wire/byte_io.h"
+
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -12,8 +17,13 @@ struct UdpEndpoint final {
     std::uint16_t port = 0;
 };
 
+struct NetworkImpairmentSettings;
+struct NetworkImpairmentDiagnostics;
+
 class UdpTransport final {
 public:
+    static constexpr std::size_t kMaxGatherSegments = 64;
+
     UdpTransport();
     ~UdpTransport();
 
@@ -27,10 +37,17 @@ public:
     bool IsOpen() const;
     std::uint16_t LocalPort() const;
 
-    bool SendTo(const UdpEndpoint& endpoint, std::string_view payload, std::string& out_error);
-    bool Receive(std::string& out_payload, UdpEndpoint& out_sender, std::string& out_error);
+    core::Status SendTo(const UdpEndpoint& endpoint, std::string_view payload);
+    core::Status SendGatherTo(const UdpEndpoint& endpoint, std::span<const wire::ByteSpan> segments);
+    core::Status Receive(std::string& out_payload, UdpEndpoint& out_sender);
+
+    void SetImpairment(const NetworkImpairmentSettings& settings);
+    NetworkImpairmentDiagnostics ImpairmentDiagnostics() const;
+    core::Status FlushImpairedDatagrams();
 
 private:
+    core::Status SendNow(const UdpEndpoint& endpoint, std::string_view payload);
+
     struct Impl;
     std::unique_ptr<Impl> impl_;
 };
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "sim/input_log.h"
+#include "wire/byte_io.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace novaria::runtime {
+
+class InputLogFileWriter final {
+public:
+    bool Open(const std::filesystem::path& file_path, std::string& out_error);
+    bool Append(wire::ByteSpan bytes, std::string& out_error);
+    void Close();
+    bool IsOpen() const;
+
+private:
+    std::filesystem::path file_path_;
+    std::ofstream file_;
+};
+
+bool ReadInputLogFile(
+    const std::filesystem::path& file_path,
+    sim::InputLog& out_log,
+    std::string& out_error);
+
+}  // namespace novaria::runtime
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "net/net_channel.h"
 #include "net/net_service.h"
+#include "net/network_impairment.h"
 #include "net/udp_transport.h"
 
 #include <cstdint>
@@ -13,6 +15,8 @@ struct NetServiceConfig final {
     std::string local_host = "127.0.0.1";
     std::uint16_t local_port = 0;
     net::UdpEndpoint remote_endpoint{};
+    net::NetworkImpairmentSettings impairment{};
+    net::NetChannelSettings channels{};
 };
 
 std::unique_ptr<net::INetService> CreateNetService(const NetServiceConfig& config);
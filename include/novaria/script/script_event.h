@@ -0,0 +1,99 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <variant>
+
+namespace novaria::script {
+
+enum class ScriptEventId : std::uint8_t {
+    GameplayProgress = 0,
+    GameplayPickup = 1,
+    GameplayInteraction = 2,
+    NetSessionStateChanged = 3,
+};
+
+inline constexpr std::size_t kScriptEventIdCount = 4;
+
+inline const char* ScriptEventName(ScriptEventId event_id) {
+    switch (event_id) {
+        case ScriptEventId::GameplayProgress:
+            return "gameplay.progress";
+        case ScriptEventId::GameplayPickup:
+            return "gameplay.pickup";
+        case ScriptEventId::GameplayInteraction:
+            return "gameplay.interaction";
+        case ScriptEventId::NetSessionStateChanged:
+            return "net.session_state_changed";
+    }
+    return "unknown";
+}
+
+inline bool TryParseScriptEventName(std::string_view event_name, ScriptEventId& out_event_id) {
+    for (std::size_t index = 0; index < kScriptEventIdCount; ++index) {
+        const ScriptEventId event_id = static_cast<ScriptEventId>(index);
+        if (event_name == ScriptEventName(event_id)) {
+            out_event_id = event_id;
+            return true;
+        }
+    }
+    return false;
+}
+
+using ScriptEventText = std::array<char, 48>;
+
+inline void AssignScriptEventText(std::string_view text, ScriptEventText& out_text) {
+    const std::size_t length = std::min(text.size(), out_text.size() - 1);
+    std::memcpy(out_text.data(), text.data(), length);
+    out_text[length] = '\0';
+}
+
+struct GameplayProgressEventPayload final {
+    const char* milestone = "";
+};
+
+struct GameplayPickupEventPayload final {
+    std::uint32_t player_id = 0;
+    int tile_x = 0;
+    int tile_y = 0;
+    std::uint16_t material_id = 0;
+    std::uint16_t resource_id = 0;
+    std::uint32_t amount = 0;
+};
+
+struct GameplayInteractionEventPayload final {
+    std::uint32_t player_id = 0;
+    const char* interaction_type = "";
+    const char* result = "";
+    std::uint16_t target_material_id = 0;
+    int tile_x = 0;
+    int tile_y = 0;
+};
+
+struct NetSessionStateChangedEventPayload final {
+    const char* session_state = "";
+    ScriptEventText reason{};
+};
+
+using ScriptEventPayload = std::variant<
+    GameplayProgressEventPayload,
+    GameplayPickupEventPayload,
+    GameplayInteractionEventPayload,
+    NetSessionStateChangedEventPayload>;
+
+struct ScriptEvent final {
+    ScriptEventId id = ScriptEventId::GameplayProgress;
+    std::uint64_t tick_index = 0;
+    ScriptEventPayload payload{};
+
+    template <typename Payload>
+    const Payload& As() const {
+        return *std::get_if<Payload>(&payload);
+    }
+};
+
+}  // namespace novaria::script
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "core/status.h"
 #include "core/tick_context.h"
+#include "script/script_event.h"
 #include "wire/byte_io.h"
 
 #include <cstdint>
@@ -10,12 +12,8 @@
 
 namespace novaria::script {
 
-inline constexpr const char* kScriptApiVersion = "0.1.0";
-
-struct ScriptEvent final {
-    std::string event_name;
-    std::string payload;
-};
+// 0.2.0: novaria_on_event receives a payload table instead of a "k=v;" string.
+inline constexpr const char* kScriptApiVersion = "0.2.0";
 
 struct ScriptModuleSource final {
     std::string module_name;
@@ -47,12 +45,11 @@ public:
     virtual void Shutdown() = 0;
     virtual void Tick(const core::TickContext& tick_context) = 0;
     virtual void DispatchEvent(const ScriptEvent& event_data) = 0;
-    virtual bool TryCallModuleFunction(
+    virtual core::Status TryCallModuleFunction(
         std::string_view module_name,
         std::string_view function_name,
         wire::ByteSpan request_payload,
-        wire::ByteBuffer& out_response_payload,
-        std::string& out_error) = 0;
+        wire::ByteBuffer& out_response_payload) = 0;
     virtual ScriptRuntimeDescriptor RuntimeDescriptor() const = 0;
 };
 
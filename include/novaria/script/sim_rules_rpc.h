@@ -7,10 +7,14 @@
 
 namespace novaria::script::simrpc {
 
-inline wire::ByteBuffer EncodeValidateRequest() {
-    wire::ByteWriter writer;
+inline void EncodeValidateRequest(wire::ByteWriter& writer) {
     writer.WriteU8(kVersion);
     writer.WriteU8(static_cast<wire::Byte>(Command::Validate));
+}
+
+inline wire::ByteBuffer EncodeValidateRequest() {
+    wire::ByteWriter writer;
+    EncodeValidateRequest(writer);
     return writer.TakeBuffer();
 }
 
@@ -44,8 +48,7 @@ inline bool TryDecodeValidateResponse(wire::ByteSpan payload, ValidateResponse&
     return true;
 }
 
-inline wire::ByteBuffer EncodeActionPrimaryRequest(const ActionPrimaryRequest& request) {
-    wire::ByteWriter writer;
+inline void EncodeActionPrimaryRequest(const ActionPrimaryRequest& request, wire::ByteWriter& writer) {
     writer.WriteU8(kVersion);
     writer.WriteU8(static_cast<wire::Byte>(Command::GameplayActionPrimary));
     writer.WriteVarUInt(request.player_id);
@@ -77,6 +80,11 @@ inline wire::ByteBuffer EncodeActionPrimaryRequest(const ActionPrimaryRequest& r
         harvest_flags |= 4;
     }
     writer.WriteU8(harvest_flags);
+}
+
+inline wire::ByteBuffer EncodeActionPrimaryRequest(const ActionPrimaryRequest& request) {
+    wire::ByteWriter writer;
+    EncodeActionPrimaryRequest(request, writer);
     return writer.TakeBuffer();
 }
 
@@ -205,8 +213,7 @@ inline bool TryDecodeActionPrimaryResponse(
     return true;
 }
 
-inline wire::ByteBuffer EncodeCraftRecipeRequest(const CraftRecipeRequest& request) {
-    wire::ByteWriter writer;
+inline void EncodeCraftRecipeRequest(const CraftRecipeRequest& request, wire::ByteWriter& writer) {
     writer.WriteU8(kVersion);
     writer.WriteU8(static_cast<wire::Byte>(Command::GameplayCraftRecipe));
     writer.WriteVarUInt(request.player_id);
@@ -221,6 +228,11 @@ inline wire::ByteBuffer EncodeCraftRecipeRequest(const CraftRecipeRequest& reque
     writer.WriteVarUInt(request.torch_count);
     writer.WriteVarUInt(request.workbench_count);
     writer.WriteVarUInt(request.wood_sword_count);
+}
+
+inline wire::ByteBuffer EncodeCraftRecipeRequest(const CraftRecipeRequest& request) {
+    wire::ByteWriter writer;
+    EncodeCraftRecipeRequest(request, writer);
     return writer.TakeBuffer();
 }
 
@@ -344,29 +356,40 @@ inline bool TryDecodeCraftRecipeResponse(
     return true;
 }
 
-inline wire::ByteBuffer EncodeValidateResponse(bool ok) {
-    wire::ByteWriter writer;
+inline void EncodeValidateResponse(bool ok, wire::ByteWriter& writer) {
     writer.WriteU8(kVersion);
     writer.WriteU8(static_cast<wire::Byte>(Command::Validate));
     writer.WriteU8(ok ? 1 : 0);
+}
+
+inline wire::ByteBuffer EncodeValidateResponse(bool ok) {
+    wire::ByteWriter writer;
+    EncodeValidateResponse(ok, writer);
     return writer.TakeBuffer();
 }
 
-inline wire::ByteBuffer EncodeActionPrimaryResponse(
+inline void EncodeActionPrimaryResponse(
     ActionPrimaryResult result,
     PlaceKind place_kind,
-    std::uint32_t required_ticks) {
-    wire::ByteWriter writer;
+    std::uint32_t required_ticks,
+    wire::ByteWriter& writer) {
     writer.WriteU8(kVersion);
     writer.WriteU8(static_cast<wire::Byte>(Command::GameplayActionPrimary));
     writer.WriteU8(static_cast<wire::Byte>(result));
     writer.WriteU8(static_cast<wire::Byte>(place_kind));
     writer.WriteVarUInt(required_ticks);
-    return writer.TakeBuffer();
 }
 
-inline wire::ByteBuffer EncodeCraftRecipeResponse(const CraftRecipeResponse& response) {
+inline wire::ByteBuffer EncodeActionPrimaryResponse(
+    ActionPrimaryResult result,
+    PlaceKind place_kind,
+    std::uint32_t required_ticks) {
     wire::ByteWriter writer;
+    EncodeActionPrimaryResponse(result, place_kind, required_ticks, writer);
+    return writer.TakeBuffer();
+}
+
+inline void EncodeCraftRecipeResponse(const CraftRecipeResponse& response, wire::ByteWriter& writer) {
     writer.WriteU8(kVersion);
     writer.WriteU8(static_cast<wire::Byte>(Command::GameplayCraftRecipe));
     writer.WriteU8(static_cast<wire::Byte>(response.result));
@@ -386,6 +409,11 @@ inline wire::ByteBuffer EncodeCraftRecipeResponse(const CraftRecipeResponse& res
         milestone_flags |= 2;
     }
     writer.WriteU8(milestone_flags);
+}
+
+inline wire::ByteBuffer EncodeCraftRecipeResponse(const CraftRecipeResponse& response) {
+    wire::ByteWriter writer;
+    EncodeCraftRecipeResponse(response, writer);
     return writer.TakeBuffer();
 }
 
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "net/net_service.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace novaria::sim {
+
+enum class CommandRateClass : std::uint8_t {
+    Motion = 0,
+    Action = 1,
+    World = 2,
+    Control = 3,
+};
+
+inline constexpr std::size_t kCommandRateClassCount = 4;
+
+CommandRateClass CommandRateClassForId(std::uint32_t command_id);
+const char* CommandRateClassName(CommandRateClass command_class);
+
+struct CommandRateLimit final {
+    double commands_per_second = 0.0;
+    double burst = 0.0;
+};
+
+struct CommandRateLimiterSettings final {
+    bool enabled = true;
+    std::array<CommandRateLimit, kCommandRateClassCount> limits{{
+        {.commands_per_second = 240.0, .burst = 32.0},
+        {.commands_per_second = 120.0, .burst = 32.0},
+        {.commands_per_second = 240.0, .burst = 64.0},
+        {.commands_per_second = 240.0, .burst = 64.0},
+    }};
+};
+
+struct PlayerCommandRateDiagnostics final {
+    std::uint32_t player_id = 0;
+    std::uint64_t admitted_count = 0;
+    std::uint64_t rate_limited_count = 0;
+    std::array<std::uint64_t, kCommandRateClassCount> rate_limited_by_class{};
+};
+
+struct CommandRateLimiterDiagnostics final {
+    bool enabled = false;
+    std::size_t tracked_player_count = 0;
+    std::uint64_t admitted_count = 0;
+    std::uint64_t rate_limited_count = 0;
+    std::uint64_t untracked_player_dropped_count = 0;
+    std::uint64_t evicted_player_count = 0;
+    std::vector<PlayerCommandRateDiagnostics> players;
+};
+
+class CommandRateLimiter final {
+public:
+    static constexpr std::size_t kMaxPlayers = 64;
+    static constexpr std::size_t kMaxRetainedPlayerDiagnostics = 256;
+
+    void Reset();
+    void SetSettings(const CommandRateLimiterSettings& settings);
+    const CommandRateLimiterSettings& Settings() const;
+    bool Admit(const net::PlayerCommand& command, std::uint64_t tick_index, double fixed_delta_seconds);
+    CommandRateLimiterDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    struct PlayerBuckets final {
+        std::array<double, kCommandRateClassCount> tokens{};
+        std::uint64_t last_refill_tick = 0;
+        PlayerCommandRateDiagnostics diagnostics{};
+    };
+
+    bool EvictIdlePlayer(std::uint64_t tick_index, double fixed_delta_seconds);
+
+    CommandRateLimiterSettings settings_{};
+    std::map<std::uint32_t, PlayerBuckets> players_;
+    std::map<std::uint32_t, PlayerCommandRateDiagnostics> evicted_player_diagnostics_;
+    std::uint64_t admitted_count_ = 0;
+    std::uint64_t rate_limited_count_ = 0;
+    std::uint64_t untracked_player_dropped_count_ = 0;
+    std::uint64_t evicted_player_count_ = 0;
+};
+
+}  // namespace novaria::sim
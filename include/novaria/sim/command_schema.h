@@ -26,6 +26,8 @@ inline constexpr std::uint32_t kGameplayAttackBoss = 27;
 
 inline constexpr std::uint32_t kCombatFireProjectile = 30;
 
+inline constexpr std::uint32_t kReplicationEntityAck = 40;
+
 const char* CommandName(std::uint32_t command_id);
 
 inline constexpr std::uint16_t kResourceWood = 1;
@@ -101,34 +103,54 @@ struct FireProjectilePayload final {
     std::uint16_t faction = 0;
 };
 
+struct ReplicationEntityAckPayload final {
+    std::uint64_t acked_tick = 0;
+};
+
 wire::ByteBuffer EncodeWorldSetTilePayload(const WorldSetTilePayload& payload);
+void EncodeWorldSetTilePayload(const WorldSetTilePayload& payload, wire::ByteWriter& writer);
 bool TryDecodeWorldSetTilePayload(wire::ByteSpan payload, WorldSetTilePayload& out_payload);
 
 wire::ByteBuffer EncodeWorldChunkPayload(const WorldChunkPayload& payload);
+void EncodeWorldChunkPayload(const WorldChunkPayload& payload, wire::ByteWriter& writer);
 bool TryDecodeWorldChunkPayload(wire::ByteSpan payload, WorldChunkPayload& out_payload);
 
 wire::ByteBuffer EncodeCollectResourcePayload(const CollectResourcePayload& payload);
+void EncodeCollectResourcePayload(const CollectResourcePayload& payload, wire::ByteWriter& writer);
 bool TryDecodeCollectResourcePayload(wire::ByteSpan payload, CollectResourcePayload& out_payload);
 
 wire::ByteBuffer EncodeSpawnDropPayload(const SpawnDropPayload& payload);
+void EncodeSpawnDropPayload(const SpawnDropPayload& payload, wire::ByteWriter& writer);
 bool TryDecodeSpawnDropPayload(wire::ByteSpan payload, SpawnDropPayload& out_payload);
 
 wire::ByteBuffer EncodePickupProbePayload(const PickupProbePayload& payload);
+void EncodePickupProbePayload(const PickupProbePayload& payload, wire::ByteWriter& writer);
 bool TryDecodePickupProbePayload(wire::ByteSpan payload, PickupProbePayload& out_payload);
 
 wire::ByteBuffer EncodeInteractionPayload(const InteractionPayload& payload);
+void EncodeInteractionPayload(const InteractionPayload& payload, wire::ByteWriter& writer);
 bool TryDecodeInteractionPayload(wire::ByteSpan payload, InteractionPayload& out_payload);
 
 wire::ByteBuffer EncodePlayerMotionInputPayload(const PlayerMotionInputPayload& payload);
+void EncodePlayerMotionInputPayload(const PlayerMotionInputPayload& payload, wire::ByteWriter& writer);
 bool TryDecodePlayerMotionInputPayload(wire::ByteSpan payload, PlayerMotionInputPayload& out_payload);
 
 wire::ByteBuffer EncodeActionPrimaryPayload(const ActionPrimaryPayload& payload);
+void EncodeActionPrimaryPayload(const ActionPrimaryPayload& payload, wire::ByteWriter& writer);
 bool TryDecodeActionPrimaryPayload(wire::ByteSpan payload, ActionPrimaryPayload& out_payload);
 
 wire::ByteBuffer EncodeCraftRecipePayload(const CraftRecipePayload& payload);
+void EncodeCraftRecipePayload(const CraftRecipePayload& payload, wire::ByteWriter& writer);
 bool TryDecodeCraftRecipePayload(wire::ByteSpan payload, CraftRecipePayload& out_payload);
 
 wire::ByteBuffer EncodeFireProjectilePayload(const FireProjectilePayload& payload);
+void EncodeFireProjectilePayload(const FireProjectilePayload& payload, wire::ByteWriter& writer);
 bool TryDecodeFireProjectilePayload(wire::ByteSpan payload, FireProjectilePayload& out_payload);
 
+wire::ByteBuffer EncodeReplicationEntityAckPayload(const ReplicationEntityAckPayload& payload);
+void EncodeReplicationEntityAckPayload(const ReplicationEntityAckPayload& payload, wire::ByteWriter& writer);
+bool TryDecodeReplicationEntityAckPayload(
+    wire::ByteSpan payload,
+    ReplicationEntityAckPayload& out_payload);
+
 }  // namespace novaria::sim::command
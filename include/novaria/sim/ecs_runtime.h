@@ -3,7 +3,9 @@
 #include "sim/command_schema.h"
 #include "sim/gameplay_types.h"
 #include "sim/player_motion.h"
+#include "core/status.h"
 #include "core/tick_context.h"
+#include "wire/byte_io.h"
 
 #include <cstdint>
 #include <memory>
@@ -59,6 +61,27 @@ struct GameplayEvent final {
     std::uint32_t amount = 0;
 };
 
+enum class ReplicatedEntityKind : std::uint8_t {
+    Projectile = 1,
+    Hostile = 2,
+    Drop = 3,
+    // Players are not networked ECS entities; the simulation kernel appends them to the replicated set.
+    Player = 4,
+};
+
+struct ReplicatedEntitySnapshot final {
+    std::uint32_t network_id = 0;
+    ReplicatedEntityKind kind = ReplicatedEntityKind::Projectile;
+    float position_x = 0.0F;
+    float position_y = 0.0F;
+    float velocity_x = 0.0F;
+    float velocity_y = 0.0F;
+    std::int32_t health = 0;
+    std::uint16_t material_id = 0;
+    std::uint32_t amount = 0;
+    std::uint32_t owner_player_id = 0;
+};
+
 struct RuntimeDiagnostics final {
     std::size_t active_projectile_count = 0;
     std::size_t active_hostile_count = 0;
@@ -71,6 +94,10 @@ struct RuntimeDiagnostics final {
     std::uint64_t total_drop_picked_up = 0;
 };
 
+// Nesting depth of Runtime calls on the calling thread, so allocation tests can attribute heap use made
+// inside the EnTT-backed runtime separately from the code around it.
+std::uint32_t BackendCallDepth();
+
 class Runtime final {
 public:
     Runtime();
@@ -88,7 +115,11 @@ public:
     PlayerInventorySnapshot InventorySnapshot(std::uint32_t player_id) const;
     ActionPrimaryProgressSnapshot ActionPrimaryProgressSnapshot(std::uint32_t player_id) const;
     PlayerMotionSnapshot MotionSnapshot(std::uint32_t player_id) const;
+    PlayerMotionState MotionState(std::uint32_t player_id) const;
+    std::vector<std::uint32_t> PlayerIds() const;
+    void CollectPlayerIds(std::vector<std::uint32_t>& out_player_ids) const;
     void SetPlayerMotionInput(std::uint32_t player_id, const PlayerMotionInput& input);
+    void SetPlayerMotionState(std::uint32_t player_id, const PlayerMotionState& state);
     void AddResourceToInventory(
         std::uint32_t player_id,
         std::uint16_t resource_id,
@@ -111,8 +142,18 @@ public:
     void QueuePickupProbe(std::uint32_t player_id, const command::PickupProbePayload& payload);
     void Tick(const core::TickContext& tick_context, const world::IWorldService& world_service);
     std::vector<CombatEvent> ConsumeCombatEvents();
+    void ConsumeCombatEvents(std::vector<CombatEvent>& out_events);
     std::vector<GameplayEvent> ConsumeGameplayEvents();
+    void ConsumeGameplayEvents(std::vector<GameplayEvent>& out_events);
+    std::vector<ReplicatedEntitySnapshot> ReplicatedEntities() const;
+    void CollectReplicatedEntities(std::vector<ReplicatedEntitySnapshot>& out_entities) const;
     RuntimeDiagnostics DiagnosticsSnapshot() const;
+    void SaveState(wire::ByteWriter& writer) const;
+    core::Status LoadState(wire::ByteReader& reader);
+    // Two-phase load: StageState parses and validates into scratch owned by the runtime without touching
+    // live state; CommitStagedState then replaces the live state and cannot fail.
+    core::Status StageState(wire::ByteReader& reader);
+    void CommitStagedState();
 
 private:
     struct Impl;
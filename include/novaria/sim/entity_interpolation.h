@@ -0,0 +1,74 @@
+#pragma once
+
+#include "sim/player_motion.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace novaria::sim {
+
+struct EntityInterpolationSettings final {
+    double delay_seconds = 0.1;
+    double max_extrapolation_seconds = 0.1;
+};
+
+struct InterpolatedEntityState final {
+    std::uint32_t entity_id = 0;
+    float position_x = 0.0F;
+    float position_y = 0.0F;
+    float velocity_x = 0.0F;
+    float velocity_y = 0.0F;
+    bool extrapolated = false;
+};
+
+struct EntityInterpolationDiagnostics final {
+    std::size_t tracked_entity_count = 0;
+    std::uint64_t interpolated_sample_count = 0;
+    std::uint64_t extrapolated_sample_count = 0;
+    std::uint64_t extrapolation_clamped_count = 0;
+    std::uint64_t underflow_sample_count = 0;
+    std::uint64_t dropped_out_of_order_count = 0;
+    std::uint64_t dropped_entity_limit_count = 0;
+    std::uint64_t stale_entity_evicted_count = 0;
+    std::uint64_t clock_resync_count = 0;
+};
+
+class EntityInterpolationBuffer final {
+public:
+    static constexpr std::size_t kMaxSamplesPerEntity = 32;
+    static constexpr std::size_t kMaxEntities = 256;
+    static constexpr double kClockResyncTicks = 30.0;
+    static constexpr double kClockDecayTicksPerObservation = 0.01;
+    static constexpr std::uint64_t kStaleEntityTicks = 180;
+
+    void Reset();
+    void SetSettings(const EntityInterpolationSettings& settings);
+    const EntityInterpolationSettings& Settings() const;
+    void ObserveServerTick(std::uint64_t server_tick, std::uint64_t local_tick);
+    void PushSample(std::uint32_t entity_id, std::uint64_t server_tick, const PlayerMotionState& state);
+    std::vector<InterpolatedEntityState> Sample(
+        std::uint64_t local_tick,
+        float interpolation_alpha,
+        double fixed_delta_seconds);
+    EntityInterpolationDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    struct Snapshot final {
+        std::uint64_t server_tick = 0;
+        PlayerMotionState state{};
+    };
+
+    void EvictStaleEntities();
+
+    EntityInterpolationSettings settings_{};
+    std::unordered_map<std::uint32_t, std::deque<Snapshot>> entity_snapshots_;
+    bool clock_synced_ = false;
+    double server_tick_offset_ = 0.0;
+    std::uint64_t newest_server_tick_ = 0;
+    EntityInterpolationDiagnostics diagnostics_{};
+};
+
+}  // namespace novaria::sim
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "sim/ecs_runtime.h"
+#include "sim/entity_state_codec.h"
+#include "sim/player_motion.h"
+#include "wire/byte_io.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+namespace novaria::sim {
+
+inline constexpr float kReplicatedPositionUnitsPerTile = 64.0F;
+inline constexpr float kReplicatedVelocityUnitsPerTile = 64.0F;
+// Players ride the entity delta under their player id with this bit set, which keeps them clear of the ECS
+// network ids that count up from 1. Player ids that already carry the bit are not replicated.
+inline constexpr std::uint32_t kReplicatedPlayerNetworkIdFlag = 0x80000000U;
+
+struct EntityReplicationSettings final {
+    float interest_radius_tiles = 48.0F;
+    std::size_t max_entities_per_client = 64;
+};
+
+struct EntityReplicationSenderDiagnostics final {
+    std::size_t client_count = 0;
+    std::uint64_t full_snapshot_count = 0;
+    std::uint64_t delta_snapshot_count = 0;
+    std::uint64_t created_entity_count = 0;
+    std::uint64_t updated_entity_count = 0;
+    std::uint64_t removed_entity_count = 0;
+    std::uint64_t unchanged_entity_count = 0;
+    std::uint64_t interest_culled_count = 0;
+    std::uint64_t budget_culled_count = 0;
+    std::uint64_t ignored_ack_count = 0;
+    std::uint64_t dropped_client_limit_count = 0;
+    std::uint64_t expired_baseline_count = 0;
+    std::size_t last_encoded_bytes = 0;
+    std::uint64_t total_encoded_bytes = 0;
+};
+
+struct EntityReplicationReceiverDiagnostics final {
+    std::size_t replicated_entity_count = 0;
+    std::uint64_t applied_full_snapshot_count = 0;
+    std::uint64_t applied_delta_count = 0;
+    std::uint64_t missing_baseline_count = 0;
+    std::uint64_t rejected_delta_count = 0;
+    std::uint64_t last_applied_tick = 0;
+};
+
+QuantizedEntityState QuantizeReplicatedEntity(const ecs::ReplicatedEntitySnapshot& entity);
+ecs::ReplicatedEntitySnapshot DequantizeReplicatedEntity(const QuantizedEntityState& entity);
+ecs::ReplicatedEntitySnapshot ReplicatedPlayerEntity(std::uint32_t player_id, const PlayerMotionState& motion);
+
+class EntityReplicationSender final {
+public:
+    static constexpr std::size_t kMaxClients = 64;
+    static constexpr std::size_t kMaxBaselineHistory = 64;
+
+    void Reset();
+    void SetSettings(const EntityReplicationSettings& settings);
+    const EntityReplicationSettings& Settings() const;
+    void Acknowledge(std::uint32_t client_player_id, std::uint64_t acked_tick);
+    bool BuildClientDelta(
+        std::uint32_t client_player_id,
+        std::uint64_t tick_index,
+        float interest_center_x,
+        float interest_center_y,
+        const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+        wire::ByteBuffer& out_encoded_delta);
+    bool BuildClientDelta(
+        std::uint32_t client_player_id,
+        std::uint64_t tick_index,
+        float interest_center_x,
+        float interest_center_y,
+        const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+        wire::ByteWriter& writer);
+    EntityReplicationSenderDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    struct SentSnapshot final {
+        std::uint64_t tick_index = 0;
+        std::vector<QuantizedEntityState> entities;
+    };
+
+    struct ClientState final {
+        bool has_acked_tick = false;
+        std::uint64_t acked_tick = 0;
+        std::vector<SentSnapshot> sent_snapshots;
+    };
+
+    struct InterestCandidate final {
+        float distance_sq = 0.0F;
+        std::size_t index = 0;
+    };
+
+    void SelectInterestSet(
+        std::uint32_t client_player_id,
+        float interest_center_x,
+        float interest_center_y,
+        const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+        std::vector<QuantizedEntityState>& out_selected);
+    std::vector<QuantizedEntityState> AcquireEntitySet();
+    void DropOldestSentSnapshots(ClientState& client, std::size_t count);
+
+    EntityReplicationSettings settings_{};
+    std::unordered_map<std::uint32_t, ClientState> clients_;
+    std::vector<InterestCandidate> interest_candidates_;
+    std::vector<std::vector<QuantizedEntityState>> spare_entity_sets_;
+    EntityDelta delta_scratch_{};
+    EntityReplicationSenderDiagnostics diagnostics_{};
+};
+
+class EntityReplicationReceiver final {
+public:
+    static constexpr std::size_t kMaxSnapshotHistory = 64;
+
+    void Reset();
+    bool ApplyDelta(std::uint64_t tick_index, const EntityDelta& delta);
+    bool HasAppliedTick() const;
+    std::uint64_t LastAppliedTick() const;
+    std::vector<ecs::ReplicatedEntitySnapshot> Entities() const;
+    void CollectEntities(std::vector<ecs::ReplicatedEntitySnapshot>& out_entities) const;
+    EntityReplicationReceiverDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    struct ReceivedSnapshot final {
+        std::uint64_t tick_index = 0;
+        std::vector<QuantizedEntityState> entities;
+    };
+
+    std::deque<ReceivedSnapshot> snapshots_;
+    EntityReplicationReceiverDiagnostics diagnostics_{};
+};
+
+}  // namespace novaria::sim
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "sim/ecs_runtime.h"
+#include "sim/player_motion.h"
+#include "wire/byte_io.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace novaria::sim {
+
+enum class EntityStateType : std::uint8_t {
+    PlayerState = 1,
+    EntityDelta = 2,
+};
+
+inline constexpr std::uint8_t kEntityDeltaFieldCreated = 1U << 0;
+inline constexpr std::uint8_t kEntityDeltaFieldPosition = 1U << 1;
+inline constexpr std::uint8_t kEntityDeltaFieldVelocity = 1U << 2;
+inline constexpr std::uint8_t kEntityDeltaFieldHealth = 1U << 3;
+inline constexpr std::uint8_t kEntityDeltaFieldAttributes = 1U << 4;
+inline constexpr std::uint8_t kEntityDeltaFieldAll =
+    kEntityDeltaFieldCreated | kEntityDeltaFieldPosition | kEntityDeltaFieldVelocity |
+    kEntityDeltaFieldHealth | kEntityDeltaFieldAttributes;
+inline constexpr std::size_t kMaxEntityDeltaEntries = 1024;
+
+struct PlayerEntityState final {
+    std::uint32_t player_id = 0;
+    std::uint32_t acked_command_sequence = 0;
+    PlayerMotionState motion{};
+};
+
+struct QuantizedEntityState final {
+    std::uint32_t network_id = 0;
+    ecs::ReplicatedEntityKind kind = ecs::ReplicatedEntityKind::Projectile;
+    std::int32_t position_x = 0;
+    std::int32_t position_y = 0;
+    std::int32_t velocity_x = 0;
+    std::int32_t velocity_y = 0;
+    std::int32_t health = 0;
+    std::uint16_t material_id = 0;
+    std::uint32_t amount = 0;
+    std::uint32_t owner_player_id = 0;
+};
+
+struct EntityDeltaUpdate final {
+    std::uint8_t field_mask = 0;
+    QuantizedEntityState values{};
+};
+
+struct EntityDelta final {
+    std::uint32_t recipient_player_id = 0;
+    bool has_baseline = false;
+    std::uint64_t baseline_tick = 0;
+    std::vector<std::uint32_t> removed_network_ids;
+    std::vector<EntityDeltaUpdate> updates;
+};
+
+bool TryPeekEntityStateType(wire::ByteSpan payload, EntityStateType& out_type);
+
+wire::ByteBuffer EncodePlayerEntityState(const PlayerEntityState& state);
+void EncodePlayerEntityState(const PlayerEntityState& state, wire::ByteWriter& writer);
+bool TryDecodePlayerEntityState(wire::ByteSpan payload, PlayerEntityState& out_state);
+
+wire::ByteBuffer EncodeEntityDelta(const EntityDelta& delta);
+void EncodeEntityDelta(const EntityDelta& delta, wire::ByteWriter& writer);
+bool TryDecodeEntityDelta(wire::ByteSpan payload, EntityDelta& out_delta);
+
+}  // namespace novaria::sim
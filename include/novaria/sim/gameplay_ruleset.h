@@ -6,7 +6,6 @@
 #include "sim/command_schema.h"
 
 #include <cstdint>
-#include <string_view>
 #include <vector>
 
 namespace novaria::sim {
@@ -49,7 +48,7 @@ public:
 private:
     void DispatchGameplayProgressEvent(
         script::IScriptHost& script_host,
-        std::string_view milestone,
+        const char* milestone,
         std::uint64_t tick_index) const;
     void UpdatePlayableLoopCompletion(
         script::IScriptHost& script_host,
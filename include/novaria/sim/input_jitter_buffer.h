@@ -0,0 +1,93 @@
+#pragma once
+
+#include "net/net_service.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace novaria::sim {
+
+struct InputJitterBufferSettings final {
+    std::uint32_t min_delay_ticks = 0;
+    std::uint32_t initial_delay_ticks = 1;
+    std::uint32_t max_delay_ticks = 8;
+    std::uint64_t decay_interval_ticks = 120;
+    std::uint64_t idle_eviction_ticks = 600;
+    std::size_t max_buffered_commands_per_player = 64;
+    std::size_t max_released_commands_per_player_per_tick = 32;
+};
+
+struct InputJitterPlayerDiagnostics final {
+    std::uint32_t player_id = 0;
+    std::uint32_t delay_ticks = 0;
+    std::size_t buffered_command_count = 0;
+    std::uint64_t released_command_count = 0;
+    std::uint64_t deferred_command_count = 0;
+    std::uint64_t dropped_overflow_count = 0;
+};
+
+struct InputJitterBufferDiagnostics final {
+    std::size_t tracked_player_count = 0;
+    std::size_t buffered_command_count = 0;
+    std::uint32_t max_player_delay_ticks = 0;
+    std::uint64_t released_command_count = 0;
+    std::uint64_t unstamped_command_count = 0;
+    std::uint64_t on_time_command_count = 0;
+    std::uint64_t late_command_count = 0;
+    std::uint64_t early_clamped_command_count = 0;
+    std::uint64_t dropped_overflow_count = 0;
+    std::uint64_t deferred_command_count = 0;
+    std::uint64_t evicted_player_count = 0;
+    std::uint64_t delay_increase_count = 0;
+    std::uint64_t delay_decrease_count = 0;
+    std::vector<InputJitterPlayerDiagnostics> players;
+};
+
+class InputJitterBuffer final {
+public:
+    static constexpr std::size_t kMaxPlayers = 64;
+    static constexpr std::size_t kMaxRetainedPlayerDiagnostics = 256;
+
+    void Reset();
+    void SetSettings(const InputJitterBufferSettings& settings);
+    const InputJitterBufferSettings& Settings() const;
+    void Push(net::PlayerCommand command, std::uint64_t arrival_tick);
+    void Release(std::uint64_t tick_index, std::vector<net::PlayerCommand>& out_commands);
+    std::uint32_t PlayerDelayTicks(std::uint32_t player_id) const;
+    InputJitterBufferDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    static constexpr std::uint64_t kNoSlack = std::numeric_limits<std::uint64_t>::max();
+
+    struct BufferedCommand final {
+        net::PlayerCommand command;
+        std::uint64_t release_tick = 0;
+    };
+
+    struct PlayerQueue final {
+        std::vector<BufferedCommand> commands;
+        std::size_t head = 0;
+        std::uint32_t delay_ticks = 0;
+        std::uint64_t last_release_tick = 0;
+        std::uint64_t last_arrival_tick = 0;
+        std::uint64_t window_start_tick = 0;
+        std::uint64_t min_slack_ticks = kNoSlack;
+        std::size_t released_this_tick = 0;
+        std::uint64_t released_command_count = 0;
+        std::uint64_t deferred_command_count = 0;
+        std::uint64_t dropped_overflow_count = 0;
+    };
+
+    bool EvictIdlePlayer(std::uint64_t arrival_tick);
+
+    InputJitterBufferSettings settings_{};
+    std::map<std::uint32_t, PlayerQueue> players_;
+    std::map<std::uint32_t, InputJitterPlayerDiagnostics> evicted_player_diagnostics_;
+    InputJitterBufferDiagnostics diagnostics_{};
+    std::size_t release_rotation_ = 0;
+};
+
+}  // namespace novaria::sim
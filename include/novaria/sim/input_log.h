@@ -0,0 +1,90 @@
+#pragma once
+
+#include "net/net_service.h"
+#include "wire/byte_io.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace novaria::sim {
+
+inline constexpr std::uint32_t kInputLogFormatVersion = 1;
+
+enum class InputLogRecordType : std::uint8_t {
+    FixedDelta = 1,
+    SessionState = 2,
+    LocalCommand = 3,
+    RemoteCommand = 4,
+    Checkpoint = 5,
+    End = 6,
+};
+
+struct InputLogHeader final {
+    std::uint32_t format_version = kInputLogFormatVersion;
+    std::uint64_t start_tick = 0;
+    std::uint32_t local_player_id = 1;
+    bool authority = true;
+};
+
+struct InputLogFixedDelta final {
+    std::uint64_t tick_index = 0;
+    double fixed_delta_seconds = 0.0;
+};
+
+struct InputLogSessionChange final {
+    std::uint64_t tick_index = 0;
+    net::NetSessionState session_state = net::NetSessionState::Disconnected;
+    std::string transition_reason;
+};
+
+struct InputLogCommand final {
+    std::uint64_t tick_index = 0;
+    bool local = false;
+    net::PlayerCommand command;
+};
+
+struct InputLogCheckpoint final {
+    std::uint64_t tick_index = 0;
+    std::uint64_t state_hash = 0;
+};
+
+struct InputLog final {
+    InputLogHeader header{};
+    std::vector<InputLogFixedDelta> fixed_deltas;
+    std::vector<InputLogSessionChange> session_changes;
+    std::vector<InputLogCommand> commands;
+    std::vector<InputLogCheckpoint> checkpoints;
+    bool has_end = false;
+    std::uint64_t end_tick = 0;
+    std::uint64_t end_state_hash = 0;
+};
+
+class InputRecorder final {
+public:
+    void Begin(const InputLogHeader& header);
+    void Reset();
+    bool Active() const;
+    std::uint64_t RecordedCommandCount() const;
+    void RecordFixedDelta(std::uint64_t tick_index, double fixed_delta_seconds);
+    void RecordSessionState(
+        std::uint64_t tick_index,
+        net::NetSessionState session_state,
+        const std::string& transition_reason);
+    void RecordCommand(std::uint64_t tick_index, const net::PlayerCommand& command, bool local);
+    void RecordCheckpoint(std::uint64_t tick_index, std::uint64_t state_hash);
+    void End(std::uint64_t tick_index, std::uint64_t state_hash);
+    void ConsumeBytes(wire::ByteBuffer& out_bytes);
+
+private:
+    void BeginRecord(InputLogRecordType type, std::uint64_t tick_index);
+
+    wire::ByteWriter writer_;
+    bool active_ = false;
+    std::uint64_t last_tick_index_ = 0;
+    std::uint64_t recorded_command_count_ = 0;
+};
+
+bool TryDecodeInputLog(wire::ByteSpan bytes, InputLog& out_log, std::string& out_error);
+
+}  // namespace novaria::sim
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "net/net_service.h"
+#include "sim/input_log.h"
+#include "sim/simulation_kernel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace novaria::sim {
+
+class InputReplayNetService final : public net::INetService {
+public:
+    explicit InputReplayNetService(const InputLog& log);
+
+    bool Initialize(std::string& out_error) override;
+    void Shutdown() override;
+    void RequestConnect() override;
+    void RequestDisconnect() override;
+    void NotifyHeartbeatReceived(std::uint64_t tick_index) override;
+    net::NetSessionState SessionState() const override;
+    net::NetDiagnosticsSnapshot DiagnosticsSnapshot() const override;
+    void Tick(const core::TickContext& tick_context) override;
+    std::uint32_t SubmitLocalCommand(net::PlayerCommand command) override;
+    void ConsumeRemoteCommands(std::vector<net::PlayerCommand>& out_commands) override;
+    void ConsumeRemoteChunkPayloads(std::vector<wire::ByteBuffer>& out_payloads) override;
+    void ConsumeRemoteEntityStates(std::vector<net::EntityStateBatch>& out_batches) override;
+    void PublishWorldSnapshot(
+        std::uint64_t tick_index,
+        const std::vector<wire::ByteBuffer>& encoded_dirty_chunks) override;
+    void PublishEntityStates(
+        std::uint64_t tick_index,
+        const std::vector<wire::ByteBuffer>& encoded_entity_states,
+        const std::vector<std::uint32_t>& recipient_player_ids) override;
+
+    std::uint64_t ReplayedCommandCount() const;
+
+private:
+    const InputLog& log_;
+    std::size_t command_cursor_ = 0;
+    std::size_t session_cursor_ = 0;
+    net::NetSessionState session_state_ = net::NetSessionState::Disconnected;
+    std::string last_session_transition_reason_;
+    std::vector<net::PlayerCommand> pending_remote_commands_;
+    std::uint64_t replayed_command_count_ = 0;
+};
+
+struct InputReplayResult final {
+    std::uint64_t start_tick = 0;
+    std::uint64_t end_tick = 0;
+    std::uint64_t replayed_tick_count = 0;
+    std::uint64_t replayed_command_count = 0;
+    std::size_t verified_checkpoint_count = 0;
+    bool verified_end_state = false;
+    bool diverged = false;
+    std::uint64_t divergent_tick = 0;
+    std::uint64_t expected_state_hash = 0;
+    std::uint64_t actual_state_hash = 0;
+    double elapsed_seconds = 0.0;
+};
+
+bool ValidateInputLogForReplay(const InputLog& log, std::string& out_error);
+
+bool RunInputReplay(
+    const InputLog& log,
+    SimulationKernel& kernel,
+    const InputReplayNetService& net_service,
+    InputReplayResult& out_result,
+    std::string& out_error);
+
+}  // namespace novaria::sim
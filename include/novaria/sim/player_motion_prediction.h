@@ -0,0 +1,63 @@
+#pragma once
+
+#include "sim/player_motion.h"
+#include "world/world_service.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace novaria::sim {
+
+struct PlayerMotionPredictionDiagnostics final {
+    std::uint64_t recorded_input_count = 0;
+    std::uint64_t reconcile_count = 0;
+    std::uint64_t correction_count = 0;
+    std::uint64_t replayed_input_count = 0;
+    std::uint64_t dropped_history_count = 0;
+    std::size_t pending_input_count = 0;
+    std::uint32_t last_acked_sequence = 0;
+    float last_position_error = 0.0F;
+    float max_position_error = 0.0F;
+    double total_position_error = 0.0;
+};
+
+class PlayerMotionPredictor final {
+public:
+    static constexpr std::size_t kHistoryCapacity = 128;
+    static constexpr float kCorrectionEpsilon = 0.001F;
+
+    void Reset();
+    void RecordInput(
+        std::uint32_t sequence,
+        const PlayerMotionInput& input,
+        const PlayerMotionState& predicted_state);
+    bool Reconcile(
+        std::uint32_t acked_sequence,
+        const PlayerMotionState& authoritative_state,
+        const PlayerMotionSettings& settings,
+        const world::IWorldService& world_service,
+        double fixed_delta_seconds,
+        PlayerMotionState& out_state);
+    std::size_t PendingInputCount() const;
+    PlayerMotionPredictionDiagnostics DiagnosticsSnapshot() const;
+
+private:
+    struct HistoryEntry final {
+        std::uint32_t sequence = 0;
+        PlayerMotionInput input{};
+        PlayerMotionState predicted_state{};
+    };
+
+    void RecordPositionError(float position_error);
+    HistoryEntry& EntryAt(std::size_t offset);
+
+    std::array<HistoryEntry, kHistoryCapacity> history_{};
+    std::size_t history_begin_ = 0;
+    std::size_t history_count_ = 0;
+    PlayerMotionState last_authoritative_state_{};
+    bool has_authoritative_state_ = false;
+    PlayerMotionPredictionDiagnostics diagnostics_{};
+};
+
+}  // namespace novaria::sim
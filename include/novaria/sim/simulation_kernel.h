@@ -1,19 +1,31 @@
 #pragma once
 
+#include "core/status.h"
+#include "core/worker_pool.h"
 #include "net/net_service.h"
 #include "script/script_host.h"
+#include "sim/command_rate_limiter.h"
 #include "sim/gameplay_ruleset.h"
 #include "sim/gameplay_types.h"
+#include "sim/input_jitter_buffer.h"
+#include "sim/input_log.h"
 #include "sim/ecs_runtime.h"
+#include "sim/entity_interpolation.h"
+#include "sim/entity_replication.h"
 #include "sim/player_motion.h"
+#include "sim/player_motion_prediction.h"
+#include "sim/tick_profiler.h"
 #include "sim/typed_command.h"
 #include "world/world_service.h"
+#include "wire/byte_buffer_pool.h"
 #include "wire/byte_io.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace novaria::sim {
@@ -23,6 +35,15 @@ enum class SimulationAuthorityMode : std::uint8_t {
     Replica = 1,
 };
 
+struct SimulationStateSnapshot final {
+    std::uint64_t tick_index = 0;
+    GameplayProgressSnapshot gameplay_progress{};
+    world::WorldState world{};
+    wire::ByteWriter arena;
+};
+
+void ReserveSimulationState(SimulationStateSnapshot& state, std::size_t arena_bytes, std::size_t chunk_count);
+
 class SimulationKernel final {
 public:
     static constexpr std::size_t kMaxPendingLocalCommands = 1024;
@@ -40,8 +61,8 @@ public:
     std::uint32_t LocalPlayerId() const;
     void SetAuthorityMode(SimulationAuthorityMode authority_mode);
     SimulationAuthorityMode AuthorityMode() const;
-    void SubmitLocalCommand(const net::PlayerCommand& command);
-    bool ApplyRemoteChunkPayload(wire::ByteSpan encoded_payload, std::string& out_error);
+    void SubmitLocalCommand(net::PlayerCommand command);
+    core::Status ApplyRemoteChunkPayload(wire::ByteSpan encoded_payload);
     std::uint64_t CurrentTick() const;
     std::size_t PendingLocalCommandCount() const;
     std::size_t DroppedLocalCommandCount() const;
@@ -49,7 +70,34 @@ public:
     PlayerInventorySnapshot InventorySnapshot(std::uint32_t player_id) const;
     ActionPrimaryProgressSnapshot ActionPrimaryProgressSnapshot(std::uint32_t player_id) const;
     PlayerMotionSnapshot LocalPlayerMotion() const;
+    PlayerMotionPredictionDiagnostics LocalMotionPredictionDiagnostics() const;
+    void SetRemoteInterpolationSettings(const EntityInterpolationSettings& settings);
+    std::vector<InterpolatedEntityState> SampleRemotePlayers(float interpolation_alpha);
+    EntityInterpolationDiagnostics RemoteInterpolationDiagnostics() const;
+    void SetEntityReplicationSettings(const EntityReplicationSettings& settings);
+    std::vector<ecs::ReplicatedEntitySnapshot> ReplicatedEntities() const;
+    std::vector<ecs::ReplicatedEntitySnapshot> SampleReplicatedEntities(float interpolation_alpha);
+    EntityReplicationSenderDiagnostics EntityReplicationSenderDiagnosticsSnapshot() const;
+    EntityReplicationReceiverDiagnostics EntityReplicationReceiverDiagnosticsSnapshot() const;
+    void SetInputJitterBufferSettings(const InputJitterBufferSettings& settings);
+    InputJitterBufferDiagnostics InputJitterBufferDiagnosticsSnapshot() const;
+    void SetCommandRateLimiterSettings(const CommandRateLimiterSettings& settings);
+    CommandRateLimiterDiagnostics CommandRateLimiterDiagnosticsSnapshot() const;
+    void SetTickProfilerSettings(const TickProfilerSettings& settings);
+    TickProfilerDiagnostics TickProfilerDiagnosticsSnapshot() const;
+    bool SetSnapshotEncodeWorkerCount(std::size_t worker_count, std::string& out_error);
+    std::size_t SnapshotEncodeWorkerCount() const;
+    void StartInputRecording(std::uint64_t checkpoint_interval_ticks);
+    void StopInputRecording();
+    bool InputRecordingActive() const;
+    void ConsumeInputRecording(wire::ByteBuffer& out_bytes);
+    std::uint64_t ComputeStateHash() const;
+    void SaveState(SimulationStateSnapshot& out_state) const;
+    core::Status LoadState(const SimulationStateSnapshot& state);
     std::vector<GameplayPickupEvent> ConsumePickupEventsForPlayer(std::uint32_t player_id);
+    void ConsumePickupEventsForPlayer(
+        std::uint32_t player_id,
+        std::vector<GameplayPickupEvent>& out_events);
     void RestoreGameplayProgress(const GameplayProgressSnapshot& snapshot);
     void Update(double fixed_delta_seconds);
 
@@ -61,16 +109,25 @@ private:
         std::string transition_reason;
     };
 
-    void ExecuteWorldCommandIfMatched(const TypedPlayerCommand& command);
-    void ExecuteControlCommandIfMatched(
-        const TypedPlayerCommand& command,
-        std::uint32_t player_id);
-    void ExecuteGameplayCommandIfMatched(
-        const TypedPlayerCommand& command,
-        std::uint32_t player_id);
-    void ExecuteCombatCommandIfMatched(
-        const TypedPlayerCommand& command,
-        std::uint32_t player_id);
+    using CommandHandlerTable = TypedPlayerCommandHandlerTable<SimulationKernel>;
+
+    static constexpr CommandHandlerTable BuildCommandHandlers();
+    static const CommandHandlerTable kCommandHandlers;
+
+    void ExecutePlayerMotionInput(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteWorldSetTile(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteWorldLoadChunk(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteWorldUnloadChunk(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteCollectResource(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteSpawnDrop(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecutePickupProbe(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteInteraction(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteActionPrimary(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteCraftRecipe(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteAttackEnemy(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteAttackBoss(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteFireProjectile(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
+    void ExecuteReplicationEntityAck(const TypedPlayerCommand& typed_command, std::uint32_t player_id);
     void QueueNetSessionChangedEvent(
         net::NetSessionState session_state,
         std::string_view transition_reason);
@@ -78,6 +135,13 @@ private:
     void QueueChunkForInitialSync(const world::ChunkCoord& chunk_coord);
     void RemoveChunkFromInitialSync(const world::ChunkCoord& chunk_coord);
     void QueueLoadedChunksForInitialSync();
+    void ApplyRemoteEntityStates(double fixed_delta_seconds);
+    bool ApplyRemoteEntityDelta(std::uint64_t tick_index, wire::ByteSpan encoded_delta);
+    void PushReceivedEntitySamples(std::uint64_t server_tick);
+    void PublishEntityStates();
+    void DispatchChunkSnapshotEncode(const std::vector<world::ChunkCoord>& chunk_coords);
+    void CompleteChunkSnapshotEncode(bool publish);
+    void ResetReplicationState();
 
     bool initialized_ = false;
     std::uint64_t tick_index_ = 0;
@@ -94,6 +158,48 @@ private:
     std::uint64_t next_net_session_event_dispatch_tick_ = 0;
     PendingNetSessionEvent pending_net_session_event_{};
     std::vector<world::ChunkCoord> pending_initial_sync_chunks_;
+    PlayerMotionPredictor local_motion_predictor_;
+    EntityInterpolationBuffer remote_entity_interpolation_;
+    EntityInterpolationBuffer replicated_entity_interpolation_;
+    EntityReplicationSender entity_replication_sender_;
+    EntityReplicationReceiver entity_replication_receiver_;
+    CommandRateLimiter command_rate_limiter_;
+    InputJitterBuffer remote_input_jitter_buffer_;
+    TickProfiler tick_profiler_;
+    InputRecorder input_recorder_;
+    std::uint64_t input_checkpoint_interval_ticks_ = 0;
+    double input_recorded_fixed_delta_seconds_ = 0.0;
+    double last_fixed_delta_seconds_ = 0.0;
+    wire::ByteBufferPool chunk_snapshot_buffer_pool_;
+    wire::ByteBufferPool entity_state_buffer_pool_;
+    std::vector<std::uint32_t> entity_state_recipient_ids_;
+    world::ChunkSnapshot chunk_snapshot_scratch_{};
+    std::vector<std::uint32_t> player_id_scratch_;
+    std::vector<ecs::ReplicatedEntitySnapshot> replicated_entity_scratch_;
+    std::vector<ecs::ReplicatedEntitySnapshot> received_entities_;
+    wire::ByteWriter script_request_writer_;
+    wire::ByteBuffer script_response_buffer_;
+    wire::ByteWriter command_payload_writer_;
+    std::vector<net::PlayerCommand> remote_command_scratch_;
+    std::vector<net::PlayerCommand> released_command_scratch_;
+    TypedPlayerCommand typed_command_scratch_{};
+    std::vector<wire::ByteBuffer> remote_chunk_payload_scratch_;
+    std::vector<net::EntityStateBatch> remote_entity_state_scratch_;
+    std::vector<ecs::CombatEvent> combat_event_scratch_;
+    std::vector<ecs::GameplayEvent> gameplay_event_scratch_;
+    std::vector<world::ChunkCoord> chunk_coord_scratch_;
+    std::vector<world::ChunkSnapshot> snapshot_encode_inputs_;
+    std::vector<wire::ByteWriter> snapshot_encode_writers_;
+    std::vector<std::uint8_t> snapshot_encode_results_;
+    std::size_t snapshot_encode_count_ = 0;
+    std::uint64_t snapshot_encode_tick_ = 0;
+    bool snapshot_encode_pending_ = false;
+    core::WorkerPool snapshot_encode_workers_;
+    // Ordered so SaveState writes it canonically.
+    std::map<std::uint32_t, std::uint32_t> last_applied_command_sequences_;
+    std::vector<net::PlayerCommand> staged_local_commands_;
+    std::vector<GameplayPickupEvent> staged_pickup_events_;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> staged_command_sequences_;
     GameplayRuleset gameplay_ruleset_{};
     SimulationAuthorityMode authority_mode_ = SimulationAuthorityMode::Authority;
 };
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace novaria::sim {
+
+enum class TickPhase : std::uint8_t {
+    LocalCommandSubmit = 0,
+    NetTick = 1,
+    CommandDispatch = 2,
+    ReplicaApply = 3,
+    WorldTick = 4,
+    EcsTick = 5,
+    RulesetEvents = 6,
+    ScriptTick = 7,
+    SnapshotPublish = 8,
+};
+
+inline constexpr std::size_t kTickPhaseCount = 9;
+
+const char* TickPhaseName(TickPhase phase);
+
+struct TickProfilerSettings final {
+    bool enabled = false;
+    double tick_budget_ms = 1000.0 / 60.0;
+};
+
+struct TickPhaseTiming final {
+    double last_ms = 0.0;
+    double p50_ms = 0.0;
+    double p99_ms = 0.0;
+    double max_ms = 0.0;
+    std::uint64_t dominant_overrun_count = 0;
+};
+
+struct TickProfilerDiagnostics final {
+    bool enabled = false;
+    double tick_budget_ms = 0.0;
+    std::uint64_t profiled_tick_count = 0;
+    std::uint64_t overrun_count = 0;
+    std::size_t window_sample_count = 0;
+    TickPhaseTiming total{};
+    std::array<TickPhaseTiming, kTickPhaseCount> phases{};
+};
+
+class TickProfiler final {
+public:
+    static constexpr std::size_t kWindowSize = 256;
+
+    void SetSettings(const TickProfilerSettings& settings);
+    const TickProfilerSettings& Settings() const;
+    void Reset();
+    TickProfilerDiagnostics DiagnosticsSnapshot() const;
+
+    bool Enabled() const {
+        return settings_.enabled;
+    }
+    void BeginTick() {
+        if (settings_.enabled) {
+            phase_start_ = tick_start_ = Clock::now();
+        }
+    }
+    void EndPhase(TickPhase phase) {
+        if (settings_.enabled) {
+            RecordPhase(phase);
+        }
+    }
+    void EndTick() {
+        if (settings_.enabled) {
+            RecordTick();
+        }
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+    using SampleWindow = std::array<std::uint32_t, kWindowSize>;
+
+    void RecordPhase(TickPhase phase);
+    void RecordTick();
+
+    TickProfilerSettings settings_{};
+    Clock::time_point tick_start_{};
+    Clock::time_point phase_start_{};
+    std::array<std::uint32_t, kTickPhaseCount> current_phase_us_{};
+    std::array<SampleWindow, kTickPhaseCount> phase_windows_{};
+    std::array<std::uint64_t, kTickPhaseCount> dominant_overrun_counts_{};
+    SampleWindow total_window_{};
+    std::size_t window_cursor_ = 0;
+    std::size_t window_sample_count_ = 0;
+    std::uint64_t profiled_tick_count_ = 0;
+    std::uint64_t overrun_count_ = 0;
+};
+
+}  // namespace novaria::sim
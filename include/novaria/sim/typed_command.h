@@ -3,7 +3,10 @@
 #include "net/net_service.h"
 #include "sim/command_schema.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <variant>
 
 namespace novaria::sim {
 
@@ -24,24 +27,64 @@ enum class TypedPlayerCommandType : std::uint8_t {
     GameplayAttackEnemy,
     GameplayAttackBoss,
     CombatFireProjectile,
+    ReplicationEntityAck,
 };
 
+inline constexpr std::size_t kTypedPlayerCommandTypeCount = 17;
+
+using TypedPlayerCommandPayload = std::variant<
+    std::monostate,
+    command::PlayerMotionInputPayload,
+    command::WorldSetTilePayload,
+    command::WorldChunkPayload,
+    command::CollectResourcePayload,
+    command::SpawnDropPayload,
+    command::PickupProbePayload,
+    command::InteractionPayload,
+    command::ActionPrimaryPayload,
+    command::CraftRecipePayload,
+    command::FireProjectilePayload,
+    command::ReplicationEntityAckPayload>;
+
 struct TypedPlayerCommand final {
     TypedPlayerCommandType type = TypedPlayerCommandType::Unknown;
-    command::PlayerMotionInputPayload player_motion_input{};
-    command::WorldSetTilePayload world_set_tile{};
-    command::WorldChunkPayload world_chunk{};
-    command::CollectResourcePayload collect_resource{};
-    command::SpawnDropPayload spawn_drop{};
-    command::PickupProbePayload pickup_probe{};
-    command::InteractionPayload interaction{};
-    command::ActionPrimaryPayload action_primary{};
-    command::CraftRecipePayload craft_recipe{};
-    command::FireProjectilePayload fire_projectile{};
+    TypedPlayerCommandPayload payload{};
+
+    template <typename Payload>
+    const Payload& As() const {
+        return *std::get_if<Payload>(&payload);
+    }
 };
 
+TypedPlayerCommandType TypedPlayerCommandTypeForId(std::uint32_t command_id);
+
 bool TryDecodePlayerCommand(
     const net::PlayerCommand& source_command,
     TypedPlayerCommand& out_typed_command);
 
+template <typename Context>
+using TypedPlayerCommandHandler = void (Context::*)(const TypedPlayerCommand& command, std::uint32_t player_id);
+
+template <typename Context>
+using TypedPlayerCommandHandlerTable = std::array<TypedPlayerCommandHandler<Context>, kTypedPlayerCommandTypeCount>;
+
+template <typename Context>
+bool DispatchPlayerCommand(
+    const net::PlayerCommand& source_command,
+    const TypedPlayerCommandHandlerTable<Context>& handlers,
+    Context& context,
+    TypedPlayerCommand& scratch_command) {
+    if (!TryDecodePlayerCommand(source_command, scratch_command)) {
+        return false;
+    }
+
+    const TypedPlayerCommandHandler<Context> handler = handlers[static_cast<std::size_t>(scratch_command.type)];
+    if (handler == nullptr) {
+        return false;
+    }
+
+    (context.*handler)(scratch_command, source_command.player_id);
+    return true;
+}
+
 }  // namespace novaria::sim
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "wire/byte_io.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace novaria::wire {
+
+class ByteBufferPool final {
+public:
+    void Recycle();
+    ByteWriter AcquireWriter();
+    void Commit(ByteWriter& writer);
+    void Release(ByteWriter& writer);
+    const std::vector<ByteBuffer>& Buffers() const;
+    std::size_t FreeBufferCount() const;
+
+private:
+    std::vector<ByteBuffer> buffers_;
+    std::vector<ByteBuffer> free_buffers_;
+};
+
+}  // namespace novaria::wire
@@ -15,6 +15,9 @@ using ByteSpan = std::span<const Byte>;
 
 class ByteWriter final {
 public:
+    ByteWriter() = default;
+    explicit ByteWriter(ByteBuffer&& storage);
+
     void Clear();
     const ByteBuffer& Buffer() const;
     ByteBuffer&& TakeBuffer();
@@ -22,6 +25,9 @@ public:
     void WriteU8(Byte value);
     void WriteVarUInt(std::uint64_t value);
     void WriteVarInt(std::int64_t value);
+    void WriteF32(float value);
+    void WriteU16Array(std::span<const std::uint16_t> values);
+    void WriteU32Array(std::span<const std::uint32_t> values);
     void WriteRawBytes(ByteSpan bytes);
     void WriteBytes(ByteSpan bytes);
     void WriteString(std::string_view text);
@@ -32,6 +38,8 @@ private:
 
 class ByteReader final {
 public:
+    static constexpr std::size_t kMaxVarUIntSize = 10;
+
     explicit ByteReader(ByteSpan bytes);
 
     std::size_t Offset() const;
@@ -41,11 +49,18 @@ public:
     bool ReadU8(Byte& out_value);
     bool ReadVarUInt(std::uint64_t& out_value);
     bool ReadVarInt(std::int64_t& out_value);
+    bool ReadVarUInts(std::span<std::uint64_t> out_values);
+    bool ReadVarInts(std::span<std::int64_t> out_values);
+    bool ReadF32(float& out_value);
+    bool ReadU16Array(std::span<std::uint16_t> out_values);
+    bool ReadU32Array(std::span<std::uint32_t> out_values);
     bool ReadRawBytes(std::size_t length, ByteSpan& out_bytes);
     bool ReadBytes(ByteSpan& out_bytes);
     bool ReadString(std::string& out_text);
 
 private:
+    bool ReadVarUIntSlow(std::uint64_t& out_value);
+
     ByteSpan bytes_;
     std::size_t offset_ = 0;
 };
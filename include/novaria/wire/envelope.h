@@ -1,19 +1,23 @@
 #pragma once
 
+#include "core/status.h"
 #include "wire/byte_io.h"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <string>
 
 namespace novaria::wire {
 
 inline constexpr std::uint8_t kWireVersionV1 = 1;
+inline constexpr std::size_t kMaxEnvelopeHeaderSizeV1 = 12;
 
 enum class MessageKind : std::uint8_t {
     Control = 1,
     Command = 2,
     ChunkSnapshot = 3,
     ChunkSnapshotBatch = 4,
+    EntityStateBatch = 5,
 };
 
 const char* MessageKindName(MessageKind kind);
@@ -23,8 +27,17 @@ struct EnvelopeView final {
     ByteSpan payload{};
 };
 
-bool TryDecodeEnvelopeV1(ByteSpan datagram, EnvelopeView& out_envelope, std::string& out_error);
+// Runs once per received datagram; failures carry a static detail string and never allocate.
+core::Status DecodeEnvelopeV1(ByteSpan datagram, EnvelopeView& out_envelope);
 
+struct EnvelopeHeaderV1 final {
+    std::array<Byte, kMaxEnvelopeHeaderSizeV1> bytes{};
+    std::size_t size = 0;
+
+    ByteSpan Span() const;
+};
+
+void EncodeEnvelopeHeaderV1(MessageKind kind, std::size_t payload_size, EnvelopeHeaderV1& out_header);
 void EncodeEnvelopeV1(MessageKind kind, ByteSpan payload, ByteBuffer& out_datagram);
 
 }  // namespace novaria::wire
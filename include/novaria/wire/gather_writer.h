@@ -0,0 +1,38 @@
+#pragma once
+
+#include "wire/byte_io.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace novaria::wire {
+
+class GatherWriter final {
+public:
+    static constexpr std::size_t kInlineCopyThreshold = 64;
+
+    void Clear();
+    ByteWriter& InlineWriter();
+    void AppendExternal(ByteSpan bytes);
+    std::size_t Size() const;
+    const std::vector<ByteSpan>& Segments();
+    void Flatten(ByteBuffer& out_bytes);
+
+private:
+    struct Segment final {
+        bool external = false;
+        std::size_t inline_offset = 0;
+        std::size_t size = 0;
+        ByteSpan external_bytes{};
+    };
+
+    void CutInlineSegment();
+
+    ByteWriter inline_writer_;
+    std::vector<Segment> segments_;
+    std::vector<ByteSpan> spans_;
+    std::size_t inline_cut_offset_ = 0;
+    std::size_t external_size_ = 0;
+};
+
+}  // namespace novaria::wire
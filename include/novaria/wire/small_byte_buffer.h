@@ -0,0 +1,44 @@
+#pragma once
+
+#include "wire/byte_io.h"
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+
+namespace novaria::wire {
+
+class SmallByteBuffer final {
+public:
+    static constexpr std::size_t kInlineCapacity = 32;
+
+    SmallByteBuffer() = default;
+    SmallByteBuffer(std::initializer_list<Byte> bytes);
+    SmallByteBuffer(const ByteBuffer& bytes);
+    explicit SmallByteBuffer(ByteSpan bytes);
+    SmallByteBuffer(const SmallByteBuffer& other);
+    SmallByteBuffer(SmallByteBuffer&& other) noexcept;
+    SmallByteBuffer& operator=(const SmallByteBuffer& other);
+    SmallByteBuffer& operator=(SmallByteBuffer&& other) noexcept;
+
+    void Assign(ByteSpan bytes);
+    void Clear();
+    bool IsInline() const;
+    ByteSpan View() const;
+
+    const Byte* data() const;
+    std::size_t size() const;
+    bool empty() const;
+    const Byte* begin() const;
+    const Byte* end() const;
+
+    friend bool operator==(const SmallByteBuffer& lhs, const SmallByteBuffer& rhs);
+    friend bool operator==(const SmallByteBuffer& lhs, const ByteBuffer& rhs);
+
+private:
+    std::array<Byte, kInlineCapacity> inline_bytes_{};
+    ByteBuffer heap_bytes_;
+    std::size_t size_ = 0;
+};
+
+}  // namespace novaria::wire
@@ -1,22 +1,22 @@
 #pragma once
 
+#include "core/status.h"
 #include "world/world_service.h"
 #include "wire/byte_io.h"
 
-#include <string>
-
 namespace novaria::world {
 
 class WorldSnapshotCodec final {
 public:
-    static bool EncodeChunkSnapshot(
+    static core::Status EncodeChunkSnapshot(
+        const ChunkSnapshot& snapshot,
+        wire::ByteBuffer& out_payload);
+    static core::Status EncodeChunkSnapshot(
         const ChunkSnapshot& snapshot,
-        wire::ByteBuffer& out_payload,
-        std::string& out_error);
-    static bool DecodeChunkSnapshot(
+        wire::ByteWriter& writer);
+    static core::Status DecodeChunkSnapshot(
         wire::ByteSpan payload,
-        ChunkSnapshot& out_snapshot,
-        std::string& out_error);
+        ChunkSnapshot& out_snapshot);
 };
 
 }  // namespace novaria::world
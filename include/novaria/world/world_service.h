@@ -1,8 +1,10 @@
 #pragma once
 
+#include "core/status.h"
 #include "core/tick_context.h"
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -26,6 +28,15 @@ struct ChunkSnapshot final {
     std::vector<std::uint16_t> tiles;
 };
 
+struct WorldStateChunk final {
+    ChunkCoord chunk_coord;
+    std::shared_ptr<const std::vector<std::uint16_t>> tiles;
+};
+
+struct WorldState final {
+    std::vector<WorldStateChunk> chunks;
+};
+
 class IWorldService {
 public:
     virtual ~IWorldService() = default;
@@ -35,20 +46,19 @@ public:
     virtual void Tick(const core::TickContext& tick_context) = 0;
     virtual void LoadChunk(const ChunkCoord& chunk_coord) = 0;
     virtual void UnloadChunk(const ChunkCoord& chunk_coord) = 0;
-    virtual bool ApplyTileMutation(const TileMutation& mutation, std::string& out_error) = 0;
-    virtual bool BuildChunkSnapshot(
+    virtual core::Status ApplyTileMutation(const TileMutation& mutation) = 0;
+    virtual core::Status BuildChunkSnapshot(
         const ChunkCoord& chunk_coord,
-        ChunkSnapshot& out_snapshot,
-        std::string& out_error) const = 0;
-    virtual bool ApplyChunkSnapshot(
-        const ChunkSnapshot& snapshot,
-        std::string& out_error) = 0;
+        ChunkSnapshot& out_snapshot) const = 0;
+    virtual core::Status ApplyChunkSnapshot(const ChunkSnapshot& snapshot) = 0;
     virtual bool TryReadTile(
         int tile_x,
         int tile_y,
         std::uint16_t& out_material_id) const = 0;
-    virtual std::vector<ChunkCoord> LoadedChunkCoords() const = 0;
-    virtual std::vector<ChunkCoord> ConsumeDirtyChunks() = 0;
+    virtual void LoadedChunkCoords(std::vector<ChunkCoord>& out_chunk_coords) const = 0;
+    virtual void ConsumeDirtyChunks(std::vector<ChunkCoord>& out_chunk_coords) = 0;
+    virtual void CaptureState(WorldState& out_state) const = 0;
+    virtual core::Status RestoreState(const WorldState& state) = 0;
 };
 
 }  // namespace novaria::world
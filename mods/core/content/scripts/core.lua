@@ -3,7 +3,7 @@ novaria.core = novaria.core or {}
 novaria.core.last_tick = novaria.core.last_tick or 0
 novaria.core.last_delta = novaria.core.last_delta or 0
 novaria.core.last_event_name = novaria.core.last_event_name or ""
-novaria.core.last_event_payload = novaria.core.last_event_payload or ""
+novaria.core.last_event_payload = novaria.core.last_event_payload or {}
 novaria.core.event_count = novaria.core.event_count or 0
 
 function novaria_on_tick(tick_index, delta_seconds)
@@ -188,6 +188,12 @@ bool GameApp::Initialize(const std::filesystem::path& config_path) {
         *net_service_,
         *script_host_);
     simulation_kernel_->SetLocalPlayerId(local_player_id_);
+    const double interpolation_delay_seconds =
+        static_cast<double>(config_.net_interpolation_delay_ms) / 1000.0;
+    simulation_kernel_->SetRemoteInterpolationSettings(sim::EntityInterpolationSettings{
+        .delay_seconds = interpolation_delay_seconds,
+        .max_extrapolation_seconds = interpolation_delay_seconds,
+    });
 
     if (!simulation_kernel_->Initialize(runtime_error)) {
         core::Logger::Error("app", "Simulation kernel initialization failed: " + runtime_error);
@@ -251,7 +257,7 @@ int GameApp::Run() {
 
             return !quit_requested_;
         },
-        [this](double fixed_delta_seconds) {
+        [this, &loop](double fixed_delta_seconds) {
             simulation_kernel_->Update(fixed_delta_seconds);
             player_controller_.SyncFromSimulation(*simulation_kernel_);
 
@@ -282,10 +288,11 @@ int GameApp::Run() {
                     ", manual_disconnects=" + std::to_string(diagnostics.manual_disconnect_count) +
                     ", ignored_senders=" +
                     std::to_string(diagnostics.ignored_unexpected_sender_count) +
-                    ", dropped_commands(total/disconnected/queue_full)=" +
+                    ", dropped_commands(total/disconnected/queue_full/player_queue_full)=" +
                     std::to_string(diagnostics.dropped_command_count) + "/" +
                     std::to_string(diagnostics.dropped_command_disconnected_count) + "/" +
-                    std::to_string(diagnostics.dropped_command_queue_full_count) +
+                    std::to_string(diagnostics.dropped_command_queue_full_count) + "/" +
+                    std::to_string(diagnostics.dropped_command_player_queue_full_count) +
                     ", dropped_payloads(total/disconnected/queue_full)=" +
                     std::to_string(diagnostics.dropped_remote_chunk_payload_count) + "/" +
                     std::to_string(diagnostics.dropped_remote_chunk_payload_disconnected_count) + "/" +
@@ -300,7 +307,94 @@ int GameApp::Run() {
                     std::to_string(diagnostics.unsent_snapshot_disconnected_count) + "/" +
                     std::to_string(diagnostics.unsent_snapshot_self_suppressed_count) + "/" +
                     std::to_string(diagnostics.unsent_snapshot_send_failure_count) +
+                    ", command_streams(redundant/duplicate/lost/overflow)=" +
+                    std::to_string(diagnostics.redundant_command_send_count) + "/" +
+                    std::to_string(diagnostics.duplicate_command_count) + "/" +
+                    std::to_string(diagnostics.lost_command_count) + "/" +
+                    std::to_string(diagnostics.unacked_command_overflow_count) +
+                    ", entity_states(dropped/unsent)=" +
+                    std::to_string(diagnostics.dropped_remote_entity_state_count) + "/" +
+                    std::to_string(diagnostics.unsent_entity_state_count) +
+                    ", rtt_us(smoothed/var)=" +
+                    std::to_string(diagnostics.smoothed_rtt_microseconds) + "/" +
+                    std::to_string(diagnostics.rtt_variance_microseconds) +
+                    ", loss_estimate=" + std::to_string(diagnostics.estimated_loss_rate) +
+                    ", tick_clock(synced/offset/one_way_ticks/resyncs)=" +
+                    (diagnostics.tick_clock_synced ? "true" : "false") + "/" +
+                    std::to_string(diagnostics.remote_tick_offset) + "/" +
+                    std::to_string(diagnostics.one_way_delay_ticks) + "/" +
+                    std::to_string(diagnostics.tick_clock_resync_count) +
+                    ", impairment(dropped/duplicated/reordered/queued)=" +
+                    std::to_string(diagnostics.impairment_dropped_datagram_count) + "/" +
+                    std::to_string(diagnostics.impairment_duplicated_datagram_count) + "/" +
+                    std::to_string(diagnostics.impairment_reordered_datagram_count) + "/" +
+                    std::to_string(diagnostics.impairment_queued_datagram_count) +
                     ", ignored_heartbeats=" + std::to_string(diagnostics.ignored_heartbeat_count));
+            if (simulation_kernel_->AuthorityMode() == sim::SimulationAuthorityMode::Replica) {
+                const sim::PlayerMotionPredictionDiagnostics prediction =
+                    simulation_kernel_->LocalMotionPredictionDiagnostics();
+                const double mean_position_error =
+                    prediction.reconcile_count == 0
+                        ? 0.0
+                        : prediction.total_position_error / static_cast<double>(prediction.reconcile_count);
+                core::Logger::Info(
+                    "sim",
+                    "Prediction: acked_sequence=" + std::to_string(prediction.last_acked_sequence) +
+                        ", pending_inputs=" + std::to_string(prediction.pending_input_count) +
+                        ", reconciles=" + std::to_string(prediction.reconcile_count) +
+                        ", corrections=" + std::to_string(prediction.correction_count) +
+                        ", replayed_inputs=" + std::to_string(prediction.replayed_input_count) +
+                        ", dropped_history=" + std::to_string(prediction.dropped_history_count) +
+                        ", position_error(last/mean/max)=" +
+                        std::to_string(prediction.last_position_error) + "/" +
+                        std::to_string(mean_position_error) + "/" +
+                        std::to_string(prediction.max_position_error));
+                const sim::EntityReplicationReceiverDiagnostics replication =
+                    simulation_kernel_->EntityReplicationReceiverDiagnosticsSnapshot();
+                core::Logger::Info(
+                    "sim",
+                    "Entity replication: entities=" + std::to_string(replication.replicated_entity_count) +
+                        ", applied(full/delta)=" +
+                        std::to_string(replication.applied_full_snapshot_count) + "/" +
+                        std::to_string(replication.applied_delta_count) +
+                        ", missing_baseline=" + std::to_string(replication.missing_baseline_count) +
+                        ", rejected=" + std::to_string(replication.rejected_delta_count));
+            } else {
+                const sim::EntityReplicationSenderDiagnostics replication =
+                    simulation_kernel_->EntityReplicationSenderDiagnosticsSnapshot();
+                core::Logger::Info(
+                    "sim",
+                    "Entity replication: clients=" + std::to_string(replication.client_count) +
+                        ", snapshots(full/delta)=" +
+                        std::to_string(replication.full_snapshot_count) + "/" +
+                        std::to_string(replication.delta_snapshot_count) +
+                        ", entities(created/updated/removed/unchanged)=" +
+                        std::to_string(replication.created_entity_count) + "/" +
+                        std::to_string(replication.updated_entity_count) + "/" +
+                        std::to_string(replication.removed_entity_count) + "/" +
+                        std::to_string(replication.unchanged_entity_count) +
+                        ", culled(interest/budget)=" +
+                        std::to_string(replication.interest_culled_count) + "/" +
+                        std::to_string(replication.budget_culled_count) +
+                        ", bytes(last/total)=" +
+                        std::to_string(replication.last_encoded_bytes) + "/" +
+                        std::to_string(replication.total_encoded_bytes));
+                const sim::InputJitterBufferDiagnostics jitter =
+                    simulation_kernel_->InputJitterBufferDiagnosticsSnapshot();
+                core::Logger::Info(
+                    "sim",
+                    "Input jitter buffer: players=" + std::to_string(jitter.tracked_player_count) +
+                        ", buffered=" + std::to_string(jitter.buffered_command_count) +
+                        ", max_delay_ticks=" + std::to_string(jitter.max_player_delay_ticks) +
+                        ", inputs(on_time/late/clamped/unstamped)=" +
+                        std::to_string(jitter.on_time_command_count) + "/" +
+                        std::to_string(jitter.late_command_count) + "/" +
+                        std::to_string(jitter.early_clamped_command_count) + "/" +
+                        std::to_string(jitter.unstamped_command_count) +
+                        ", delay(increases/decreases)=" +
+                        std::to_string(jitter.delay_increase_count) + "/" +
+                        std::to_string(jitter.delay_decrease_count));
+            }
             const sim::GameplayProgressSnapshot gameplay_progress =
                 simulation_kernel_->GameplayProgress();
             core::Logger::Info(
@@ -314,6 +408,17 @@ int GameApp::Run() {
                     ", boss_defeated=" + (gameplay_progress.boss_defeated ? "true" : "false") +
                     ", loop_complete=" +
                     (gameplay_progress.playable_loop_complete ? "true" : "false"));
+            const core::TickSchedulerStats pacing = loop.SchedulerStats();
+            core::Logger::Info(
+                "app",
+                "Tick pacing: ticks=" + std::to_string(pacing.tick_count) +
+                    ", catch_up=" + std::to_string(pacing.catch_up_tick_count) +
+                    ", skipped=" + std::to_string(pacing.skipped_tick_count) +
+                    ", overruns=" + std::to_string(pacing.overrun_count) +
+                    ", tick_ms(mean/max)=" + std::to_string(pacing.mean_tick_ms) + "/" +
+                    std::to_string(pacing.max_tick_ms) +
+                    ", lateness_ms(mean/max)=" + std::to_string(pacing.mean_lateness_ms) + "/" +
+                    std::to_string(pacing.max_lateness_ms));
         },
         [this](float interpolation_alpha) {
             const float daylight_factor =
@@ -327,7 +432,9 @@ int GameApp::Run() {
                 viewport_width,
                 viewport_height,
                 *world_service_,
-                daylight_factor);
+                daylight_factor,
+                simulation_kernel_->SampleRemotePlayers(interpolation_alpha),
+                simulation_kernel_->SampleReplicatedEntities(interpolation_alpha));
             sdl_context_.RenderFrame(interpolation_alpha, scene);
         });
 
@@ -345,30 +452,32 @@ void GameApp::Shutdown() {
     const sim::GameplayProgressSnapshot gameplay_progress =
         simulation_kernel_->GameplayProgress();
     std::vector<wire::ByteBuffer> encoded_world_chunks;
-    for (const world::ChunkCoord& chunk_coord : world_service_->LoadedChunkCoords()) {
+    std::vector<world::ChunkCoord> loaded_chunk_coords;
+    world_service_->LoadedChunkCoords(loaded_chunk_coords);
+    for (const world::ChunkCoord& chunk_coord : loaded_chunk_coords) {
         world::ChunkSnapshot chunk_snapshot{};
-        std::string snapshot_error;
-        if (!world_service_->BuildChunkSnapshot(chunk_coord, chunk_snapshot, snapshot_error)) {
+        const core::Status build_status =
+            world_service_->BuildChunkSnapshot(chunk_coord, chunk_snapshot);
+        if (!build_status) {
             core::Logger::Warn(
                 "save",
                 "Skip world chunk snapshot build at (" +
                     std::to_string(chunk_coord.x) + "," +
                     std::to_string(chunk_coord.y) + "): " +
-                    snapshot_error);
+                    build_status.Message());
             continue;
         }
 
         wire::ByteBuffer encoded_chunk;
-        if (!world::WorldSnapshotCodec::EncodeChunkSnapshot(
-                chunk_snapshot,
-                encoded_chunk,
-                snapshot_error)) {
+        const core::Status encode_status =
+            world::WorldSnapshotCodec::EncodeChunkSnapshot(chunk_snapshot, encoded_chunk);
+        if (!encode_status) {
             core::Logger::Warn(
                 "save",
                 "Skip world chunk snapshot encode at (" +
                     std::to_string(chunk_coord.x) + "," +
                     std::to_string(chunk_coord.y) + "): " +
-                    snapshot_error);
+                    encode_status.Message());
             continue;
         }
 
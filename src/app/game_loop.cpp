@@ -1,34 +1,33 @@
 #include "app/game_loop.h"
 
-#include <algorithm>
-#include <chrono>
+#include <cstdint>
 
 namespace novaria::app {
 
-void GameLoop::Run(const PumpEventsFn& pump_events, const UpdateFn& update, const RenderFn& render) {
-    constexpr double kFixedDeltaSeconds = 1.0 / 60.0;
-    constexpr double kMaxFrameClampSeconds = 0.25;
+GameLoop::GameLoop(const core::TickSchedulerSettings& settings) {
+    scheduler_.SetSettings(settings);
+}
 
-    auto previous_time = std::chrono::steady_clock::now();
-    double accumulator = 0.0;
+void GameLoop::Run(const PumpEventsFn& pump_events, const UpdateFn& update, const RenderFn& render) {
+    using Clock = core::TickScheduler::Clock;
+    const double fixed_delta_seconds = scheduler_.Settings().tick_interval_seconds;
+    const std::uint32_t max_ticks_per_frame = scheduler_.Settings().max_catch_up_ticks + 1;
 
+    scheduler_.Start(Clock::now());
     while (pump_events()) {
-        const auto now = std::chrono::steady_clock::now();
-        auto frame_seconds =
-            std::chrono::duration<double>(now - previous_time).count();
-        previous_time = now;
-
-        frame_seconds = std::clamp(frame_seconds, 0.0, kMaxFrameClampSeconds);
-        accumulator += frame_seconds;
-
-        while (accumulator >= kFixedDeltaSeconds) {
-            update(kFixedDeltaSeconds);
-            accumulator -= kFixedDeltaSeconds;
+        for (std::uint32_t frame_tick = 0;
+             frame_tick < max_ticks_per_frame && scheduler_.TryBeginTick(Clock::now());
+             ++frame_tick) {
+            update(fixed_delta_seconds);
+            scheduler_.EndTick(Clock::now());
         }
 
-        const float interpolation_alpha = static_cast<float>(accumulator / kFixedDeltaSeconds);
-        render(interpolation_alpha);
+        render(scheduler_.InterpolationAlpha(Clock::now()));
     }
 }
 
+core::TickSchedulerStats GameLoop::SchedulerStats() const {
+    return scheduler_.Stats();
+}
+
 }  // namespace novaria::app
@@ -90,50 +90,48 @@ void PlayerController::Update(
             motion_input_payload.input_flags |= sim::command::kMotionInputFlagJumpPressed;
         }
     }
-    simulation_kernel.SubmitLocalCommand(net::PlayerCommand{
-        .player_id = local_player_id,
-        .command_id = sim::command::kPlayerMotionInput,
-        .payload = sim::command::EncodePlayerMotionInputPayload(motion_input_payload),
-    });
-
-    auto submit_world_load_chunk = [&simulation_kernel, local_player_id](int chunk_x, int chunk_y) {
+    wire::ByteWriter& payload_writer = command_payload_writer_;
+    payload_writer.Clear();
+    auto submit_command = [&simulation_kernel, &payload_writer, local_player_id](std::uint32_t command_id) {
         simulation_kernel.SubmitLocalCommand(net::PlayerCommand{
             .player_id = local_player_id,
-            .command_id = sim::command::kWorldLoadChunk,
-            .payload = sim::command::EncodeWorldChunkPayload(sim::command::WorldChunkPayload{
-                .chunk_x = chunk_x,
-                .chunk_y = chunk_y,
-            }),
+            .command_id = command_id,
+            .payload = wire::SmallByteBuffer(payload_writer.Buffer()),
         });
+        payload_writer.Clear();
     };
 
-    auto submit_world_unload_chunk = [&simulation_kernel, local_player_id](int chunk_x, int chunk_y) {
-        simulation_kernel.SubmitLocalCommand(net::PlayerCommand{
-            .player_id = local_player_id,
-            .command_id = sim::command::kWorldUnloadChunk,
-            .payload = sim::command::EncodeWorldChunkPayload(sim::command::WorldChunkPayload{
+    sim::command::EncodePlayerMotionInputPayload(motion_input_payload, payload_writer);
+    submit_command(sim::command::kPlayerMotionInput);
+
+    auto submit_world_load_chunk = [&submit_command, &payload_writer](int chunk_x, int chunk_y) {
+        sim::command::EncodeWorldChunkPayload(
+            sim::command::WorldChunkPayload{
                 .chunk_x = chunk_x,
                 .chunk_y = chunk_y,
-            }),
-        });
+            },
+            payload_writer);
+        submit_command(sim::command::kWorldLoadChunk);
     };
 
-    auto submit_command =
-        [&simulation_kernel, local_player_id](std::uint32_t command_id, wire::ByteBuffer payload) {
-            simulation_kernel.SubmitLocalCommand(net::PlayerCommand{
-                .player_id = local_player_id,
-                .command_id = command_id,
-                .payload = std::move(payload),
-            });
-        };
+    auto submit_world_unload_chunk = [&submit_command, &payload_writer](int chunk_x, int chunk_y) {
+        sim::command::EncodeWorldChunkPayload(
+            sim::command::WorldChunkPayload{
+                .chunk_x = chunk_x,
+                .chunk_y = chunk_y,
+            },
+            payload_writer);
+        submit_command(sim::command::kWorldUnloadChunk);
+    };
 
-    auto submit_pickup_probe = [&submit_command](int tile_x, int tile_y) {
-        submit_command(
-            sim::command::kGameplayPickupProbe,
-            sim::command::EncodePickupProbePayload(sim::command::PickupProbePayload{
+    auto submit_pickup_probe = [&submit_command, &payload_writer](int tile_x, int tile_y) {
+        sim::command::EncodePickupProbePayload(
+            sim::command::PickupProbePayload{
                 .tile_x = tile_x,
                 .tile_y = tile_y,
-                }));
+            },
+            payload_writer);
+        submit_command(sim::command::kGameplayPickupProbe);
     };
 
     constexpr int kChunkWindowRadius = 2;
@@ -228,14 +226,15 @@ void PlayerController::Update(
     }
 
     if (!state_.inventory_open && input_intent.action_primary_held && target_reachable) {
-        submit_command(
-            sim::command::kGameplayActionPrimary,
-            sim::command::EncodeActionPrimaryPayload(sim::command::ActionPrimaryPayload{
+        sim::command::EncodeActionPrimaryPayload(
+            sim::command::ActionPrimaryPayload{
                 .target_tile_x = target_tile_x,
                 .target_tile_y = target_tile_y,
                 .hotbar_row = state_.active_hotbar_row,
                 .hotbar_slot = state_.selected_hotbar_slot,
-            }));
+            },
+            payload_writer);
+        submit_command(sim::command::kGameplayActionPrimary);
     }
 
     const bool craft_confirm_pressed =
@@ -249,11 +248,12 @@ void PlayerController::Update(
         std::uint16_t interaction_target_material = 0;
 
         if (craft_confirm_pressed) {
-            submit_command(
-                sim::command::kGameplayCraftRecipe,
-                sim::command::EncodeCraftRecipePayload(sim::command::CraftRecipePayload{
+            sim::command::EncodeCraftRecipePayload(
+                sim::command::CraftRecipePayload{
                     .recipe_index = state_.selected_recipe_index,
-                }));
+                },
+                payload_writer);
+            submit_command(sim::command::kGameplayCraftRecipe);
 
             interaction_type = sim::command::kInteractionTypeCraftRecipe;
             interaction_tile_x = state_.tile_x;
@@ -276,15 +276,16 @@ void PlayerController::Update(
                 }
             }
 
-            submit_command(
-                sim::command::kGameplayInteraction,
-                sim::command::EncodeInteractionPayload(sim::command::InteractionPayload{
+            sim::command::EncodeInteractionPayload(
+                sim::command::InteractionPayload{
                     .interaction_type = interaction_type,
                     .target_tile_x = interaction_tile_x,
                     .target_tile_y = interaction_tile_y,
                     .target_material_id = interaction_target_material,
                     .result_code = interaction_result,
-                }));
+                },
+                payload_writer);
+            submit_command(sim::command::kGameplayInteraction);
         }
     }
 
@@ -296,8 +297,8 @@ void PlayerController::Update(
     submit_pickup_probe(state_.tile_x, state_.tile_y);
 
     constexpr std::uint16_t kPickupToastTicks = 90;
-    for (const sim::GameplayPickupEvent& pickup_event :
-         simulation_kernel.ConsumePickupEventsForPlayer(local_player_id)) {
+    simulation_kernel.ConsumePickupEventsForPlayer(local_player_id, pickup_event_scratch_);
+    for (const sim::GameplayPickupEvent& pickup_event : pickup_event_scratch_) {
         state_.pickup_toast_material_id = pickup_event.material_id;
         state_.pickup_toast_amount = pickup_event.amount;
         state_.pickup_toast_ticks_remaining = kPickupToastTicks;
@@ -67,7 +67,9 @@ platform::RenderScene RenderSceneBuilder::Build(
     int viewport_width,
     int viewport_height,
     const world::IWorldService& world_service,
-    float daylight_factor) const {
+    float daylight_factor,
+    const std::vector<sim::InterpolatedEntityState>& remote_players,
+    const std::vector<sim::ecs::ReplicatedEntitySnapshot>& replicated_entities) const {
     constexpr int kTilePixelSize = 32;
     platform::RenderScene scene{};
     scene.tile_pixel_size = kTilePixelSize;
@@ -178,7 +180,50 @@ platform::RenderScene RenderSceneBuilder::Build(
         scene.camera_tile_y * tile_pixel_size_f;
 
     scene.overlay_commands.clear();
-    scene.overlay_commands.reserve(256);
+    scene.overlay_commands.reserve(256 + remote_players.size() + replicated_entities.size());
+
+    for (const sim::ecs::ReplicatedEntitySnapshot& entity : replicated_entities) {
+        float size_tiles = 0.0F;
+        platform::RgbaColor color{};
+        switch (entity.kind) {
+            case sim::ecs::ReplicatedEntityKind::Projectile:
+                size_tiles = 0.25F;
+                color = platform::RgbaColor{.r = 250, .g = 214, .b = 92, .a = 240};
+                break;
+            case sim::ecs::ReplicatedEntityKind::Hostile:
+                size_tiles = 0.9F;
+                color = platform::RgbaColor{.r = 196, .g = 62, .b = 70, .a = 230};
+                break;
+            case sim::ecs::ReplicatedEntityKind::Drop:
+                size_tiles = 0.4F;
+                color = platform::RgbaColor{.r = 164, .g = 214, .b = 120, .a = 230};
+                break;
+            case sim::ecs::ReplicatedEntityKind::Player:
+                // Players are drawn from the interpolated remote player list.
+                continue;
+        }
+        scene.overlay_commands.push_back(platform::RenderCommand::FilledRect(
+            platform::RenderLayer::WorldOverlay,
+            4,
+            world_origin_x + (entity.position_x - size_tiles * 0.5F) * tile_pixel_size_f,
+            world_origin_y + (entity.position_y - size_tiles * 0.5F) * tile_pixel_size_f,
+            size_tiles * tile_pixel_size_f,
+            size_tiles * tile_pixel_size_f,
+            color));
+    }
+
+    const sim::PlayerMotionSettings& motion_settings = sim::DefaultPlayerMotionSettings();
+    const platform::RgbaColor remote_player_color{.r = 226, .g = 158, .b = 88, .a = 230};
+    for (const sim::InterpolatedEntityState& remote_player : remote_players) {
+        scene.overlay_commands.push_back(platform::RenderCommand::FilledRect(
+            platform::RenderLayer::WorldOverlay,
+            5,
+            world_origin_x + (remote_player.position_x - motion_settings.half_width) * tile_pixel_size_f,
+            world_origin_y + (remote_player.position_y - motion_settings.height) * tile_pixel_size_f,
+            motion_settings.half_width * 2.0F * tile_pixel_size_f,
+            motion_settings.height * tile_pixel_size_f,
+            remote_player_color));
+    }
 
     const ui::GameplayUiPalette ui_palette{
         .text = platform::RgbaColor{.r = 232, .g = 232, .b = 236, .a = 240},
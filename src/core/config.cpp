@@ -24,6 +24,20 @@ bool ParsePort(const std::string& value, int& out_port) {
     return true;
 }
 
+bool ParseIntInRange(const std::string& value, int min_value, int max_value, int& out_value) {
+    int parsed_value = 0;
+    if (!cfg::ParseInt(value, parsed_value)) {
+        return false;
+    }
+
+    if (parsed_value < min_value || parsed_value > max_value) {
+        return false;
+    }
+
+    out_value = parsed_value;
+    return true;
+}
+
 bool ParseString(const std::string& value, std::string& out_value) {
     return cfg::ParseQuotedString(value, out_value);
 }
@@ -137,6 +151,15 @@ bool ApplyConfigLines(
             continue;
         }
 
+        if (key == "net_interpolation_delay_ms") {
+            if (!ParseIntInRange(value, 0, 1000, in_out_config.net_interpolation_delay_ms)) {
+                out_error = "net_interpolation_delay_ms expects integer within [0,1000]: line " +
+                    std::to_string(line_number);
+                return false;
+            }
+            continue;
+        }
+
         out_error =
             "Unknown config key: " + key +
             " (line " + std::to_string(line_number) + ")";
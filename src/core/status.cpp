@@ -0,0 +1,47 @@
+#include "core/status.h"
+
+#include <system_error>
+
+namespace novaria::core {
+
+std::string Status::Message() const {
+    if (IsOk()) {
+        return {};
+    }
+
+    std::string message = detail_[0] != '\0' ? std::string(detail_) : std::string(StatusCodeName(code_));
+    if (code_ == StatusCode::SystemError && system_error_code_ != 0) {
+        message += ": ";
+        message += std::system_category().message(system_error_code_);
+        message += " (code=";
+        message += std::to_string(system_error_code_);
+        message += ")";
+    }
+    return message;
+}
+
+const char* StatusCodeName(StatusCode code) {
+    switch (code) {
+        case StatusCode::Ok:
+            return "ok";
+        case StatusCode::NotInitialized:
+            return "not_initialized";
+        case StatusCode::InvalidArgument:
+            return "invalid_argument";
+        case StatusCode::NotFound:
+            return "not_found";
+        case StatusCode::MalformedPayload:
+            return "malformed_payload";
+        case StatusCode::WouldBlock:
+            return "would_block";
+        case StatusCode::SystemError:
+            return "system_error";
+        case StatusCode::ScriptError:
+            return "script_error";
+        case StatusCode::Unavailable:
+            return "unavailable";
+    }
+    return "unknown";
+}
+
+}  // namespace novaria::core
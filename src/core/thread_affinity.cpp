@@ -0,0 +1,56 @@
+#include "core/thread_affinity.h"
+
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace novaria::core {
+
+std::size_t HardwareThreadCount() {
+    const unsigned int count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : static_cast<std::size_t>(count);
+}
+
+bool PinCurrentThreadToCore(std::size_t core_index, std::string& out_error) {
+#if defined(_WIN32)
+    if (core_index >= sizeof(DWORD_PTR) * 8) {
+        out_error = "core index out of affinity mask range: " + std::to_string(core_index);
+        return false;
+    }
+    const DWORD_PTR mask = static_cast<DWORD_PTR>(1) << core_index;
+    if (::SetThreadAffinityMask(::GetCurrentThread(), mask) == 0) {
+        out_error = "SetThreadAffinityMask failed, code=" + std::to_string(::GetLastError());
+        return false;
+    }
+#elif defined(__linux__)
+    if (core_index >= CPU_SETSIZE) {
+        out_error = "core index out of affinity mask range: " + std::to_string(core_index);
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    CPU_SET(core_index, &cpu_set);
+    const int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (result != 0) {
+        out_error = "pthread_setaffinity_np failed, code=" + std::to_string(result);
+        return false;
+    }
+#else
+    (void)core_index;
+    out_error = "thread pinning is not supported on this platform";
+    return false;
+#endif
+
+    out_error.clear();
+    return true;
+}
+
+}  // namespace novaria::core
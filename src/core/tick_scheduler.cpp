@@ -0,0 +1,143 @@
+#include "core/tick_scheduler.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace novaria::core {
+namespace {
+
+double ToMilliseconds(TickScheduler::Clock::duration duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+}  // namespace
+
+void TickScheduler::SetSettings(const TickSchedulerSettings& settings) {
+    settings_ = settings;
+    if (!(settings_.tick_interval_seconds > 0.0)) {
+        settings_.tick_interval_seconds = TickSchedulerSettings{}.tick_interval_seconds;
+    }
+    if (settings_.spin_wait.count() < 0) {
+        settings_.spin_wait = std::chrono::microseconds{0};
+    }
+    tick_interval_ = std::max(
+        std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(settings_.tick_interval_seconds)),
+        Clock::duration{1});
+}
+
+const TickSchedulerSettings& TickScheduler::Settings() const {
+    return settings_;
+}
+
+TickScheduler::Clock::duration TickScheduler::TickInterval() const {
+    return tick_interval_;
+}
+
+void TickScheduler::Start(Clock::time_point now) {
+    next_tick_deadline_ = now + tick_interval_;
+    tick_active_ = false;
+}
+
+bool TickScheduler::TryBeginTick(Clock::time_point now) {
+    if (settings_.fast_forward) {
+        next_tick_deadline_ = now;
+    } else if (now < next_tick_deadline_) {
+        return false;
+    }
+
+    // Deadlines are absolute; a backlog beyond max_catch_up_ticks is dropped rather than replayed.
+    Clock::duration lateness = now - next_tick_deadline_;
+    const auto ticks_behind = static_cast<std::uint64_t>(lateness / tick_interval_);
+    if (ticks_behind > settings_.max_catch_up_ticks) {
+        const std::uint64_t dropped_ticks = ticks_behind - settings_.max_catch_up_ticks;
+        next_tick_deadline_ += tick_interval_ * static_cast<Clock::rep>(dropped_ticks);
+        skipped_tick_count_ += dropped_ticks;
+        lateness = now - next_tick_deadline_;
+    }
+    if (lateness >= tick_interval_) {
+        ++catch_up_tick_count_;
+    }
+
+    last_lateness_ = lateness;
+    total_lateness_ += lateness;
+    max_lateness_ = std::max(max_lateness_, lateness);
+    tick_begin_time_ = now;
+    tick_active_ = true;
+    return true;
+}
+
+void TickScheduler::EndTick(Clock::time_point now) {
+    if (!tick_active_) {
+        return;
+    }
+
+    const Clock::duration tick_duration = now - tick_begin_time_;
+    last_tick_duration_ = tick_duration;
+    total_tick_duration_ += tick_duration;
+    max_tick_duration_ = std::max(max_tick_duration_, tick_duration);
+    if (tick_duration > tick_interval_) {
+        ++overrun_count_;
+    }
+    ++tick_count_;
+    next_tick_deadline_ += tick_interval_;
+    tick_active_ = false;
+}
+
+void TickScheduler::WaitForNextTick() const {
+    if (settings_.fast_forward) {
+        return;
+    }
+
+    // OS sleeps overshoot by up to a scheduler quantum, so sleep short of the deadline and spin the rest.
+    const Clock::duration spin_wait = std::chrono::duration_cast<Clock::duration>(settings_.spin_wait);
+    for (Clock::time_point now = Clock::now(); now < next_tick_deadline_; now = Clock::now()) {
+        const Clock::duration remaining = next_tick_deadline_ - now;
+        if (remaining > spin_wait) {
+            std::this_thread::sleep_for(remaining - spin_wait);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+float TickScheduler::InterpolationAlpha(Clock::time_point now) const {
+    const Clock::time_point last_tick_deadline = next_tick_deadline_ - tick_interval_;
+    const double alpha = std::chrono::duration<double>(now - last_tick_deadline) /
+        std::chrono::duration<double>(tick_interval_);
+    return static_cast<float>(std::clamp(alpha, 0.0, 1.0));
+}
+
+TickScheduler::Clock::time_point TickScheduler::NextTickDeadline() const {
+    return next_tick_deadline_;
+}
+
+TickSchedulerStats TickScheduler::Stats() const {
+    const double tick_count = static_cast<double>(std::max<std::uint64_t>(tick_count_, 1));
+    return TickSchedulerStats{
+        .tick_count = tick_count_,
+        .catch_up_tick_count = catch_up_tick_count_,
+        .skipped_tick_count = skipped_tick_count_,
+        .overrun_count = overrun_count_,
+        .last_tick_ms = ToMilliseconds(last_tick_duration_),
+        .mean_tick_ms = ToMilliseconds(total_tick_duration_) / tick_count,
+        .max_tick_ms = ToMilliseconds(max_tick_duration_),
+        .last_lateness_ms = ToMilliseconds(last_lateness_),
+        .mean_lateness_ms = ToMilliseconds(total_lateness_) / tick_count,
+        .max_lateness_ms = ToMilliseconds(max_lateness_),
+    };
+}
+
+void TickScheduler::ResetStats() {
+    tick_count_ = 0;
+    catch_up_tick_count_ = 0;
+    skipped_tick_count_ = 0;
+    overrun_count_ = 0;
+    last_tick_duration_ = {};
+    total_tick_duration_ = {};
+    max_tick_duration_ = {};
+    last_lateness_ = {};
+    total_lateness_ = {};
+    max_lateness_ = {};
+}
+
+}  // namespace novaria::core
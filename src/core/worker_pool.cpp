@@ -0,0 +1,138 @@
+#include "core/worker_pool.h"
+
+#include <system_error>
+#include <utility>
+
+namespace novaria::core {
+
+WorkerPool::~WorkerPool() {
+    Stop();
+}
+
+bool WorkerPool::Start(std::size_t worker_count, std::string& out_error) {
+    if (!workers_.empty()) {
+        out_error = "worker pool already started";
+        return false;
+    }
+    if (worker_count == 0 || worker_count > kMaxWorkers) {
+        out_error = "worker count must be in [1, " + std::to_string(kMaxWorkers) + "]";
+        return false;
+    }
+
+    stopping_ = false;
+    try {
+        workers_.reserve(worker_count);
+        for (std::size_t index = 0; index < worker_count; ++index) {
+            workers_.emplace_back([this, start_generation = generation_]() { WorkerLoop(start_generation); });
+        }
+    } catch (const std::system_error& error) {
+        Stop();
+        out_error = std::string("worker thread start failed: ") + error.what();
+        return false;
+    }
+
+    out_error.clear();
+    return true;
+}
+
+void WorkerPool::Stop() {
+    if (workers_.empty()) {
+        return;
+    }
+
+    Wait();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    work_ready_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+}
+
+std::size_t WorkerPool::WorkerCount() const {
+    return workers_.size();
+}
+
+bool WorkerPool::Busy() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return busy_;
+}
+
+void WorkerPool::Dispatch(std::size_t job_count, std::function<void(std::size_t)> job) {
+    Wait();
+    if (job_count == 0) {
+        return;
+    }
+    if (workers_.empty()) {
+        for (std::size_t index = 0; index < job_count; ++index) {
+            job(index);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = std::move(job);
+        job_count_ = job_count;
+        next_job_index_.store(0, std::memory_order_relaxed);
+        active_worker_count_ = workers_.size();
+        busy_ = true;
+        ++generation_;
+    }
+    work_ready_.notify_all();
+}
+
+void WorkerPool::Wait() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!busy_) {
+            return;
+        }
+    }
+
+    // The caller claims remaining jobs instead of idling while the workers drain the batch.
+    RunJobs();
+    std::unique_lock<std::mutex> lock(mutex_);
+    work_done_.wait(lock, [this]() { return active_worker_count_ == 0; });
+    busy_ = false;
+}
+
+void WorkerPool::WorkerLoop(std::uint64_t observed_generation) {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            work_ready_.wait(lock, [this, observed_generation]() {
+                return stopping_ || generation_ != observed_generation;
+            });
+            if (stopping_) {
+                return;
+            }
+            observed_generation = generation_;
+        }
+
+        RunJobs();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --active_worker_count_;
+            if (active_worker_count_ != 0) {
+                continue;
+            }
+        }
+        work_done_.notify_all();
+    }
+}
+
+void WorkerPool::RunJobs() {
+    while (true) {
+        const std::size_t index = next_job_index_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= job_count_) {
+            return;
+        }
+        job_(index);
+    }
+}
+
+}  // namespace novaria::core
@@ -0,0 +1,62 @@
+#include "net/net_channel.h"
+
+namespace novaria::net {
+
+const char* NetChannelName(NetChannel channel) {
+    switch (channel) {
+        case NetChannel::Control:
+            return "control";
+        case NetChannel::Command:
+            return "command";
+        case NetChannel::EntityState:
+            return "entity_state";
+        case NetChannel::ChunkStream:
+            return "chunk_stream";
+    }
+
+    return "unknown";
+}
+
+bool ValidateNetChannelSettings(const NetChannelSettings& settings, std::string& out_error) {
+    for (std::size_t index = 1; index < kNetChannelCount; ++index) {
+        if (settings.channels[index].receive_queue_limit == 0) {
+            out_error =
+                std::string("net channel receive_queue_limit must be > 0: ") +
+                NetChannelName(static_cast<NetChannel>(index));
+            return false;
+        }
+    }
+    if (settings.max_chunk_stream_datagram_bytes == 0) {
+        out_error = "net channel max_chunk_stream_datagram_bytes must be > 0";
+        return false;
+    }
+    if (settings.max_entity_state_datagram_bytes == 0) {
+        out_error = "net channel max_entity_state_datagram_bytes must be > 0";
+        return false;
+    }
+    if (settings.max_queued_chunk_payloads == 0) {
+        out_error = "net channel max_queued_chunk_payloads must be > 0";
+        return false;
+    }
+
+    const NetCongestionSettings& congestion = settings.congestion;
+    if (congestion.min_window_bytes_per_tick == 0 ||
+        congestion.min_window_bytes_per_tick > congestion.initial_window_bytes_per_tick ||
+        congestion.initial_window_bytes_per_tick > congestion.max_window_bytes_per_tick) {
+        out_error = "net congestion window must satisfy 0 < min <= initial <= max";
+        return false;
+    }
+    if (congestion.additive_increase_bytes == 0) {
+        out_error = "net congestion additive_increase_bytes must be > 0";
+        return false;
+    }
+    if (congestion.in_flight_timeout_ticks == 0) {
+        out_error = "net congestion in_flight_timeout_ticks must be > 0";
+        return false;
+    }
+
+    out_error.clear();
+    return true;
+}
+
+}  // namespace novaria::net
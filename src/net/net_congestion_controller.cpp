@@ -0,0 +1,48 @@
+#include "net/net_congestion_controller.h"
+
+#include <algorithm>
+
+namespace novaria::net {
+
+void NetCongestionController::Configure(const NetCongestionSettings& settings) {
+    settings_ = settings;
+    Reset();
+}
+
+void NetCongestionController::Reset() {
+    window_bytes_per_tick_ = settings_.initial_window_bytes_per_tick;
+    last_decrease_tick_ = kNoLossTick;
+    loss_event_count_ = 0;
+}
+
+void NetCongestionController::OnDelivered(std::size_t delivered_batch_count) {
+    if (delivered_batch_count == 0) {
+        return;
+    }
+
+    window_bytes_per_tick_ = std::min(
+        window_bytes_per_tick_ + settings_.additive_increase_bytes,
+        settings_.max_window_bytes_per_tick);
+}
+
+void NetCongestionController::OnLoss(std::uint64_t tick_index) {
+    // Losses reported within one recovery period belong to the same congestion event.
+    if (last_decrease_tick_ != kNoLossTick &&
+        tick_index < last_decrease_tick_ + settings_.loss_recovery_ticks) {
+        return;
+    }
+
+    last_decrease_tick_ = tick_index;
+    ++loss_event_count_;
+    window_bytes_per_tick_ = std::max(window_bytes_per_tick_ / 2, settings_.min_window_bytes_per_tick);
+}
+
+std::size_t NetCongestionController::WindowBytesPerTick() const {
+    return window_bytes_per_tick_;
+}
+
+std::uint64_t NetCongestionController::LossEventCount() const {
+    return loss_event_count_;
+}
+
+}  // namespace novaria::net
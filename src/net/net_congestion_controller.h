@@ -0,0 +1,29 @@
+#pragma once
+
+#include "net/net_channel.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace novaria::net {
+
+class NetCongestionController final {
+public:
+    void Configure(const NetCongestionSettings& settings);
+    void Reset();
+    void OnDelivered(std::size_t delivered_batch_count);
+    void OnLoss(std::uint64_t tick_index);
+    std::size_t WindowBytesPerTick() const;
+    std::uint64_t LossEventCount() const;
+
+private:
+    static constexpr std::uint64_t kNoLossTick = std::numeric_limits<std::uint64_t>::max();
+
+    NetCongestionSettings settings_{};
+    std::size_t window_bytes_per_tick_ = 0;
+    std::uint64_t last_decrease_tick_ = kNoLossTick;
+    std::uint64_t loss_event_count_ = 0;
+};
+
+}  // namespace novaria::net
@@ -0,0 +1,66 @@
+#include "net/net_link_estimator.h"
+
+#include <algorithm>
+
+namespace novaria::net {
+
+void NetLinkEstimator::Reset() {
+    quality_ = {};
+    last_heartbeat_sequence_ = 0;
+}
+
+void NetLinkEstimator::ResetHeartbeatSequence() {
+    last_heartbeat_sequence_ = 0;
+}
+
+void NetLinkEstimator::ObserveRttSample(std::uint64_t rtt_microseconds) {
+    quality_.last_rtt_microseconds = rtt_microseconds;
+    if (quality_.rtt_sample_count == 0) {
+        quality_.smoothed_rtt_microseconds = rtt_microseconds;
+        quality_.rtt_variance_microseconds = rtt_microseconds / 2;
+        quality_.min_rtt_microseconds = rtt_microseconds;
+    } else {
+        const std::uint64_t deviation =
+            rtt_microseconds > quality_.smoothed_rtt_microseconds
+                ? rtt_microseconds - quality_.smoothed_rtt_microseconds
+                : quality_.smoothed_rtt_microseconds - rtt_microseconds;
+        quality_.rtt_variance_microseconds = (quality_.rtt_variance_microseconds * 3 + deviation) / 4;
+        quality_.smoothed_rtt_microseconds = (quality_.smoothed_rtt_microseconds * 7 + rtt_microseconds) / 8;
+        quality_.min_rtt_microseconds = std::min(quality_.min_rtt_microseconds, rtt_microseconds);
+    }
+    ++quality_.rtt_sample_count;
+}
+
+void NetLinkEstimator::ObserveHeartbeatSequence(std::uint32_t sequence) {
+    if (sequence == 0) {
+        return;
+    }
+
+    if (last_heartbeat_sequence_ != 0) {
+        if (sequence == last_heartbeat_sequence_) {
+            return;
+        }
+        if (sequence < last_heartbeat_sequence_ &&
+            last_heartbeat_sequence_ - sequence <= kMaxHeartbeatSequenceGap) {
+            return;
+        }
+        if (sequence > last_heartbeat_sequence_ &&
+            sequence - last_heartbeat_sequence_ <= kMaxHeartbeatSequenceGap) {
+            const std::uint32_t lost = sequence - last_heartbeat_sequence_ - 1;
+            quality_.heartbeat_lost_count += lost;
+            for (std::uint32_t index = 0; index < lost; ++index) {
+                quality_.estimated_loss_rate += (1.0 - quality_.estimated_loss_rate) * kLossRateSmoothing;
+            }
+        }
+    }
+
+    ++quality_.heartbeat_received_count;
+    quality_.estimated_loss_rate -= quality_.estimated_loss_rate * kLossRateSmoothing;
+    last_heartbeat_sequence_ = sequence;
+}
+
+const NetLinkQuality& NetLinkEstimator::Quality() const {
+    return quality_;
+}
+
+}  // namespace novaria::net
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+
+namespace novaria::net {
+
+struct NetLinkQuality final {
+    std::uint64_t rtt_sample_count = 0;
+    std::uint64_t last_rtt_microseconds = 0;
+    std::uint64_t smoothed_rtt_microseconds = 0;
+    std::uint64_t rtt_variance_microseconds = 0;
+    std::uint64_t min_rtt_microseconds = 0;
+    std::uint64_t heartbeat_received_count = 0;
+    std::uint64_t heartbeat_lost_count = 0;
+    double estimated_loss_rate = 0.0;
+};
+
+class NetLinkEstimator final {
+public:
+    static constexpr double kLossRateSmoothing = 1.0 / 16.0;
+    static constexpr std::uint32_t kMaxHeartbeatSequenceGap = 1024;
+
+    void Reset();
+    void ResetHeartbeatSequence();
+    void ObserveRttSample(std::uint64_t rtt_microseconds);
+    void ObserveHeartbeatSequence(std::uint32_t sequence);
+    const NetLinkQuality& Quality() const;
+
+private:
+    NetLinkQuality quality_{};
+    std::uint32_t last_heartbeat_sequence_ = 0;
+};
+
+}  // namespace novaria::net
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <limits>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -30,108 +31,261 @@ enum class ControlType : std::uint8_t {
     Syn = 1,
     Ack = 2,
     Heartbeat = 3,
+    StreamFeedback = 4,
 };
 
-wire::ByteBuffer BuildControlPayload(ControlType control_type) {
-    wire::ByteWriter writer;
-    writer.WriteU8(static_cast<wire::Byte>(control_type));
-    return writer.TakeBuffer();
+struct HeartbeatTiming final {
+    std::uint32_t sequence = 0;
+    std::uint64_t send_microseconds = 0;
+    std::uint64_t echo_microseconds = 0;
+    std::uint64_t echo_hold_microseconds = 0;
+    std::uint64_t tick_index = 0;
+};
+
+void WriteControlPayload(ControlType control_type, wire::GatherWriter& out_payload) {
+    out_payload.Clear();
+    out_payload.InlineWriter().WriteU8(static_cast<wire::Byte>(control_type));
+}
+
+void WriteHeartbeatPayload(const HeartbeatTiming& timing, wire::GatherWriter& out_payload) {
+    out_payload.Clear();
+    wire::ByteWriter& writer = out_payload.InlineWriter();
+    writer.WriteU8(static_cast<wire::Byte>(ControlType::Heartbeat));
+    writer.WriteVarUInt(timing.sequence);
+    writer.WriteVarUInt(timing.send_microseconds);
+    writer.WriteVarUInt(timing.echo_microseconds);
+    writer.WriteVarUInt(timing.echo_hold_microseconds);
+    writer.WriteVarUInt(timing.tick_index);
 }
 
-wire::ByteBuffer BuildControlDatagram(ControlType control_type) {
-    wire::ByteBuffer payload = BuildControlPayload(control_type);
-    wire::ByteBuffer datagram;
-    wire::EncodeEnvelopeV1(
-        wire::MessageKind::Control,
-        wire::ByteSpan(payload.data(), payload.size()),
-        datagram);
-    return datagram;
+void WriteStreamFeedbackPayload(const ChunkStreamFeedback& feedback, wire::GatherWriter& out_payload) {
+    out_payload.Clear();
+    wire::ByteWriter& writer = out_payload.InlineWriter();
+    writer.WriteU8(static_cast<wire::Byte>(ControlType::StreamFeedback));
+    writer.WriteVarUInt(feedback.acked_sequence);
+    writer.WriteVarUInt(feedback.lost_batch_count);
+    writer.WriteVarUInt(feedback.receive_window_chunks);
 }
 
-bool TryDecodeControlPayload(wire::ByteSpan payload, ControlType& out_control_type) {
-    if (payload.size() != 1) {
+bool TryDecodeStreamFeedback(wire::ByteReader& reader, ChunkStreamFeedback& out_feedback) {
+    std::uint64_t acked_sequence = 0;
+    ChunkStreamFeedback feedback{};
+    if (!reader.ReadVarUInt(acked_sequence) ||
+        acked_sequence == 0 ||
+        acked_sequence > std::numeric_limits<std::uint32_t>::max() ||
+        !reader.ReadVarUInt(feedback.lost_batch_count) ||
+        !reader.ReadVarUInt(feedback.receive_window_chunks) ||
+        !reader.IsFullyConsumed()) {
+        return false;
+    }
+
+    feedback.acked_sequence = static_cast<std::uint32_t>(acked_sequence);
+    out_feedback = feedback;
+    return true;
+}
+
+bool TryDecodeControlPayload(
+    wire::ByteSpan payload,
+    ControlType& out_control_type,
+    HeartbeatTiming& out_heartbeat_timing,
+    ChunkStreamFeedback& out_stream_feedback) {
+    wire::ByteReader reader(payload);
+    wire::Byte control_type = 0;
+    if (!reader.ReadU8(control_type)) {
         return false;
     }
 
-    out_control_type = static_cast<ControlType>(payload[0]);
+    out_control_type = static_cast<ControlType>(control_type);
     switch (out_control_type) {
         case ControlType::Syn:
         case ControlType::Ack:
         case ControlType::Heartbeat:
-            return true;
+            break;
+        case ControlType::StreamFeedback:
+            return TryDecodeStreamFeedback(reader, out_stream_feedback);
+        default:
+            return false;
+    }
+
+    out_heartbeat_timing = {};
+    if (reader.IsFullyConsumed()) {
+        return true;
+    }
+    if (out_control_type != ControlType::Heartbeat) {
+        return false;
+    }
+
+    std::uint64_t sequence = 0;
+    HeartbeatTiming timing{};
+    if (!reader.ReadVarUInt(sequence) ||
+        sequence == 0 ||
+        sequence > std::numeric_limits<std::uint32_t>::max() ||
+        !reader.ReadVarUInt(timing.send_microseconds) ||
+        !reader.ReadVarUInt(timing.echo_microseconds) ||
+        !reader.ReadVarUInt(timing.echo_hold_microseconds) ||
+        !reader.ReadVarUInt(timing.tick_index) ||
+        !reader.IsFullyConsumed()) {
+        return false;
     }
 
-    return false;
+    timing.sequence = static_cast<std::uint32_t>(sequence);
+    out_heartbeat_timing = timing;
+    return true;
 }
 
-wire::ByteBuffer BuildCommandPayload(const PlayerCommand& command) {
-    wire::ByteWriter writer;
-    writer.WriteVarUInt(command.player_id);
-    writer.WriteVarUInt(command.command_id);
-    writer.WriteBytes(wire::ByteSpan(command.payload.data(), command.payload.size()));
-    return writer.TakeBuffer();
+std::size_t MessageKindSlot(std::uint8_t kind) {
+    return kind < kNetMessageKindSlotCount ? kind : 0;
 }
 
-wire::ByteBuffer BuildCommandDatagram(const PlayerCommand& command) {
-    wire::ByteBuffer payload = BuildCommandPayload(command);
-    wire::ByteBuffer datagram;
-    wire::EncodeEnvelopeV1(
-        wire::MessageKind::Command,
-        wire::ByteSpan(payload.data(), payload.size()),
-        datagram);
-    return datagram;
+std::size_t DatagramSizeBucket(std::size_t datagram_size) {
+    for (std::size_t bucket = 0; bucket < kNetDatagramSizeBucketUpperBounds.size(); ++bucket) {
+        if (datagram_size <= kNetDatagramSizeBucketUpperBounds[bucket]) {
+            return bucket;
+        }
+    }
+    return kNetDatagramSizeBucketUpperBounds.size();
 }
 
-bool TryDecodeCommandPayload(wire::ByteSpan payload, PlayerCommand& out_command) {
-    wire::ByteReader reader(payload);
+void WriteCommandBatchPayload(
+    std::uint32_t player_id,
+    const std::vector<PlayerCommand>& unacked_commands,
+    std::size_t command_count,
+    wire::GatherWriter& out_payload) {
+    const std::size_t first_index = unacked_commands.size() - command_count;
+    out_payload.Clear();
+    wire::ByteWriter& writer = out_payload.InlineWriter();
+    writer.WriteVarUInt(player_id);
+    writer.WriteVarUInt(unacked_commands[first_index].sequence);
+    writer.WriteVarUInt(command_count);
+    std::uint64_t previous_target_tick = 0;
+    for (std::size_t index = first_index; index < unacked_commands.size(); ++index) {
+        const PlayerCommand& command = unacked_commands[index];
+        writer.WriteVarUInt(command.command_id);
+        writer.WriteVarUInt(command.target_tick - previous_target_tick);
+        previous_target_tick = command.target_tick;
+        writer.WriteVarUInt(command.payload.size());
+        out_payload.AppendExternal(wire::ByteSpan(command.payload.data(), command.payload.size()));
+    }
+}
+
+bool TryDecodeCommandBatchPayload(
+    wire::ByteSpan payload,
+    std::uint32_t& out_player_id,
+    std::vector<PlayerCommand>& out_commands) {
+    out_commands.clear();
 
+    wire::ByteReader reader(payload);
     std::uint64_t player_id = 0;
-    std::uint64_t command_id = 0;
-    wire::ByteSpan command_payload{};
+    std::uint64_t first_sequence = 0;
+    std::uint64_t command_count = 0;
     if (!reader.ReadVarUInt(player_id) ||
-        !reader.ReadVarUInt(command_id) ||
-        !reader.ReadBytes(command_payload) ||
-        !reader.IsFullyConsumed() ||
+        !reader.ReadVarUInt(first_sequence) ||
+        !reader.ReadVarUInt(command_count) ||
         player_id > std::numeric_limits<std::uint32_t>::max() ||
-        command_id > std::numeric_limits<std::uint32_t>::max()) {
+        first_sequence == 0 ||
+        command_count == 0 ||
+        command_count > NetServiceUdpPeer::kMaxRedundantCommandsPerDatagram ||
+        first_sequence + command_count - 1 > std::numeric_limits<std::uint32_t>::max()) {
         return false;
     }
 
-    out_command = PlayerCommand{
-        .player_id = static_cast<std::uint32_t>(player_id),
-        .command_id = static_cast<std::uint32_t>(command_id),
-        .payload = wire::ByteBuffer(command_payload.begin(), command_payload.end()),
-    };
+    out_commands.reserve(static_cast<std::size_t>(command_count));
+    std::uint64_t target_tick = 0;
+    for (std::uint64_t index = 0; index < command_count; ++index) {
+        std::uint64_t command_id = 0;
+        std::uint64_t target_tick_delta = 0;
+        wire::ByteSpan command_payload{};
+        if (!reader.ReadVarUInt(command_id) ||
+            !reader.ReadVarUInt(target_tick_delta) ||
+            !reader.ReadBytes(command_payload) ||
+            command_id > std::numeric_limits<std::uint32_t>::max() ||
+            target_tick_delta > std::numeric_limits<std::uint64_t>::max() - target_tick) {
+            return false;
+        }
+        target_tick += target_tick_delta;
+
+        out_commands.push_back(PlayerCommand{
+            .player_id = static_cast<std::uint32_t>(player_id),
+            .command_id = static_cast<std::uint32_t>(command_id),
+            .payload = wire::SmallByteBuffer(command_payload),
+            .sequence = static_cast<std::uint32_t>(first_sequence + index),
+            .target_tick = target_tick,
+        });
+    }
+
+    if (!reader.IsFullyConsumed()) {
+        return false;
+    }
+
+    out_player_id = static_cast<std::uint32_t>(player_id);
     return true;
 }
 
-wire::ByteBuffer BuildChunkSnapshotBatchDatagram(const std::vector<wire::ByteBuffer>& chunk_snapshots) {
-    wire::ByteWriter writer;
+void WriteChunkSnapshotBatchPayload(
+    const std::vector<CommandAck>& command_acks,
+    std::uint32_t stream_sequence,
+    std::span<const wire::ByteBuffer> chunk_snapshots,
+    wire::GatherWriter& out_payload) {
+    out_payload.Clear();
+    wire::ByteWriter& writer = out_payload.InlineWriter();
+    writer.WriteVarUInt(command_acks.size());
+    for (const CommandAck& command_ack : command_acks) {
+        writer.WriteVarUInt(command_ack.player_id);
+        writer.WriteVarUInt(command_ack.sequence);
+    }
+    writer.WriteVarUInt(stream_sequence);
     writer.WriteVarUInt(chunk_snapshots.size());
     for (const wire::ByteBuffer& chunk : chunk_snapshots) {
-        writer.WriteRawBytes(wire::ByteSpan(chunk.data(), chunk.size()));
+        out_payload.AppendExternal(wire::ByteSpan(chunk.data(), chunk.size()));
     }
-
-    wire::ByteBuffer datagram;
-    const wire::ByteBuffer& batch_payload = writer.Buffer();
-    wire::EncodeEnvelopeV1(
-        wire::MessageKind::ChunkSnapshotBatch,
-        wire::ByteSpan(batch_payload.data(), batch_payload.size()),
-        datagram);
-    return datagram;
 }
 
-bool TrySplitChunkSnapshotBatch(wire::ByteSpan payload, std::vector<wire::ByteBuffer>& out_chunks) {
+bool TrySplitChunkSnapshotBatch(
+    wire::ByteSpan payload,
+    std::vector<CommandAck>& out_command_acks,
+    std::uint32_t& out_stream_sequence,
+    std::vector<wire::ByteSpan>& out_chunks) {
+    out_command_acks.clear();
     out_chunks.clear();
 
     wire::ByteReader reader(payload);
+    std::uint64_t ack_count = 0;
+    if (!reader.ReadVarUInt(ack_count)) {
+        return false;
+    }
+    if (ack_count > NetServiceUdpPeer::kMaxCommandStreams) {
+        return false;
+    }
+
+    out_command_acks.reserve(static_cast<std::size_t>(ack_count));
+    for (std::uint64_t i = 0; i < ack_count; ++i) {
+        std::uint64_t player_id = 0;
+        std::uint64_t sequence = 0;
+        if (!reader.ReadVarUInt(player_id) ||
+            !reader.ReadVarUInt(sequence) ||
+            player_id > std::numeric_limits<std::uint32_t>::max() ||
+            sequence > std::numeric_limits<std::uint32_t>::max()) {
+            return false;
+        }
+
+        out_command_acks.push_back(CommandAck{
+            .player_id = static_cast<std::uint32_t>(player_id),
+            .sequence = static_cast<std::uint32_t>(sequence),
+        });
+    }
+
+    std::uint64_t stream_sequence = 0;
     std::uint64_t chunk_count = 0;
-    if (!reader.ReadVarUInt(chunk_count)) {
+    if (!reader.ReadVarUInt(stream_sequence) ||
+        !reader.ReadVarUInt(chunk_count)) {
         return false;
     }
-    if (chunk_count > NetServiceUdpPeer::kMaxPendingRemoteChunkPayloads) {
+    if (stream_sequence > std::numeric_limits<std::uint32_t>::max() ||
+        (stream_sequence == 0 && chunk_count != 0) ||
+        chunk_count > NetServiceUdpPeer::kMaxPendingRemoteChunkPayloads) {
         return false;
     }
+    out_stream_sequence = static_cast<std::uint32_t>(stream_sequence);
 
     out_chunks.reserve(static_cast<std::size_t>(chunk_count));
     for (std::uint64_t i = 0; i < chunk_count; ++i) {
@@ -162,19 +316,65 @@ bool TrySplitChunkSnapshotBatch(wire::ByteSpan payload, std::vector<wire::ByteBu
             return false;
         }
 
-        const wire::ByteSpan chunk_payload = payload.subspan(start_offset, end_offset - start_offset);
-        out_chunks.emplace_back(chunk_payload.begin(), chunk_payload.end());
+        out_chunks.push_back(payload.subspan(start_offset, end_offset - start_offset));
     }
 
     return reader.IsFullyConsumed();
 }
 
-std::string_view ToStringView(wire::ByteSpan bytes) {
-    return std::string_view(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+std::size_t VarUIntSize(std::uint64_t value) {
+    std::size_t size = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        ++size;
+    }
+    return size;
+}
+
+void WriteEntityStateBatchPayload(
+    std::uint64_t tick_index,
+    std::span<const wire::ByteSpan> entity_states,
+    wire::GatherWriter& out_payload) {
+    out_payload.Clear();
+    wire::ByteWriter& writer = out_payload.InlineWriter();
+    writer.WriteVarUInt(tick_index);
+    writer.WriteVarUInt(entity_states.size());
+    for (const wire::ByteSpan entity_state : entity_states) {
+        writer.WriteVarUInt(entity_state.size());
+        out_payload.AppendExternal(entity_state);
+    }
 }
 
-std::string_view ToStringView(const wire::ByteBuffer& bytes) {
-    return ToStringView(wire::ByteSpan(bytes.data(), bytes.size()));
+bool TryDecodeEntityStateBatchPayload(
+    wire::ByteSpan payload,
+    std::uint64_t& out_tick_index,
+    std::vector<wire::ByteBuffer>& out_entity_states) {
+    wire::ByteReader reader(payload);
+    std::uint64_t tick_index = 0;
+    std::uint64_t entity_state_count = 0;
+    if (!reader.ReadVarUInt(tick_index) ||
+        !reader.ReadVarUInt(entity_state_count) ||
+        entity_state_count > NetServiceUdpPeer::kMaxPendingRemoteEntityStates) {
+        return false;
+    }
+
+    // Assigning into the existing elements reuses the storage of a recycled batch.
+    out_entity_states.resize(static_cast<std::size_t>(entity_state_count));
+    for (wire::ByteBuffer& out_entity_state : out_entity_states) {
+        wire::ByteSpan entity_state{};
+        if (!reader.ReadBytes(entity_state)) {
+            return false;
+        }
+
+        out_entity_state.assign(entity_state.begin(), entity_state.end());
+    }
+
+    if (!reader.IsFullyConsumed()) {
+        return false;
+    }
+
+    out_tick_index = tick_index;
+    return true;
 }
 
 wire::ByteSpan ToByteSpan(std::string_view text) {
@@ -194,6 +394,11 @@ void NetServiceUdpPeer::TransitionSessionState(NetSessionState next_state, std::
     ++session_transition_count_;
     if (next_state == NetSessionState::Connected) {
         ++connected_transition_count_;
+    } else {
+        ResetCommandStreams();
+        ResetOutboundChannels();
+        ResetChunkStreamFlow();
+        tick_clock_.Reset();
     }
 
     core::Logger::Info(
@@ -207,14 +412,20 @@ void NetServiceUdpPeer::TransitionSessionState(NetSessionState next_state, std::
 bool NetServiceUdpPeer::Initialize(std::string& out_error) {
     session_state_ = NetSessionState::Disconnected;
     pending_remote_commands_.clear();
+    pending_remote_command_counts_.clear();
     pending_remote_chunk_payloads_.clear();
+    pending_remote_entity_state_batches_.clear();
+    pending_remote_entity_state_count_ = 0;
     total_processed_command_count_ = 0;
     dropped_command_count_ = 0;
     dropped_remote_chunk_payload_count_ = 0;
     dropped_command_disconnected_count_ = 0;
     dropped_command_queue_full_count_ = 0;
+    dropped_command_player_queue_full_count_ = 0;
+    player_command_drops_.clear();
     dropped_remote_chunk_payload_disconnected_count_ = 0;
     dropped_remote_chunk_payload_queue_full_count_ = 0;
+    dropped_remote_entity_state_count_ = 0;
     unsent_command_count_ = 0;
     unsent_command_disconnected_count_ = 0;
     unsent_command_self_suppressed_count_ = 0;
@@ -223,6 +434,12 @@ bool NetServiceUdpPeer::Initialize(std::string& out_error) {
     unsent_snapshot_disconnected_count_ = 0;
     unsent_snapshot_self_suppressed_count_ = 0;
     unsent_snapshot_send_failure_count_ = 0;
+    unsent_entity_state_count_ = 0;
+    redundant_command_send_count_ = 0;
+    duplicate_command_count_ = 0;
+    lost_command_count_ = 0;
+    unacked_command_overflow_count_ = 0;
+    evicted_command_stream_count_ = 0;
     connect_request_count_ = 0;
     connect_probe_send_count_ = 0;
     connect_probe_send_failure_count_ = 0;
@@ -243,7 +460,33 @@ bool NetServiceUdpPeer::Initialize(std::string& out_error) {
     connect_probe_interval_ticks_ = kConnectProbeIntervalTicks;
     last_sent_heartbeat_tick_ = kInvalidTick;
     handshake_ack_received_ = false;
-
+    ResetCommandStreams();
+    link_estimator_.Reset();
+    tick_clock_.Reset();
+    tick_delta_seconds_ = 1.0 / 60.0;
+    link_clock_epoch_ = std::chrono::steady_clock::now();
+    next_heartbeat_sequence_ = 1;
+    pending_heartbeat_echo_microseconds_ = 0;
+    pending_heartbeat_echo_received_microseconds_ = 0;
+    traffic_by_kind_ = {};
+    sent_datagram_size_histogram_ = {};
+    channel_diagnostics_ = {};
+    ResetOutboundChannels();
+    current_tick_index_ = 0;
+    congestion_controller_.Configure(channel_settings_.congestion);
+    chunk_stream_flow_diagnostics_ = {};
+    ResetChunkStreamFlow();
+    ResetChannelSendBudgets();
+
+    if (!ValidateNetworkImpairmentSettings(impairment_settings_, out_error)) {
+        initialized_ = false;
+        return false;
+    }
+    if (!ValidateNetChannelSettings(channel_settings_, out_error)) {
+        initialized_ = false;
+        return false;
+    }
+    transport_.SetImpairment(impairment_settings_);
     if (!transport_.Open(bind_host_, bind_port_, out_error)) {
         initialized_ = false;
         return false;
@@ -265,6 +508,21 @@ bool NetServiceUdpPeer::Initialize(std::string& out_error) {
             std::to_string(transport_.LocalPort()) +
             ", remote=" + remote_endpoint_.host +
             ":" + std::to_string(remote_endpoint_.port) + ".");
+    if (impairment_settings_.enabled) {
+        core::Logger::Warn(
+            "net",
+            "Network impairment enabled: seed=" + std::to_string(impairment_settings_.seed) +
+                ", latency_ms=" + std::to_string(impairment_settings_.latency_ms) +
+                ", jitter_ms=" + std::to_string(impairment_settings_.jitter_ms) +
+                ", loss=" + std::to_string(impairment_settings_.loss_rate) +
+                ", burst(enter/exit/loss)=" + std::to_string(impairment_settings_.burst_enter_rate) + "/" +
+                std::to_string(impairment_settings_.burst_exit_rate) + "/" +
+                std::to_string(impairment_settings_.burst_loss_rate) +
+                ", duplicate=" + std::to_string(impairment_settings_.duplicate_rate) +
+                ", reorder=" + std::to_string(impairment_settings_.reorder_rate) +
+                ", bandwidth_bytes_per_second=" +
+                std::to_string(impairment_settings_.bandwidth_bytes_per_second) + ".");
+    }
     return true;
 }
 
@@ -275,7 +533,10 @@ void NetServiceUdpPeer::Shutdown() {
 
     TransitionSessionState(NetSessionState::Disconnected, "shutdown");
     pending_remote_commands_.clear();
+    pending_remote_command_counts_.clear();
     pending_remote_chunk_payloads_.clear();
+    pending_remote_entity_state_batches_.clear();
+    pending_remote_entity_state_count_ = 0;
     last_published_encoded_chunks_.clear();
     last_heartbeat_tick_ = kInvalidTick;
     connect_started_tick_ = kInvalidTick;
@@ -318,7 +579,10 @@ void NetServiceUdpPeer::RequestDisconnect() {
     ++manual_disconnect_count_;
     TransitionSessionState(NetSessionState::Disconnected, "request_disconnect");
     pending_remote_commands_.clear();
+    pending_remote_command_counts_.clear();
     pending_remote_chunk_payloads_.clear();
+    pending_remote_entity_state_batches_.clear();
+    pending_remote_entity_state_count_ = 0;
     last_heartbeat_tick_ = kInvalidTick;
     connect_started_tick_ = kInvalidTick;
     next_connect_probe_tick_ = kInvalidTick;
@@ -345,6 +609,23 @@ NetSessionState NetServiceUdpPeer::SessionState() const {
 }
 
 NetDiagnosticsSnapshot NetServiceUdpPeer::DiagnosticsSnapshot() const {
+    const NetworkImpairmentDiagnostics impairment = transport_.ImpairmentDiagnostics();
+    const NetLinkQuality& link_quality = link_estimator_.Quality();
+    const NetTickClockState& tick_clock = tick_clock_.State();
+    std::array<NetChannelDiagnostics, kNetChannelCount> channels = channel_diagnostics_;
+    channels[static_cast<std::size_t>(NetChannel::Command)].pending_receive_count = pending_remote_commands_.size();
+    channels[static_cast<std::size_t>(NetChannel::EntityState)].pending_receive_count =
+        pending_remote_entity_state_count_;
+    channels[static_cast<std::size_t>(NetChannel::ChunkStream)].pending_receive_count =
+        pending_remote_chunk_payloads_.size();
+    channels[static_cast<std::size_t>(NetChannel::ChunkStream)].queued_send_count =
+        outbound_chunk_queue_.size() - outbound_chunk_queue_head_;
+    NetChunkStreamFlowDiagnostics chunk_stream_flow = chunk_stream_flow_diagnostics_;
+    chunk_stream_flow.congestion_window_bytes_per_tick = congestion_controller_.WindowBytesPerTick();
+    chunk_stream_flow.congestion_loss_event_count = congestion_controller_.LossEventCount();
+    chunk_stream_flow.in_flight_batch_count = in_flight_chunk_batches_.size();
+    chunk_stream_flow.in_flight_chunk_count = in_flight_chunk_count_;
+    chunk_stream_flow.remote_receive_window_chunks = remote_chunk_stream_window_;
     return NetDiagnosticsSnapshot{
         .session_state = session_state_,
         .last_session_transition_reason = last_session_transition_reason_,
@@ -361,9 +642,11 @@ NetDiagnosticsSnapshot NetServiceUdpPeer::DiagnosticsSnapshot() const {
         .dropped_command_count = dropped_command_count_,
         .dropped_command_disconnected_count = dropped_command_disconnected_count_,
         .dropped_command_queue_full_count = dropped_command_queue_full_count_,
+        .dropped_command_player_queue_full_count = dropped_command_player_queue_full_count_,
         .dropped_remote_chunk_payload_count = dropped_remote_chunk_payload_count_,
         .dropped_remote_chunk_payload_disconnected_count = dropped_remote_chunk_payload_disconnected_count_,
         .dropped_remote_chunk_payload_queue_full_count = dropped_remote_chunk_payload_queue_full_count_,
+        .dropped_remote_entity_state_count = dropped_remote_entity_state_count_,
         .unsent_command_count = unsent_command_count_,
         .unsent_command_disconnected_count = unsent_command_disconnected_count_,
         .unsent_command_self_suppressed_count = unsent_command_self_suppressed_count_,
@@ -372,6 +655,37 @@ NetDiagnosticsSnapshot NetServiceUdpPeer::DiagnosticsSnapshot() const {
         .unsent_snapshot_disconnected_count = unsent_snapshot_disconnected_count_,
         .unsent_snapshot_self_suppressed_count = unsent_snapshot_self_suppressed_count_,
         .unsent_snapshot_send_failure_count = unsent_snapshot_send_failure_count_,
+        .unsent_entity_state_count = unsent_entity_state_count_,
+        .redundant_command_send_count = redundant_command_send_count_,
+        .duplicate_command_count = duplicate_command_count_,
+        .lost_command_count = lost_command_count_,
+        .unacked_command_overflow_count = unacked_command_overflow_count_,
+        .evicted_command_stream_count = evicted_command_stream_count_,
+        .impairment_dropped_datagram_count =
+            impairment.dropped_loss_count +
+            impairment.dropped_burst_loss_count +
+            impairment.dropped_queue_full_count,
+        .impairment_duplicated_datagram_count = impairment.duplicated_datagram_count,
+        .impairment_reordered_datagram_count = impairment.reordered_datagram_count,
+        .impairment_queued_datagram_count = impairment.queued_datagram_count,
+        .rtt_sample_count = link_quality.rtt_sample_count,
+        .last_rtt_microseconds = link_quality.last_rtt_microseconds,
+        .smoothed_rtt_microseconds = link_quality.smoothed_rtt_microseconds,
+        .rtt_variance_microseconds = link_quality.rtt_variance_microseconds,
+        .min_rtt_microseconds = link_quality.min_rtt_microseconds,
+        .heartbeat_received_count = link_quality.heartbeat_received_count,
+        .heartbeat_lost_count = link_quality.heartbeat_lost_count,
+        .estimated_loss_rate = link_quality.estimated_loss_rate,
+        .tick_clock_synced = tick_clock_.IsSynced(),
+        .tick_clock_sample_count = tick_clock.sample_count,
+        .tick_clock_resync_count = tick_clock.resync_count,
+        .remote_tick_offset = tick_clock.remote_tick_offset,
+        .one_way_delay_ticks = tick_clock.one_way_delay_ticks,
+        .traffic_by_kind = traffic_by_kind_,
+        .sent_datagram_size_histogram = sent_datagram_size_histogram_,
+        .channels = channels,
+        .chunk_stream_flow = chunk_stream_flow,
+        .player_command_drops = player_command_drops_,
     };
 }
 
@@ -380,7 +694,14 @@ void NetServiceUdpPeer::Tick(const core::TickContext& tick_context) {
         return;
     }
 
+    current_tick_index_ = tick_context.tick_index;
+    if (tick_context.fixed_delta_seconds > 0.0) {
+        tick_delta_seconds_ = tick_context.fixed_delta_seconds;
+    }
+    ResetChannelSendBudgets();
+    SendPendingCommandAck();
     DrainInboundDatagrams(tick_context.tick_index);
+    SendPendingChunkStreamFeedback(tick_context.tick_index);
 
     if (session_state_ == NetSessionState::Connecting) {
         if (connect_started_tick_ == kInvalidTick) {
@@ -391,9 +712,9 @@ void NetServiceUdpPeer::Tick(const core::TickContext& tick_context) {
         if (next_connect_probe_tick_ == kInvalidTick ||
             tick_context.tick_index >= next_connect_probe_tick_) {
             ++connect_probe_send_count_;
-            std::string send_error;
-            if (!SendControlDatagram(static_cast<std::uint8_t>(ControlType::Syn), send_error)) {
-                core::Logger::Warn("net", "UDP connect probe failed: " + send_error);
+            const core::Status send_status = SendControlDatagram(static_cast<std::uint8_t>(ControlType::Syn));
+            if (!send_status) {
+                core::Logger::Warn("net", "UDP connect probe failed: " + send_status.Message());
                 ++connect_probe_send_failure_count_;
             }
             next_connect_probe_tick_ = tick_context.tick_index + connect_probe_interval_ticks_;
@@ -412,7 +733,10 @@ void NetServiceUdpPeer::Tick(const core::TickContext& tick_context) {
                    tick_context.tick_index > connect_started_tick_ + kConnectTimeoutTicks) {
             TransitionSessionState(NetSessionState::Disconnected, "connect_timeout");
             pending_remote_commands_.clear();
+            pending_remote_command_counts_.clear();
             pending_remote_chunk_payloads_.clear();
+            pending_remote_entity_state_batches_.clear();
+            pending_remote_entity_state_count_ = 0;
             last_heartbeat_tick_ = kInvalidTick;
             connect_started_tick_ = kInvalidTick;
             next_connect_probe_tick_ = kInvalidTick;
@@ -426,7 +750,10 @@ void NetServiceUdpPeer::Tick(const core::TickContext& tick_context) {
         tick_context.tick_index > last_heartbeat_tick_ + kHeartbeatTimeoutTicks) {
         TransitionSessionState(NetSessionState::Disconnected, "heartbeat_timeout");
         pending_remote_commands_.clear();
+        pending_remote_command_counts_.clear();
         pending_remote_chunk_payloads_.clear();
+        pending_remote_entity_state_batches_.clear();
+        pending_remote_entity_state_count_ = 0;
         last_heartbeat_tick_ = kInvalidTick;
         connect_started_tick_ = kInvalidTick;
         next_connect_probe_tick_ = kInvalidTick;
@@ -435,74 +762,125 @@ void NetServiceUdpPeer::Tick(const core::TickContext& tick_context) {
         ++timeout_disconnect_count_;
     }
 
+    // Until the tick clock has enough samples, heartbeats double as a fast clock-sync handshake.
+    const std::uint64_t heartbeat_interval_ticks =
+        tick_clock_.IsSynced() ? kHeartbeatSendIntervalTicks : kClockSyncHeartbeatIntervalTicks;
     if (session_state_ == NetSessionState::Connected &&
         (last_sent_heartbeat_tick_ == kInvalidTick ||
-            tick_context.tick_index >= last_sent_heartbeat_tick_ + kHeartbeatSendIntervalTicks)) {
-        std::string heartbeat_error;
-        if (!SendControlDatagram(static_cast<std::uint8_t>(ControlType::Heartbeat), heartbeat_error)) {
-            core::Logger::Warn("net", "UDP heartbeat send failed: " + heartbeat_error);
+            tick_context.tick_index >= last_sent_heartbeat_tick_ + heartbeat_interval_ticks)) {
+        const core::Status heartbeat_status = SendHeartbeatDatagram();
+        if (!heartbeat_status) {
+            core::Logger::Warn("net", "UDP heartbeat send failed: " + heartbeat_status.Message());
         } else {
             last_sent_heartbeat_tick_ = tick_context.tick_index;
         }
     }
+
+    FlushChunkStream();
 }
 
-void NetServiceUdpPeer::SubmitLocalCommand(const PlayerCommand& command) {
+std::uint32_t NetServiceUdpPeer::SubmitLocalCommand(PlayerCommand command) {
     if (!initialized_) {
-        return;
+        return 0;
     }
 
-    if (pending_remote_commands_.size() >= kMaxPendingCommands) {
+    if (pending_remote_commands_.size() >= ReceiveQueueLimit(NetChannel::Command)) {
         ++dropped_command_count_;
         ++dropped_command_queue_full_count_;
-        return;
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::Command)].receive_queue_full_drop_count;
+        return 0;
     }
 
-    pending_remote_commands_.push_back(command);
+    const std::uint32_t player_id = command.player_id;
+    pending_remote_commands_.push_back(std::move(command));
 
     if (session_state_ != NetSessionState::Connected) {
         ++unsent_command_count_;
         ++unsent_command_disconnected_count_;
-        return;
+        return 0;
     }
 
     if (IsSelfEndpoint()) {
         ++unsent_command_count_;
         ++unsent_command_self_suppressed_count_;
-        return;
+        return 0;
+    }
+
+    OutboundCommandStream& stream = outbound_command_streams_[player_id];
+    PlayerCommand& sequenced_command = pending_remote_commands_.back();
+    sequenced_command.sequence = stream.next_sequence++;
+    const std::uint32_t assigned_sequence = sequenced_command.sequence;
+    stream.unacked_commands.push_back(sequenced_command);
+    if (tick_clock_.IsSynced()) {
+        // Only the outbound copy is stamped; the local echo already runs on this peer's clock.
+        stream.last_target_tick = std::max(
+            tick_clock_.PredictArrivalTick(current_tick_index_ + 1),
+            stream.last_target_tick);
+        stream.unacked_commands.back().target_tick = stream.last_target_tick;
+    }
+    if (stream.unacked_commands.size() > kMaxUnackedCommandsPerPlayer) {
+        stream.unacked_commands.erase(stream.unacked_commands.begin());
+        ++unacked_command_overflow_count_;
+    }
+
+    const std::size_t carried_command_count =
+        std::min(stream.unacked_commands.size(), kMaxRedundantCommandsPerDatagram);
+    WriteCommandBatchPayload(player_id, stream.unacked_commands, carried_command_count, gather_payload_);
+    if (!HasSendBudget(NetChannel::Command, gather_payload_.Size())) {
+        // Stays in unacked_commands and rides along with the next command datagram.
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::Command)].budget_deferred_count;
+        return assigned_sequence;
     }
 
-    std::string send_error;
-    const wire::ByteBuffer datagram = BuildCommandDatagram(command);
-    if (!SendDatagram(datagram, send_error)) {
+    const core::Status send_status = SendGatherDatagram(NetChannel::Command, wire::MessageKind::Command);
+    if (!send_status) {
         ++unsent_command_count_;
         ++unsent_command_send_failure_count_;
-        core::Logger::Warn("net", "UDP command send failed: " + send_error);
+        core::Logger::Warn("net", "UDP command send failed: " + send_status.Message());
+        return assigned_sequence;
     }
+
+    redundant_command_send_count_ += carried_command_count - 1;
+    return assigned_sequence;
 }
 
-std::vector<PlayerCommand> NetServiceUdpPeer::ConsumeRemoteCommands() {
+void NetServiceUdpPeer::ConsumeRemoteCommands(std::vector<PlayerCommand>& out_commands) {
+    out_commands.clear();
     if (!initialized_) {
-        return {};
+        return;
     }
 
-    std::vector<PlayerCommand> commands = std::move(pending_remote_commands_);
-    pending_remote_commands_.clear();
-    total_processed_command_count_ += commands.size();
-    return commands;
+    out_commands.swap(pending_remote_commands_);
+    total_processed_command_count_ += out_commands.size();
+    pending_remote_command_counts_.clear();
 }
 
-std::vector<wire::ByteBuffer> NetServiceUdpPeer::ConsumeRemoteChunkPayloads() {
+void NetServiceUdpPeer::ConsumeRemoteChunkPayloads(std::vector<wire::ByteBuffer>& out_payloads) {
+    RecyclePayloadBuffers(out_payloads);
     if (!initialized_) {
-        return {};
+        return;
     }
     if (session_state_ != NetSessionState::Connected) {
-        return {};
+        return;
     }
 
-    std::vector<wire::ByteBuffer> payloads = std::move(pending_remote_chunk_payloads_);
-    pending_remote_chunk_payloads_.clear();
-    return payloads;
+    out_payloads.swap(pending_remote_chunk_payloads_);
+}
+
+void NetServiceUdpPeer::ConsumeRemoteEntityStates(std::vector<EntityStateBatch>& out_batches) {
+    for (EntityStateBatch& batch : out_batches) {
+        RecycleEntityStateBatch(batch);
+    }
+    out_batches.clear();
+    if (!initialized_) {
+        return;
+    }
+    if (session_state_ != NetSessionState::Connected) {
+        return;
+    }
+
+    out_batches.swap(pending_remote_entity_state_batches_);
+    pending_remote_entity_state_count_ = 0;
 }
 
 void NetServiceUdpPeer::PublishWorldSnapshot(
@@ -518,6 +896,7 @@ void NetServiceUdpPeer::PublishWorldSnapshot(
         return;
     }
 
+    current_tick_index_ = std::max(current_tick_index_, tick_index);
     last_published_snapshot_tick_ = tick_index;
     last_published_dirty_chunk_count_ = encoded_dirty_chunks.size();
     last_published_encoded_chunks_ = encoded_dirty_chunks;
@@ -527,17 +906,90 @@ void NetServiceUdpPeer::PublishWorldSnapshot(
         unsent_snapshot_payload_count_ += encoded_dirty_chunks.size();
         unsent_snapshot_self_suppressed_count_ += encoded_dirty_chunks.size();
         for (const auto& payload : encoded_dirty_chunks) {
-            EnqueueRemoteChunkPayload(payload);
+            EnqueueRemoteChunkPayload(wire::ByteSpan(payload.data(), payload.size()));
         }
         return;
     }
 
-    const wire::ByteBuffer datagram = BuildChunkSnapshotBatchDatagram(encoded_dirty_chunks);
-    std::string send_error;
-    if (!SendDatagram(datagram, send_error)) {
-        unsent_snapshot_payload_count_ += encoded_dirty_chunks.size();
-        unsent_snapshot_send_failure_count_ += encoded_dirty_chunks.size();
-        core::Logger::Warn("net", "UDP snapshot publish failed: " + send_error);
+    NetChannelDiagnostics& chunk_channel =
+        channel_diagnostics_[static_cast<std::size_t>(NetChannel::ChunkStream)];
+    for (const wire::ByteBuffer& payload : encoded_dirty_chunks) {
+        if (outbound_chunk_queue_.size() - outbound_chunk_queue_head_ >=
+            channel_settings_.max_queued_chunk_payloads) {
+            ++unsent_snapshot_payload_count_;
+            ++chunk_channel.send_queue_full_drop_count;
+            continue;
+        }
+        outbound_chunk_queue_.push_back(TakeRecycledPayloadBuffer(wire::ByteSpan(payload.data(), payload.size())));
+    }
+
+    FlushChunkStream();
+}
+
+void NetServiceUdpPeer::PublishEntityStates(
+    std::uint64_t tick_index,
+    const std::vector<wire::ByteBuffer>& encoded_entity_states,
+    const std::vector<std::uint32_t>& recipient_player_ids) {
+    if (!initialized_ || encoded_entity_states.empty()) {
+        return;
+    }
+
+    if (session_state_ != NetSessionState::Connected ||
+        IsSelfEndpoint() ||
+        recipient_player_ids.size() != encoded_entity_states.size()) {
+        unsent_entity_state_count_ += encoded_entity_states.size();
+        return;
+    }
+
+    // A client delta leaves only toward the endpoint its player's commands arrive from.
+    outbound_entity_state_scratch_.clear();
+    for (std::size_t index = 0; index < encoded_entity_states.size(); ++index) {
+        const std::uint32_t recipient_player_id = recipient_player_ids[index];
+        if (recipient_player_id != kBroadcastEntityStateRecipient &&
+            !inbound_command_streams_.contains(recipient_player_id)) {
+            continue;
+        }
+        const wire::ByteBuffer& entity_state = encoded_entity_states[index];
+        outbound_entity_state_scratch_.emplace_back(entity_state.data(), entity_state.size());
+    }
+
+    NetChannelDiagnostics& entity_state_channel =
+        channel_diagnostics_[static_cast<std::size_t>(NetChannel::EntityState)];
+    const std::size_t header_bytes =
+        VarUIntSize(tick_index) + VarUIntSize(outbound_entity_state_scratch_.size());
+    std::size_t batch_begin = 0;
+    while (batch_begin < outbound_entity_state_scratch_.size()) {
+        std::size_t batch_end = batch_begin;
+        std::size_t batch_bytes = header_bytes;
+        while (batch_end < outbound_entity_state_scratch_.size()) {
+            const std::size_t state_size = outbound_entity_state_scratch_[batch_end].size();
+            const std::size_t framed_size = VarUIntSize(state_size) + state_size;
+            if (batch_end != batch_begin &&
+                batch_bytes + framed_size > channel_settings_.max_entity_state_datagram_bytes) {
+                break;
+            }
+            batch_bytes += framed_size;
+            ++batch_end;
+        }
+
+        const std::span<const wire::ByteSpan> batch(
+            outbound_entity_state_scratch_.data() + batch_begin,
+            batch_end - batch_begin);
+        WriteEntityStateBatchPayload(tick_index, batch, gather_payload_);
+        if (!HasSendBudget(NetChannel::EntityState, gather_payload_.Size())) {
+            // Entity states are superseded every tick, so over-budget datagrams are dropped, not queued.
+            unsent_entity_state_count_ += outbound_entity_state_scratch_.size() - batch_begin;
+            ++entity_state_channel.budget_deferred_count;
+            return;
+        }
+
+        const core::Status send_status =
+            SendGatherDatagram(NetChannel::EntityState, wire::MessageKind::EntityStateBatch);
+        if (!send_status) {
+            unsent_entity_state_count_ += batch.size();
+            core::Logger::Warn("net", "UDP entity state publish failed: " + send_status.Message());
+        }
+        batch_begin = batch_end;
     }
 }
 
@@ -573,6 +1025,21 @@ void NetServiceUdpPeer::SetRemoteEndpoint(UdpEndpoint endpoint) {
     remote_endpoint_ = std::move(endpoint);
 }
 
+void NetServiceUdpPeer::SetImpairment(const NetworkImpairmentSettings& settings) {
+    impairment_settings_ = settings;
+    if (initialized_) {
+        transport_.SetImpairment(impairment_settings_);
+    }
+}
+
+void NetServiceUdpPeer::SetChannelSettings(const NetChannelSettings& settings) {
+    if (initialized_) {
+        return;
+    }
+
+    channel_settings_ = settings;
+}
+
 UdpEndpoint NetServiceUdpPeer::RemoteEndpoint() const {
     return remote_endpoint_;
 }
@@ -625,57 +1092,491 @@ bool NetServiceUdpPeer::TryAdoptDynamicPeerFromSyn(const UdpEndpoint& sender) {
     return true;
 }
 
-void NetServiceUdpPeer::EnqueueRemoteCommand(PlayerCommand command) {
+bool NetServiceUdpPeer::EnqueueRemoteCommand(PlayerCommand command) {
     if (session_state_ != NetSessionState::Connected) {
         ++dropped_command_count_;
         ++dropped_command_disconnected_count_;
-        return;
+        return false;
     }
 
-    if (pending_remote_commands_.size() >= kMaxPendingCommands) {
+    if (pending_remote_commands_.size() >= ReceiveQueueLimit(NetChannel::Command)) {
         ++dropped_command_count_;
         ++dropped_command_queue_full_count_;
-        return;
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::Command)].receive_queue_full_drop_count;
+        return false;
+    }
+
+    if (!ReservePlayerCommandSlot(command.player_id)) {
+        ++dropped_command_count_;
+        ++dropped_command_player_queue_full_count_;
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::Command)].receive_queue_full_drop_count;
+        RecordPlayerCommandQueueFullDrop(command.player_id);
+        return false;
     }
 
     pending_remote_commands_.push_back(std::move(command));
+    return true;
+}
+
+bool NetServiceUdpPeer::ReservePlayerCommandSlot(std::uint32_t player_id) {
+    // A flooding peer fills its own share of the receive queue instead of starving other players.
+    for (auto& [pending_player_id, pending_count] : pending_remote_command_counts_) {
+        if (pending_player_id == player_id) {
+            if (pending_count >= kMaxPendingCommandsPerPlayer) {
+                return false;
+            }
+            ++pending_count;
+            return true;
+        }
+    }
+
+    pending_remote_command_counts_.emplace_back(player_id, 1);
+    return true;
+}
+
+void NetServiceUdpPeer::RecordPlayerCommandQueueFullDrop(std::uint32_t player_id) {
+    for (NetPlayerCommandDrops& drops : player_command_drops_) {
+        if (drops.player_id == player_id) {
+            ++drops.dropped_queue_full_count;
+            return;
+        }
+    }
+
+    // Past the entry cap a flooding player is only visible in the aggregate counter.
+    if (player_command_drops_.size() < kMaxPlayerCommandDropEntries) {
+        player_command_drops_.push_back({.player_id = player_id, .dropped_queue_full_count = 1});
+    }
+}
+
+void NetServiceUdpPeer::AcceptRemoteCommandBatch(
+    std::uint32_t player_id,
+    std::vector<PlayerCommand>& commands) {
+    if (session_state_ != NetSessionState::Connected) {
+        dropped_command_count_ += commands.size();
+        dropped_command_disconnected_count_ += commands.size();
+        return;
+    }
+
+    auto stream_it = inbound_command_streams_.find(player_id);
+    if (stream_it == inbound_command_streams_.end()) {
+        if (inbound_command_streams_.size() >= kMaxCommandStreams && !EvictIdleInboundCommandStream()) {
+            dropped_command_count_ += commands.size();
+            return;
+        }
+        stream_it = inbound_command_streams_.emplace(player_id, InboundCommandStream{}).first;
+    }
+
+    stream_it->second.last_received_tick = current_tick_index_;
+    std::uint32_t& received_sequence = stream_it->second.received_sequence;
+    for (PlayerCommand& command : commands) {
+        if (command.sequence <= received_sequence) {
+            ++duplicate_command_count_;
+            continue;
+        }
+
+        const std::uint32_t sequence = command.sequence;
+        const std::uint32_t skipped_count = sequence - received_sequence - 1;
+        if (!EnqueueRemoteCommand(std::move(command))) {
+            // Leave the sequence unacked so the sender's redundant copies can still deliver it after a drain.
+            break;
+        }
+
+        lost_command_count_ += skipped_count;
+        received_sequence = sequence;
+        command_ack_pending_ = true;
+    }
+}
+
+bool NetServiceUdpPeer::EvictIdleInboundCommandStream() {
+    auto idle_it = std::min_element(
+        inbound_command_streams_.begin(),
+        inbound_command_streams_.end(),
+        [](const auto& lhs, const auto& rhs) {
+            return lhs.second.last_received_tick < rhs.second.last_received_tick;
+        });
+    if (idle_it == inbound_command_streams_.end() ||
+        current_tick_index_ - idle_it->second.last_received_tick < kIdleCommandStreamTicks) {
+        return false;
+    }
+
+    // Players that left stop sending; their slot goes to a newcomer instead of locking the table at its cap.
+    inbound_command_streams_.erase(idle_it);
+    ++evicted_command_stream_count_;
+    return true;
 }
 
-void NetServiceUdpPeer::EnqueueRemoteChunkPayload(wire::ByteBuffer payload) {
+void NetServiceUdpPeer::ApplyCommandAcks(const std::vector<CommandAck>& command_acks) {
+    for (const CommandAck& command_ack : command_acks) {
+        auto stream_it = outbound_command_streams_.find(command_ack.player_id);
+        if (stream_it == outbound_command_streams_.end()) {
+            continue;
+        }
+
+        std::vector<PlayerCommand>& unacked_commands = stream_it->second.unacked_commands;
+        unacked_commands.erase(
+            unacked_commands.begin(),
+            std::find_if(
+                unacked_commands.begin(),
+                unacked_commands.end(),
+                [&command_ack](const PlayerCommand& command) { return command.sequence > command_ack.sequence; }));
+    }
+}
+
+const std::vector<CommandAck>& NetServiceUdpPeer::BuildCommandAcks() {
+    std::vector<CommandAck>& command_acks = command_ack_scratch_;
+    command_acks.clear();
+    for (const auto& [player_id, stream] : inbound_command_streams_) {
+        command_acks.push_back(CommandAck{
+            .player_id = player_id,
+            .sequence = stream.received_sequence,
+        });
+    }
+
+    std::sort(
+        command_acks.begin(),
+        command_acks.end(),
+        [](const CommandAck& lhs, const CommandAck& rhs) {
+            return lhs.player_id < rhs.player_id;
+        });
+    return command_acks;
+}
+
+void NetServiceUdpPeer::ResetCommandStreams() {
+    outbound_command_streams_.clear();
+    inbound_command_streams_.clear();
+    command_ack_pending_ = false;
+    last_received_entity_state_tick_ = kInvalidTick;
+}
+
+void NetServiceUdpPeer::ResetOutboundChannels() {
+    RecyclePayloadBuffers(outbound_chunk_queue_);
+    outbound_chunk_queue_head_ = 0;
+}
+
+void NetServiceUdpPeer::ResetChannelSendBudgets() {
+    for (std::size_t index = 0; index < kNetChannelCount; ++index) {
+        channel_send_budget_limit_[index] = channel_settings_.channels[index].send_budget_bytes_per_tick;
+    }
+    if (channel_settings_.congestion.enabled) {
+        // The congestion window narrows the configured chunk stream budget, which stays a hard cap.
+        std::size_t& chunk_limit = channel_send_budget_limit_[static_cast<std::size_t>(NetChannel::ChunkStream)];
+        const std::size_t window = congestion_controller_.WindowBytesPerTick();
+        chunk_limit = chunk_limit == 0 ? window : std::min(chunk_limit, window);
+    }
+    channel_send_budget_remaining_ = channel_send_budget_limit_;
+}
+
+bool NetServiceUdpPeer::HasSendBudget(NetChannel channel, std::size_t payload_size) const {
+    const std::size_t channel_index = static_cast<std::size_t>(channel);
+    const std::size_t budget = channel_send_budget_limit_[channel_index];
+    const std::size_t remaining = channel_send_budget_remaining_[channel_index];
+    // A zero budget means unlimited; an untouched budget always admits one datagram so that a
+    // payload larger than the whole per-tick budget still makes progress.
+    return budget == 0 || remaining == budget || payload_size <= remaining;
+}
+
+std::size_t NetServiceUdpPeer::ReceiveQueueLimit(NetChannel channel) const {
+    return channel_settings_.Budget(channel).receive_queue_limit;
+}
+
+void NetServiceUdpPeer::FlushChunkStream() {
+    if (!initialized_ ||
+        session_state_ != NetSessionState::Connected ||
+        IsSelfEndpoint()) {
+        return;
+    }
+
+    const bool flow_controlled = channel_settings_.congestion.enabled;
+    if (flow_controlled) {
+        ExpireInFlightChunkBatches();
+    }
+
+    NetChannelDiagnostics& chunk_channel =
+        channel_diagnostics_[static_cast<std::size_t>(NetChannel::ChunkStream)];
+    while (outbound_chunk_queue_head_ < outbound_chunk_queue_.size()) {
+        std::size_t max_batch_chunks = outbound_chunk_queue_.size() - outbound_chunk_queue_head_;
+        if (flow_controlled) {
+            const std::size_t open_window =
+                remote_chunk_stream_window_ > in_flight_chunk_count_
+                    ? remote_chunk_stream_window_ - in_flight_chunk_count_
+                    : 0;
+            if (open_window == 0) {
+                ++chunk_stream_flow_diagnostics_.receive_window_deferred_count;
+                break;
+            }
+            max_batch_chunks = std::min(max_batch_chunks, open_window);
+        }
+
+        const std::size_t batch_limit = outbound_chunk_queue_head_ + max_batch_chunks;
+        std::size_t batch_end = outbound_chunk_queue_head_;
+        std::size_t batch_bytes = 0;
+        while (batch_end < batch_limit &&
+               (batch_end == outbound_chunk_queue_head_ ||
+                batch_bytes + outbound_chunk_queue_[batch_end].size() <=
+                    channel_settings_.max_chunk_stream_datagram_bytes)) {
+            batch_bytes += outbound_chunk_queue_[batch_end].size();
+            ++batch_end;
+        }
+
+        const std::span<const wire::ByteBuffer> batch(
+            outbound_chunk_queue_.data() + outbound_chunk_queue_head_,
+            batch_end - outbound_chunk_queue_head_);
+        WriteChunkSnapshotBatchPayload(BuildCommandAcks(), next_chunk_stream_sequence_, batch, gather_payload_);
+        if (!HasSendBudget(NetChannel::ChunkStream, gather_payload_.Size())) {
+            ++chunk_channel.budget_deferred_count;
+            break;
+        }
+
+        const core::Status send_status =
+            SendGatherDatagram(NetChannel::ChunkStream, wire::MessageKind::ChunkSnapshotBatch);
+        if (!send_status) {
+            unsent_snapshot_payload_count_ += batch.size();
+            unsent_snapshot_send_failure_count_ += batch.size();
+            core::Logger::Warn("net", "UDP snapshot publish failed: " + send_status.Message());
+        } else {
+            command_ack_pending_ = false;
+            if (flow_controlled) {
+                in_flight_chunk_batches_.push_back(InFlightChunkBatch{
+                    .sequence = next_chunk_stream_sequence_,
+                    .chunk_count = batch.size(),
+                    .sent_tick = current_tick_index_,
+                });
+                in_flight_chunk_count_ += batch.size();
+            }
+            ++next_chunk_stream_sequence_;
+        }
+        outbound_chunk_queue_head_ = batch_end;
+    }
+
+    if (outbound_chunk_queue_head_ == outbound_chunk_queue_.size()) {
+        ResetOutboundChannels();
+    } else if (outbound_chunk_queue_head_ * 2 >= outbound_chunk_queue_.size()) {
+        for (std::size_t index = 0; index < outbound_chunk_queue_head_; ++index) {
+            RecyclePayloadBuffer(outbound_chunk_queue_[index]);
+        }
+        outbound_chunk_queue_.erase(
+            outbound_chunk_queue_.begin(),
+            outbound_chunk_queue_.begin() + static_cast<std::ptrdiff_t>(outbound_chunk_queue_head_));
+        outbound_chunk_queue_head_ = 0;
+    }
+}
+
+void NetServiceUdpPeer::ResetChunkStreamFlow() {
+    congestion_controller_.Reset();
+    next_chunk_stream_sequence_ = 1;
+    in_flight_chunk_batches_.clear();
+    in_flight_chunk_count_ = 0;
+    // Until the peer advertises its window, assume it mirrors the local chunk stream receive limit.
+    remote_chunk_stream_window_ = ReceiveQueueLimit(NetChannel::ChunkStream);
+    remote_chunk_stream_acked_sequence_ = 0;
+    remote_chunk_stream_lost_batch_count_ = 0;
+    inbound_chunk_stream_sequence_ = 0;
+    inbound_chunk_stream_lost_batch_count_ = 0;
+    chunk_stream_feedback_pending_ = false;
+    last_advertised_chunk_stream_window_ = 0;
+    last_sent_chunk_stream_feedback_tick_ = kInvalidTick;
+}
+
+void NetServiceUdpPeer::ExpireInFlightChunkBatches() {
+    std::size_t timed_out_batch_count = 0;
+    while (timed_out_batch_count < in_flight_chunk_batches_.size() &&
+           current_tick_index_ >=
+               in_flight_chunk_batches_[timed_out_batch_count].sent_tick +
+                   channel_settings_.congestion.in_flight_timeout_ticks) {
+        in_flight_chunk_count_ -= in_flight_chunk_batches_[timed_out_batch_count].chunk_count;
+        ++timed_out_batch_count;
+        ++chunk_stream_flow_diagnostics_.timed_out_batch_count;
+    }
+    in_flight_chunk_batches_.erase(
+        in_flight_chunk_batches_.begin(),
+        in_flight_chunk_batches_.begin() + static_cast<std::ptrdiff_t>(timed_out_batch_count));
+    if (timed_out_batch_count != 0) {
+        congestion_controller_.OnLoss(current_tick_index_);
+    }
+}
+
+void NetServiceUdpPeer::ApplyChunkStreamFeedback(const ChunkStreamFeedback& feedback) {
+    ++chunk_stream_flow_diagnostics_.feedback_received_count;
+    if (feedback.acked_sequence >= next_chunk_stream_sequence_ ||
+        feedback.acked_sequence < remote_chunk_stream_acked_sequence_) {
+        return;
+    }
+
+    remote_chunk_stream_acked_sequence_ = feedback.acked_sequence;
+    remote_chunk_stream_window_ = static_cast<std::size_t>(std::min<std::uint64_t>(
+        feedback.receive_window_chunks,
+        std::numeric_limits<std::size_t>::max()));
+
+    std::size_t delivered_batch_count = 0;
+    while (delivered_batch_count < in_flight_chunk_batches_.size() &&
+           in_flight_chunk_batches_[delivered_batch_count].sequence <= feedback.acked_sequence) {
+        in_flight_chunk_count_ -= in_flight_chunk_batches_[delivered_batch_count].chunk_count;
+        ++delivered_batch_count;
+    }
+    in_flight_chunk_batches_.erase(
+        in_flight_chunk_batches_.begin(),
+        in_flight_chunk_batches_.begin() + static_cast<std::ptrdiff_t>(delivered_batch_count));
+
+    if (feedback.lost_batch_count > remote_chunk_stream_lost_batch_count_) {
+        chunk_stream_flow_diagnostics_.reported_lost_batch_count +=
+            feedback.lost_batch_count - remote_chunk_stream_lost_batch_count_;
+        remote_chunk_stream_lost_batch_count_ = feedback.lost_batch_count;
+        congestion_controller_.OnLoss(current_tick_index_);
+        return;
+    }
+
+    congestion_controller_.OnDelivered(delivered_batch_count);
+}
+
+void NetServiceUdpPeer::AcceptChunkStreamSequence(std::uint32_t sequence) {
+    if (sequence == 0 || session_state_ != NetSessionState::Connected) {
+        return;
+    }
+
+    // Batches arriving behind a newer one were already reported lost; their chunks are still applied.
+    if (sequence > inbound_chunk_stream_sequence_) {
+        inbound_chunk_stream_lost_batch_count_ += sequence - inbound_chunk_stream_sequence_ - 1;
+        inbound_chunk_stream_sequence_ = sequence;
+    }
+    chunk_stream_feedback_pending_ = true;
+}
+
+std::size_t NetServiceUdpPeer::ChunkStreamReceiveWindow() const {
+    const std::size_t limit = ReceiveQueueLimit(NetChannel::ChunkStream);
+    return limit > pending_remote_chunk_payloads_.size() ? limit - pending_remote_chunk_payloads_.size() : 0;
+}
+
+void NetServiceUdpPeer::SendPendingChunkStreamFeedback(std::uint64_t tick_index) {
+    if (inbound_chunk_stream_sequence_ == 0 ||
+        session_state_ != NetSessionState::Connected ||
+        IsSelfEndpoint()) {
+        return;
+    }
+
+    const std::size_t window = ChunkStreamReceiveWindow();
+    const bool refresh_due =
+        last_sent_chunk_stream_feedback_tick_ == kInvalidTick ||
+        tick_index >= last_sent_chunk_stream_feedback_tick_ + kStreamFeedbackIntervalTicks;
+    if (!chunk_stream_feedback_pending_ && window == last_advertised_chunk_stream_window_ && !refresh_due) {
+        return;
+    }
+
+    WriteStreamFeedbackPayload(
+        ChunkStreamFeedback{
+            .acked_sequence = inbound_chunk_stream_sequence_,
+            .lost_batch_count = inbound_chunk_stream_lost_batch_count_,
+            .receive_window_chunks = window,
+        },
+        gather_payload_);
+    const core::Status send_status = SendGatherDatagram(NetChannel::Control, wire::MessageKind::Control);
+    if (!send_status) {
+        core::Logger::Warn("net", "UDP chunk stream feedback send failed: " + send_status.Message());
+        return;
+    }
+
+    chunk_stream_feedback_pending_ = false;
+    last_advertised_chunk_stream_window_ = window;
+    last_sent_chunk_stream_feedback_tick_ = tick_index;
+    ++chunk_stream_flow_diagnostics_.feedback_sent_count;
+}
+
+void NetServiceUdpPeer::EnqueueRemoteChunkPayload(wire::ByteSpan payload) {
     if (session_state_ != NetSessionState::Connected) {
         ++dropped_remote_chunk_payload_count_;
         ++dropped_remote_chunk_payload_disconnected_count_;
         return;
     }
 
-    if (pending_remote_chunk_payloads_.size() >= kMaxPendingRemoteChunkPayloads) {
+    if (pending_remote_chunk_payloads_.size() >= ReceiveQueueLimit(NetChannel::ChunkStream)) {
         ++dropped_remote_chunk_payload_count_;
         ++dropped_remote_chunk_payload_queue_full_count_;
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::ChunkStream)].receive_queue_full_drop_count;
+        return;
+    }
+
+    pending_remote_chunk_payloads_.push_back(TakeRecycledPayloadBuffer(payload));
+}
+
+wire::ByteBuffer NetServiceUdpPeer::TakeRecycledPayloadBuffer(wire::ByteSpan bytes) {
+    wire::ByteBuffer buffer;
+    if (!recycled_payload_buffers_.empty()) {
+        buffer = std::move(recycled_payload_buffers_.back());
+        recycled_payload_buffers_.pop_back();
+    }
+    buffer.assign(bytes.begin(), bytes.end());
+    return buffer;
+}
+
+void NetServiceUdpPeer::RecyclePayloadBuffer(wire::ByteBuffer& buffer) {
+    // Sent and consumed chunk storage comes back here so the next chunks are copied without allocating.
+    if (buffer.capacity() != 0 && recycled_payload_buffers_.size() < kMaxRecycledPayloadBuffers) {
+        recycled_payload_buffers_.push_back(std::move(buffer));
+    }
+}
+
+void NetServiceUdpPeer::RecyclePayloadBuffers(std::vector<wire::ByteBuffer>& buffers) {
+    for (wire::ByteBuffer& buffer : buffers) {
+        RecyclePayloadBuffer(buffer);
+    }
+    buffers.clear();
+}
+
+void NetServiceUdpPeer::RecycleEntityStateBatch(EntityStateBatch& batch) {
+    if (recycled_entity_state_batches_.size() < kMaxRecycledEntityStateBatches) {
+        recycled_entity_state_batches_.push_back(std::move(batch));
+    }
+}
+
+void NetServiceUdpPeer::AcceptRemoteEntityStateBatch(EntityStateBatch& batch) {
+    if (session_state_ != NetSessionState::Connected) {
+        dropped_remote_entity_state_count_ += batch.entity_states.size();
+        RecycleEntityStateBatch(batch);
+        return;
+    }
+
+    // One tick may span several MTU-sized datagrams, so only strictly older ticks are stale.
+    if (last_received_entity_state_tick_ != kInvalidTick &&
+        batch.tick_index < last_received_entity_state_tick_) {
+        dropped_remote_entity_state_count_ += batch.entity_states.size();
+        RecycleEntityStateBatch(batch);
+        return;
+    }
+
+    if (pending_remote_entity_state_count_ + batch.entity_states.size() >
+        ReceiveQueueLimit(NetChannel::EntityState)) {
+        dropped_remote_entity_state_count_ += batch.entity_states.size();
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::EntityState)].receive_queue_full_drop_count;
+        RecycleEntityStateBatch(batch);
         return;
     }
 
-    pending_remote_chunk_payloads_.push_back(std::move(payload));
+    last_received_entity_state_tick_ = batch.tick_index;
+    pending_remote_entity_state_count_ += batch.entity_states.size();
+    pending_remote_entity_state_batches_.push_back(std::move(batch));
 }
 
 void NetServiceUdpPeer::DrainInboundDatagrams(std::uint64_t tick_index) {
-    std::string payload;
+    std::string& payload = receive_payload_scratch_;
     UdpEndpoint sender{};
-    std::string receive_error;
-    while (transport_.Receive(payload, sender, receive_error)) {
+    core::Status receive_status = core::Status::Ok();
+    while ((receive_status = transport_.Receive(payload, sender)).IsOk()) {
         const wire::ByteSpan datagram_bytes = ToByteSpan(payload);
 
         wire::EnvelopeView envelope{};
-        std::string decode_error;
-        if (!wire::TryDecodeEnvelopeV1(datagram_bytes, envelope, decode_error)) {
+        if (!wire::DecodeEnvelopeV1(datagram_bytes, envelope)) {
+            RecordReceivedDatagram(0, payload.size());
             ++ignored_unexpected_sender_count_;
             payload.clear();
             continue;
         }
+        RecordReceivedDatagram(MessageKindSlot(static_cast<std::uint8_t>(envelope.kind)), payload.size());
 
         ControlType control_type = ControlType::Heartbeat;
+        HeartbeatTiming heartbeat_timing{};
+        ChunkStreamFeedback stream_feedback{};
         const bool is_control_syn =
             envelope.kind == wire::MessageKind::Control &&
-            TryDecodeControlPayload(envelope.payload, control_type) &&
+            TryDecodeControlPayload(envelope.payload, control_type, heartbeat_timing, stream_feedback) &&
             control_type == ControlType::Syn;
 
         if (!IsExpectedSender(sender) && !(is_control_syn && TryAdoptDynamicPeerFromSyn(sender))) {
@@ -685,16 +1586,22 @@ void NetServiceUdpPeer::DrainInboundDatagrams(std::uint64_t tick_index) {
         }
 
         if (envelope.kind == wire::MessageKind::Control) {
-            if (!TryDecodeControlPayload(envelope.payload, control_type)) {
+            if (!TryDecodeControlPayload(envelope.payload, control_type, heartbeat_timing, stream_feedback)) {
                 ++ignored_unexpected_sender_count_;
                 payload.clear();
                 continue;
             }
 
             if (control_type == ControlType::Syn) {
-                std::string ack_error;
-                if (!SendControlDatagramTo(sender, static_cast<std::uint8_t>(ControlType::Ack), ack_error)) {
-                    core::Logger::Warn("net", "UDP ack send failed: " + ack_error);
+                ResetCommandStreams();
+                ResetChunkStreamFlow();
+                link_estimator_.ResetHeartbeatSequence();
+                tick_clock_.Reset();
+                pending_heartbeat_echo_microseconds_ = 0;
+                const core::Status ack_status =
+                    SendControlDatagramTo(sender, static_cast<std::uint8_t>(ControlType::Ack));
+                if (!ack_status) {
+                    core::Logger::Warn("net", "UDP ack send failed: " + ack_status.Message());
                 }
                 if (session_state_ == NetSessionState::Disconnected) {
                     TransitionSessionState(NetSessionState::Connecting, "peer_syn");
@@ -706,9 +1613,34 @@ void NetServiceUdpPeer::DrainInboundDatagrams(std::uint64_t tick_index) {
                 handshake_ack_received_ = true;
             } else if (control_type == ControlType::Heartbeat) {
                 last_heartbeat_tick_ = tick_index;
+                if (heartbeat_timing.sequence != 0) {
+                    const std::uint64_t now_microseconds = LinkClockMicroseconds();
+                    link_estimator_.ObserveHeartbeatSequence(heartbeat_timing.sequence);
+                    pending_heartbeat_echo_microseconds_ = heartbeat_timing.send_microseconds;
+                    pending_heartbeat_echo_received_microseconds_ = now_microseconds;
+                    if (heartbeat_timing.echo_microseconds != 0 &&
+                        now_microseconds >=
+                            heartbeat_timing.echo_microseconds + heartbeat_timing.echo_hold_microseconds) {
+                        link_estimator_.ObserveRttSample(
+                            now_microseconds -
+                            heartbeat_timing.echo_microseconds -
+                            heartbeat_timing.echo_hold_microseconds);
+                    }
+                    const NetLinkQuality& link_quality = link_estimator_.Quality();
+                    const double one_way_delay_ticks =
+                        link_quality.rtt_sample_count == 0
+                            ? 0.0
+                            : static_cast<double>(link_quality.smoothed_rtt_microseconds) /
+                                (2.0 * tick_delta_seconds_ * 1000000.0);
+                    tick_clock_.ObserveRemoteTick(heartbeat_timing.tick_index, tick_index, one_way_delay_ticks);
+                }
                 if (session_state_ == NetSessionState::Connecting) {
                     handshake_ack_received_ = true;
                 }
+            } else if (control_type == ControlType::StreamFeedback) {
+                if (session_state_ == NetSessionState::Connected) {
+                    ApplyChunkStreamFeedback(stream_feedback);
+                }
             }
 
             payload.clear();
@@ -716,35 +1648,58 @@ void NetServiceUdpPeer::DrainInboundDatagrams(std::uint64_t tick_index) {
         }
 
         if (envelope.kind == wire::MessageKind::Command) {
-            PlayerCommand command{};
-            if (!TryDecodeCommandPayload(envelope.payload, command)) {
+            std::uint32_t player_id = 0;
+            if (!TryDecodeCommandBatchPayload(envelope.payload, player_id, received_command_scratch_)) {
                 ++dropped_command_count_;
                 core::Logger::Warn("net", "UDP received invalid command datagram.");
                 payload.clear();
                 continue;
             }
 
-            EnqueueRemoteCommand(std::move(command));
+            AcceptRemoteCommandBatch(player_id, received_command_scratch_);
             payload.clear();
             continue;
         }
 
         if (envelope.kind == wire::MessageKind::ChunkSnapshot) {
-            EnqueueRemoteChunkPayload(wire::ByteBuffer(envelope.payload.begin(), envelope.payload.end()));
+            EnqueueRemoteChunkPayload(envelope.payload);
             payload.clear();
             continue;
         }
 
         if (envelope.kind == wire::MessageKind::ChunkSnapshotBatch) {
-            std::vector<wire::ByteBuffer> chunks;
-            if (!TrySplitChunkSnapshotBatch(envelope.payload, chunks)) {
+            std::uint32_t stream_sequence = 0;
+            if (!TrySplitChunkSnapshotBatch(
+                    envelope.payload,
+                    received_command_ack_scratch_,
+                    stream_sequence,
+                    received_chunk_scratch_)) {
                 ++dropped_remote_chunk_payload_count_;
                 payload.clear();
                 continue;
             }
-            for (auto& chunk : chunks) {
-                EnqueueRemoteChunkPayload(std::move(chunk));
+            ApplyCommandAcks(received_command_ack_scratch_);
+            AcceptChunkStreamSequence(stream_sequence);
+            for (const wire::ByteSpan chunk : received_chunk_scratch_) {
+                EnqueueRemoteChunkPayload(chunk);
+            }
+            payload.clear();
+            continue;
+        }
+
+        if (envelope.kind == wire::MessageKind::EntityStateBatch) {
+            EntityStateBatch batch{};
+            if (!recycled_entity_state_batches_.empty()) {
+                batch = std::move(recycled_entity_state_batches_.back());
+                recycled_entity_state_batches_.pop_back();
+            }
+            if (!TryDecodeEntityStateBatchPayload(envelope.payload, batch.tick_index, batch.entity_states)) {
+                ++dropped_remote_entity_state_count_;
+                RecycleEntityStateBatch(batch);
+                payload.clear();
+                continue;
             }
+            AcceptRemoteEntityStateBatch(batch);
             payload.clear();
             continue;
         }
@@ -752,25 +1707,111 @@ void NetServiceUdpPeer::DrainInboundDatagrams(std::uint64_t tick_index) {
         payload.clear();
     }
 
-    if (!receive_error.empty()) {
-        core::Logger::Warn("net", "UDP receive failed: " + receive_error);
+    if (receive_status.Code() != core::StatusCode::WouldBlock) {
+        core::Logger::Warn("net", "UDP receive failed: " + receive_status.Message());
+    }
+}
+
+core::Status NetServiceUdpPeer::SendControlDatagram(std::uint8_t control_type) {
+    return SendControlDatagramTo(remote_endpoint_, control_type);
+}
+
+core::Status NetServiceUdpPeer::SendControlDatagramTo(const UdpEndpoint& endpoint, std::uint8_t control_type) {
+    WriteControlPayload(static_cast<ControlType>(control_type), gather_payload_);
+    return SendGatherDatagramTo(endpoint, NetChannel::Control, wire::MessageKind::Control);
+}
+
+core::Status NetServiceUdpPeer::SendHeartbeatDatagram() {
+    const std::uint64_t now_microseconds = LinkClockMicroseconds();
+    HeartbeatTiming timing{
+        .sequence = next_heartbeat_sequence_,
+        .send_microseconds = now_microseconds,
+        .tick_index = current_tick_index_,
+    };
+    if (pending_heartbeat_echo_microseconds_ != 0) {
+        timing.echo_microseconds = pending_heartbeat_echo_microseconds_;
+        timing.echo_hold_microseconds = now_microseconds - pending_heartbeat_echo_received_microseconds_;
+    }
+
+    WriteHeartbeatPayload(timing, gather_payload_);
+    const core::Status send_status = SendGatherDatagram(NetChannel::Control, wire::MessageKind::Control);
+    if (!send_status) {
+        return send_status;
     }
+
+    ++next_heartbeat_sequence_;
+    pending_heartbeat_echo_microseconds_ = 0;
+    return core::Status::Ok();
 }
 
-bool NetServiceUdpPeer::SendControlDatagram(std::uint8_t control_type, std::string& out_error) {
-    return SendControlDatagramTo(remote_endpoint_, control_type, out_error);
+core::Status NetServiceUdpPeer::SendGatherDatagram(NetChannel channel, wire::MessageKind kind) {
+    return SendGatherDatagramTo(remote_endpoint_, channel, kind);
 }
 
-bool NetServiceUdpPeer::SendControlDatagramTo(
+core::Status NetServiceUdpPeer::SendGatherDatagramTo(
     const UdpEndpoint& endpoint,
-    std::uint8_t control_type,
-    std::string& out_error) {
-    const wire::ByteBuffer datagram = BuildControlDatagram(static_cast<ControlType>(control_type));
-    return transport_.SendTo(endpoint, ToStringView(datagram), out_error);
+    NetChannel channel,
+    wire::MessageKind kind) {
+    wire::EnvelopeHeaderV1 header{};
+    wire::EncodeEnvelopeHeaderV1(kind, gather_payload_.Size(), header);
+
+    const std::vector<wire::ByteSpan>& payload_segments = gather_payload_.Segments();
+    gather_segments_.clear();
+    gather_segments_.push_back(header.Span());
+    gather_segments_.insert(gather_segments_.end(), payload_segments.begin(), payload_segments.end());
+    const core::Status send_status = transport_.SendGatherTo(endpoint, gather_segments_);
+    if (!send_status) {
+        return send_status;
+    }
+
+    const std::size_t datagram_size = header.size + gather_payload_.Size();
+    RecordSentDatagram(MessageKindSlot(static_cast<std::uint8_t>(kind)), datagram_size);
+
+    const std::size_t channel_index = static_cast<std::size_t>(channel);
+    ++channel_diagnostics_[channel_index].sent_datagram_count;
+    channel_diagnostics_[channel_index].sent_byte_count += datagram_size;
+    std::size_t& budget_remaining = channel_send_budget_remaining_[channel_index];
+    budget_remaining -= std::min(budget_remaining, gather_payload_.Size());
+    return core::Status::Ok();
+}
+
+void NetServiceUdpPeer::RecordSentDatagram(std::size_t kind_slot, std::size_t datagram_size) {
+    ++traffic_by_kind_[kind_slot].sent_packet_count;
+    traffic_by_kind_[kind_slot].sent_byte_count += datagram_size;
+    ++sent_datagram_size_histogram_[DatagramSizeBucket(datagram_size)];
+}
+
+void NetServiceUdpPeer::RecordReceivedDatagram(std::size_t kind_slot, std::size_t datagram_size) {
+    ++traffic_by_kind_[kind_slot].received_packet_count;
+    traffic_by_kind_[kind_slot].received_byte_count += datagram_size;
+}
+
+std::uint64_t NetServiceUdpPeer::LinkClockMicroseconds() const {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now() - link_clock_epoch_).count()) +
+        1;
 }
 
-bool NetServiceUdpPeer::SendDatagram(const wire::ByteBuffer& datagram, std::string& out_error) {
-    return transport_.SendTo(remote_endpoint_, ToStringView(datagram), out_error);
+void NetServiceUdpPeer::SendPendingCommandAck() {
+    if (!command_ack_pending_ ||
+        session_state_ != NetSessionState::Connected ||
+        IsSelfEndpoint()) {
+        return;
+    }
+
+    WriteChunkSnapshotBatchPayload(BuildCommandAcks(), 0, {}, gather_payload_);
+    if (!HasSendBudget(NetChannel::Command, gather_payload_.Size())) {
+        ++channel_diagnostics_[static_cast<std::size_t>(NetChannel::Command)].budget_deferred_count;
+        return;
+    }
+
+    const core::Status send_status = SendGatherDatagram(NetChannel::Command, wire::MessageKind::ChunkSnapshotBatch);
+    if (!send_status) {
+        core::Logger::Warn("net", "UDP command ack send failed: " + send_status.Message());
+        return;
+    }
+
+    command_ack_pending_ = false;
 }
 
 }  // namespace novaria::net
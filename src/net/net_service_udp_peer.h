@@ -1,27 +1,59 @@
 #pragma once
 
+#include "net/net_channel.h"
+#include "net/net_congestion_controller.h"
+#include "net/net_link_estimator.h"
 #include "net/net_service.h"
+#include "net/net_tick_clock.h"
+#include "net/network_impairment.h"
 #include "net/udp_transport.h"
 #include "wire/envelope.h"
+#include "wire/gather_writer.h"
 
+#include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace novaria::net {
 
+struct CommandAck final {
+    std::uint32_t player_id = 0;
+    std::uint32_t sequence = 0;
+};
+
+struct ChunkStreamFeedback final {
+    std::uint32_t acked_sequence = 0;
+    std::uint64_t lost_batch_count = 0;
+    std::uint64_t receive_window_chunks = 0;
+};
+
 class NetServiceUdpPeer final : public INetService {
 public:
     static constexpr std::size_t kMaxPendingCommands = 1024;
+    static constexpr std::size_t kMaxPendingCommandsPerPlayer = 256;
+    static constexpr std::size_t kMaxPlayerCommandDropEntries = 256;
     static constexpr std::size_t kMaxPendingRemoteChunkPayloads = 1024;
+    static constexpr std::size_t kMaxPendingRemoteEntityStates = 1024;
+    static constexpr std::size_t kMaxRecycledPayloadBuffers = 1024;
+    static constexpr std::size_t kMaxRecycledEntityStateBatches = 64;
     static constexpr std::uint64_t kHeartbeatTimeoutTicks = 180;
     static constexpr std::uint64_t kConnectProbeIntervalTicks = 30;
     static constexpr std::uint64_t kMaxConnectProbeIntervalTicks = 240;
     static constexpr std::uint64_t kConnectTimeoutTicks = 600;
     static constexpr std::uint64_t kHeartbeatSendIntervalTicks = 30;
+    static constexpr std::uint64_t kClockSyncHeartbeatIntervalTicks = 4;
+    static constexpr std::size_t kMaxRedundantCommandsPerDatagram = 8;
+    static constexpr std::size_t kMaxUnackedCommandsPerPlayer = 64;
+    static constexpr std::size_t kMaxCommandStreams = 64;
+    static constexpr std::uint64_t kIdleCommandStreamTicks = 600;
+    static constexpr std::uint64_t kStreamFeedbackIntervalTicks = 30;
 
     bool Initialize(std::string& out_error) override;
     void Shutdown() override;
@@ -31,43 +63,109 @@ public:
     NetSessionState SessionState() const override;
     NetDiagnosticsSnapshot DiagnosticsSnapshot() const override;
     void Tick(const core::TickContext& tick_context) override;
-    void SubmitLocalCommand(const PlayerCommand& command) override;
-    std::vector<PlayerCommand> ConsumeRemoteCommands() override;
-    std::vector<wire::ByteBuffer> ConsumeRemoteChunkPayloads() override;
+    std::uint32_t SubmitLocalCommand(PlayerCommand command) override;
+    void ConsumeRemoteCommands(std::vector<PlayerCommand>& out_commands) override;
+    void ConsumeRemoteChunkPayloads(std::vector<wire::ByteBuffer>& out_payloads) override;
+    void ConsumeRemoteEntityStates(std::vector<EntityStateBatch>& out_batches) override;
     void PublishWorldSnapshot(
         std::uint64_t tick_index,
         const std::vector<wire::ByteBuffer>& encoded_dirty_chunks) override;
+    void PublishEntityStates(
+        std::uint64_t tick_index,
+        const std::vector<wire::ByteBuffer>& encoded_entity_states,
+        const std::vector<std::uint32_t>& recipient_player_ids) override;
 
     void SetBindHost(std::string local_host);
     void SetBindPort(std::uint16_t local_port);
     void SetRemoteEndpoint(UdpEndpoint endpoint);
+    void SetImpairment(const NetworkImpairmentSettings& settings);
+    void SetChannelSettings(const NetChannelSettings& settings);
     UdpEndpoint RemoteEndpoint() const;
     std::uint16_t LocalPort() const;
 
 private:
+    struct OutboundCommandStream final {
+        std::uint32_t next_sequence = 1;
+        std::uint64_t last_target_tick = 0;
+        std::vector<PlayerCommand> unacked_commands;
+    };
+
+    struct InboundCommandStream final {
+        std::uint32_t received_sequence = 0;
+        std::uint64_t last_received_tick = 0;
+    };
+
+    struct InFlightChunkBatch final {
+        std::uint32_t sequence = 0;
+        std::size_t chunk_count = 0;
+        std::uint64_t sent_tick = 0;
+    };
+
     static constexpr std::uint64_t kInvalidTick = std::numeric_limits<std::uint64_t>::max();
     void TransitionSessionState(NetSessionState next_state, std::string_view reason);
     bool IsSelfEndpoint() const;
     bool IsExpectedSender(const UdpEndpoint& sender) const;
     bool TryAdoptDynamicPeerFromSyn(const UdpEndpoint& sender);
-    void EnqueueRemoteCommand(PlayerCommand command);
-    void EnqueueRemoteChunkPayload(wire::ByteBuffer payload);
+    bool EnqueueRemoteCommand(PlayerCommand command);
+    bool ReservePlayerCommandSlot(std::uint32_t player_id);
+    void RecordPlayerCommandQueueFullDrop(std::uint32_t player_id);
+    void AcceptRemoteCommandBatch(std::uint32_t player_id, std::vector<PlayerCommand>& commands);
+    bool EvictIdleInboundCommandStream();
+    void ApplyCommandAcks(const std::vector<CommandAck>& command_acks);
+    const std::vector<CommandAck>& BuildCommandAcks();
+    void ResetCommandStreams();
+    void ResetOutboundChannels();
+    void ResetChannelSendBudgets();
+    bool HasSendBudget(NetChannel channel, std::size_t payload_size) const;
+    std::size_t ReceiveQueueLimit(NetChannel channel) const;
+    void FlushChunkStream();
+    void ResetChunkStreamFlow();
+    void ExpireInFlightChunkBatches();
+    void ApplyChunkStreamFeedback(const ChunkStreamFeedback& feedback);
+    void AcceptChunkStreamSequence(std::uint32_t sequence);
+    std::size_t ChunkStreamReceiveWindow() const;
+    void SendPendingChunkStreamFeedback(std::uint64_t tick_index);
+    void EnqueueRemoteChunkPayload(wire::ByteSpan payload);
+    wire::ByteBuffer TakeRecycledPayloadBuffer(wire::ByteSpan bytes);
+    void RecyclePayloadBuffer(wire::ByteBuffer& buffer);
+    void RecyclePayloadBuffers(std::vector<wire::ByteBuffer>& buffers);
+    void RecycleEntityStateBatch(EntityStateBatch& batch);
+    void AcceptRemoteEntityStateBatch(EntityStateBatch& batch);
     void DrainInboundDatagrams(std::uint64_t tick_index);
-    bool SendControlDatagramTo(const UdpEndpoint& endpoint, std::uint8_t control_type, std::string& out_error);
-    bool SendControlDatagram(std::uint8_t control_type, std::string& out_error);
-    bool SendDatagram(const wire::ByteBuffer& datagram, std::string& out_error);
+    core::Status SendControlDatagramTo(const UdpEndpoint& endpoint, std::uint8_t control_type);
+    core::Status SendControlDatagram(std::uint8_t control_type);
+    core::Status SendHeartbeatDatagram();
+    core::Status SendGatherDatagram(NetChannel channel, wire::MessageKind kind);
+    core::Status SendGatherDatagramTo(const UdpEndpoint& endpoint, NetChannel channel, wire::MessageKind kind);
+    void RecordSentDatagram(std::size_t kind_slot, std::size_t datagram_size);
+    void RecordReceivedDatagram(std::size_t kind_slot, std::size_t datagram_size);
+    std::uint64_t LinkClockMicroseconds() const;
+    void SendPendingCommandAck();
 
     bool initialized_ = false;
     NetSessionState session_state_ = NetSessionState::Disconnected;
     std::vector<PlayerCommand> pending_remote_commands_;
+    std::vector<std::pair<std::uint32_t, std::size_t>> pending_remote_command_counts_;
+    std::vector<PlayerCommand> received_command_scratch_;
     std::vector<wire::ByteBuffer> pending_remote_chunk_payloads_;
+    std::vector<wire::ByteBuffer> recycled_payload_buffers_;
+    std::vector<EntityStateBatch> pending_remote_entity_state_batches_;
+    std::vector<EntityStateBatch> recycled_entity_state_batches_;
+    std::string receive_payload_scratch_;
+    std::vector<CommandAck> received_command_ack_scratch_;
+    std::vector<wire::ByteSpan> received_chunk_scratch_;
+    std::vector<CommandAck> command_ack_scratch_;
+    std::size_t pending_remote_entity_state_count_ = 0;
     std::size_t total_processed_command_count_ = 0;
     std::size_t dropped_command_count_ = 0;
     std::size_t dropped_remote_chunk_payload_count_ = 0;
     std::size_t dropped_command_disconnected_count_ = 0;
     std::size_t dropped_command_queue_full_count_ = 0;
+    std::size_t dropped_command_player_queue_full_count_ = 0;
+    std::vector<NetPlayerCommandDrops> player_command_drops_;
     std::size_t dropped_remote_chunk_payload_disconnected_count_ = 0;
     std::size_t dropped_remote_chunk_payload_queue_full_count_ = 0;
+    std::size_t dropped_remote_entity_state_count_ = 0;
     std::size_t unsent_command_count_ = 0;
     std::size_t unsent_command_disconnected_count_ = 0;
     std::size_t unsent_command_self_suppressed_count_ = 0;
@@ -76,6 +174,12 @@ private:
     std::size_t unsent_snapshot_disconnected_count_ = 0;
     std::size_t unsent_snapshot_self_suppressed_count_ = 0;
     std::size_t unsent_snapshot_send_failure_count_ = 0;
+    std::size_t unsent_entity_state_count_ = 0;
+    std::size_t redundant_command_send_count_ = 0;
+    std::size_t duplicate_command_count_ = 0;
+    std::size_t lost_command_count_ = 0;
+    std::size_t unacked_command_overflow_count_ = 0;
+    std::size_t evicted_command_stream_count_ = 0;
     std::uint64_t connect_request_count_ = 0;
     std::uint64_t connect_probe_send_count_ = 0;
     std::uint64_t connect_probe_send_failure_count_ = 0;
@@ -91,6 +195,7 @@ private:
     std::size_t last_published_dirty_chunk_count_ = 0;
     std::vector<wire::ByteBuffer> last_published_encoded_chunks_;
     std::uint64_t snapshot_publish_count_ = 0;
+    std::uint64_t last_received_entity_state_tick_ = kInvalidTick;
     std::string bind_host_ = "127.0.0.1";
     std::uint16_t bind_port_ = 0;
     std::uint64_t connect_started_tick_ = kInvalidTick;
@@ -98,7 +203,43 @@ private:
     std::uint64_t connect_probe_interval_ticks_ = kConnectProbeIntervalTicks;
     std::uint64_t last_sent_heartbeat_tick_ = kInvalidTick;
     bool handshake_ack_received_ = false;
+    std::unordered_map<std::uint32_t, OutboundCommandStream> outbound_command_streams_;
+    std::unordered_map<std::uint32_t, InboundCommandStream> inbound_command_streams_;
+    bool command_ack_pending_ = false;
     std::uint16_t remote_endpoint_config_port_ = 0;
+    NetLinkEstimator link_estimator_;
+    NetTickClock tick_clock_;
+    double tick_delta_seconds_ = 1.0 / 60.0;
+    std::chrono::steady_clock::time_point link_clock_epoch_ = std::chrono::steady_clock::now();
+    std::uint32_t next_heartbeat_sequence_ = 1;
+    std::uint64_t pending_heartbeat_echo_microseconds_ = 0;
+    std::uint64_t pending_heartbeat_echo_received_microseconds_ = 0;
+    std::array<NetMessageKindTraffic, kNetMessageKindSlotCount> traffic_by_kind_{};
+    std::array<std::uint64_t, kNetDatagramSizeBucketCount> sent_datagram_size_histogram_{};
+    NetworkImpairmentSettings impairment_settings_{};
+    NetChannelSettings channel_settings_{};
+    std::array<std::size_t, kNetChannelCount> channel_send_budget_limit_{};
+    std::array<std::size_t, kNetChannelCount> channel_send_budget_remaining_{};
+    std::array<NetChannelDiagnostics, kNetChannelCount> channel_diagnostics_{};
+    std::vector<wire::ByteBuffer> outbound_chunk_queue_;
+    std::size_t outbound_chunk_queue_head_ = 0;
+    std::vector<wire::ByteSpan> outbound_entity_state_scratch_;
+    std::uint64_t current_tick_index_ = 0;
+    NetCongestionController congestion_controller_;
+    NetChunkStreamFlowDiagnostics chunk_stream_flow_diagnostics_{};
+    std::uint32_t next_chunk_stream_sequence_ = 1;
+    std::vector<InFlightChunkBatch> in_flight_chunk_batches_;
+    std::size_t in_flight_chunk_count_ = 0;
+    std::size_t remote_chunk_stream_window_ = 0;
+    std::uint32_t remote_chunk_stream_acked_sequence_ = 0;
+    std::uint64_t remote_chunk_stream_lost_batch_count_ = 0;
+    std::uint32_t inbound_chunk_stream_sequence_ = 0;
+    std::uint64_t inbound_chunk_stream_lost_batch_count_ = 0;
+    bool chunk_stream_feedback_pending_ = false;
+    std::size_t last_advertised_chunk_stream_window_ = 0;
+    std::uint64_t last_sent_chunk_stream_feedback_tick_ = kInvalidTick;
+    wire::GatherWriter gather_payload_;
+    std::vector<wire::ByteSpan> gather_segments_;
     UdpTransport transport_;
     UdpEndpoint remote_endpoint_{};
 };
@@ -0,0 +1,53 @@
+#include "net/net_tick_clock.h"
+
+#include <cmath>
+
+namespace novaria::net {
+namespace {
+
+std::uint64_t ToTick(double tick) {
+    return tick <= 0.0 ? 0 : static_cast<std::uint64_t>(std::llround(tick));
+}
+
+}  // namespace
+
+void NetTickClock::Reset() {
+    state_ = {};
+}
+
+void NetTickClock::ObserveRemoteTick(
+    std::uint64_t remote_tick,
+    std::uint64_t local_tick,
+    double one_way_delay_ticks) {
+    const double sample_offset =
+        static_cast<double>(remote_tick) + one_way_delay_ticks - static_cast<double>(local_tick);
+    if (state_.sample_count == 0) {
+        state_.remote_tick_offset = sample_offset;
+    } else if (std::fabs(sample_offset - state_.remote_tick_offset) > kResyncThresholdTicks) {
+        state_.remote_tick_offset = sample_offset;
+        ++state_.resync_count;
+    } else {
+        state_.remote_tick_offset += (sample_offset - state_.remote_tick_offset) * kOffsetSmoothing;
+    }
+
+    state_.one_way_delay_ticks = one_way_delay_ticks;
+    ++state_.sample_count;
+}
+
+bool NetTickClock::IsSynced() const {
+    return state_.sample_count >= kSyncSampleCount;
+}
+
+std::uint64_t NetTickClock::EstimateRemoteTick(std::uint64_t local_tick) const {
+    return ToTick(static_cast<double>(local_tick) + state_.remote_tick_offset);
+}
+
+std::uint64_t NetTickClock::PredictArrivalTick(std::uint64_t local_tick) const {
+    return ToTick(std::ceil(static_cast<double>(local_tick) + state_.remote_tick_offset + state_.one_way_delay_ticks));
+}
+
+const NetTickClockState& NetTickClock::State() const {
+    return state_;
+}
+
+}  // namespace novaria::net
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+namespace novaria::net {
+
+struct NetTickClockState final {
+    std::uint64_t sample_count = 0;
+    std::uint64_t resync_count = 0;
+    double remote_tick_offset = 0.0;
+    double one_way_delay_ticks = 0.0;
+};
+
+class NetTickClock final {
+public:
+    static constexpr double kOffsetSmoothing = 1.0 / 8.0;
+    static constexpr double kResyncThresholdTicks = 30.0;
+    static constexpr std::uint64_t kSyncSampleCount = 4;
+
+    void Reset();
+    void ObserveRemoteTick(std::uint64_t remote_tick, std::uint64_t local_tick, double one_way_delay_ticks);
+    bool IsSynced() const;
+    std::uint64_t EstimateRemoteTick(std::uint64_t local_tick) const;
+    std::uint64_t PredictArrivalTick(std::uint64_t local_tick) const;
+    const NetTickClockState& State() const;
+
+private:
+    NetTickClockState state_{};
+};
+
+}  // namespace novaria::net
@@ -0,0 +1,201 @@
+#include "net/network_impairment.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace novaria::net {
+namespace {
+
+constexpr std::uint32_t kMaxImpairmentDelayMs = 10000;
+
+bool IsProbability(double value) {
+    return value >= 0.0 && value <= 1.0;
+}
+
+}  // namespace
+
+bool ValidateNetworkImpairmentSettings(const NetworkImpairmentSettings& settings, std::string& out_error) {
+    if (settings.latency_ms > kMaxImpairmentDelayMs ||
+        settings.jitter_ms > kMaxImpairmentDelayMs ||
+        settings.reorder_delay_ms > kMaxImpairmentDelayMs) {
+        out_error = "impairment delays must be <= " + std::to_string(kMaxImpairmentDelayMs) + " ms";
+        return false;
+    }
+    if (!IsProbability(settings.loss_rate) ||
+        !IsProbability(settings.burst_enter_rate) ||
+        !IsProbability(settings.burst_exit_rate) ||
+        !IsProbability(settings.burst_loss_rate) ||
+        !IsProbability(settings.duplicate_rate) ||
+        !IsProbability(settings.reorder_rate)) {
+        out_error = "impairment rates must be within [0, 1]";
+        return false;
+    }
+    if (settings.max_queued_bytes == 0) {
+        out_error = "impairment max_queued_bytes must be > 0";
+        return false;
+    }
+
+    out_error.clear();
+    return true;
+}
+
+bool NetworkImpairment::LaterRelease::operator()(
+    const ScheduledDatagram& lhs,
+    const ScheduledDatagram& rhs) const {
+    if (lhs.release_microseconds != rhs.release_microseconds) {
+        return lhs.release_microseconds > rhs.release_microseconds;
+    }
+    return lhs.order > rhs.order;
+}
+
+void NetworkImpairment::Configure(const NetworkImpairmentSettings& settings) {
+    settings_ = settings;
+    Reset();
+}
+
+const NetworkImpairmentSettings& NetworkImpairment::Settings() const {
+    return settings_;
+}
+
+bool NetworkImpairment::IsEnabled() const {
+    return settings_.enabled;
+}
+
+void NetworkImpairment::Reset() {
+    random_state_ = settings_.seed;
+    in_burst_ = false;
+    link_free_microseconds_ = 0;
+    next_order_ = 0;
+    queue_.clear();
+    diagnostics_ = {};
+}
+
+void NetworkImpairment::Submit(
+    std::uint64_t now_microseconds,
+    const UdpEndpoint& endpoint,
+    std::string_view payload) {
+    ++diagnostics_.submitted_datagram_count;
+    if (!settings_.enabled) {
+        Schedule(now_microseconds, endpoint, payload);
+        return;
+    }
+
+    if (ShouldDrop()) {
+        return;
+    }
+    if (diagnostics_.queued_bytes + payload.size() > settings_.max_queued_bytes) {
+        ++diagnostics_.dropped_queue_full_count;
+        return;
+    }
+
+    std::uint64_t departure_microseconds = now_microseconds;
+    if (settings_.bandwidth_bytes_per_second > 0) {
+        const std::uint64_t start_microseconds = std::max(now_microseconds, link_free_microseconds_);
+        if (start_microseconds > now_microseconds) {
+            ++diagnostics_.bandwidth_delayed_datagram_count;
+        }
+        link_free_microseconds_ =
+            start_microseconds +
+            payload.size() * 1000000ULL / settings_.bandwidth_bytes_per_second;
+        departure_microseconds = link_free_microseconds_;
+    }
+
+    std::uint64_t release_microseconds = departure_microseconds + SampleDelayMicroseconds();
+    if (settings_.reorder_rate > 0.0 && NextUnit() < settings_.reorder_rate) {
+        release_microseconds += static_cast<std::uint64_t>(settings_.reorder_delay_ms) * 1000;
+        ++diagnostics_.reordered_datagram_count;
+    }
+    Schedule(release_microseconds, endpoint, payload);
+
+    if (settings_.duplicate_rate > 0.0 && NextUnit() < settings_.duplicate_rate) {
+        Schedule(departure_microseconds + SampleDelayMicroseconds(), endpoint, payload);
+        ++diagnostics_.duplicated_datagram_count;
+    }
+}
+
+bool NetworkImpairment::PopDue(std::uint64_t now_microseconds, ImpairedDatagram& out_datagram) {
+    if (queue_.empty() || queue_.front().release_microseconds > now_microseconds) {
+        return false;
+    }
+
+    std::pop_heap(queue_.begin(), queue_.end(), LaterRelease{});
+    out_datagram = std::move(queue_.back().datagram);
+    queue_.pop_back();
+    diagnostics_.queued_bytes -= out_datagram.payload.size();
+    ++diagnostics_.delivered_datagram_count;
+    return true;
+}
+
+bool NetworkImpairment::HasQueued() const {
+    return !queue_.empty();
+}
+
+NetworkImpairmentDiagnostics NetworkImpairment::DiagnosticsSnapshot() const {
+    NetworkImpairmentDiagnostics diagnostics = diagnostics_;
+    diagnostics.queued_datagram_count = queue_.size();
+    return diagnostics;
+}
+
+std::uint64_t NetworkImpairment::NextRandom() {
+    std::uint64_t value = (random_state_ += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+double NetworkImpairment::NextUnit() {
+    return static_cast<double>(NextRandom() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+bool NetworkImpairment::ShouldDrop() {
+    if (settings_.burst_enter_rate > 0.0) {
+        if (!in_burst_ && NextUnit() < settings_.burst_enter_rate) {
+            in_burst_ = true;
+            ++diagnostics_.burst_enter_count;
+        } else if (in_burst_ && NextUnit() < settings_.burst_exit_rate) {
+            in_burst_ = false;
+        }
+    }
+
+    if (in_burst_) {
+        if (NextUnit() < settings_.burst_loss_rate) {
+            ++diagnostics_.dropped_burst_loss_count;
+            return true;
+        }
+        return false;
+    }
+
+    if (settings_.loss_rate > 0.0 && NextUnit() < settings_.loss_rate) {
+        ++diagnostics_.dropped_loss_count;
+        return true;
+    }
+    return false;
+}
+
+std::uint64_t NetworkImpairment::SampleDelayMicroseconds() {
+    const std::int64_t latency_microseconds = static_cast<std::int64_t>(settings_.latency_ms) * 1000;
+    if (settings_.jitter_ms == 0) {
+        return static_cast<std::uint64_t>(latency_microseconds);
+    }
+
+    const std::int64_t jitter_microseconds = static_cast<std::int64_t>(settings_.jitter_ms) * 1000;
+    const std::int64_t offset =
+        static_cast<std::int64_t>(NextRandom() % static_cast<std::uint64_t>(2 * jitter_microseconds + 1)) -
+        jitter_microseconds;
+    return static_cast<std::uint64_t>(std::max<std::int64_t>(0, latency_microseconds + offset));
+}
+
+void NetworkImpairment::Schedule(
+    std::uint64_t release_microseconds,
+    const UdpEndpoint& endpoint,
+    std::string_view payload) {
+    queue_.push_back(ScheduledDatagram{
+        .release_microseconds = release_microseconds,
+        .order = next_order_++,
+        .datagram = ImpairedDatagram{.endpoint = endpoint, .payload = std::string(payload)},
+    });
+    std::push_heap(queue_.begin(), queue_.end(), LaterRelease{});
+    diagnostics_.queued_bytes += payload.size();
+}
+
+}  // namespace novaria::net
@@ -1,6 +1,9 @@
 #include "net/udp_transport.h"
 
+#include "net/network_impairment.h"
+
 #include <array>
+#include <chrono>
 #include <cstring>
 #include <string>
 
@@ -15,6 +18,7 @@
 #include <fcntl.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #include <cerrno>
 #endif
@@ -80,10 +84,9 @@ bool SetNonBlocking(NativeSocket socket_handle, std::string& out_error) {
     return true;
 }
 
-bool BuildEndpointAddress(const UdpEndpoint& endpoint, sockaddr_in& out_address, std::string& out_error) {
+core::Status BuildEndpointAddress(const UdpEndpoint& endpoint, sockaddr_in& out_address) {
     if (endpoint.port == 0) {
-        out_error = "endpoint port must be non-zero";
-        return false;
+        return core::Status::Error(core::StatusCode::InvalidArgument, "endpoint port must be non-zero");
     }
 
     std::memset(&out_address, 0, sizeof(out_address));
@@ -91,12 +94,10 @@ bool BuildEndpointAddress(const UdpEndpoint& endpoint, sockaddr_in& out_address,
     out_address.sin_port = htons(endpoint.port);
     const int parse_result = inet_pton(AF_INET, endpoint.host.c_str(), &out_address.sin_addr);
     if (parse_result != 1) {
-        out_error = "invalid IPv4 host: " + endpoint.host;
-        return false;
+        return core::Status::Error(core::StatusCode::InvalidArgument, "invalid IPv4 endpoint host");
     }
 
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
 }
 
 bool BuildBindAddress(
@@ -138,12 +139,19 @@ std::string AddressToString(const sockaddr_in& address) {
     return std::string(text);
 }
 
+int LastSocketErrorCode() {
+#if defined(_WIN32)
+    return WSAGetLastError();
+#else
+    return errno;
+#endif
+}
+
 bool IsWouldBlockError(int error_code) {
 #if defined(_WIN32)
     return error_code == WSAEWOULDBLOCK || error_code == WSAECONNRESET;
 #else
-    (void)error_code;
-    return errno == EWOULDBLOCK || errno == EAGAIN;
+    return error_code == EWOULDBLOCK || error_code == EAGAIN;
 #endif
 }
 
@@ -164,6 +172,13 @@ std::string BuildSocketErrorMessage(const char* prefix, int error_code = 0) {
 struct UdpTransport::Impl final {
     NativeSocket socket_handle = kInvalidSocket;
     std::uint16_t local_port = 0;
+    NetworkImpairment impairment;
+    std::chrono::steady_clock::time_point impairment_epoch = std::chrono::steady_clock::now();
+
+    std::uint64_t ImpairmentClockMicroseconds() const {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - impairment_epoch).count());
+    }
 #if defined(_WIN32)
     bool socket_subsystem_acquired = false;
 #endif
@@ -271,6 +286,7 @@ void UdpTransport::Close() {
 #endif
 
     impl_->local_port = 0;
+    impl_->impairment.Reset();
 }
 
 bool UdpTransport::IsOpen() const {
@@ -281,18 +297,127 @@ std::uint16_t UdpTransport::LocalPort() const {
     return impl_ != nullptr ? impl_->local_port : 0;
 }
 
-bool UdpTransport::SendTo(
+core::Status UdpTransport::SendTo(const UdpEndpoint& endpoint, std::string_view payload) {
+    if (!IsOpen()) {
+        return core::Status::Error(core::StatusCode::NotInitialized, "transport is not open");
+    }
+    if (!impl_->impairment.IsEnabled()) {
+        return SendNow(endpoint, payload);
+    }
+
+    sockaddr_in endpoint_address{};
+    const core::Status address_status = BuildEndpointAddress(endpoint, endpoint_address);
+    if (!address_status) {
+        return address_status;
+    }
+
+    impl_->impairment.Submit(impl_->ImpairmentClockMicroseconds(), endpoint, payload);
+    return FlushImpairedDatagrams();
+}
+
+core::Status UdpTransport::SendGatherTo(
     const UdpEndpoint& endpoint,
-    std::string_view payload,
-    std::string& out_error) {
+    std::span<const wire::ByteSpan> segments) {
     if (!IsOpen()) {
-        out_error = "transport is not open";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "transport is not open");
+    }
+
+    std::size_t total_size = 0;
+    for (const wire::ByteSpan segment : segments) {
+        total_size += segment.size();
+    }
+
+    if (impl_->impairment.IsEnabled() || segments.size() > kMaxGatherSegments) {
+        std::string flattened;
+        flattened.reserve(total_size);
+        for (const wire::ByteSpan segment : segments) {
+            flattened.append(reinterpret_cast<const char*>(segment.data()), segment.size());
+        }
+        return SendTo(endpoint, flattened);
     }
 
     sockaddr_in endpoint_address{};
-    if (!BuildEndpointAddress(endpoint, endpoint_address, out_error)) {
-        return false;
+    const core::Status address_status = BuildEndpointAddress(endpoint, endpoint_address);
+    if (!address_status) {
+        return address_status;
+    }
+
+#if defined(_WIN32)
+    std::array<WSABUF, kMaxGatherSegments> buffers{};
+    for (std::size_t index = 0; index < segments.size(); ++index) {
+        buffers[index].buf = reinterpret_cast<CHAR*>(const_cast<wire::Byte*>(segments[index].data()));
+        buffers[index].len = static_cast<ULONG>(segments[index].size());
+    }
+    DWORD sent_size = 0;
+    if (WSASendTo(
+            impl_->socket_handle,
+            buffers.data(),
+            static_cast<DWORD>(segments.size()),
+            &sent_size,
+            0,
+            reinterpret_cast<const sockaddr*>(&endpoint_address),
+            sizeof(endpoint_address),
+            nullptr,
+            nullptr) != 0) {
+        return core::Status::SystemError("WSASendTo failed", LastSocketErrorCode());
+    }
+    const std::size_t send_result = static_cast<std::size_t>(sent_size);
+#else
+    std::array<iovec, kMaxGatherSegments> buffers{};
+    for (std::size_t index = 0; index < segments.size(); ++index) {
+        buffers[index].iov_base = const_cast<wire::Byte*>(segments[index].data());
+        buffers[index].iov_len = segments[index].size();
+    }
+    msghdr message{};
+    message.msg_name = &endpoint_address;
+    message.msg_namelen = sizeof(endpoint_address);
+    message.msg_iov = buffers.data();
+    message.msg_iovlen = segments.size();
+    const ssize_t sent_size = sendmsg(impl_->socket_handle, &message, 0);
+    if (sent_size < 0) {
+        return core::Status::SystemError("sendmsg failed", LastSocketErrorCode());
+    }
+    const std::size_t send_result = static_cast<std::size_t>(sent_size);
+#endif
+
+    if (send_result != total_size) {
+        return core::Status::Error(core::StatusCode::SystemError, "sendmsg failed: partial datagram write");
+    }
+
+    return core::Status::Ok();
+}
+
+void UdpTransport::SetImpairment(const NetworkImpairmentSettings& settings) {
+    impl_->impairment.Configure(settings);
+    impl_->impairment_epoch = std::chrono::steady_clock::now();
+}
+
+NetworkImpairmentDiagnostics UdpTransport::ImpairmentDiagnostics() const {
+    return impl_->impairment.DiagnosticsSnapshot();
+}
+
+core::Status UdpTransport::FlushImpairedDatagrams() {
+    if (!IsOpen()) {
+        return core::Status::Error(core::StatusCode::NotInitialized, "transport is not open");
+    }
+
+    core::Status flush_status = core::Status::Ok();
+    ImpairedDatagram datagram;
+    const std::uint64_t now_microseconds = impl_->ImpairmentClockMicroseconds();
+    while (impl_->impairment.PopDue(now_microseconds, datagram)) {
+        const core::Status send_status = SendNow(datagram.endpoint, datagram.payload);
+        if (!send_status) {
+            flush_status = send_status;
+        }
+    }
+    return flush_status;
+}
+
+core::Status UdpTransport::SendNow(const UdpEndpoint& endpoint, std::string_view payload) {
+    sockaddr_in endpoint_address{};
+    const core::Status address_status = BuildEndpointAddress(endpoint, endpoint_address);
+    if (!address_status) {
+        return address_status;
     }
 
     const int send_result = sendto(
@@ -303,23 +428,22 @@ bool UdpTransport::SendTo(
         reinterpret_cast<const sockaddr*>(&endpoint_address),
         sizeof(endpoint_address));
     if (send_result < 0) {
-        out_error = BuildSocketErrorMessage("sendto failed");
-        return false;
+        return core::Status::SystemError("sendto failed", LastSocketErrorCode());
     }
 
     if (static_cast<std::size_t>(send_result) != payload.size()) {
-        out_error = "sendto failed: partial datagram write";
-        return false;
+        return core::Status::Error(core::StatusCode::SystemError, "sendto failed: partial datagram write");
     }
 
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
 }
 
-bool UdpTransport::Receive(std::string& out_payload, UdpEndpoint& out_sender, std::string& out_error) {
+core::Status UdpTransport::Receive(std::string& out_payload, UdpEndpoint& out_sender) {
     if (!IsOpen()) {
-        out_error = "transport is not open";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "transport is not open");
+    }
+    if (impl_->impairment.HasQueued()) {
+        (void)FlushImpairedDatagrams();
     }
 
     std::array<char, 65535> receive_buffer{};
@@ -337,25 +461,18 @@ bool UdpTransport::Receive(std::string& out_payload, UdpEndpoint& out_sender, st
         reinterpret_cast<sockaddr*>(&sender_address),
         &sender_address_size);
     if (receive_result < 0) {
-#if defined(_WIN32)
-        const int socket_error = WSAGetLastError();
-#else
-        const int socket_error = errno;
-#endif
+        const int socket_error = LastSocketErrorCode();
         if (IsWouldBlockError(socket_error)) {
-            out_error.clear();
-            return false;
+            return core::Status::Error(core::StatusCode::WouldBlock, "no datagram available");
         }
 
-        out_error = BuildSocketErrorMessage("recvfrom failed", socket_error);
-        return false;
+        return core::Status::SystemError("recvfrom failed", socket_error);
     }
 
     out_payload.assign(receive_buffer.data(), static_cast<std::size_t>(receive_result));
     out_sender.host = AddressToString(sender_address);
     out_sender.port = ntohs(sender_address.sin_port);
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
 }
 
 }  // namespace novaria::net
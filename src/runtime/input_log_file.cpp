@@ -0,0 +1,74 @@
+#include "runtime/input_log_file.h"
+
+#include <iterator>
+
+namespace novaria::runtime {
+
+bool InputLogFileWriter::Open(const std::filesystem::path& file_path, std::string& out_error) {
+    Close();
+    file_.open(file_path, std::ios::binary | std::ios::trunc);
+    if (!file_.is_open()) {
+        out_error = "cannot open input log for writing: " + file_path.string();
+        return false;
+    }
+
+    file_path_ = file_path;
+    out_error.clear();
+    return true;
+}
+
+bool InputLogFileWriter::Append(wire::ByteSpan bytes, std::string& out_error) {
+    if (!file_.is_open()) {
+        out_error = "input log is not open";
+        return false;
+    }
+    if (bytes.empty()) {
+        out_error.clear();
+        return true;
+    }
+
+    // Flushed per append so a crashed server still leaves every completed record on disk.
+    file_.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    file_.flush();
+    if (!file_.good()) {
+        out_error = "write input log failed: " + file_path_.string();
+        return false;
+    }
+
+    out_error.clear();
+    return true;
+}
+
+void InputLogFileWriter::Close() {
+    if (file_.is_open()) {
+        file_.close();
+    }
+    file_path_.clear();
+}
+
+bool InputLogFileWriter::IsOpen() const {
+    return file_.is_open();
+}
+
+bool ReadInputLogFile(
+    const std::filesystem::path& file_path,
+    sim::InputLog& out_log,
+    std::string& out_error) {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open()) {
+        out_error = "cannot open input log: " + file_path.string();
+        return false;
+    }
+
+    const wire::ByteBuffer bytes(
+        (std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>());
+    if (!sim::TryDecodeInputLog(wire::ByteSpan(bytes.data(), bytes.size()), out_log, out_error)) {
+        out_error = file_path.string() + ": " + out_error;
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace novaria::runtime
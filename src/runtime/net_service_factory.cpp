@@ -11,6 +11,8 @@ std::unique_ptr<net::INetService> CreateNetService(const NetServiceConfig& confi
     service->SetBindHost(config.local_host);
     service->SetBindPort(config.local_port);
     service->SetRemoteEndpoint(config.remote_endpoint);
+    service->SetImpairment(config.impairment);
+    service->SetChannelSettings(config.channels);
     return service;
 }
 
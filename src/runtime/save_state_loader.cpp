@@ -85,13 +85,12 @@ bool ApplySaveState(
     }
     if (loaded_state.has_world_snapshot) {
         for (const wire::ByteBuffer& payload : loaded_state.world_chunk_payloads) {
-            std::string apply_error;
-            if (!kernel.ApplyRemoteChunkPayload(
-                    wire::ByteSpan(payload.data(), payload.size()),
-                    apply_error)) {
+            const core::Status apply_status =
+                kernel.ApplyRemoteChunkPayload(wire::ByteSpan(payload.data(), payload.size()));
+            if (!apply_status) {
                 core::Logger::Warn(
                     "save",
-                    "Failed to apply saved chunk payload: " + apply_error);
+                    "Failed to apply saved chunk payload: " + apply_status.Message());
             }
         }
     }
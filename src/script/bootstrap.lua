@@ -2,7 +2,7 @@ novaria = novaria or {}
 novaria.last_tick = 0
 novaria.last_delta = 0
 novaria.last_event_name = ""
-novaria.last_event_payload = ""
+novaria.last_event_payload = {}
 
 function novaria_on_tick(tick_index, delta_seconds)
   novaria.last_tick = tick_index
@@ -9,8 +9,10 @@
 #include <fstream>
 #include <iterator>
 #include <string>
+#include <string_view>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #if defined(NOVARIA_WITH_LUAJIT)
 #include <cstring>
@@ -27,12 +29,41 @@ extern "C" {
 namespace novaria::script {
 namespace {
 
+constexpr std::string_view kEventSubscriptionCapabilityPrefix = "event.receive:";
+
+std::uint32_t ScriptEventBit(ScriptEventId event_id) {
+    return 1U << static_cast<std::uint32_t>(event_id);
+}
+
+bool TryParseEventSubscriptionCapability(std::string_view capability, ScriptEventId& out_event_id) {
+    if (capability.rfind(kEventSubscriptionCapabilityPrefix, 0) != 0) {
+        return false;
+    }
+    return TryParseScriptEventName(capability.substr(kEventSubscriptionCapabilityPrefix.size()), out_event_id);
+}
+
 #if defined(NOVARIA_WITH_LUAJIT)
 const std::unordered_set<std::string> kSupportedScriptCapabilities = {
     "event.receive",
     "tick.receive",
 };
 
+constexpr std::uint32_t kAllScriptEventsMask = (1U << kScriptEventIdCount) - 1;
+
+std::uint32_t BuildEventSubscriptionMask(const std::vector<std::string>& capabilities) {
+    std::uint32_t subscription_mask = 0;
+    for (const std::string& capability : capabilities) {
+        if (capability == "event.receive") {
+            return kAllScriptEventsMask;
+        }
+        ScriptEventId event_id = ScriptEventId::GameplayProgress;
+        if (TryParseEventSubscriptionCapability(capability, event_id)) {
+            subscription_mask |= ScriptEventBit(event_id);
+        }
+    }
+    return subscription_mask;
+}
+
 bool ReadTextFile(
     const std::filesystem::path& file_path,
     std::string& out_text) {
@@ -212,6 +243,56 @@ bool CopyWhitelistedGlobalsToEnvironment(
     out_error.clear();
     return true;
 }
+
+void SetTableInteger(lua_State* lua_state, const char* key, lua_Integer value) {
+    lua_pushinteger(lua_state, value);
+    lua_setfield(lua_state, -2, key);
+}
+
+void SetTableString(lua_State* lua_state, const char* key, const char* value) {
+    lua_pushstring(lua_state, value);
+    lua_setfield(lua_state, -2, key);
+}
+
+void PushScriptEventPayloadTable(lua_State* lua_state, const ScriptEvent& event_data) {
+    lua_createtable(lua_state, 0, 8);
+    switch (event_data.id) {
+        case ScriptEventId::GameplayProgress: {
+            const auto& payload = event_data.As<GameplayProgressEventPayload>();
+            SetTableString(lua_state, "milestone", payload.milestone);
+            break;
+        }
+        case ScriptEventId::GameplayPickup: {
+            const auto& payload = event_data.As<GameplayPickupEventPayload>();
+            SetTableInteger(lua_state, "player", payload.player_id);
+            SetTableInteger(lua_state, "material_id", payload.material_id);
+            SetTableInteger(lua_state, "resource_id", payload.resource_id);
+            SetTableInteger(lua_state, "amount", payload.amount);
+            SetTableInteger(lua_state, "tile_x", payload.tile_x);
+            SetTableInteger(lua_state, "tile_y", payload.tile_y);
+            SetTableString(lua_state, "branch", payload.amount > 1 ? "stack" : "single");
+            break;
+        }
+        case ScriptEventId::GameplayInteraction: {
+            const auto& payload = event_data.As<GameplayInteractionEventPayload>();
+            SetTableInteger(lua_state, "player", payload.player_id);
+            SetTableString(lua_state, "type", payload.interaction_type);
+            SetTableString(lua_state, "result", payload.result);
+            SetTableInteger(lua_state, "target_material_id", payload.target_material_id);
+            SetTableInteger(lua_state, "tile_x", payload.tile_x);
+            SetTableInteger(lua_state, "tile_y", payload.tile_y);
+            SetTableString(lua_state, "branch", payload.interaction_type);
+            break;
+        }
+        case ScriptEventId::NetSessionStateChanged: {
+            const auto& payload = event_data.As<NetSessionStateChangedEventPayload>();
+            SetTableString(lua_state, "state", payload.session_state);
+            SetTableString(lua_state, "reason", payload.reason.data());
+            break;
+        }
+    }
+    SetTableInteger(lua_state, "tick", static_cast<lua_Integer>(event_data.tick_index));
+}
 #endif
 
 }  // namespace
@@ -259,7 +340,9 @@ bool LuaJitScriptHost::SetScriptModules(
             module_source.capabilities.end());
 
         for (const std::string& capability : module_source.capabilities) {
-            if (!kSupportedScriptCapabilities.contains(capability)) {
+            ScriptEventId subscribed_event_id = ScriptEventId::GameplayProgress;
+            if (!kSupportedScriptCapabilities.contains(capability) &&
+                !TryParseEventSubscriptionCapability(capability, subscribed_event_id)) {
                 out_error =
                     "Unsupported script capability: module=" + module_source.module_name +
                     ", capability=" + capability;
@@ -361,6 +444,7 @@ bool LuaJitScriptHost::Initialize(std::string& out_error) {
     loaded_modules_.clear();
     total_processed_event_count_ = 0;
     dropped_event_count_ = 0;
+    unsubscribed_event_count_ = 0;
 
 #if !defined(NOVARIA_WITH_LUAJIT)
     initialized_ = false;
@@ -447,7 +531,11 @@ void LuaJitScriptHost::Tick(const core::TickContext& tick_context) {
 
     std::string event_error;
     for (const ScriptEvent& event_data : pending_events_) {
+        const std::uint32_t event_bit = ScriptEventBit(event_data.id);
         for (const LoadedModule& module : loaded_modules_) {
+            if ((module.event_subscription_mask & event_bit) == 0) {
+                continue;
+            }
             if (!InvokeModuleEventHandler(module, event_data, event_error)) {
                 core::Logger::Warn(
                     "script",
@@ -467,6 +555,11 @@ void LuaJitScriptHost::DispatchEvent(const ScriptEvent& event_data) {
         return;
     }
 
+    if (!HasEventSubscriber(event_data.id)) {
+        ++unsubscribed_event_count_;
+        return;
+    }
+
     if (pending_events_.size() >= kMaxPendingEvents) {
         ++dropped_event_count_;
         return;
@@ -475,24 +568,21 @@ void LuaJitScriptHost::DispatchEvent(const ScriptEvent& event_data) {
     pending_events_.push_back(event_data);
 }
 
-bool LuaJitScriptHost::TryCallModuleFunction(
+core::Status LuaJitScriptHost::TryCallModuleFunction(
     std::string_view module_name,
     std::string_view function_name,
     wire::ByteSpan request_payload,
-    wire::ByteBuffer& out_response_payload,
-    std::string& out_error) {
+    wire::ByteBuffer& out_response_payload) {
     out_response_payload.clear();
 
 #if !defined(NOVARIA_WITH_LUAJIT)
     (void)module_name;
     (void)function_name;
     (void)request_payload;
-    out_error = "LuaJIT backend is disabled.";
-    return false;
+    return core::Status::Error(core::StatusCode::Unavailable, "LuaJIT backend is disabled.");
 #else
     if (!initialized_ || lua_state_ == nullptr) {
-        out_error = "Lua VM is not initialized.";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "Lua VM is not initialized.");
     }
 
     const LoadedModule* target_module = nullptr;
@@ -503,30 +593,28 @@ bool LuaJitScriptHost::TryCallModuleFunction(
         }
     }
     if (target_module == nullptr) {
-        out_error = "Script module not loaded: " + std::string(module_name);
-        return false;
+        return core::Status::Error(core::StatusCode::NotFound, "Script module not loaded.");
     }
     if (target_module->environment_ref == LUA_REFNIL ||
         target_module->environment_ref == LUA_NOREF) {
-        out_error = "Script module environment ref is invalid: " + target_module->module_name;
-        return false;
+        return core::Status::Error(
+            core::StatusCode::ScriptError,
+            "Script module environment ref is invalid.");
     }
 
     lua_rawgeti(lua_state_, LUA_REGISTRYINDEX, target_module->environment_ref);
     if (!lua_istable(lua_state_, -1)) {
         lua_pop(lua_state_, 1);
-        out_error = "Script module environment is not a table: " + target_module->module_name;
-        return false;
+        return core::Status::Error(
+            core::StatusCode::ScriptError,
+            "Script module environment is not a table.");
     }
 
     const std::string function_name_string(function_name);
     lua_getfield(lua_state_, -1, function_name_string.c_str());
     if (!lua_isfunction(lua_state_, -1)) {
         lua_pop(lua_state_, 2);
-        out_error =
-            "Script module '" + target_module->module_name +
-            "' missing rpc function: " + function_name_string;
-        return false;
+        return core::Status::Error(core::StatusCode::NotFound, "Script module missing rpc function.");
     }
 
     lua_pushlstring(
@@ -541,15 +629,18 @@ bool LuaJitScriptHost::TryCallModuleFunction(
             1,
             call_error)) {
         lua_pop(lua_state_, 1);
-        out_error =
-            "Script rpc call failed (" + target_module->module_name + "): " + call_error;
-        return false;
+        core::Logger::Warn(
+            "script",
+            "Script rpc call failed (" + target_module->module_name + "." + function_name_string +
+                "): " + call_error);
+        return core::Status::Error(core::StatusCode::ScriptError, "Script rpc call failed.");
     }
 
     if (!lua_isstring(lua_state_, -1)) {
         lua_pop(lua_state_, 2);
-        out_error = "Script rpc call did not return string (" + target_module->module_name + ").";
-        return false;
+        return core::Status::Error(
+            core::StatusCode::MalformedPayload,
+            "Script rpc call did not return string.");
     }
 
     std::size_t result_len = 0;
@@ -562,8 +653,7 @@ bool LuaJitScriptHost::TryCallModuleFunction(
     }
     lua_pop(lua_state_, 2);
 
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
 #endif
 }
 
@@ -627,6 +717,17 @@ std::size_t LuaJitScriptHost::DroppedEventCount() const {
     return dropped_event_count_;
 }
 
+std::size_t LuaJitScriptHost::UnsubscribedEventCount() const {
+    return unsubscribed_event_count_;
+}
+
+bool LuaJitScriptHost::HasEventSubscriber(ScriptEventId event_id) const {
+    const std::uint32_t event_bit = ScriptEventBit(event_id);
+    return std::any_of(loaded_modules_.begin(), loaded_modules_.end(), [event_bit](const LoadedModule& module) {
+        return module.has_event_handler && (module.event_subscription_mask & event_bit) != 0;
+    });
+}
+
 bool LuaJitScriptHost::ApplyMvpSandbox(std::string& out_error) {
 #if !defined(NOVARIA_WITH_LUAJIT)
     (void)out_error;
@@ -842,16 +943,13 @@ bool LuaJitScriptHost::LoadModuleScript(
             module_source.capabilities.begin(),
             module_source.capabilities.end(),
             "tick.receive") != module_source.capabilities.end();
-    const bool can_receive_event =
-        std::find(
-            module_source.capabilities.begin(),
-            module_source.capabilities.end(),
-            "event.receive") != module_source.capabilities.end();
+    const std::uint32_t event_subscription_mask = BuildEventSubscriptionMask(module_source.capabilities);
     loaded_modules_.push_back(LoadedModule{
         .module_name = module_source.module_name,
         .environment_ref = environment_ref,
         .can_receive_tick = can_receive_tick,
-        .can_receive_event = can_receive_event,
+        .can_receive_event = event_subscription_mask != 0,
+        .event_subscription_mask = event_subscription_mask,
         .has_tick_handler = has_tick_handler,
         .has_event_handler = has_event_handler,
     });
@@ -940,8 +1038,8 @@ bool LuaJitScriptHost::InvokeModuleEventHandler(
         return true;
     }
 
-    lua_pushstring(lua_state_, event_data.event_name.c_str());
-    lua_pushstring(lua_state_, event_data.payload.c_str());
+    lua_pushstring(lua_state_, ScriptEventName(event_data.id));
+    PushScriptEventPayloadTable(lua_state_, event_data);
     if (!RunProtectedLuaCall(
             lua_state_,
             static_cast<int>(kInstructionBudgetPerCall),
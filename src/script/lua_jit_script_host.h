@@ -3,6 +3,7 @@
 #include "script/script_host.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -24,18 +25,18 @@ public:
     void Shutdown() override;
     void Tick(const core::TickContext& tick_context) override;
     void DispatchEvent(const ScriptEvent& event_data) override;
-    bool TryCallModuleFunction(
+    core::Status TryCallModuleFunction(
         std::string_view module_name,
         std::string_view function_name,
         wire::ByteSpan request_payload,
-        wire::ByteBuffer& out_response_payload,
-        std::string& out_error) override;
+        wire::ByteBuffer& out_response_payload) override;
     ScriptRuntimeDescriptor RuntimeDescriptor() const override;
 
     bool IsVmReady() const;
     std::size_t PendingEventCount() const;
     std::size_t TotalProcessedEventCount() const;
     std::size_t DroppedEventCount() const;
+    std::size_t UnsubscribedEventCount() const;
 
 private:
     struct LoadedModule final {
@@ -43,6 +44,7 @@ private:
         int environment_ref = -1;
         bool can_receive_tick = false;
         bool can_receive_event = false;
+        std::uint32_t event_subscription_mask = 0;
         bool has_tick_handler = false;
         bool has_event_handler = false;
     };
@@ -54,6 +56,7 @@ private:
 
     static void* QuotaAllocator(void* user_data, void* pointer, size_t old_size, size_t new_size);
     void ClearLoadedModules();
+    bool HasEventSubscriber(ScriptEventId event_id) const;
     bool LoadScriptModules(
         const std::vector<ScriptModuleSource>& module_sources,
         std::string& out_error);
@@ -84,6 +87,7 @@ private:
     std::vector<LoadedModule> loaded_modules_;
     std::size_t total_processed_event_count_ = 0;
     std::size_t dropped_event_count_ = 0;
+    std::size_t unsubscribed_event_count_ = 0;
 };
 
 }  // namespace novaria::script
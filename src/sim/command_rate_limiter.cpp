@@ -0,0 +1,173 @@
+#include "sim/command_rate_limiter.h"
+
+#include "sim/command_schema.h"
+
+#include <algorithm>
+
+namespace novaria::sim {
+
+CommandRateClass CommandRateClassForId(std::uint32_t command_id) {
+    switch (command_id) {
+        case command::kJump:
+        case command::kPlayerMotionInput:
+            return CommandRateClass::Motion;
+        case command::kWorldSetTile:
+        case command::kWorldLoadChunk:
+        case command::kWorldUnloadChunk:
+            return CommandRateClass::World;
+        case command::kReplicationEntityAck:
+            return CommandRateClass::Control;
+        default:
+            return CommandRateClass::Action;
+    }
+}
+
+const char* CommandRateClassName(CommandRateClass command_class) {
+    switch (command_class) {
+        case CommandRateClass::Motion:
+            return "motion";
+        case CommandRateClass::Action:
+            return "action";
+        case CommandRateClass::World:
+            return "world";
+        case CommandRateClass::Control:
+            return "control";
+    }
+    return "unknown";
+}
+
+void CommandRateLimiter::Reset() {
+    players_.clear();
+    evicted_player_diagnostics_.clear();
+}
+
+void CommandRateLimiter::SetSettings(const CommandRateLimiterSettings& settings) {
+    settings_ = settings;
+    for (CommandRateLimit& limit : settings_.limits) {
+        limit.commands_per_second = std::max(0.0, limit.commands_per_second);
+        limit.burst = std::max(1.0, limit.burst);
+    }
+    players_.clear();
+    evicted_player_diagnostics_.clear();
+}
+
+const CommandRateLimiterSettings& CommandRateLimiter::Settings() const {
+    return settings_;
+}
+
+bool CommandRateLimiter::Admit(
+    const net::PlayerCommand& command,
+    std::uint64_t tick_index,
+    double fixed_delta_seconds) {
+    if (!settings_.enabled) {
+        ++admitted_count_;
+        return true;
+    }
+
+    auto player_it = players_.find(command.player_id);
+    if (player_it == players_.end()) {
+        if (players_.size() >= kMaxPlayers && !EvictIdlePlayer(tick_index, fixed_delta_seconds)) {
+            ++untracked_player_dropped_count_;
+            return false;
+        }
+        PlayerBuckets buckets{.last_refill_tick = tick_index};
+        for (std::size_t index = 0; index < kCommandRateClassCount; ++index) {
+            buckets.tokens[index] = settings_.limits[index].burst;
+        }
+        buckets.diagnostics.player_id = command.player_id;
+        if (const auto retained_it = evicted_player_diagnostics_.find(command.player_id);
+            retained_it != evicted_player_diagnostics_.end()) {
+            buckets.diagnostics = retained_it->second;
+            evicted_player_diagnostics_.erase(retained_it);
+        }
+        player_it = players_.emplace(command.player_id, buckets).first;
+    }
+
+    // Buckets refill in simulation ticks, not wall time, so admission replays deterministically.
+    PlayerBuckets& buckets = player_it->second;
+    if (tick_index > buckets.last_refill_tick) {
+        const double elapsed_seconds =
+            static_cast<double>(tick_index - buckets.last_refill_tick) * fixed_delta_seconds;
+        for (std::size_t index = 0; index < kCommandRateClassCount; ++index) {
+            buckets.tokens[index] = std::min(
+                settings_.limits[index].burst,
+                buckets.tokens[index] + elapsed_seconds * settings_.limits[index].commands_per_second);
+        }
+        buckets.last_refill_tick = tick_index;
+    }
+
+    const std::size_t class_index = static_cast<std::size_t>(CommandRateClassForId(command.command_id));
+    if (buckets.tokens[class_index] < 1.0) {
+        ++buckets.diagnostics.rate_limited_count;
+        ++buckets.diagnostics.rate_limited_by_class[class_index];
+        ++rate_limited_count_;
+        return false;
+    }
+
+    buckets.tokens[class_index] -= 1.0;
+    ++buckets.diagnostics.admitted_count;
+    ++admitted_count_;
+    return true;
+}
+
+bool CommandRateLimiter::EvictIdlePlayer(std::uint64_t tick_index, double fixed_delta_seconds) {
+    auto idle_it = std::min_element(
+        players_.begin(),
+        players_.end(),
+        [](const auto& lhs, const auto& rhs) {
+            return lhs.second.last_refill_tick < rhs.second.last_refill_tick;
+        });
+    if (idle_it == players_.end() || tick_index <= idle_it->second.last_refill_tick) {
+        return false;
+    }
+
+    // Only a player whose buckets have refilled to burst is evicted, so returning later grants nothing extra.
+    const double idle_seconds =
+        static_cast<double>(tick_index - idle_it->second.last_refill_tick) * fixed_delta_seconds;
+    for (std::size_t index = 0; index < kCommandRateClassCount; ++index) {
+        const CommandRateLimit& limit = settings_.limits[index];
+        if (idle_it->second.tokens[index] + idle_seconds * limit.commands_per_second < limit.burst) {
+            return false;
+        }
+    }
+
+    // Keep the drop counters of players that were ever limited so diagnostics still name them after eviction.
+    const PlayerCommandRateDiagnostics& evicted = idle_it->second.diagnostics;
+    if (evicted.rate_limited_count != 0 &&
+        evicted_player_diagnostics_.size() < kMaxRetainedPlayerDiagnostics) {
+        evicted_player_diagnostics_.emplace(evicted.player_id, evicted);
+    }
+    players_.erase(idle_it);
+    ++evicted_player_count_;
+    return true;
+}
+
+CommandRateLimiterDiagnostics CommandRateLimiter::DiagnosticsSnapshot() const {
+    CommandRateLimiterDiagnostics diagnostics{
+        .enabled = settings_.enabled,
+        .tracked_player_count = players_.size(),
+        .admitted_count = admitted_count_,
+        .rate_limited_count = rate_limited_count_,
+        .untracked_player_dropped_count = untracked_player_dropped_count_,
+        .evicted_player_count = evicted_player_count_,
+        .players = {},
+    };
+    diagnostics.players.reserve(players_.size() + evicted_player_diagnostics_.size());
+    for (const auto& [player_id, buckets] : players_) {
+        (void)player_id;
+        diagnostics.players.push_back(buckets.diagnostics);
+    }
+    for (const auto& [player_id, evicted] : evicted_player_diagnostics_) {
+        (void)player_id;
+        diagnostics.players.push_back(evicted);
+    }
+    std::sort(
+        diagnostics.players.begin(),
+        diagnostics.players.end(),
+        [](const PlayerCommandRateDiagnostics& lhs, const PlayerCommandRateDiagnostics& rhs) {
+            return lhs.player_id < rhs.player_id;
+        });
+    return diagnostics;
+}
+
+}  // namespace novaria::sim
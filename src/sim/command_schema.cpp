@@ -73,16 +73,22 @@ const char* CommandName(std::uint32_t command_id) {
             return "gameplay.attack_boss";
         case kCombatFireProjectile:
             return "combat.fire_projectile";
+        case kReplicationEntityAck:
+            return "replication.entity_ack";
     }
 
     return "unknown";
 }
 
-wire::ByteBuffer EncodeWorldSetTilePayload(const WorldSetTilePayload& payload) {
-    wire::ByteWriter writer;
+void EncodeWorldSetTilePayload(const WorldSetTilePayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.tile_x);
     writer.WriteVarInt(payload.tile_y);
     writer.WriteVarUInt(payload.material_id);
+}
+
+wire::ByteBuffer EncodeWorldSetTilePayload(const WorldSetTilePayload& payload) {
+    wire::ByteWriter writer;
+    EncodeWorldSetTilePayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -105,10 +111,14 @@ bool TryDecodeWorldSetTilePayload(wire::ByteSpan payload, WorldSetTilePayload& o
     return true;
 }
 
-wire::ByteBuffer EncodeWorldChunkPayload(const WorldChunkPayload& payload) {
-    wire::ByteWriter writer;
+void EncodeWorldChunkPayload(const WorldChunkPayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.chunk_x);
     writer.WriteVarInt(payload.chunk_y);
+}
+
+wire::ByteBuffer EncodeWorldChunkPayload(const WorldChunkPayload& payload) {
+    wire::ByteWriter writer;
+    EncodeWorldChunkPayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -128,10 +138,14 @@ bool TryDecodeWorldChunkPayload(wire::ByteSpan payload, WorldChunkPayload& out_p
     return true;
 }
 
-wire::ByteBuffer EncodeCollectResourcePayload(const CollectResourcePayload& payload) {
-    wire::ByteWriter writer;
+void EncodeCollectResourcePayload(const CollectResourcePayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarUInt(payload.resource_id);
     writer.WriteVarUInt(payload.amount);
+}
+
+wire::ByteBuffer EncodeCollectResourcePayload(const CollectResourcePayload& payload) {
+    wire::ByteWriter writer;
+    EncodeCollectResourcePayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -154,12 +168,16 @@ bool TryDecodeCollectResourcePayload(wire::ByteSpan payload, CollectResourcePayl
     return true;
 }
 
-wire::ByteBuffer EncodeSpawnDropPayload(const SpawnDropPayload& payload) {
-    wire::ByteWriter writer;
+void EncodeSpawnDropPayload(const SpawnDropPayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.tile_x);
     writer.WriteVarInt(payload.tile_y);
     writer.WriteVarUInt(payload.material_id);
     writer.WriteVarUInt(payload.amount);
+}
+
+wire::ByteBuffer EncodeSpawnDropPayload(const SpawnDropPayload& payload) {
+    wire::ByteWriter writer;
+    EncodeSpawnDropPayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -188,10 +206,14 @@ bool TryDecodeSpawnDropPayload(wire::ByteSpan payload, SpawnDropPayload& out_pay
     return true;
 }
 
-wire::ByteBuffer EncodePickupProbePayload(const PickupProbePayload& payload) {
-    wire::ByteWriter writer;
+void EncodePickupProbePayload(const PickupProbePayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.tile_x);
     writer.WriteVarInt(payload.tile_y);
+}
+
+wire::ByteBuffer EncodePickupProbePayload(const PickupProbePayload& payload) {
+    wire::ByteWriter writer;
+    EncodePickupProbePayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -211,13 +233,17 @@ bool TryDecodePickupProbePayload(wire::ByteSpan payload, PickupProbePayload& out
     return true;
 }
 
-wire::ByteBuffer EncodeInteractionPayload(const InteractionPayload& payload) {
-    wire::ByteWriter writer;
+void EncodeInteractionPayload(const InteractionPayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarUInt(payload.interaction_type);
     writer.WriteVarInt(payload.target_tile_x);
     writer.WriteVarInt(payload.target_tile_y);
     writer.WriteVarUInt(payload.target_material_id);
     writer.WriteVarUInt(payload.result_code);
+}
+
+wire::ByteBuffer EncodeInteractionPayload(const InteractionPayload& payload) {
+    wire::ByteWriter writer;
+    EncodeInteractionPayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -246,10 +272,14 @@ bool TryDecodeInteractionPayload(wire::ByteSpan payload, InteractionPayload& out
     return true;
 }
 
-wire::ByteBuffer EncodePlayerMotionInputPayload(const PlayerMotionInputPayload& payload) {
-    wire::ByteWriter writer;
+void EncodePlayerMotionInputPayload(const PlayerMotionInputPayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.move_axis_milli);
     writer.WriteVarUInt(payload.input_flags);
+}
+
+wire::ByteBuffer EncodePlayerMotionInputPayload(const PlayerMotionInputPayload& payload) {
+    wire::ByteWriter writer;
+    EncodePlayerMotionInputPayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -281,12 +311,16 @@ bool TryDecodePlayerMotionInputPayload(wire::ByteSpan payload, PlayerMotionInput
     return true;
 }
 
-wire::ByteBuffer EncodeActionPrimaryPayload(const ActionPrimaryPayload& payload) {
-    wire::ByteWriter writer;
+void EncodeActionPrimaryPayload(const ActionPrimaryPayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.target_tile_x);
     writer.WriteVarInt(payload.target_tile_y);
     writer.WriteVarUInt(payload.hotbar_row);
     writer.WriteVarUInt(payload.hotbar_slot);
+}
+
+wire::ByteBuffer EncodeActionPrimaryPayload(const ActionPrimaryPayload& payload) {
+    wire::ByteWriter writer;
+    EncodeActionPrimaryPayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -315,9 +349,13 @@ bool TryDecodeActionPrimaryPayload(wire::ByteSpan payload, ActionPrimaryPayload&
     return true;
 }
 
+void EncodeCraftRecipePayload(const CraftRecipePayload& payload, wire::ByteWriter& writer) {
+    writer.WriteVarUInt(payload.recipe_index);
+}
+
 wire::ByteBuffer EncodeCraftRecipePayload(const CraftRecipePayload& payload) {
     wire::ByteWriter writer;
-    writer.WriteVarUInt(payload.recipe_index);
+    EncodeCraftRecipePayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -337,8 +375,7 @@ bool TryDecodeCraftRecipePayload(wire::ByteSpan payload, CraftRecipePayload& out
     return true;
 }
 
-wire::ByteBuffer EncodeFireProjectilePayload(const FireProjectilePayload& payload) {
-    wire::ByteWriter writer;
+void EncodeFireProjectilePayload(const FireProjectilePayload& payload, wire::ByteWriter& writer) {
     writer.WriteVarInt(payload.origin_tile_x);
     writer.WriteVarInt(payload.origin_tile_y);
     writer.WriteVarInt(payload.velocity_milli_x);
@@ -346,6 +383,11 @@ wire::ByteBuffer EncodeFireProjectilePayload(const FireProjectilePayload& payloa
     writer.WriteVarUInt(payload.damage);
     writer.WriteVarUInt(payload.lifetime_ticks);
     writer.WriteVarUInt(payload.faction);
+}
+
+wire::ByteBuffer EncodeFireProjectilePayload(const FireProjectilePayload& payload) {
+    wire::ByteWriter writer;
+    EncodeFireProjectilePayload(payload, writer);
     return writer.TakeBuffer();
 }
 
@@ -383,4 +425,28 @@ bool TryDecodeFireProjectilePayload(wire::ByteSpan payload, FireProjectilePayloa
     return true;
 }
 
+void EncodeReplicationEntityAckPayload(const ReplicationEntityAckPayload& payload, wire::ByteWriter& writer) {
+    writer.WriteVarUInt(payload.acked_tick);
+}
+
+wire::ByteBuffer EncodeReplicationEntityAckPayload(const ReplicationEntityAckPayload& payload) {
+    wire::ByteWriter writer;
+    EncodeReplicationEntityAckPayload(payload, writer);
+    return writer.TakeBuffer();
+}
+
+bool TryDecodeReplicationEntityAckPayload(
+    wire::ByteSpan payload,
+    ReplicationEntityAckPayload& out_payload) {
+    wire::ByteReader reader(payload);
+    std::uint64_t acked_tick = 0;
+    if (!reader.ReadVarUInt(acked_tick) || !EnsureFullyConsumed(reader)) {
+        return false;
+    }
+    out_payload = ReplicationEntityAckPayload{
+        .acked_tick = acked_tick,
+    };
+    return true;
+}
+
 }  // namespace novaria::sim::command
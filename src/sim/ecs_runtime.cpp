@@ -9,6 +9,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -16,6 +19,17 @@
 namespace novaria::sim::ecs {
 namespace {
 
+thread_local std::uint32_t g_backend_call_depth = 0;
+
+class BackendCallScope final {
+public:
+    BackendCallScope() { ++g_backend_call_depth; }
+    ~BackendCallScope() { --g_backend_call_depth; }
+
+    BackendCallScope(const BackendCallScope&) = delete;
+    BackendCallScope& operator=(const BackendCallScope&) = delete;
+};
+
 struct Transform final {
     float tile_x = 0.0F;
     float tile_y = 0.0F;
@@ -60,6 +74,10 @@ struct PlayerId final {
     std::uint32_t value = 0;
 };
 
+struct NetworkId final {
+    std::uint32_t value = 0;
+};
+
 struct PlayerInventory final {
     std::uint32_t dirt_count = 0;
     std::uint32_t stone_count = 0;
@@ -92,26 +110,382 @@ struct PlayerMotion final {
     bool pending_jump_pressed = false;
 };
 
-}  // namespace
+struct ProjectileSpawnRequest final {
+    std::uint32_t owner_player_id = 0;
+    command::FireProjectilePayload payload{};
+};
 
-struct Runtime::Impl final {
-    struct ProjectileSpawnRequest final {
-        std::uint32_t owner_player_id = 0;
-        command::FireProjectilePayload payload{};
-    };
+struct DamageRequest final {
+    entt::entity target = entt::null;
+    std::uint16_t damage = 0;
+};
 
-    struct DamageRequest final {
-        entt::entity target = entt::null;
-        std::uint16_t damage = 0;
-    };
+struct DropSpawnRequest final {
+    command::SpawnDropPayload payload{};
+};
+
+struct PickupProbeRequest final {
+    std::uint32_t player_id = 0;
+    command::PickupProbePayload payload{};
+};
+
+struct SavedDamageRequest final {
+    std::uint32_t target_index = 0;
+    std::uint16_t damage = 0;
+};
+
+// Saved state is encoded field by field (floats as IEEE bits, integers as varints, bools as one byte), so
+// identical state always produces identical bytes: no struct padding, layout or endianness leaks in.
+struct SavedFieldWriter final {
+    wire::ByteWriter& writer;
+
+    void operator()(float value) {
+        writer.WriteF32(value);
+    }
+
+    void operator()(bool value) {
+        writer.WriteU8(value ? 1 : 0);
+    }
+
+    template <typename Value>
+        requires std::is_integral_v<Value>
+    void operator()(Value value) {
+        if constexpr (std::is_signed_v<Value>) {
+            writer.WriteVarInt(value);
+        } else {
+            writer.WriteVarUInt(value);
+        }
+    }
+
+    template <typename Value>
+        requires std::is_enum_v<Value>
+    void operator()(Value value) {
+        (*this)(static_cast<std::underlying_type_t<Value>>(value));
+    }
+};
+
+struct SavedFieldReader final {
+    wire::ByteReader& reader;
+    bool ok = true;
+
+    void operator()(float& value) {
+        ok = ok && reader.ReadF32(value);
+    }
+
+    void operator()(bool& value) {
+        wire::Byte byte = 0;
+        ok = ok && reader.ReadU8(byte) && byte <= 1;
+        value = byte != 0;
+    }
+
+    template <typename Value>
+        requires std::is_integral_v<Value>
+    void operator()(Value& value) {
+        if constexpr (std::is_signed_v<Value>) {
+            std::int64_t raw = 0;
+            ok = ok && reader.ReadVarInt(raw) && raw >= std::numeric_limits<Value>::min() &&
+                raw <= std::numeric_limits<Value>::max();
+            value = static_cast<Value>(raw);
+        } else {
+            std::uint64_t raw = 0;
+            ok = ok && reader.ReadVarUInt(raw) && raw <= std::numeric_limits<Value>::max();
+            value = static_cast<Value>(raw);
+        }
+    }
+
+    template <typename Value>
+        requires std::is_enum_v<Value>
+    void operator()(Value& value) {
+        std::underlying_type_t<Value> raw{};
+        (*this)(raw);
+        value = static_cast<Value>(raw);
+    }
+};
+
+template <typename Visit>
+void VisitSavedFields(Transform& value, Visit& visit) {
+    visit(value.tile_x);
+    visit(value.tile_y);
+}
+
+template <typename Visit>
+void VisitSavedFields(Velocity& value, Visit& visit) {
+    visit(value.tile_per_second_x);
+    visit(value.tile_per_second_y);
+}
+
+template <typename Visit>
+void VisitSavedFields(Collider& value, Visit& visit) {
+    visit(value.radius);
+}
+
+template <typename Visit>
+void VisitSavedFields(Health& value, Visit& visit) {
+    visit(value.value);
+}
+
+template <typename Visit>
+void VisitSavedFields(Lifetime& value, Visit& visit) {
+    visit(value.ticks_remaining);
+}
+
+template <typename Visit>
+void VisitSavedFields(Faction& value, Visit& visit) {
+    visit(value.id);
+}
 
-    struct DropSpawnRequest final {
-        command::SpawnDropPayload payload{};
+template <typename Visit>
+void VisitSavedFields(Projectile& value, Visit& visit) {
+    visit(value.owner_player_id);
+    visit(value.damage);
+}
+
+template <typename Visit>
+void VisitSavedFields(WorldDrop& value, Visit& visit) {
+    visit(value.material_id);
+    visit(value.amount);
+}
+
+template <typename Visit>
+void VisitSavedFields(HostileTarget& value, Visit& visit) {
+    visit(value.reward_kill_count);
+}
+
+template <typename Visit>
+void VisitSavedFields(PlayerId& value, Visit& visit) {
+    visit(value.value);
+}
+
+template <typename Visit>
+void VisitSavedFields(NetworkId& value, Visit& visit) {
+    visit(value.value);
+}
+
+template <typename Visit>
+void VisitSavedFields(PlayerInventory& value, Visit& visit) {
+    visit(value.dirt_count);
+    visit(value.stone_count);
+    visit(value.wood_count);
+    visit(value.coal_count);
+    visit(value.torch_count);
+    visit(value.workbench_count);
+    visit(value.wood_sword_count);
+    visit(value.has_pickaxe_tool);
+    visit(value.has_axe_tool);
+}
+
+template <typename Visit>
+void VisitSavedFields(PrimaryActionProgress& value, Visit& visit) {
+    visit(value.active);
+    visit(value.is_harvest);
+    visit(value.is_place);
+    visit(value.target_tile_x);
+    visit(value.target_tile_y);
+    visit(value.target_material_id);
+    visit(value.place_material_id);
+    visit(value.hotbar_row);
+    visit(value.hotbar_slot);
+    visit(value.required_ticks);
+    visit(value.elapsed_ticks);
+}
+
+template <typename Visit>
+void VisitSavedFields(PlayerMotion& value, Visit& visit) {
+    visit(value.state.position_x);
+    visit(value.state.position_y);
+    visit(value.state.velocity_x);
+    visit(value.state.velocity_y);
+    visit(value.state.on_ground);
+    visit(value.input.move_axis);
+    visit(value.input.jump_pressed);
+    visit(value.pending_jump_pressed);
+}
+
+template <typename Visit>
+void VisitSavedFields(ProjectileSpawnRequest& value, Visit& visit) {
+    visit(value.owner_player_id);
+    visit(value.payload.origin_tile_x);
+    visit(value.payload.origin_tile_y);
+    visit(value.payload.velocity_milli_x);
+    visit(value.payload.velocity_milli_y);
+    visit(value.payload.damage);
+    visit(value.payload.lifetime_ticks);
+    visit(value.payload.faction);
+}
+
+template <typename Visit>
+void VisitSavedFields(SavedDamageRequest& value, Visit& visit) {
+    visit(value.target_index);
+    visit(value.damage);
+}
+
+template <typename Visit>
+void VisitSavedFields(CombatEvent& value, Visit& visit) {
+    visit(value.type);
+    visit(value.reward_kill_count);
+}
+
+template <typename Visit>
+void VisitSavedFields(DropSpawnRequest& value, Visit& visit) {
+    visit(value.payload.tile_x);
+    visit(value.payload.tile_y);
+    visit(value.payload.material_id);
+    visit(value.payload.amount);
+}
+
+template <typename Visit>
+void VisitSavedFields(PickupProbeRequest& value, Visit& visit) {
+    visit(value.player_id);
+    visit(value.payload.tile_x);
+    visit(value.payload.tile_y);
+}
+
+template <typename Visit>
+void VisitSavedFields(GameplayEvent& value, Visit& visit) {
+    visit(value.type);
+    visit(value.player_id);
+    visit(value.tile_x);
+    visit(value.tile_y);
+    visit(value.material_id);
+    visit(value.resource_id);
+    visit(value.amount);
+}
+
+template <typename Visit>
+void VisitSavedFields(RuntimeDiagnostics& value, Visit& visit) {
+    visit(value.active_projectile_count);
+    visit(value.active_hostile_count);
+    visit(value.active_drop_count);
+    visit(value.total_projectile_spawned);
+    visit(value.total_projectile_recycled);
+    visit(value.total_damage_instances);
+    visit(value.total_hostile_defeated);
+    visit(value.total_drop_spawned);
+    visit(value.total_drop_picked_up);
+}
+
+template <typename Value>
+void WriteSavedValue(wire::ByteWriter& writer, const Value& value) {
+    Value fields = value;
+    SavedFieldWriter field_writer{.writer = writer};
+    VisitSavedFields(fields, field_writer);
+}
+
+template <typename Value>
+bool ReadSavedValue(wire::ByteReader& reader, Value& out_value) {
+    SavedFieldReader field_reader{.reader = reader};
+    VisitSavedFields(out_value, field_reader);
+    return field_reader.ok;
+}
+
+template <typename Value>
+void WriteSavedValues(wire::ByteWriter& writer, const std::vector<Value>& values) {
+    writer.WriteVarUInt(values.size());
+    for (const Value& value : values) {
+        WriteSavedValue(writer, value);
+    }
+}
+
+template <typename Value>
+bool ReadSavedValues(wire::ByteReader& reader, std::vector<Value>& out_values) {
+    std::uint64_t count = 0;
+    if (!reader.ReadVarUInt(count) || count > reader.Remaining()) {
+        return false;
+    }
+    out_values.resize(static_cast<std::size_t>(count));
+    for (Value& value : out_values) {
+        if (!ReadSavedValue(reader, value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Saved entities are written one record at a time: a presence mask over the component list, then the
+// fields of each present component. Records carry no entt ids and are ordered by a stable gameplay key, so
+// the encoding does not depend on how EnTT numbers entities or walks its pools.
+template <typename... Components>
+struct SavedComponentSet final {
+    static_assert(sizeof...(Components) <= 32);
+
+    struct Record final {
+        std::uint32_t mask = 0;
+        std::tuple<Components...> values{};
+
+        template <typename Component>
+        bool Has() const {
+            return (mask & Bit<Component>()) != 0;
+        }
+
+        template <typename Component>
+        const Component& Get() const {
+            return std::get<Component>(values);
+        }
     };
 
-    struct PickupProbeRequest final {
-        std::uint32_t player_id = 0;
-        command::PickupProbePayload payload{};
+    template <typename Component>
+    static constexpr std::uint32_t Bit() {
+        std::uint32_t bit = 1;
+        std::uint32_t result = 0;
+        ((result |= std::is_same_v<Component, Components> ? bit : 0U, bit <<= 1), ...);
+        return result;
+    }
+
+    static void Write(const entt::registry& registry, entt::entity entity, wire::ByteWriter& writer) {
+        std::uint32_t mask = 0;
+        ((mask |= registry.all_of<Components>(entity) ? Bit<Components>() : 0U), ...);
+        writer.WriteVarUInt(mask);
+        ((registry.all_of<Components>(entity) ? WriteSavedValue(writer, registry.get<const Components>(entity)) : void()),
+         ...);
+    }
+
+    static bool Read(wire::ByteReader& reader, Record& out_record) {
+        std::uint64_t mask = 0;
+        if (!reader.ReadVarUInt(mask) || mask == 0 || mask >= (std::uint64_t{1} << sizeof...(Components))) {
+            return false;
+        }
+        out_record.mask = static_cast<std::uint32_t>(mask);
+        return ((!out_record.template Has<Components>() ||
+                 ReadSavedValue(reader, std::get<Components>(out_record.values))) &&
+                ...);
+    }
+
+    static void Emplace(entt::registry& registry, entt::entity entity, const Record& record) {
+        ((record.template Has<Components>() ? (void)registry.emplace<Components>(entity, record.template Get<Components>())
+                                            : void()),
+         ...);
+    }
+};
+
+using SavedComponents = SavedComponentSet<
+    Transform,
+    Velocity,
+    Collider,
+    Health,
+    Lifetime,
+    Faction,
+    Projectile,
+    WorldDrop,
+    HostileTarget,
+    PlayerId,
+    NetworkId,
+    PlayerInventory,
+    PrimaryActionProgress,
+    PlayerMotion>;
+
+}  // namespace
+
+struct Runtime::Impl final {
+    struct StagedState final {
+        std::uint32_t next_network_id = 1;
+        std::vector<SavedComponents::Record> entities{};
+        std::vector<ProjectileSpawnRequest> pending_projectile_spawns{};
+        std::vector<SavedDamageRequest> pending_damage_requests{};
+        std::vector<CombatEvent> pending_combat_events{};
+        std::vector<DropSpawnRequest> pending_drop_spawns{};
+        std::vector<PickupProbeRequest> pending_pickup_probes{};
+        std::vector<GameplayEvent> pending_gameplay_events{};
+        RuntimeDiagnostics diagnostics{};
     };
 
     bool initialized = false;
@@ -124,9 +498,14 @@ struct Runtime::Impl final {
     std::vector<PickupProbeRequest> pending_pickup_probes{};
     std::vector<GameplayEvent> pending_gameplay_events{};
     RuntimeDiagnostics diagnostics{};
+    std::uint32_t next_network_id = 1;
+    StagedState staged_state{};
+    std::vector<entt::entity> staged_entity_scratch{};
+    mutable std::vector<entt::entity> saved_entity_scratch{};
 
     void ResetState() {
         registry.clear();
+        next_network_id = 1;
         player_entities.clear();
         pending_projectile_spawns.clear();
         pending_damage_requests.clear();
@@ -137,6 +516,12 @@ struct Runtime::Impl final {
         diagnostics = {};
     }
 
+    entt::entity CreateNetworkedEntity() {
+        const entt::entity entity = registry.create();
+        registry.emplace<NetworkId>(entity, NetworkId{.value = next_network_id++});
+        return entity;
+    }
+
     entt::entity EnsurePlayerEntity(std::uint32_t player_id) {
         if (player_id == 0) {
             return entt::null;
@@ -157,6 +542,31 @@ struct Runtime::Impl final {
         return entity;
     }
 
+    // Players (keyed by player id) first, then networked entities (keyed by network id). Every entity is
+    // created through EnsurePlayerEntity or CreateNetworkedEntity, so the two ranges cover the registry.
+    void CollectSavedEntities(std::vector<entt::entity>& out_entities) const {
+        out_entities.clear();
+        for (const entt::entity entity : registry.view<const PlayerId>()) {
+            out_entities.push_back(entity);
+        }
+        std::sort(out_entities.begin(), out_entities.end(), [this](entt::entity lhs, entt::entity rhs) {
+            return registry.get<const PlayerId>(lhs).value < registry.get<const PlayerId>(rhs).value;
+        });
+
+        const std::size_t player_count = out_entities.size();
+        for (const entt::entity entity : registry.view<const NetworkId>()) {
+            if (!registry.all_of<PlayerId>(entity)) {
+                out_entities.push_back(entity);
+            }
+        }
+        std::sort(
+            out_entities.begin() + static_cast<std::ptrdiff_t>(player_count),
+            out_entities.end(),
+            [this](entt::entity lhs, entt::entity rhs) {
+                return registry.get<const NetworkId>(lhs).value < registry.get<const NetworkId>(rhs).value;
+            });
+    }
+
     entt::entity FindPlayerEntity(std::uint32_t player_id) const {
         const auto iter = player_entities.find(player_id);
         if (iter == player_entities.end()) {
@@ -217,7 +627,7 @@ struct Runtime::Impl final {
     }
 
     void SpawnTrainingHostileTarget() {
-        const entt::entity hostile = registry.create();
+        const entt::entity hostile = CreateNetworkedEntity();
         registry.emplace<Transform>(hostile, Transform{.tile_x = 6.5F, .tile_y = -4.0F});
         registry.emplace<Collider>(hostile, Collider{.radius = 0.45F});
         registry.emplace<Health>(hostile, Health{.value = 20});
@@ -227,7 +637,7 @@ struct Runtime::Impl final {
 
     void RunSpawnSystem() {
         for (const ProjectileSpawnRequest& spawn : pending_projectile_spawns) {
-            const entt::entity projectile = registry.create();
+            const entt::entity projectile = CreateNetworkedEntity();
             registry.emplace<Transform>(
                 projectile,
                 Transform{
@@ -259,7 +669,7 @@ struct Runtime::Impl final {
 
     void RunDropSpawnSystem() {
         for (const DropSpawnRequest& spawn : pending_drop_spawns) {
-            const entt::entity drop_entity = registry.create();
+            const entt::entity drop_entity = CreateNetworkedEntity();
             registry.emplace<Transform>(
                 drop_entity,
                 Transform{
@@ -317,15 +727,20 @@ struct Runtime::Impl final {
 
     void RunCollisionSystem() {
         const auto projectile_view = registry.view<const Projectile, const Transform, const Collider, const Faction>();
-        const auto hostile_view = registry.view<const HostileTarget, const Transform, const Collider, const Faction, Health>();
+        const auto hostile_view =
+            registry.view<const HostileTarget, const Transform, const Collider, const Faction, const NetworkId, Health>();
         const auto drop_view = registry.view<const WorldDrop, const Transform, const Collider>();
 
+        // Pool walk order is an EnTT implementation detail (and differs after a state load), so a projectile
+        // overlapping several hostiles hits the one with the lowest network id.
         for (const entt::entity projectile_entity : projectile_view) {
             const auto& projectile = projectile_view.get<const Projectile>(projectile_entity);
             const auto& projectile_transform = projectile_view.get<const Transform>(projectile_entity);
             const auto& projectile_collider = projectile_view.get<const Collider>(projectile_entity);
             const auto& projectile_faction = projectile_view.get<const Faction>(projectile_entity);
 
+            entt::entity hit_entity = entt::null;
+            std::uint32_t hit_network_id = 0;
             for (const entt::entity hostile_entity : hostile_view) {
                 const auto& hostile_transform = hostile_view.get<const Transform>(hostile_entity);
                 const auto& hostile_collider = hostile_view.get<const Collider>(hostile_entity);
@@ -343,15 +758,23 @@ struct Runtime::Impl final {
                     continue;
                 }
 
-                pending_damage_requests.push_back(DamageRequest{
-                    .target = hostile_entity,
-                    .damage = projectile.damage,
-                });
-
-                registry.emplace_or_replace<Lifetime>(projectile_entity, Lifetime{.ticks_remaining = 0});
-                ++diagnostics.total_damage_instances;
-                break;
+                const std::uint32_t network_id = hostile_view.get<const NetworkId>(hostile_entity).value;
+                if (hit_entity == entt::null || network_id < hit_network_id) {
+                    hit_entity = hostile_entity;
+                    hit_network_id = network_id;
+                }
+            }
+            if (hit_entity == entt::null) {
+                continue;
             }
+
+            pending_damage_requests.push_back(DamageRequest{
+                .target = hit_entity,
+                .damage = projectile.damage,
+            });
+
+            registry.emplace_or_replace<Lifetime>(projectile_entity, Lifetime{.ticks_remaining = 0});
+            ++diagnostics.total_damage_instances;
         }
 
         (void)drop_view;
@@ -389,7 +812,9 @@ struct Runtime::Impl final {
     }
 
     void RunPickupProbeSystem() {
-        const auto drop_view = registry.view<const WorldDrop, const Transform, const Collider>();
+        // Like collisions, a probe overlapping several drops takes the lowest network id rather than
+        // whichever drop the pool happens to yield first.
+        const auto drop_view = registry.view<const WorldDrop, const Transform, const Collider, const NetworkId>();
         std::vector<entt::entity> consumed_drop_entities;
         for (const PickupProbeRequest& probe : pending_pickup_probes) {
             float probe_tile_x = static_cast<float>(probe.payload.tile_x) + 0.5F;
@@ -401,8 +826,9 @@ struct Runtime::Impl final {
                 probe_tile_y = player_transform.tile_y;
             }
 
+            entt::entity picked_entity = entt::null;
+            std::uint32_t picked_network_id = 0;
             for (const entt::entity entity : drop_view) {
-                const auto& drop = drop_view.get<const WorldDrop>(entity);
                 const auto& transform = drop_view.get<const Transform>(entity);
                 const auto& collider = drop_view.get<const Collider>(entity);
 
@@ -417,20 +843,29 @@ struct Runtime::Impl final {
                     continue;
                 }
 
-                AddPickupToInventory(probe.player_id, drop.material_id, drop.amount);
-                diagnostics.total_drop_picked_up += drop.amount;
-                pending_gameplay_events.push_back(GameplayEvent{
-                    .type = GameplayEventType::PickupResolved,
-                    .player_id = probe.player_id,
-                    .tile_x = probe.payload.tile_x,
-                    .tile_y = probe.payload.tile_y,
-                    .material_id = drop.material_id,
-                    .resource_id = 0,
-                    .amount = drop.amount,
-                });
-                consumed_drop_entities.push_back(entity);
-                break;
+                const std::uint32_t network_id = drop_view.get<const NetworkId>(entity).value;
+                if (picked_entity == entt::null || network_id < picked_network_id) {
+                    picked_entity = entity;
+                    picked_network_id = network_id;
+                }
+            }
+            if (picked_entity == entt::null) {
+                continue;
             }
+
+            const auto& drop = drop_view.get<const WorldDrop>(picked_entity);
+            AddPickupToInventory(probe.player_id, drop.material_id, drop.amount);
+            diagnostics.total_drop_picked_up += drop.amount;
+            pending_gameplay_events.push_back(GameplayEvent{
+                .type = GameplayEventType::PickupResolved,
+                .player_id = probe.player_id,
+                .tile_x = probe.payload.tile_x,
+                .tile_y = probe.payload.tile_y,
+                .material_id = drop.material_id,
+                .resource_id = 0,
+                .amount = drop.amount,
+            });
+            consumed_drop_entities.push_back(picked_entity);
         }
 
         DestroyEntities(consumed_drop_entities);
@@ -452,6 +887,10 @@ struct Runtime::Impl final {
     }
 };
 
+std::uint32_t BackendCallDepth() {
+    return g_backend_call_depth;
+}
+
 Runtime::Runtime() : impl_(std::make_unique<Impl>()) {}
 
 Runtime::~Runtime() = default;
@@ -461,6 +900,7 @@ Runtime::Runtime(Runtime&&) noexcept = default;
 Runtime& Runtime::operator=(Runtime&&) noexcept = default;
 
 bool Runtime::Initialize(std::string& out_error) {
+    const BackendCallScope backend_call_scope;
     impl_->ResetState();
     impl_->SpawnTrainingHostileTarget();
 
@@ -470,6 +910,7 @@ bool Runtime::Initialize(std::string& out_error) {
 }
 
 void Runtime::Shutdown() {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized) {
         return;
     }
@@ -479,6 +920,7 @@ void Runtime::Shutdown() {
 }
 
 void Runtime::EnsurePlayer(std::uint32_t player_id) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized || player_id == 0) {
         return;
     }
@@ -487,6 +929,7 @@ void Runtime::EnsurePlayer(std::uint32_t player_id) {
 }
 
 PlayerInventorySnapshot Runtime::InventorySnapshot(std::uint32_t player_id) const {
+    const BackendCallScope backend_call_scope;
     const entt::entity entity = impl_->FindPlayerEntity(player_id);
     if (entity == entt::null || !impl_->registry.all_of<PlayerInventory>(entity)) {
         return PlayerInventorySnapshot{};
@@ -507,6 +950,7 @@ PlayerInventorySnapshot Runtime::InventorySnapshot(std::uint32_t player_id) cons
 }
 
 ActionPrimaryProgressSnapshot Runtime::ActionPrimaryProgressSnapshot(std::uint32_t player_id) const {
+    const BackendCallScope backend_call_scope;
     const entt::entity entity = impl_->FindPlayerEntity(player_id);
     if (entity == entt::null || !impl_->registry.all_of<PrimaryActionProgress>(entity)) {
         return ::novaria::sim::ActionPrimaryProgressSnapshot{};
@@ -529,6 +973,7 @@ ActionPrimaryProgressSnapshot Runtime::ActionPrimaryProgressSnapshot(std::uint32
 }
 
 PlayerMotionSnapshot Runtime::MotionSnapshot(std::uint32_t player_id) const {
+    const BackendCallScope backend_call_scope;
     const entt::entity entity = impl_->FindPlayerEntity(player_id);
     if (entity == entt::null || !impl_->registry.all_of<PlayerMotion>(entity)) {
         return PlayerMotionSnapshot{};
@@ -538,7 +983,56 @@ PlayerMotionSnapshot Runtime::MotionSnapshot(std::uint32_t player_id) const {
     return SnapshotPlayerMotion(motion.state);
 }
 
+PlayerMotionState Runtime::MotionState(std::uint32_t player_id) const {
+    const BackendCallScope backend_call_scope;
+    const entt::entity entity = impl_->FindPlayerEntity(player_id);
+    if (entity == entt::null || !impl_->registry.all_of<PlayerMotion>(entity)) {
+        return PlayerMotionState{};
+    }
+
+    return impl_->registry.get<const PlayerMotion>(entity).state;
+}
+
+std::vector<std::uint32_t> Runtime::PlayerIds() const {
+    const BackendCallScope backend_call_scope;
+    std::vector<std::uint32_t> player_ids;
+    CollectPlayerIds(player_ids);
+    return player_ids;
+}
+
+void Runtime::CollectPlayerIds(std::vector<std::uint32_t>& out_player_ids) const {
+    const BackendCallScope backend_call_scope;
+    out_player_ids.clear();
+    out_player_ids.reserve(impl_->player_entities.size());
+    for (const auto& [player_id, entity] : impl_->player_entities) {
+        if (impl_->registry.valid(entity)) {
+            out_player_ids.push_back(player_id);
+        }
+    }
+
+    std::sort(out_player_ids.begin(), out_player_ids.end());
+}
+
+void Runtime::SetPlayerMotionState(std::uint32_t player_id, const PlayerMotionState& state) {
+    const BackendCallScope backend_call_scope;
+    if (!impl_->initialized || player_id == 0) {
+        return;
+    }
+
+    const entt::entity player = impl_->EnsurePlayerEntity(player_id);
+    if (player == entt::null || !impl_->registry.all_of<PlayerMotion, Transform>(player)) {
+        return;
+    }
+
+    impl_->registry.get<PlayerMotion>(player).state = state;
+    const PlayerMotionSnapshot snapshot = SnapshotPlayerMotion(state);
+    auto& transform = impl_->registry.get<Transform>(player);
+    transform.tile_x = snapshot.position_x;
+    transform.tile_y = snapshot.position_y;
+}
+
 void Runtime::SetPlayerMotionInput(std::uint32_t player_id, const PlayerMotionInput& input) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized || player_id == 0) {
         return;
     }
@@ -559,6 +1053,7 @@ void Runtime::AddResourceToInventory(
     std::uint32_t player_id,
     std::uint16_t resource_id,
     std::uint32_t amount) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized || player_id == 0) {
         return;
     }
@@ -580,6 +1075,7 @@ bool Runtime::TryCraftRecipePlan(
     std::uint32_t player_id,
     const CraftRecipePlan& plan,
     std::uint16_t& out_crafted_material_id) {
+    const BackendCallScope backend_call_scope;
     out_crafted_material_id = 0;
     if (!impl_->initialized || player_id == 0) {
         return false;
@@ -634,6 +1130,7 @@ void Runtime::ApplyActionPrimary(
     const ActionPrimaryPlan& plan,
     std::uint16_t target_material_id,
     world::IWorldService& world_service) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized || player_id == 0) {
         return;
     }
@@ -681,18 +1178,15 @@ void Runtime::ApplyActionPrimary(
     }
 
     if (progress.is_harvest) {
-        std::string error;
-        (void)world_service.ApplyTileMutation(
-            world::TileMutation{
-                .tile_x = progress.target_tile_x,
-                .tile_y = progress.target_tile_y,
-                .material_id = world::material::kAir,
-            },
-            error);
+        (void)world_service.ApplyTileMutation(world::TileMutation{
+            .tile_x = progress.target_tile_x,
+            .tile_y = progress.target_tile_y,
+            .material_id = world::material::kAir,
+        });
 
         const std::uint16_t drop_material =
             target_material_id == world::material::kGrass ? world::material::kDirt : target_material_id;
-        impl_->pending_drop_spawns.push_back(Impl::DropSpawnRequest{
+        impl_->pending_drop_spawns.push_back(DropSpawnRequest{
             .payload = command::SpawnDropPayload{
                 .tile_x = progress.target_tile_x,
                 .tile_y = progress.target_tile_y,
@@ -723,14 +1217,11 @@ void Runtime::ApplyActionPrimary(
             }
         }
 
-        std::string error;
-        if (!world_service.ApplyTileMutation(
-                world::TileMutation{
-                    .tile_x = progress.target_tile_x,
-                    .tile_y = progress.target_tile_y,
-                    .material_id = progress.place_material_id,
-                },
-                error)) {
+        if (!world_service.ApplyTileMutation(world::TileMutation{
+                .tile_x = progress.target_tile_x,
+                .tile_y = progress.target_tile_y,
+                .material_id = progress.place_material_id,
+            })) {
             progress = {};
             return;
         }
@@ -756,36 +1247,40 @@ void Runtime::ApplyActionPrimary(
 void Runtime::QueueSpawnProjectile(
     std::uint32_t owner_player_id,
     const command::FireProjectilePayload& payload) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized || owner_player_id == 0) {
         return;
     }
 
-    impl_->pending_projectile_spawns.push_back(Impl::ProjectileSpawnRequest{
+    impl_->pending_projectile_spawns.push_back(ProjectileSpawnRequest{
         .owner_player_id = owner_player_id,
         .payload = payload,
     });
 }
 
 void Runtime::QueueSpawnWorldDrop(const command::SpawnDropPayload& payload) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized) {
         return;
     }
 
-    impl_->pending_drop_spawns.push_back(Impl::DropSpawnRequest{.payload = payload});
+    impl_->pending_drop_spawns.push_back(DropSpawnRequest{.payload = payload});
 }
 
 void Runtime::QueuePickupProbe(std::uint32_t player_id, const command::PickupProbePayload& payload) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized || player_id == 0) {
         return;
     }
 
-    impl_->pending_pickup_probes.push_back(Impl::PickupProbeRequest{
+    impl_->pending_pickup_probes.push_back(PickupProbeRequest{
         .player_id = player_id,
         .payload = payload,
     });
 }
 
 void Runtime::Tick(const core::TickContext& tick_context, const world::IWorldService& world_service) {
+    const BackendCallScope backend_call_scope;
     if (!impl_->initialized) {
         return;
     }
@@ -805,19 +1300,209 @@ void Runtime::Tick(const core::TickContext& tick_context, const world::IWorldSer
 }
 
 std::vector<CombatEvent> Runtime::ConsumeCombatEvents() {
-    std::vector<CombatEvent> events = std::move(impl_->pending_combat_events);
-    impl_->pending_combat_events.clear();
+    const BackendCallScope backend_call_scope;
+    std::vector<CombatEvent> events;
+    ConsumeCombatEvents(events);
     return events;
 }
 
+void Runtime::ConsumeCombatEvents(std::vector<CombatEvent>& out_events) {
+    const BackendCallScope backend_call_scope;
+    out_events.clear();
+    out_events.swap(impl_->pending_combat_events);
+}
+
 std::vector<GameplayEvent> Runtime::ConsumeGameplayEvents() {
-    std::vector<GameplayEvent> events = std::move(impl_->pending_gameplay_events);
-    impl_->pending_gameplay_events.clear();
+    const BackendCallScope backend_call_scope;
+    std::vector<GameplayEvent> events;
+    ConsumeGameplayEvents(events);
     return events;
 }
 
+void Runtime::ConsumeGameplayEvents(std::vector<GameplayEvent>& out_events) {
+    const BackendCallScope backend_call_scope;
+    out_events.clear();
+    out_events.swap(impl_->pending_gameplay_events);
+}
+
+std::vector<ReplicatedEntitySnapshot> Runtime::ReplicatedEntities() const {
+    const BackendCallScope backend_call_scope;
+    std::vector<ReplicatedEntitySnapshot> entities;
+    CollectReplicatedEntities(entities);
+    return entities;
+}
+
+void Runtime::CollectReplicatedEntities(std::vector<ReplicatedEntitySnapshot>& out_entities) const {
+    const BackendCallScope backend_call_scope;
+    out_entities.clear();
+    const entt::registry& registry = impl_->registry;
+    for (const entt::entity entity : registry.view<const NetworkId, const Transform>()) {
+        ReplicatedEntitySnapshot snapshot{
+            .network_id = registry.get<const NetworkId>(entity).value,
+        };
+        if (const auto* projectile = registry.try_get<const Projectile>(entity); projectile != nullptr) {
+            snapshot.kind = ReplicatedEntityKind::Projectile;
+            snapshot.owner_player_id = projectile->owner_player_id;
+        } else if (registry.all_of<HostileTarget>(entity)) {
+            snapshot.kind = ReplicatedEntityKind::Hostile;
+        } else if (const auto* drop = registry.try_get<const WorldDrop>(entity); drop != nullptr) {
+            snapshot.kind = ReplicatedEntityKind::Drop;
+            snapshot.material_id = drop->material_id;
+            snapshot.amount = drop->amount;
+        } else {
+            continue;
+        }
+
+        const auto& transform = registry.get<const Transform>(entity);
+        snapshot.position_x = transform.tile_x;
+        snapshot.position_y = transform.tile_y;
+        if (const auto* velocity = registry.try_get<const Velocity>(entity); velocity != nullptr) {
+            snapshot.velocity_x = velocity->tile_per_second_x;
+            snapshot.velocity_y = velocity->tile_per_second_y;
+        }
+        if (const auto* health = registry.try_get<const Health>(entity); health != nullptr) {
+            snapshot.health = health->value;
+        }
+        out_entities.push_back(snapshot);
+    }
+
+    std::sort(
+        out_entities.begin(),
+        out_entities.end(),
+        [](const ReplicatedEntitySnapshot& lhs, const ReplicatedEntitySnapshot& rhs) {
+            return lhs.network_id < rhs.network_id;
+        });
+}
+
 RuntimeDiagnostics Runtime::DiagnosticsSnapshot() const {
+    const BackendCallScope backend_call_scope;
     return impl_->diagnostics;
 }
 
+void Runtime::SaveState(wire::ByteWriter& writer) const {
+    const BackendCallScope backend_call_scope;
+    const Impl& impl = *impl_;
+    std::vector<entt::entity>& entities = impl.saved_entity_scratch;
+    impl.CollectSavedEntities(entities);
+
+    writer.WriteVarUInt(impl.next_network_id);
+    writer.WriteVarUInt(entities.size());
+    for (const entt::entity entity : entities) {
+        SavedComponents::Write(impl.registry, entity, writer);
+    }
+    WriteSavedValues(writer, impl.pending_projectile_spawns);
+    writer.WriteVarUInt(impl.pending_damage_requests.size());
+    for (const DamageRequest& request : impl.pending_damage_requests) {
+        // Targets are saved as 1-based positions in the saved entity list; 0 marks a target that is gone.
+        const auto target = std::find(entities.begin(), entities.end(), request.target);
+        WriteSavedValue(writer, SavedDamageRequest{
+            .target_index = target == entities.end() ? 0 : static_cast<std::uint32_t>(target - entities.begin()) + 1,
+            .damage = request.damage,
+        });
+    }
+    WriteSavedValues(writer, impl.pending_combat_events);
+    WriteSavedValues(writer, impl.pending_drop_spawns);
+    WriteSavedValues(writer, impl.pending_pickup_probes);
+    WriteSavedValues(writer, impl.pending_gameplay_events);
+    WriteSavedValue(writer, impl.diagnostics);
+}
+
+core::Status Runtime::LoadState(wire::ByteReader& reader) {
+    const BackendCallScope backend_call_scope;
+    const core::Status status = StageState(reader);
+    if (!status.IsOk()) {
+        return status;
+    }
+    CommitStagedState();
+    return core::Status::Ok();
+}
+
+core::Status Runtime::StageState(wire::ByteReader& reader) {
+    const BackendCallScope backend_call_scope;
+    if (!impl_->initialized) {
+        return core::Status::Error(core::StatusCode::NotInitialized, "ECS runtime is not initialized.");
+    }
+
+    const core::Status malformed =
+        core::Status::Error(core::StatusCode::MalformedPayload, "ECS state is truncated or malformed.");
+    Impl::StagedState& staged = impl_->staged_state;
+    std::uint64_t next_network_id = 0;
+    std::uint64_t entity_count = 0;
+    if (!reader.ReadVarUInt(next_network_id) ||
+        next_network_id > std::numeric_limits<std::uint32_t>::max() ||
+        !reader.ReadVarUInt(entity_count) ||
+        entity_count > reader.Remaining()) {
+        return malformed;
+    }
+    staged.next_network_id = static_cast<std::uint32_t>(next_network_id);
+
+    // Records must arrive in the order CollectSavedEntities writes them; rejecting anything else also
+    // rejects duplicate players and network ids.
+    staged.entities.resize(static_cast<std::size_t>(entity_count));
+    bool in_players = true;
+    std::uint32_t previous_key = 0;
+    for (std::size_t index = 0; index < staged.entities.size(); ++index) {
+        SavedComponents::Record& record = staged.entities[index];
+        if (!SavedComponents::Read(reader, record) ||
+            record.Has<PlayerId>() == record.Has<NetworkId>()) {
+            return malformed;
+        }
+        const bool is_player = record.Has<PlayerId>();
+        const std::uint32_t key = is_player ? record.Get<PlayerId>().value : record.Get<NetworkId>().value;
+        if ((is_player && !in_players) || (index > 0 && is_player == in_players && key <= previous_key)) {
+            return malformed;
+        }
+        in_players = is_player;
+        previous_key = key;
+    }
+
+    const bool loaded =
+        ReadSavedValues(reader, staged.pending_projectile_spawns) &&
+        ReadSavedValues(reader, staged.pending_damage_requests) &&
+        ReadSavedValues(reader, staged.pending_combat_events) &&
+        ReadSavedValues(reader, staged.pending_drop_spawns) &&
+        ReadSavedValues(reader, staged.pending_pickup_probes) &&
+        ReadSavedValues(reader, staged.pending_gameplay_events) &&
+        ReadSavedValue(reader, staged.diagnostics) &&
+        std::all_of(
+            staged.pending_damage_requests.begin(),
+            staged.pending_damage_requests.end(),
+            [&staged](const SavedDamageRequest& request) {
+                return request.target_index <= staged.entities.size();
+            });
+    return loaded ? core::Status::Ok() : malformed;
+}
+
+void Runtime::CommitStagedState() {
+    const BackendCallScope backend_call_scope;
+    Impl& impl = *impl_;
+    Impl::StagedState& staged = impl.staged_state;
+    impl.ResetState();
+    impl.next_network_id = staged.next_network_id;
+
+    std::vector<entt::entity>& entities = impl.staged_entity_scratch;
+    entities.clear();
+    for (const SavedComponents::Record& record : staged.entities) {
+        const entt::entity entity = impl.registry.create();
+        SavedComponents::Emplace(impl.registry, entity, record);
+        if (record.Has<PlayerId>()) {
+            impl.player_entities[record.Get<PlayerId>().value] = entity;
+        }
+        entities.push_back(entity);
+    }
+    for (const SavedDamageRequest& request : staged.pending_damage_requests) {
+        impl.pending_damage_requests.push_back(DamageRequest{
+            .target = request.target_index == 0 ? entt::null : entities[request.target_index - 1],
+            .damage = request.damage,
+        });
+    }
+
+    impl.pending_projectile_spawns.swap(staged.pending_projectile_spawns);
+    impl.pending_combat_events.swap(staged.pending_combat_events);
+    impl.pending_drop_spawns.swap(staged.pending_drop_spawns);
+    impl.pending_pickup_probes.swap(staged.pending_pickup_probes);
+    impl.pending_gameplay_events.swap(staged.pending_gameplay_events);
+    impl.diagnostics = staged.diagnostics;
+}
+
 }  // namespace novaria::sim::ecs
@@ -0,0 +1,172 @@
+#include "sim/entity_interpolation.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace novaria::sim {
+namespace {
+
+float Lerp(float from, float to, double t) {
+    return static_cast<float>(static_cast<double>(from) + (static_cast<double>(to) - from) * t);
+}
+
+}  // namespace
+
+void EntityInterpolationBuffer::Reset() {
+    entity_snapshots_.clear();
+    clock_synced_ = false;
+    server_tick_offset_ = 0.0;
+    newest_server_tick_ = 0;
+}
+
+void EntityInterpolationBuffer::SetSettings(const EntityInterpolationSettings& settings) {
+    settings_ = EntityInterpolationSettings{
+        .delay_seconds = std::max(0.0, settings.delay_seconds),
+        .max_extrapolation_seconds = std::max(0.0, settings.max_extrapolation_seconds),
+    };
+}
+
+const EntityInterpolationSettings& EntityInterpolationBuffer::Settings() const {
+    return settings_;
+}
+
+void EntityInterpolationBuffer::ObserveServerTick(std::uint64_t server_tick, std::uint64_t local_tick) {
+    const double observed_offset = static_cast<double>(server_tick) - static_cast<double>(local_tick);
+    if (!clock_synced_ || std::fabs(observed_offset - server_tick_offset_) > kClockResyncTicks) {
+        server_tick_offset_ = observed_offset;
+        clock_synced_ = true;
+        ++diagnostics_.clock_resync_count;
+    } else if (observed_offset > server_tick_offset_) {
+        server_tick_offset_ = observed_offset;
+    } else {
+        server_tick_offset_ -= std::min(
+            server_tick_offset_ - observed_offset,
+            kClockDecayTicksPerObservation);
+    }
+
+    newest_server_tick_ = std::max(newest_server_tick_, server_tick);
+    EvictStaleEntities();
+}
+
+void EntityInterpolationBuffer::PushSample(
+    std::uint32_t entity_id,
+    std::uint64_t server_tick,
+    const PlayerMotionState& state) {
+    auto entity_it = entity_snapshots_.find(entity_id);
+    if (entity_it == entity_snapshots_.end()) {
+        if (entity_snapshots_.size() >= kMaxEntities) {
+            ++diagnostics_.dropped_entity_limit_count;
+            return;
+        }
+        entity_it = entity_snapshots_.emplace(entity_id, std::deque<Snapshot>{}).first;
+    }
+
+    std::deque<Snapshot>& snapshots = entity_it->second;
+    if (!snapshots.empty() && server_tick <= snapshots.back().server_tick) {
+        ++diagnostics_.dropped_out_of_order_count;
+        return;
+    }
+
+    snapshots.push_back(Snapshot{.server_tick = server_tick, .state = state});
+    if (snapshots.size() > kMaxSamplesPerEntity) {
+        snapshots.pop_front();
+    }
+    newest_server_tick_ = std::max(newest_server_tick_, server_tick);
+}
+
+std::vector<InterpolatedEntityState> EntityInterpolationBuffer::Sample(
+    std::uint64_t local_tick,
+    float interpolation_alpha,
+    double fixed_delta_seconds) {
+    std::vector<InterpolatedEntityState> sampled_states;
+    if (!clock_synced_ || fixed_delta_seconds <= 0.0) {
+        return sampled_states;
+    }
+
+    const double delay_ticks = settings_.delay_seconds / fixed_delta_seconds;
+    const double max_extrapolation_ticks = settings_.max_extrapolation_seconds / fixed_delta_seconds;
+    const double render_tick =
+        static_cast<double>(local_tick) +
+        server_tick_offset_ +
+        static_cast<double>(std::clamp(interpolation_alpha, 0.0F, 1.0F)) -
+        delay_ticks;
+
+    sampled_states.reserve(entity_snapshots_.size());
+    for (auto& [entity_id, snapshots] : entity_snapshots_) {
+        while (snapshots.size() >= 2 &&
+               static_cast<double>(snapshots[1].server_tick) <= render_tick) {
+            snapshots.pop_front();
+        }
+        if (snapshots.empty()) {
+            continue;
+        }
+
+        const Snapshot& from = snapshots.front();
+        InterpolatedEntityState sampled{
+            .entity_id = entity_id,
+            .position_x = from.state.position_x,
+            .position_y = from.state.position_y,
+            .velocity_x = from.state.velocity_x,
+            .velocity_y = from.state.velocity_y,
+        };
+
+        const double from_tick = static_cast<double>(from.server_tick);
+        if (render_tick < from_tick) {
+            ++diagnostics_.underflow_sample_count;
+        } else if (snapshots.size() >= 2) {
+            const Snapshot& to = snapshots[1];
+            const double t = (render_tick - from_tick) /
+                (static_cast<double>(to.server_tick) - from_tick);
+            sampled.position_x = Lerp(from.state.position_x, to.state.position_x, t);
+            sampled.position_y = Lerp(from.state.position_y, to.state.position_y, t);
+            sampled.velocity_x = Lerp(from.state.velocity_x, to.state.velocity_x, t);
+            sampled.velocity_y = Lerp(from.state.velocity_y, to.state.velocity_y, t);
+            ++diagnostics_.interpolated_sample_count;
+        } else if (render_tick > from_tick) {
+            double extrapolation_ticks = render_tick - from_tick;
+            if (extrapolation_ticks > max_extrapolation_ticks) {
+                extrapolation_ticks = max_extrapolation_ticks;
+                ++diagnostics_.extrapolation_clamped_count;
+            }
+            const double extrapolation_seconds = extrapolation_ticks * fixed_delta_seconds;
+            sampled.position_x = static_cast<float>(
+                from.state.position_x + from.state.velocity_x * extrapolation_seconds);
+            sampled.position_y = static_cast<float>(
+                from.state.position_y + from.state.velocity_y * extrapolation_seconds);
+            sampled.extrapolated = true;
+            ++diagnostics_.extrapolated_sample_count;
+        } else {
+            ++diagnostics_.interpolated_sample_count;
+        }
+
+        sampled_states.push_back(sampled);
+    }
+
+    std::sort(
+        sampled_states.begin(),
+        sampled_states.end(),
+        [](const InterpolatedEntityState& lhs, const InterpolatedEntityState& rhs) {
+            return lhs.entity_id < rhs.entity_id;
+        });
+    return sampled_states;
+}
+
+EntityInterpolationDiagnostics EntityInterpolationBuffer::DiagnosticsSnapshot() const {
+    EntityInterpolationDiagnostics diagnostics = diagnostics_;
+    diagnostics.tracked_entity_count = entity_snapshots_.size();
+    return diagnostics;
+}
+
+void EntityInterpolationBuffer::EvictStaleEntities() {
+    for (auto it = entity_snapshots_.begin(); it != entity_snapshots_.end();) {
+        if (it->second.empty() ||
+            it->second.back().server_tick + kStaleEntityTicks < newest_server_tick_) {
+            it = entity_snapshots_.erase(it);
+            ++diagnostics_.stale_entity_evicted_count;
+            continue;
+        }
+        ++it;
+    }
+}
+
+}  // namespace novaria::sim
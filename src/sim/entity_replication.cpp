@@ -0,0 +1,535 @@
+#include "sim/entity_replication.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace novaria::sim {
+namespace {
+
+constexpr float kMaxQuantizedMagnitude = 1073741824.0F;
+
+std::int32_t Quantize(float value, float units_per_tile) {
+    if (!std::isfinite(value)) {
+        return 0;
+    }
+
+    const float scaled = std::clamp(
+        std::round(value * units_per_tile),
+        -kMaxQuantizedMagnitude,
+        kMaxQuantizedMagnitude);
+    return static_cast<std::int32_t>(scaled);
+}
+
+bool IsSameAttributes(const QuantizedEntityState& lhs, const QuantizedEntityState& rhs) {
+    return lhs.material_id == rhs.material_id &&
+        lhs.amount == rhs.amount &&
+        lhs.owner_player_id == rhs.owner_player_id;
+}
+
+EntityDeltaUpdate BuildCreatedUpdate(const QuantizedEntityState& entity) {
+    return EntityDeltaUpdate{
+        .field_mask = kEntityDeltaFieldAll,
+        .values = entity,
+    };
+}
+
+// Deltas are taken in 64 bits: quantized values span [-2^30, 2^30], so their difference can exceed int32.
+bool TryBuildDeltaValue(std::int32_t baseline, std::int32_t current, std::int32_t& out_delta) {
+    const std::int64_t delta = static_cast<std::int64_t>(current) - baseline;
+    if (delta < std::numeric_limits<std::int32_t>::min() ||
+        delta > std::numeric_limits<std::int32_t>::max()) {
+        return false;
+    }
+    out_delta = static_cast<std::int32_t>(delta);
+    return true;
+}
+
+EntityDeltaUpdate BuildChangedUpdate(
+    const QuantizedEntityState& baseline,
+    const QuantizedEntityState& current) {
+    EntityDeltaUpdate update{};
+    update.values.network_id = current.network_id;
+    update.values.kind = current.kind;
+    bool delta_fits = true;
+    if (current.position_x != baseline.position_x || current.position_y != baseline.position_y) {
+        update.field_mask |= kEntityDeltaFieldPosition;
+        delta_fits &= TryBuildDeltaValue(baseline.position_x, current.position_x, update.values.position_x);
+        delta_fits &= TryBuildDeltaValue(baseline.position_y, current.position_y, update.values.position_y);
+    }
+    if (current.velocity_x != baseline.velocity_x || current.velocity_y != baseline.velocity_y) {
+        update.field_mask |= kEntityDeltaFieldVelocity;
+        delta_fits &= TryBuildDeltaValue(baseline.velocity_x, current.velocity_x, update.values.velocity_x);
+        delta_fits &= TryBuildDeltaValue(baseline.velocity_y, current.velocity_y, update.values.velocity_y);
+    }
+    if (current.health != baseline.health) {
+        update.field_mask |= kEntityDeltaFieldHealth;
+        delta_fits &= TryBuildDeltaValue(baseline.health, current.health, update.values.health);
+    }
+    if (!delta_fits) {
+        // Created updates carry absolute values and replace the receiver's copy outright.
+        return BuildCreatedUpdate(current);
+    }
+    if (!IsSameAttributes(current, baseline)) {
+        update.field_mask |= kEntityDeltaFieldAttributes;
+        update.values.material_id = current.material_id;
+        update.values.amount = current.amount;
+        update.values.owner_player_id = current.owner_player_id;
+    }
+    return update;
+}
+
+bool TryApplyDeltaValue(std::int32_t& value, std::int32_t delta) {
+    const std::int64_t applied = static_cast<std::int64_t>(value) + delta;
+    if (applied < std::numeric_limits<std::int32_t>::min() ||
+        applied > std::numeric_limits<std::int32_t>::max()) {
+        return false;
+    }
+    value = static_cast<std::int32_t>(applied);
+    return true;
+}
+
+std::vector<QuantizedEntityState>::iterator FindEntity(
+    std::vector<QuantizedEntityState>& entities,
+    std::uint32_t network_id) {
+    const auto iter = std::lower_bound(
+        entities.begin(),
+        entities.end(),
+        network_id,
+        [](const QuantizedEntityState& entity, std::uint32_t id) {
+            return entity.network_id < id;
+        });
+    if (iter == entities.end() || iter->network_id != network_id) {
+        return entities.end();
+    }
+    return iter;
+}
+
+}  // namespace
+
+QuantizedEntityState QuantizeReplicatedEntity(const ecs::ReplicatedEntitySnapshot& entity) {
+    return QuantizedEntityState{
+        .network_id = entity.network_id,
+        .kind = entity.kind,
+        .position_x = Quantize(entity.position_x, kReplicatedPositionUnitsPerTile),
+        .position_y = Quantize(entity.position_y, kReplicatedPositionUnitsPerTile),
+        .velocity_x = Quantize(entity.velocity_x, kReplicatedVelocityUnitsPerTile),
+        .velocity_y = Quantize(entity.velocity_y, kReplicatedVelocityUnitsPerTile),
+        .health = entity.health,
+        .material_id = entity.material_id,
+        .amount = entity.amount,
+        .owner_player_id = entity.owner_player_id,
+    };
+}
+
+ecs::ReplicatedEntitySnapshot ReplicatedPlayerEntity(std::uint32_t player_id, const PlayerMotionState& motion) {
+    return ecs::ReplicatedEntitySnapshot{
+        .network_id = kReplicatedPlayerNetworkIdFlag | player_id,
+        .kind = ecs::ReplicatedEntityKind::Player,
+        .position_x = motion.position_x,
+        .position_y = motion.position_y,
+        .velocity_x = motion.velocity_x,
+        .velocity_y = motion.velocity_y,
+        .owner_player_id = player_id,
+    };
+}
+
+ecs::ReplicatedEntitySnapshot DequantizeReplicatedEntity(const QuantizedEntityState& entity) {
+    return ecs::ReplicatedEntitySnapshot{
+        .network_id = entity.network_id,
+        .kind = entity.kind,
+        .position_x = static_cast<float>(entity.position_x) / kReplicatedPositionUnitsPerTile,
+        .position_y = static_cast<float>(entity.position_y) / kReplicatedPositionUnitsPerTile,
+        .velocity_x = static_cast<float>(entity.velocity_x) / kReplicatedVelocityUnitsPerTile,
+        .velocity_y = static_cast<float>(entity.velocity_y) / kReplicatedVelocityUnitsPerTile,
+        .health = entity.health,
+        .material_id = entity.material_id,
+        .amount = entity.amount,
+        .owner_player_id = entity.owner_player_id,
+    };
+}
+
+void EntityReplicationSender::Reset() {
+    for (auto& [client_player_id, client] : clients_) {
+        (void)client_player_id;
+        DropOldestSentSnapshots(client, client.sent_snapshots.size());
+    }
+    clients_.clear();
+    diagnostics_.client_count = 0;
+}
+
+void EntityReplicationSender::SetSettings(const EntityReplicationSettings& settings) {
+    settings_ = settings;
+    settings_.interest_radius_tiles = std::max(0.0F, settings_.interest_radius_tiles);
+    settings_.max_entities_per_client =
+        std::min(settings_.max_entities_per_client, kMaxEntityDeltaEntries);
+}
+
+const EntityReplicationSettings& EntityReplicationSender::Settings() const {
+    return settings_;
+}
+
+void EntityReplicationSender::Acknowledge(std::uint32_t client_player_id, std::uint64_t acked_tick) {
+    const auto client_it = clients_.find(client_player_id);
+    if (client_it == clients_.end()) {
+        ++diagnostics_.ignored_ack_count;
+        return;
+    }
+
+    ClientState& client = client_it->second;
+    if (client.has_acked_tick && acked_tick <= client.acked_tick) {
+        ++diagnostics_.ignored_ack_count;
+        return;
+    }
+
+    const auto snapshot_it = std::find_if(
+        client.sent_snapshots.begin(),
+        client.sent_snapshots.end(),
+        [acked_tick](const SentSnapshot& snapshot) {
+            return snapshot.tick_index == acked_tick;
+        });
+    if (snapshot_it == client.sent_snapshots.end()) {
+        ++diagnostics_.ignored_ack_count;
+        return;
+    }
+
+    DropOldestSentSnapshots(
+        client,
+        static_cast<std::size_t>(snapshot_it - client.sent_snapshots.begin()));
+    client.has_acked_tick = true;
+    client.acked_tick = acked_tick;
+}
+
+void EntityReplicationSender::SelectInterestSet(
+    std::uint32_t client_player_id,
+    float interest_center_x,
+    float interest_center_y,
+    const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+    std::vector<QuantizedEntityState>& out_selected) {
+    using Candidate = InterestCandidate;
+
+    const float radius_sq = settings_.interest_radius_tiles * settings_.interest_radius_tiles;
+    std::vector<Candidate>& candidates = interest_candidates_;
+    candidates.clear();
+    for (std::size_t index = 0; index < entities.size(); ++index) {
+        // A client's own player arrives as its acked PlayerEntityState, never through the delta.
+        if (entities[index].kind == ecs::ReplicatedEntityKind::Player &&
+            entities[index].owner_player_id == client_player_id) {
+            continue;
+        }
+        const float delta_x = entities[index].position_x - interest_center_x;
+        const float delta_y = entities[index].position_y - interest_center_y;
+        const float distance_sq = delta_x * delta_x + delta_y * delta_y;
+        if (distance_sq > radius_sq) {
+            ++diagnostics_.interest_culled_count;
+            continue;
+        }
+        candidates.push_back(Candidate{.distance_sq = distance_sq, .index = index});
+    }
+
+    if (candidates.size() > settings_.max_entities_per_client) {
+        const auto budget_end =
+            candidates.begin() + static_cast<std::ptrdiff_t>(settings_.max_entities_per_client);
+        std::nth_element(
+            candidates.begin(),
+            budget_end,
+            candidates.end(),
+            [](const Candidate& lhs, const Candidate& rhs) {
+                if (lhs.distance_sq != rhs.distance_sq) {
+                    return lhs.distance_sq < rhs.distance_sq;
+                }
+                return lhs.index < rhs.index;
+            });
+        diagnostics_.budget_culled_count += candidates.size() - settings_.max_entities_per_client;
+        candidates.erase(budget_end, candidates.end());
+    }
+
+    out_selected.clear();
+    for (const Candidate& candidate : candidates) {
+        out_selected.push_back(QuantizeReplicatedEntity(entities[candidate.index]));
+    }
+    std::sort(
+        out_selected.begin(),
+        out_selected.end(),
+        [](const QuantizedEntityState& lhs, const QuantizedEntityState& rhs) {
+            return lhs.network_id < rhs.network_id;
+        });
+}
+
+std::vector<QuantizedEntityState> EntityReplicationSender::AcquireEntitySet() {
+    if (spare_entity_sets_.empty()) {
+        return {};
+    }
+
+    std::vector<QuantizedEntityState> entity_set = std::move(spare_entity_sets_.back());
+    spare_entity_sets_.pop_back();
+    return entity_set;
+}
+
+void EntityReplicationSender::DropOldestSentSnapshots(ClientState& client, std::size_t count) {
+    count = std::min(count, client.sent_snapshots.size());
+    for (std::size_t index = 0; index < count; ++index) {
+        std::vector<QuantizedEntityState>& entities = client.sent_snapshots[index].entities;
+        entities.clear();
+        spare_entity_sets_.push_back(std::move(entities));
+    }
+    client.sent_snapshots.erase(
+        client.sent_snapshots.begin(),
+        client.sent_snapshots.begin() + static_cast<std::ptrdiff_t>(count));
+}
+
+bool EntityReplicationSender::BuildClientDelta(
+    std::uint32_t client_player_id,
+    std::uint64_t tick_index,
+    float interest_center_x,
+    float interest_center_y,
+    const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+    wire::ByteBuffer& out_encoded_delta) {
+    wire::ByteWriter writer;
+    const bool built = BuildClientDelta(
+        client_player_id,
+        tick_index,
+        interest_center_x,
+        interest_center_y,
+        entities,
+        writer);
+    out_encoded_delta = writer.TakeBuffer();
+    return built;
+}
+
+bool EntityReplicationSender::BuildClientDelta(
+    std::uint32_t client_player_id,
+    std::uint64_t tick_index,
+    float interest_center_x,
+    float interest_center_y,
+    const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+    wire::ByteWriter& writer) {
+    if (client_player_id == 0) {
+        return false;
+    }
+
+    auto client_it = clients_.find(client_player_id);
+    if (client_it == clients_.end()) {
+        if (clients_.size() >= kMaxClients) {
+            ++diagnostics_.dropped_client_limit_count;
+            return false;
+        }
+        client_it = clients_.emplace(client_player_id, ClientState{}).first;
+        diagnostics_.client_count = clients_.size();
+    }
+    ClientState& client = client_it->second;
+
+    static const std::vector<QuantizedEntityState> kEmptyBaseline;
+    const std::vector<QuantizedEntityState>* baseline = &kEmptyBaseline;
+    EntityDelta& delta = delta_scratch_;
+    delta.recipient_player_id = client_player_id;
+    delta.has_baseline = false;
+    delta.baseline_tick = 0;
+    delta.removed_network_ids.clear();
+    delta.updates.clear();
+    if (client.has_acked_tick && !client.sent_snapshots.empty() &&
+        client.sent_snapshots.front().tick_index == client.acked_tick) {
+        baseline = &client.sent_snapshots.front().entities;
+        delta.has_baseline = true;
+        delta.baseline_tick = client.acked_tick;
+    }
+
+    std::vector<QuantizedEntityState> current = AcquireEntitySet();
+    SelectInterestSet(client_player_id, interest_center_x, interest_center_y, entities, current);
+    std::size_t baseline_index = 0;
+    std::size_t current_index = 0;
+    while (baseline_index < baseline->size() || current_index < current.size()) {
+        if (current_index == current.size() ||
+            (baseline_index < baseline->size() &&
+             (*baseline)[baseline_index].network_id < current[current_index].network_id)) {
+            delta.removed_network_ids.push_back((*baseline)[baseline_index].network_id);
+            ++baseline_index;
+            continue;
+        }
+
+        if (baseline_index == baseline->size() ||
+            current[current_index].network_id < (*baseline)[baseline_index].network_id) {
+            delta.updates.push_back(BuildCreatedUpdate(current[current_index]));
+            ++diagnostics_.created_entity_count;
+            ++current_index;
+            continue;
+        }
+
+        const EntityDeltaUpdate update =
+            BuildChangedUpdate((*baseline)[baseline_index], current[current_index]);
+        if (update.field_mask != 0) {
+            delta.updates.push_back(update);
+            ++diagnostics_.updated_entity_count;
+        } else {
+            ++diagnostics_.unchanged_entity_count;
+        }
+        ++baseline_index;
+        ++current_index;
+    }
+    diagnostics_.removed_entity_count += delta.removed_network_ids.size();
+    if (delta.has_baseline) {
+        ++diagnostics_.delta_snapshot_count;
+    } else {
+        ++diagnostics_.full_snapshot_count;
+    }
+
+    client.sent_snapshots.push_back(SentSnapshot{
+        .tick_index = tick_index,
+        .entities = std::move(current),
+    });
+    if (client.sent_snapshots.size() > kMaxBaselineHistory) {
+        const std::size_t expired_count = client.sent_snapshots.size() - kMaxBaselineHistory;
+        for (std::size_t index = 0; index < expired_count; ++index) {
+            if (client.has_acked_tick && client.sent_snapshots[index].tick_index == client.acked_tick) {
+                client.has_acked_tick = false;
+                ++diagnostics_.expired_baseline_count;
+            }
+        }
+        DropOldestSentSnapshots(client, expired_count);
+    }
+
+    const std::size_t encode_offset = writer.Buffer().size();
+    EncodeEntityDelta(delta, writer);
+    diagnostics_.last_encoded_bytes = writer.Buffer().size() - encode_offset;
+    diagnostics_.total_encoded_bytes += diagnostics_.last_encoded_bytes;
+    return true;
+}
+
+EntityReplicationSenderDiagnostics EntityReplicationSender::DiagnosticsSnapshot() const {
+    return diagnostics_;
+}
+
+void EntityReplicationReceiver::Reset() {
+    snapshots_.clear();
+    diagnostics_.replicated_entity_count = 0;
+    diagnostics_.last_applied_tick = 0;
+}
+
+bool EntityReplicationReceiver::ApplyDelta(std::uint64_t tick_index, const EntityDelta& delta) {
+    if (!snapshots_.empty() && tick_index <= snapshots_.back().tick_index) {
+        ++diagnostics_.rejected_delta_count;
+        return false;
+    }
+
+    std::vector<QuantizedEntityState> entities;
+    if (delta.has_baseline) {
+        const auto baseline_it = std::find_if(
+            snapshots_.begin(),
+            snapshots_.end(),
+            [&delta](const ReceivedSnapshot& snapshot) {
+                return snapshot.tick_index == delta.baseline_tick;
+            });
+        if (baseline_it == snapshots_.end()) {
+            ++diagnostics_.missing_baseline_count;
+            return false;
+        }
+        entities = baseline_it->entities;
+    }
+
+    for (const std::uint32_t network_id : delta.removed_network_ids) {
+        const auto iter = FindEntity(entities, network_id);
+        if (iter != entities.end()) {
+            entities.erase(iter);
+        }
+    }
+
+    for (const EntityDeltaUpdate& update : delta.updates) {
+        const QuantizedEntityState& values = update.values;
+        if ((update.field_mask & kEntityDeltaFieldCreated) != 0) {
+            const auto iter = std::lower_bound(
+                entities.begin(),
+                entities.end(),
+                values.network_id,
+                [](const QuantizedEntityState& entity, std::uint32_t id) {
+                    return entity.network_id < id;
+                });
+            if (iter != entities.end() && iter->network_id == values.network_id) {
+                *iter = values;
+            } else {
+                entities.insert(iter, values);
+            }
+            continue;
+        }
+
+        const auto iter = FindEntity(entities, values.network_id);
+        if (iter == entities.end()) {
+            ++diagnostics_.rejected_delta_count;
+            return false;
+        }
+        // A corrupt or hostile delta must not wrap the accumulated state.
+        const bool position_applied =
+            (update.field_mask & kEntityDeltaFieldPosition) == 0 ||
+            (TryApplyDeltaValue(iter->position_x, values.position_x) &&
+             TryApplyDeltaValue(iter->position_y, values.position_y));
+        const bool velocity_applied =
+            (update.field_mask & kEntityDeltaFieldVelocity) == 0 ||
+            (TryApplyDeltaValue(iter->velocity_x, values.velocity_x) &&
+             TryApplyDeltaValue(iter->velocity_y, values.velocity_y));
+        const bool health_applied =
+            (update.field_mask & kEntityDeltaFieldHealth) == 0 ||
+            TryApplyDeltaValue(iter->health, values.health);
+        if (!position_applied || !velocity_applied || !health_applied) {
+            ++diagnostics_.rejected_delta_count;
+            return false;
+        }
+        if ((update.field_mask & kEntityDeltaFieldAttributes) != 0) {
+            iter->material_id = values.material_id;
+            iter->amount = values.amount;
+            iter->owner_player_id = values.owner_player_id;
+        }
+    }
+
+    if (delta.has_baseline) {
+        while (!snapshots_.empty() && snapshots_.front().tick_index < delta.baseline_tick) {
+            snapshots_.pop_front();
+        }
+        ++diagnostics_.applied_delta_count;
+    } else {
+        ++diagnostics_.applied_full_snapshot_count;
+    }
+
+    diagnostics_.replicated_entity_count = entities.size();
+    diagnostics_.last_applied_tick = tick_index;
+    snapshots_.push_back(ReceivedSnapshot{
+        .tick_index = tick_index,
+        .entities = std::move(entities),
+    });
+    while (snapshots_.size() > kMaxSnapshotHistory) {
+        snapshots_.pop_front();
+    }
+    return true;
+}
+
+bool EntityReplicationReceiver::HasAppliedTick() const {
+    return !snapshots_.empty();
+}
+
+std::uint64_t EntityReplicationReceiver::LastAppliedTick() const {
+    return snapshots_.empty() ? 0 : snapshots_.back().tick_index;
+}
+
+std::vector<ecs::ReplicatedEntitySnapshot> EntityReplicationReceiver::Entities() const {
+    std::vector<ecs::ReplicatedEntitySnapshot> entities;
+    CollectEntities(entities);
+    return entities;
+}
+
+void EntityReplicationReceiver::CollectEntities(std::vector<ecs::ReplicatedEntitySnapshot>& out_entities) const {
+    out_entities.clear();
+    if (snapshots_.empty()) {
+        return;
+    }
+
+    out_entities.reserve(snapshots_.back().entities.size());
+    for (const QuantizedEntityState& entity : snapshots_.back().entities) {
+        out_entities.push_back(DequantizeReplicatedEntity(entity));
+    }
+}
+
+EntityReplicationReceiverDiagnostics EntityReplicationReceiver::DiagnosticsSnapshot() const {
+    return diagnostics_;
+}
+
+}  // namespace novaria::sim
@@ -0,0 +1,270 @@
+#include "sim/entity_state_codec.h"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace novaria::sim {
+namespace {
+
+bool TryReadVarUInt16(wire::ByteReader& reader, std::uint16_t& out_value) {
+    std::uint64_t parsed = 0;
+    if (!reader.ReadVarUInt(parsed) || parsed > std::numeric_limits<std::uint16_t>::max()) {
+        return false;
+    }
+    out_value = static_cast<std::uint16_t>(parsed);
+    return true;
+}
+
+bool TryReadVarUInt32(wire::ByteReader& reader, std::uint32_t& out_value) {
+    std::uint64_t parsed = 0;
+    if (!reader.ReadVarUInt(parsed) || parsed > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+    out_value = static_cast<std::uint32_t>(parsed);
+    return true;
+}
+
+bool TryReadVarInt32(wire::ByteReader& reader, std::int32_t& out_value) {
+    std::int64_t parsed = 0;
+    if (!reader.ReadVarInt(parsed) ||
+        parsed < std::numeric_limits<std::int32_t>::min() ||
+        parsed > std::numeric_limits<std::int32_t>::max()) {
+        return false;
+    }
+    out_value = static_cast<std::int32_t>(parsed);
+    return true;
+}
+
+bool TryReadFiniteF32(wire::ByteReader& reader, float& out_value) {
+    float parsed = 0.0F;
+    if (!reader.ReadF32(parsed) || !std::isfinite(parsed)) {
+        return false;
+    }
+    out_value = parsed;
+    return true;
+}
+
+bool TryReadEntityStateType(wire::ByteReader& reader, EntityStateType expected_type) {
+    wire::Byte type = 0;
+    return reader.ReadU8(type) && type == static_cast<wire::Byte>(expected_type);
+}
+
+bool IsKnownReplicatedEntityKind(wire::Byte kind) {
+    switch (static_cast<ecs::ReplicatedEntityKind>(kind)) {
+        case ecs::ReplicatedEntityKind::Projectile:
+        case ecs::ReplicatedEntityKind::Hostile:
+        case ecs::ReplicatedEntityKind::Drop:
+        case ecs::ReplicatedEntityKind::Player:
+            return true;
+    }
+    return false;
+}
+
+void WriteNetworkIdGap(wire::ByteWriter& writer, std::uint32_t network_id, std::uint32_t& previous_id) {
+    writer.WriteVarUInt(network_id - previous_id);
+    previous_id = network_id;
+}
+
+bool TryReadNetworkIdGap(wire::ByteReader& reader, std::uint32_t& previous_id, std::uint32_t& out_id) {
+    std::uint32_t gap = 0;
+    if (!TryReadVarUInt32(reader, gap) || gap == 0 ||
+        gap > std::numeric_limits<std::uint32_t>::max() - previous_id) {
+        return false;
+    }
+    out_id = previous_id + gap;
+    previous_id = out_id;
+    return true;
+}
+
+}  // namespace
+
+bool TryPeekEntityStateType(wire::ByteSpan payload, EntityStateType& out_type) {
+    if (payload.empty()) {
+        return false;
+    }
+
+    switch (static_cast<EntityStateType>(payload[0])) {
+        case EntityStateType::PlayerState:
+        case EntityStateType::EntityDelta:
+            out_type = static_cast<EntityStateType>(payload[0]);
+            return true;
+    }
+    return false;
+}
+
+void EncodePlayerEntityState(const PlayerEntityState& state, wire::ByteWriter& writer) {
+    writer.WriteU8(static_cast<wire::Byte>(EntityStateType::PlayerState));
+    writer.WriteVarUInt(state.player_id);
+    writer.WriteVarUInt(state.acked_command_sequence);
+    writer.WriteF32(state.motion.position_x);
+    writer.WriteF32(state.motion.position_y);
+    writer.WriteF32(state.motion.velocity_x);
+    writer.WriteF32(state.motion.velocity_y);
+    writer.WriteU8(state.motion.on_ground ? 1 : 0);
+}
+
+wire::ByteBuffer EncodePlayerEntityState(const PlayerEntityState& state) {
+    wire::ByteWriter writer;
+    EncodePlayerEntityState(state, writer);
+    return writer.TakeBuffer();
+}
+
+bool TryDecodePlayerEntityState(wire::ByteSpan payload, PlayerEntityState& out_state) {
+    wire::ByteReader reader(payload);
+    PlayerEntityState state{};
+    wire::Byte on_ground = 0;
+    if (!TryReadEntityStateType(reader, EntityStateType::PlayerState) ||
+        !TryReadVarUInt32(reader, state.player_id) ||
+        !TryReadVarUInt32(reader, state.acked_command_sequence) ||
+        !TryReadFiniteF32(reader, state.motion.position_x) ||
+        !TryReadFiniteF32(reader, state.motion.position_y) ||
+        !TryReadFiniteF32(reader, state.motion.velocity_x) ||
+        !TryReadFiniteF32(reader, state.motion.velocity_y) ||
+        !reader.ReadU8(on_ground) ||
+        !reader.IsFullyConsumed()) {
+        return false;
+    }
+    if (state.player_id == 0 || on_ground > 1) {
+        return false;
+    }
+
+    state.motion.on_ground = on_ground != 0;
+    out_state = state;
+    return true;
+}
+
+void EncodeEntityDelta(const EntityDelta& delta, wire::ByteWriter& writer) {
+    writer.WriteU8(static_cast<wire::Byte>(EntityStateType::EntityDelta));
+    writer.WriteVarUInt(delta.recipient_player_id);
+    writer.WriteU8(delta.has_baseline ? 1 : 0);
+    if (delta.has_baseline) {
+        writer.WriteVarUInt(delta.baseline_tick);
+    }
+
+    writer.WriteVarUInt(delta.removed_network_ids.size());
+    std::uint32_t previous_id = 0;
+    for (const std::uint32_t network_id : delta.removed_network_ids) {
+        WriteNetworkIdGap(writer, network_id, previous_id);
+    }
+
+    writer.WriteVarUInt(delta.updates.size());
+    previous_id = 0;
+    for (const EntityDeltaUpdate& update : delta.updates) {
+        const QuantizedEntityState& values = update.values;
+        WriteNetworkIdGap(writer, values.network_id, previous_id);
+        writer.WriteU8(update.field_mask);
+        if ((update.field_mask & kEntityDeltaFieldCreated) != 0) {
+            writer.WriteU8(static_cast<wire::Byte>(values.kind));
+        }
+        if ((update.field_mask & kEntityDeltaFieldPosition) != 0) {
+            writer.WriteVarInt(values.position_x);
+            writer.WriteVarInt(values.position_y);
+        }
+        if ((update.field_mask & kEntityDeltaFieldVelocity) != 0) {
+            writer.WriteVarInt(values.velocity_x);
+            writer.WriteVarInt(values.velocity_y);
+        }
+        if ((update.field_mask & kEntityDeltaFieldHealth) != 0) {
+            writer.WriteVarInt(values.health);
+        }
+        if ((update.field_mask & kEntityDeltaFieldAttributes) != 0) {
+            writer.WriteVarUInt(values.material_id);
+            writer.WriteVarUInt(values.amount);
+            writer.WriteVarUInt(values.owner_player_id);
+        }
+    }
+
+}
+
+wire::ByteBuffer EncodeEntityDelta(const EntityDelta& delta) {
+    wire::ByteWriter writer;
+    EncodeEntityDelta(delta, writer);
+    return writer.TakeBuffer();
+}
+
+bool TryDecodeEntityDelta(wire::ByteSpan payload, EntityDelta& out_delta) {
+    wire::ByteReader reader(payload);
+    EntityDelta delta{};
+    wire::Byte has_baseline = 0;
+    if (!TryReadEntityStateType(reader, EntityStateType::EntityDelta) ||
+        !TryReadVarUInt32(reader, delta.recipient_player_id) ||
+        !reader.ReadU8(has_baseline) ||
+        delta.recipient_player_id == 0 ||
+        has_baseline > 1) {
+        return false;
+    }
+    delta.has_baseline = has_baseline != 0;
+    if (delta.has_baseline && !reader.ReadVarUInt(delta.baseline_tick)) {
+        return false;
+    }
+
+    std::uint64_t removed_count = 0;
+    if (!reader.ReadVarUInt(removed_count) || removed_count > kMaxEntityDeltaEntries) {
+        return false;
+    }
+    delta.removed_network_ids.reserve(static_cast<std::size_t>(removed_count));
+    std::uint32_t previous_id = 0;
+    for (std::uint64_t index = 0; index < removed_count; ++index) {
+        std::uint32_t network_id = 0;
+        if (!TryReadNetworkIdGap(reader, previous_id, network_id)) {
+            return false;
+        }
+        delta.removed_network_ids.push_back(network_id);
+    }
+
+    std::uint64_t update_count = 0;
+    if (!reader.ReadVarUInt(update_count) || update_count > kMaxEntityDeltaEntries) {
+        return false;
+    }
+    delta.updates.reserve(static_cast<std::size_t>(update_count));
+    previous_id = 0;
+    for (std::uint64_t index = 0; index < update_count; ++index) {
+        EntityDeltaUpdate update{};
+        QuantizedEntityState& values = update.values;
+        if (!TryReadNetworkIdGap(reader, previous_id, values.network_id) ||
+            !reader.ReadU8(update.field_mask) ||
+            (update.field_mask & ~kEntityDeltaFieldAll) != 0) {
+            return false;
+        }
+
+        const bool created = (update.field_mask & kEntityDeltaFieldCreated) != 0;
+        if (created) {
+            wire::Byte kind = 0;
+            if (update.field_mask != kEntityDeltaFieldAll ||
+                !reader.ReadU8(kind) ||
+                !IsKnownReplicatedEntityKind(kind)) {
+                return false;
+            }
+            values.kind = static_cast<ecs::ReplicatedEntityKind>(kind);
+        }
+        if ((update.field_mask & kEntityDeltaFieldPosition) != 0 &&
+            (!TryReadVarInt32(reader, values.position_x) || !TryReadVarInt32(reader, values.position_y))) {
+            return false;
+        }
+        if ((update.field_mask & kEntityDeltaFieldVelocity) != 0 &&
+            (!TryReadVarInt32(reader, values.velocity_x) || !TryReadVarInt32(reader, values.velocity_y))) {
+            return false;
+        }
+        if ((update.field_mask & kEntityDeltaFieldHealth) != 0 &&
+            !TryReadVarInt32(reader, values.health)) {
+            return false;
+        }
+        if ((update.field_mask & kEntityDeltaFieldAttributes) != 0 &&
+            (!TryReadVarUInt16(reader, values.material_id) ||
+             !TryReadVarUInt32(reader, values.amount) ||
+             !TryReadVarUInt32(reader, values.owner_player_id))) {
+            return false;
+        }
+        delta.updates.push_back(update);
+    }
+
+    if (!reader.IsFullyConsumed()) {
+        return false;
+    }
+
+    out_delta = std::move(delta);
+    return true;
+}
+
+}  // namespace novaria::sim
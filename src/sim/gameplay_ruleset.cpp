@@ -31,17 +31,7 @@ const char* InteractionResultName(std::uint16_t result_code) {
     }
 }
 
-std::string BuildGameplayProgressPayload(
-    std::string_view milestone,
-    std::uint64_t tick_index) {
-    std::string payload = "milestone=";
-    payload += milestone;
-    payload += ";tick=";
-    payload += std::to_string(tick_index);
-    return payload;
-}
-
-std::string BuildGameplayInteractionPayload(
+std::string BuildGameplayInteractionLogText(
     std::uint32_t player_id,
     const command::InteractionPayload& payload,
     std::uint64_t tick_index) {
@@ -57,28 +47,6 @@ std::string BuildGameplayInteractionPayload(
     output += std::to_string(payload.target_tile_x);
     output += ";tile_y=";
     output += std::to_string(payload.target_tile_y);
-    output += ";branch=";
-    output += InteractionTypeName(payload.interaction_type);
-    output += ";tick=";
-    output += std::to_string(tick_index);
-    return output;
-}
-
-std::string BuildGameplayPickupPayload(
-    const GameplayPickupEvent& pickup_event,
-    std::uint64_t tick_index) {
-    std::string output = "player=";
-    output += std::to_string(pickup_event.player_id);
-    output += ";material_id=";
-    output += std::to_string(pickup_event.material_id);
-    output += ";amount=";
-    output += std::to_string(pickup_event.amount);
-    output += ";tile_x=";
-    output += std::to_string(pickup_event.tile_x);
-    output += ";tile_y=";
-    output += std::to_string(pickup_event.tile_y);
-    output += ";branch=";
-    output += pickup_event.amount > 1 ? "stack" : "single";
     output += ";tick=";
     output += std::to_string(tick_index);
     return output;
@@ -174,14 +142,21 @@ void GameplayRuleset::ExecuteInteraction(
     const command::InteractionPayload& payload,
     std::uint64_t tick_index,
     script::IScriptHost& script_host) {
-    const std::string output =
-        BuildGameplayInteractionPayload(player_id, payload, tick_index);
     core::Logger::Info(
         "script",
-        "Dispatch gameplay interaction event: " + output);
+        "Dispatch gameplay interaction event: " +
+            BuildGameplayInteractionLogText(player_id, payload, tick_index));
     script_host.DispatchEvent(script::ScriptEvent{
-        .event_name = "gameplay.interaction",
-        .payload = output,
+        .id = script::ScriptEventId::GameplayInteraction,
+        .tick_index = tick_index,
+        .payload = script::GameplayInteractionEventPayload{
+            .player_id = player_id,
+            .interaction_type = InteractionTypeName(payload.interaction_type),
+            .result = InteractionResultName(payload.result_code),
+            .target_material_id = payload.target_material_id,
+            .tile_x = payload.target_tile_x,
+            .tile_y = payload.target_tile_y,
+        },
     });
 }
 
@@ -250,11 +225,17 @@ void GameplayRuleset::ProcessGameplayEvents(
         };
         out_pending_pickup_events.push_back(pickup_event);
 
-        const std::string payload = BuildGameplayPickupPayload(pickup_event, tick_index);
-        core::Logger::Info("script", "Dispatch gameplay pickup event: " + payload);
         script_host.DispatchEvent(script::ScriptEvent{
-            .event_name = "gameplay.pickup",
-            .payload = payload,
+            .id = script::ScriptEventId::GameplayPickup,
+            .tick_index = tick_index,
+            .payload = script::GameplayPickupEventPayload{
+                .player_id = pickup_event.player_id,
+                .tile_x = pickup_event.tile_x,
+                .tile_y = pickup_event.tile_y,
+                .material_id = pickup_event.material_id,
+                .resource_id = pickup_event.resource_id,
+                .amount = pickup_event.amount,
+            },
         });
     }
 
@@ -263,11 +244,12 @@ void GameplayRuleset::ProcessGameplayEvents(
 
 void GameplayRuleset::DispatchGameplayProgressEvent(
     script::IScriptHost& script_host,
-    std::string_view milestone,
+    const char* milestone,
     std::uint64_t tick_index) const {
     script_host.DispatchEvent(script::ScriptEvent{
-        .event_name = "gameplay.progress",
-        .payload = BuildGameplayProgressPayload(milestone, tick_index),
+        .id = script::ScriptEventId::GameplayProgress,
+        .tick_index = tick_index,
+        .payload = script::GameplayProgressEventPayload{.milestone = milestone},
     });
 }
 
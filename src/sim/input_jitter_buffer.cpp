@@ -0,0 +1,233 @@
+#include "sim/input_jitter_buffer.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+namespace novaria::sim {
+
+void InputJitterBuffer::Reset() {
+    players_.clear();
+    evicted_player_diagnostics_.clear();
+    release_rotation_ = 0;
+}
+
+void InputJitterBuffer::SetSettings(const InputJitterBufferSettings& settings) {
+    const std::uint32_t max_delay_ticks = std::max(settings.min_delay_ticks, settings.max_delay_ticks);
+    settings_ = InputJitterBufferSettings{
+        .min_delay_ticks = settings.min_delay_ticks,
+        .initial_delay_ticks = std::clamp(settings.initial_delay_ticks, settings.min_delay_ticks, max_delay_ticks),
+        .max_delay_ticks = max_delay_ticks,
+        .decay_interval_ticks = std::max<std::uint64_t>(1, settings.decay_interval_ticks),
+        .idle_eviction_ticks = std::max<std::uint64_t>(1, settings.idle_eviction_ticks),
+        .max_buffered_commands_per_player = std::max<std::size_t>(1, settings.max_buffered_commands_per_player),
+        .max_released_commands_per_player_per_tick =
+            std::max<std::size_t>(1, settings.max_released_commands_per_player_per_tick),
+    };
+}
+
+const InputJitterBufferSettings& InputJitterBuffer::Settings() const {
+    return settings_;
+}
+
+void InputJitterBuffer::Push(net::PlayerCommand command, std::uint64_t arrival_tick) {
+    auto player_it = players_.find(command.player_id);
+    if (player_it == players_.end()) {
+        if (players_.size() >= kMaxPlayers && !EvictIdlePlayer(arrival_tick)) {
+            ++diagnostics_.dropped_overflow_count;
+            return;
+        }
+        player_it = players_.emplace(command.player_id, PlayerQueue{}).first;
+        player_it->second.delay_ticks = settings_.initial_delay_ticks;
+        player_it->second.window_start_tick = arrival_tick;
+        if (const auto retained_it = evicted_player_diagnostics_.find(command.player_id);
+            retained_it != evicted_player_diagnostics_.end()) {
+            player_it->second.released_command_count = retained_it->second.released_command_count;
+            player_it->second.deferred_command_count = retained_it->second.deferred_command_count;
+            player_it->second.dropped_overflow_count = retained_it->second.dropped_overflow_count;
+            evicted_player_diagnostics_.erase(retained_it);
+        }
+    }
+
+    PlayerQueue& queue = player_it->second;
+    queue.last_arrival_tick = arrival_tick;
+    if (queue.commands.size() - queue.head >= settings_.max_buffered_commands_per_player) {
+        ++diagnostics_.dropped_overflow_count;
+        ++queue.dropped_overflow_count;
+        return;
+    }
+
+    std::uint64_t release_tick = arrival_tick;
+    if (command.target_tick == 0) {
+        ++diagnostics_.unstamped_command_count;
+    } else {
+        const std::uint64_t scheduled_tick = command.target_tick + queue.delay_ticks;
+        if (scheduled_tick < arrival_tick) {
+            // Late input runs now and grows the buffer by the observed lateness.
+            ++diagnostics_.late_command_count;
+            const std::uint64_t grown_delay =
+                std::min<std::uint64_t>(queue.delay_ticks + (arrival_tick - scheduled_tick), settings_.max_delay_ticks);
+            if (grown_delay > queue.delay_ticks) {
+                queue.delay_ticks = static_cast<std::uint32_t>(grown_delay);
+                ++diagnostics_.delay_increase_count;
+            }
+            queue.window_start_tick = arrival_tick;
+            queue.min_slack_ticks = kNoSlack;
+        } else if (scheduled_tick > arrival_tick + settings_.max_delay_ticks) {
+            // A stamp this far ahead means the sender's clock estimate is off; never hold input longer.
+            ++diagnostics_.early_clamped_command_count;
+            release_tick = arrival_tick + settings_.max_delay_ticks;
+        } else {
+            ++diagnostics_.on_time_command_count;
+            release_tick = scheduled_tick;
+            queue.min_slack_ticks = std::min(queue.min_slack_ticks, scheduled_tick - arrival_tick);
+        }
+    }
+
+    release_tick = std::max(release_tick, queue.last_release_tick);
+    queue.last_release_tick = release_tick;
+    queue.commands.push_back(BufferedCommand{
+        .command = std::move(command),
+        .release_tick = release_tick,
+    });
+}
+
+void InputJitterBuffer::Release(std::uint64_t tick_index, std::vector<net::PlayerCommand>& out_commands) {
+    out_commands.clear();
+    if (players_.empty()) {
+        return;
+    }
+
+    // Round-robin one due command per player per pass, starting from a rotating player, so a flooding
+    // player can neither delay other players' inputs within the tick nor exceed its per-tick share.
+    const auto is_releasable = [&](const PlayerQueue& queue) {
+        return queue.head < queue.commands.size() &&
+            queue.commands[queue.head].release_tick <= tick_index &&
+            queue.released_this_tick < settings_.max_released_commands_per_player_per_tick;
+    };
+    const auto first_player = std::next(
+        players_.begin(),
+        static_cast<std::ptrdiff_t>(release_rotation_++ % players_.size()));
+    for (bool released_any = true; released_any;) {
+        released_any = false;
+        auto player_it = first_player;
+        do {
+            PlayerQueue& queue = player_it->second;
+            if (is_releasable(queue)) {
+                out_commands.push_back(std::move(queue.commands[queue.head].command));
+                ++queue.head;
+                ++queue.released_this_tick;
+                ++queue.released_command_count;
+                ++diagnostics_.released_command_count;
+                released_any = true;
+            }
+            if (++player_it == players_.end()) {
+                player_it = players_.begin();
+            }
+        } while (player_it != first_player);
+    }
+
+    for (auto& [player_id, queue] : players_) {
+        (void)player_id;
+        if (queue.head < queue.commands.size() && queue.commands[queue.head].release_tick <= tick_index) {
+            const std::uint64_t deferred = static_cast<std::uint64_t>(std::count_if(
+                queue.commands.begin() + static_cast<std::ptrdiff_t>(queue.head),
+                queue.commands.end(),
+                [tick_index](const BufferedCommand& buffered) { return buffered.release_tick <= tick_index; }));
+            queue.deferred_command_count += deferred;
+            diagnostics_.deferred_command_count += deferred;
+        }
+        queue.released_this_tick = 0;
+        if (queue.head == queue.commands.size()) {
+            queue.commands.clear();
+            queue.head = 0;
+        } else if (queue.head * 2 >= queue.commands.size()) {
+            queue.commands.erase(
+                queue.commands.begin(),
+                queue.commands.begin() + static_cast<std::ptrdiff_t>(queue.head));
+            queue.head = 0;
+        }
+
+        if (tick_index < queue.window_start_tick + settings_.decay_interval_ticks) {
+            continue;
+        }
+        // Every stamped input in the window arrived with spare ticks: shrink the buffer by one.
+        if (queue.min_slack_ticks != kNoSlack &&
+            queue.min_slack_ticks > 0 &&
+            queue.delay_ticks > settings_.min_delay_ticks) {
+            --queue.delay_ticks;
+            ++diagnostics_.delay_decrease_count;
+        }
+        queue.window_start_tick = tick_index;
+        queue.min_slack_ticks = kNoSlack;
+    }
+}
+
+bool InputJitterBuffer::EvictIdlePlayer(std::uint64_t arrival_tick) {
+    // Only a drained queue is evicted, so no buffered input is ever discarded to make room.
+    auto idle_it = players_.end();
+    for (auto player_it = players_.begin(); player_it != players_.end(); ++player_it) {
+        const PlayerQueue& queue = player_it->second;
+        if (queue.head == queue.commands.size() &&
+            arrival_tick >= queue.last_arrival_tick + settings_.idle_eviction_ticks &&
+            (idle_it == players_.end() || queue.last_arrival_tick < idle_it->second.last_arrival_tick)) {
+            idle_it = player_it;
+        }
+    }
+    if (idle_it == players_.end()) {
+        return false;
+    }
+
+    const PlayerQueue& evicted = idle_it->second;
+    if ((evicted.dropped_overflow_count != 0 || evicted.deferred_command_count != 0) &&
+        evicted_player_diagnostics_.size() < kMaxRetainedPlayerDiagnostics) {
+        evicted_player_diagnostics_.emplace(idle_it->first, InputJitterPlayerDiagnostics{
+            .player_id = idle_it->first,
+            .delay_ticks = evicted.delay_ticks,
+            .buffered_command_count = 0,
+            .released_command_count = evicted.released_command_count,
+            .deferred_command_count = evicted.deferred_command_count,
+            .dropped_overflow_count = evicted.dropped_overflow_count,
+        });
+    }
+    players_.erase(idle_it);
+    ++diagnostics_.evicted_player_count;
+    return true;
+}
+
+std::uint32_t InputJitterBuffer::PlayerDelayTicks(std::uint32_t player_id) const {
+    const auto player_it = players_.find(player_id);
+    return player_it == players_.end() ? settings_.initial_delay_ticks : player_it->second.delay_ticks;
+}
+
+InputJitterBufferDiagnostics InputJitterBuffer::DiagnosticsSnapshot() const {
+    InputJitterBufferDiagnostics diagnostics = diagnostics_;
+    diagnostics.tracked_player_count = players_.size();
+    diagnostics.players.reserve(players_.size() + evicted_player_diagnostics_.size());
+    for (const auto& [player_id, queue] : players_) {
+        const std::size_t buffered_command_count = queue.commands.size() - queue.head;
+        diagnostics.buffered_command_count += buffered_command_count;
+        diagnostics.max_player_delay_ticks = std::max(diagnostics.max_player_delay_ticks, queue.delay_ticks);
+        diagnostics.players.push_back(InputJitterPlayerDiagnostics{
+            .player_id = player_id,
+            .delay_ticks = queue.delay_ticks,
+            .buffered_command_count = buffered_command_count,
+            .released_command_count = queue.released_command_count,
+            .deferred_command_count = queue.deferred_command_count,
+            .dropped_overflow_count = queue.dropped_overflow_count,
+        });
+    }
+    for (const auto& [player_id, evicted] : evicted_player_diagnostics_) {
+        (void)player_id;
+        diagnostics.players.push_back(evicted);
+    }
+    std::sort(
+        diagnostics.players.begin(),
+        diagnostics.players.end(),
+        [](const InputJitterPlayerDiagnostics& lhs, const InputJitterPlayerDiagnostics& rhs) {
+            return lhs.player_id < rhs.player_id;
+        });
+    return diagnostics;
+}
+
+}  // namespace novaria::sim
@@ -0,0 +1,205 @@
+#include "sim/input_log.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <string>
+
+namespace novaria::sim {
+namespace {
+
+constexpr std::array<wire::Byte, 4> kInputLogMagic{'N', 'V', 'I', 'L'};
+
+bool ReadU32(wire::ByteReader& reader, std::uint32_t& out_value) {
+    std::uint64_t value = 0;
+    if (!reader.ReadVarUInt(value) || value > 0xFFFFFFFFULL) {
+        return false;
+    }
+    out_value = static_cast<std::uint32_t>(value);
+    return true;
+}
+
+bool ReadCommandBody(wire::ByteReader& reader, net::PlayerCommand& out_command) {
+    wire::ByteSpan payload;
+    if (!ReadU32(reader, out_command.player_id) ||
+        !ReadU32(reader, out_command.command_id) ||
+        !ReadU32(reader, out_command.sequence) ||
+        !reader.ReadVarUInt(out_command.target_tick) ||
+        !reader.ReadBytes(payload)) {
+        return false;
+    }
+    out_command.payload = wire::SmallByteBuffer(payload);
+    return true;
+}
+
+}  // namespace
+
+void InputRecorder::Begin(const InputLogHeader& header) {
+    writer_.Clear();
+    writer_.WriteRawBytes(wire::ByteSpan(kInputLogMagic.data(), kInputLogMagic.size()));
+    writer_.WriteVarUInt(header.format_version);
+    writer_.WriteVarUInt(header.start_tick);
+    writer_.WriteVarUInt(header.local_player_id);
+    writer_.WriteU8(header.authority ? 1 : 0);
+    active_ = true;
+    last_tick_index_ = header.start_tick;
+    recorded_command_count_ = 0;
+}
+
+void InputRecorder::Reset() {
+    writer_.Clear();
+    active_ = false;
+    last_tick_index_ = 0;
+    recorded_command_count_ = 0;
+}
+
+bool InputRecorder::Active() const {
+    return active_;
+}
+
+std::uint64_t InputRecorder::RecordedCommandCount() const {
+    return recorded_command_count_;
+}
+
+void InputRecorder::RecordFixedDelta(std::uint64_t tick_index, double fixed_delta_seconds) {
+    BeginRecord(InputLogRecordType::FixedDelta, tick_index);
+    writer_.WriteVarUInt(std::bit_cast<std::uint64_t>(fixed_delta_seconds));
+}
+
+void InputRecorder::RecordSessionState(
+    std::uint64_t tick_index,
+    net::NetSessionState session_state,
+    const std::string& transition_reason) {
+    BeginRecord(InputLogRecordType::SessionState, tick_index);
+    writer_.WriteU8(static_cast<wire::Byte>(session_state));
+    writer_.WriteString(transition_reason);
+}
+
+void InputRecorder::RecordCommand(std::uint64_t tick_index, const net::PlayerCommand& command, bool local) {
+    BeginRecord(local ? InputLogRecordType::LocalCommand : InputLogRecordType::RemoteCommand, tick_index);
+    writer_.WriteVarUInt(command.player_id);
+    writer_.WriteVarUInt(command.command_id);
+    writer_.WriteVarUInt(command.sequence);
+    writer_.WriteVarUInt(command.target_tick);
+    writer_.WriteBytes(command.payload.View());
+    ++recorded_command_count_;
+}
+
+void InputRecorder::RecordCheckpoint(std::uint64_t tick_index, std::uint64_t state_hash) {
+    BeginRecord(InputLogRecordType::Checkpoint, tick_index);
+    writer_.WriteVarUInt(state_hash);
+}
+
+void InputRecorder::End(std::uint64_t tick_index, std::uint64_t state_hash) {
+    BeginRecord(InputLogRecordType::End, tick_index);
+    writer_.WriteVarUInt(state_hash);
+    active_ = false;
+}
+
+void InputRecorder::ConsumeBytes(wire::ByteBuffer& out_bytes) {
+    out_bytes = writer_.TakeBuffer();
+}
+
+void InputRecorder::BeginRecord(InputLogRecordType type, std::uint64_t tick_index) {
+    // Records are tick-ordered; each stores its tick as a delta from the previous record.
+    writer_.WriteU8(static_cast<wire::Byte>(type));
+    writer_.WriteVarUInt(tick_index - last_tick_index_);
+    last_tick_index_ = tick_index;
+}
+
+bool TryDecodeInputLog(wire::ByteSpan bytes, InputLog& out_log, std::string& out_error) {
+    out_log = {};
+    wire::ByteReader reader(bytes);
+    wire::ByteSpan magic;
+    if (!reader.ReadRawBytes(kInputLogMagic.size(), magic) ||
+        !std::equal(magic.begin(), magic.end(), kInputLogMagic.begin())) {
+        out_error = "input log magic mismatch";
+        return false;
+    }
+
+    wire::Byte authority = 0;
+    std::uint64_t start_tick = 0;
+    if (!ReadU32(reader, out_log.header.format_version) ||
+        !reader.ReadVarUInt(start_tick) ||
+        !ReadU32(reader, out_log.header.local_player_id) ||
+        !reader.ReadU8(authority)) {
+        out_error = "input log header truncated";
+        return false;
+    }
+    if (out_log.header.format_version != kInputLogFormatVersion) {
+        out_error = "unsupported input log version: " + std::to_string(out_log.header.format_version);
+        return false;
+    }
+    out_log.header.start_tick = start_tick;
+    out_log.header.authority = authority != 0;
+
+    std::uint64_t tick_index = start_tick;
+    while (reader.Remaining() > 0) {
+        if (out_log.has_end) {
+            out_error = "input log has records after end marker";
+            return false;
+        }
+
+        wire::Byte type = 0;
+        std::uint64_t tick_delta = 0;
+        if (!reader.ReadU8(type) || !reader.ReadVarUInt(tick_delta)) {
+            out_error = "input log record header truncated";
+            return false;
+        }
+        tick_index += tick_delta;
+
+        bool record_ok = false;
+        switch (static_cast<InputLogRecordType>(type)) {
+            case InputLogRecordType::FixedDelta: {
+                std::uint64_t bits = 0;
+                record_ok = reader.ReadVarUInt(bits);
+                out_log.fixed_deltas.push_back({
+                    .tick_index = tick_index,
+                    .fixed_delta_seconds = std::bit_cast<double>(bits),
+                });
+                break;
+            }
+            case InputLogRecordType::SessionState: {
+                wire::Byte state = 0;
+                InputLogSessionChange change{};
+                change.tick_index = tick_index;
+                record_ok = reader.ReadU8(state) &&
+                    state <= static_cast<wire::Byte>(net::NetSessionState::Connected) &&
+                    reader.ReadString(change.transition_reason);
+                change.session_state = static_cast<net::NetSessionState>(state);
+                out_log.session_changes.push_back(std::move(change));
+                break;
+            }
+            case InputLogRecordType::LocalCommand:
+            case InputLogRecordType::RemoteCommand: {
+                InputLogCommand command{};
+                command.tick_index = tick_index;
+                command.local = static_cast<InputLogRecordType>(type) == InputLogRecordType::LocalCommand;
+                record_ok = ReadCommandBody(reader, command.command);
+                out_log.commands.push_back(std::move(command));
+                break;
+            }
+            case InputLogRecordType::Checkpoint: {
+                InputLogCheckpoint checkpoint{.tick_index = tick_index};
+                record_ok = reader.ReadVarUInt(checkpoint.state_hash);
+                out_log.checkpoints.push_back(checkpoint);
+                break;
+            }
+            case InputLogRecordType::End:
+                record_ok = reader.ReadVarUInt(out_log.end_state_hash);
+                out_log.has_end = true;
+                out_log.end_tick = tick_index;
+                break;
+        }
+        if (!record_ok) {
+            out_error = "input log record malformed at tick " + std::to_string(tick_index) +
+                " (type " + std::to_string(type) + ")";
+            return false;
+        }
+    }
+
+    out_error.clear();
+    return true;
+}
+
+}  // namespace novaria::sim
@@ -0,0 +1,211 @@
+#include "sim/input_replay.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace novaria::sim {
+namespace {
+
+std::uint64_t LastRecordedTick(const InputLog& log) {
+    if (log.has_end) {
+        return log.end_tick;
+    }
+
+    // A log cut short by a crash replays up to the tick after its last input.
+    std::uint64_t last_tick = log.header.start_tick;
+    if (!log.commands.empty()) {
+        last_tick = std::max(last_tick, log.commands.back().tick_index + 1);
+    }
+    if (!log.session_changes.empty()) {
+        last_tick = std::max(last_tick, log.session_changes.back().tick_index + 1);
+    }
+    if (!log.checkpoints.empty()) {
+        last_tick = std::max(last_tick, log.checkpoints.back().tick_index);
+    }
+    return last_tick;
+}
+
+}  // namespace
+
+InputReplayNetService::InputReplayNetService(const InputLog& log)
+    : log_(log) {}
+
+bool InputReplayNetService::Initialize(std::string& out_error) {
+    command_cursor_ = 0;
+    session_cursor_ = 0;
+    session_state_ = net::NetSessionState::Disconnected;
+    last_session_transition_reason_.clear();
+    pending_remote_commands_.clear();
+    replayed_command_count_ = 0;
+    out_error.clear();
+    return true;
+}
+
+void InputReplayNetService::Shutdown() {
+    pending_remote_commands_.clear();
+}
+
+void InputReplayNetService::RequestConnect() {}
+
+void InputReplayNetService::RequestDisconnect() {}
+
+void InputReplayNetService::NotifyHeartbeatReceived(std::uint64_t tick_index) {
+    (void)tick_index;
+}
+
+net::NetSessionState InputReplayNetService::SessionState() const {
+    return session_state_;
+}
+
+net::NetDiagnosticsSnapshot InputReplayNetService::DiagnosticsSnapshot() const {
+    return net::NetDiagnosticsSnapshot{
+        .session_state = session_state_,
+        .last_session_transition_reason = last_session_transition_reason_,
+    };
+}
+
+void InputReplayNetService::Tick(const core::TickContext& tick_context) {
+    // Session states and commands were recorded right after the live net tick, so they replay here.
+    while (session_cursor_ < log_.session_changes.size() &&
+           log_.session_changes[session_cursor_].tick_index <= tick_context.tick_index) {
+        const InputLogSessionChange& change = log_.session_changes[session_cursor_++];
+        session_state_ = change.session_state;
+        last_session_transition_reason_ = change.transition_reason;
+    }
+
+    while (command_cursor_ < log_.commands.size() &&
+           log_.commands[command_cursor_].tick_index <= tick_context.tick_index) {
+        const InputLogCommand& recorded = log_.commands[command_cursor_++];
+        if (recorded.local) {
+            continue;
+        }
+        pending_remote_commands_.push_back(recorded.command);
+        ++replayed_command_count_;
+    }
+}
+
+std::uint32_t InputReplayNetService::SubmitLocalCommand(net::PlayerCommand command) {
+    // Local submissions reached the live kernel through the recorded remote echo.
+    (void)command;
+    return 0;
+}
+
+void InputReplayNetService::ConsumeRemoteCommands(std::vector<net::PlayerCommand>& out_commands) {
+    out_commands.clear();
+    out_commands.swap(pending_remote_commands_);
+}
+
+void InputReplayNetService::ConsumeRemoteChunkPayloads(std::vector<wire::ByteBuffer>& out_payloads) {
+    out_payloads.clear();
+}
+
+void InputReplayNetService::ConsumeRemoteEntityStates(std::vector<net::EntityStateBatch>& out_batches) {
+    out_batches.clear();
+}
+
+void InputReplayNetService::PublishWorldSnapshot(
+    std::uint64_t tick_index,
+    const std::vector<wire::ByteBuffer>& encoded_dirty_chunks) {
+    (void)tick_index;
+    (void)encoded_dirty_chunks;
+}
+
+void InputReplayNetService::PublishEntityStates(
+    std::uint64_t tick_index,
+    const std::vector<wire::ByteBuffer>& encoded_entity_states,
+    const std::vector<std::uint32_t>& recipient_player_ids) {
+    (void)tick_index;
+    (void)encoded_entity_states;
+    (void)recipient_player_ids;
+}
+
+std::uint64_t InputReplayNetService::ReplayedCommandCount() const {
+    return replayed_command_count_;
+}
+
+bool ValidateInputLogForReplay(const InputLog& log, std::string& out_error) {
+    if (!log.header.authority) {
+        out_error = "input log was recorded in replica mode; only authority logs can be replayed";
+        return false;
+    }
+    if (log.header.start_tick != 0) {
+        out_error = "input log starts at tick " + std::to_string(log.header.start_tick) +
+            "; replay needs a recording started before the first tick";
+        return false;
+    }
+    if (log.fixed_deltas.empty() || log.fixed_deltas.front().tick_index != log.header.start_tick) {
+        out_error = "input log has no fixed delta for its first tick";
+        return false;
+    }
+
+    out_error.clear();
+    return true;
+}
+
+bool RunInputReplay(
+    const InputLog& log,
+    SimulationKernel& kernel,
+    const InputReplayNetService& net_service,
+    InputReplayResult& out_result,
+    std::string& out_error) {
+    out_result = {};
+    if (!ValidateInputLogForReplay(log, out_error)) {
+        return false;
+    }
+    if (kernel.CurrentTick() != log.header.start_tick) {
+        out_error = "replay kernel is at tick " + std::to_string(kernel.CurrentTick()) +
+            ", log starts at tick " + std::to_string(log.header.start_tick);
+        return false;
+    }
+
+    out_result.start_tick = log.header.start_tick;
+    out_result.end_tick = LastRecordedTick(log);
+
+    const auto compare_hash = [&](std::uint64_t tick_index, std::uint64_t expected_hash) {
+        const std::uint64_t actual_hash = kernel.ComputeStateHash();
+        if (actual_hash == expected_hash) {
+            return true;
+        }
+        out_result.diverged = true;
+        out_result.divergent_tick = tick_index;
+        out_result.expected_state_hash = expected_hash;
+        out_result.actual_state_hash = actual_hash;
+        return false;
+    };
+
+    std::size_t fixed_delta_cursor = 0;
+    std::size_t checkpoint_cursor = 0;
+    double fixed_delta_seconds = 0.0;
+    const auto start_time = std::chrono::steady_clock::now();
+    while (kernel.CurrentTick() < out_result.end_tick && !out_result.diverged) {
+        const std::uint64_t tick_index = kernel.CurrentTick();
+        while (fixed_delta_cursor < log.fixed_deltas.size() &&
+               log.fixed_deltas[fixed_delta_cursor].tick_index <= tick_index) {
+            fixed_delta_seconds = log.fixed_deltas[fixed_delta_cursor++].fixed_delta_seconds;
+        }
+
+        kernel.Update(fixed_delta_seconds);
+        ++out_result.replayed_tick_count;
+
+        while (checkpoint_cursor < log.checkpoints.size() &&
+               log.checkpoints[checkpoint_cursor].tick_index <= kernel.CurrentTick()) {
+            const InputLogCheckpoint& checkpoint = log.checkpoints[checkpoint_cursor++];
+            if (!compare_hash(checkpoint.tick_index, checkpoint.state_hash)) {
+                break;
+            }
+            ++out_result.verified_checkpoint_count;
+        }
+    }
+    out_result.elapsed_seconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    if (!out_result.diverged && log.has_end) {
+        out_result.verified_end_state = compare_hash(log.end_tick, log.end_state_hash);
+    }
+    out_result.replayed_command_count = net_service.ReplayedCommandCount();
+    out_error.clear();
+    return true;
+}
+
+}  // namespace novaria::sim
@@ -0,0 +1,127 @@
+#include "sim/player_motion_prediction.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace novaria::sim {
+namespace {
+
+float PositionError(const PlayerMotionState& lhs, const PlayerMotionState& rhs) {
+    const float error_x = lhs.position_x - rhs.position_x;
+    const float error_y = lhs.position_y - rhs.position_y;
+    return std::sqrt(error_x * error_x + error_y * error_y);
+}
+
+}  // namespace
+
+void PlayerMotionPredictor::Reset() {
+    history_begin_ = 0;
+    history_count_ = 0;
+    has_authoritative_state_ = false;
+    diagnostics_.last_acked_sequence = 0;
+}
+
+void PlayerMotionPredictor::RecordInput(
+    std::uint32_t sequence,
+    const PlayerMotionInput& input,
+    const PlayerMotionState& predicted_state) {
+    if (sequence == 0 || sequence <= diagnostics_.last_acked_sequence) {
+        return;
+    }
+    if (history_count_ > 0 && sequence <= EntryAt(history_count_ - 1).sequence) {
+        return;
+    }
+
+    if (history_count_ == kHistoryCapacity) {
+        history_begin_ = (history_begin_ + 1) % kHistoryCapacity;
+        --history_count_;
+        ++diagnostics_.dropped_history_count;
+    }
+
+    ++history_count_;
+    EntryAt(history_count_ - 1) = HistoryEntry{
+        .sequence = sequence,
+        .input = input,
+        .predicted_state = predicted_state,
+    };
+    ++diagnostics_.recorded_input_count;
+}
+
+bool PlayerMotionPredictor::Reconcile(
+    std::uint32_t acked_sequence,
+    const PlayerMotionState& authoritative_state,
+    const PlayerMotionSettings& settings,
+    const world::IWorldService& world_service,
+    double fixed_delta_seconds,
+    PlayerMotionState& out_state) {
+    if (acked_sequence < diagnostics_.last_acked_sequence) {
+        return false;
+    }
+
+    if (acked_sequence == diagnostics_.last_acked_sequence && has_authoritative_state_) {
+        // The authority also moves the player between inputs (knockback, collisions), so an unchanged ack
+        // still re-bases once the authoritative state drifts from the one the history was last replayed on.
+        const float drift = PositionError(authoritative_state, last_authoritative_state_);
+        if (drift <= kCorrectionEpsilon) {
+            return false;
+        }
+        RecordPositionError(drift);
+    } else {
+        diagnostics_.last_acked_sequence = acked_sequence;
+
+        bool has_acked_prediction = false;
+        PlayerMotionState acked_prediction{};
+        while (history_count_ > 0 && EntryAt(0).sequence <= acked_sequence) {
+            if (EntryAt(0).sequence == acked_sequence) {
+                has_acked_prediction = true;
+                acked_prediction = EntryAt(0).predicted_state;
+            }
+            history_begin_ = (history_begin_ + 1) % kHistoryCapacity;
+            --history_count_;
+        }
+
+        if (has_acked_prediction) {
+            RecordPositionError(PositionError(authoritative_state, acked_prediction));
+        }
+    }
+
+    ++diagnostics_.reconcile_count;
+    last_authoritative_state_ = authoritative_state;
+    has_authoritative_state_ = true;
+
+    PlayerMotionState replayed_state = authoritative_state;
+    for (std::size_t offset = 0; offset < history_count_; ++offset) {
+        HistoryEntry& entry = EntryAt(offset);
+        UpdatePlayerMotion(entry.input, settings, world_service, fixed_delta_seconds, replayed_state);
+        entry.predicted_state = replayed_state;
+    }
+    diagnostics_.replayed_input_count += history_count_;
+
+    out_state = replayed_state;
+    return true;
+}
+
+std::size_t PlayerMotionPredictor::PendingInputCount() const {
+    return history_count_;
+}
+
+PlayerMotionPredictionDiagnostics PlayerMotionPredictor::DiagnosticsSnapshot() const {
+    PlayerMotionPredictionDiagnostics diagnostics = diagnostics_;
+    diagnostics.pending_input_count = history_count_;
+    return diagnostics;
+}
+
+void PlayerMotionPredictor::RecordPositionError(float position_error) {
+    diagnostics_.last_position_error = position_error;
+    diagnostics_.max_position_error = std::max(diagnostics_.max_position_error, position_error);
+    diagnostics_.total_position_error += position_error;
+    if (position_error > kCorrectionEpsilon) {
+        ++diagnostics_.correction_count;
+    }
+}
+
+PlayerMotionPredictor::HistoryEntry& PlayerMotionPredictor::EntryAt(std::size_t offset) {
+    return history_[(history_begin_ + offset) % kHistoryCapacity];
+}
+
+}  // namespace novaria::sim
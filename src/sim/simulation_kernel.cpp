@@ -2,6 +2,7 @@
 
 #include "core/logger.h"
 #include "script/sim_rules_rpc.h"
+#include "sim/entity_state_codec.h"
 #include "world/snapshot_codec.h"
 #include "world/material_catalog.h"
 
@@ -30,17 +31,11 @@ const char* SessionStateName(net::NetSessionState state) {
     return "unknown";
 }
 
-std::string BuildSessionStateChangedPayload(
-    net::NetSessionState state,
-    std::uint64_t tick_index,
-    std::string_view transition_reason) {
-    std::string payload = "state=";
-    payload += SessionStateName(state);
-    payload += ";tick=";
-    payload += std::to_string(tick_index);
-    payload += ";reason=";
-    payload += transition_reason;
-    return payload;
+PlayerMotionInput ToPlayerMotionInput(const command::PlayerMotionInputPayload& payload) {
+    return PlayerMotionInput{
+        .move_axis = static_cast<float>(payload.move_axis_milli) / 1000.0F,
+        .jump_pressed = (payload.input_flags & command::kMotionInputFlagJumpPressed) != 0,
+    };
 }
 
 bool IsWorkbenchReachable(
@@ -73,8 +68,31 @@ bool IsSameChunkCoord(
     return lhs.x == rhs.x && lhs.y == rhs.y;
 }
 
+const ecs::ReplicatedEntitySnapshot* FindReplicatedEntity(
+    const std::vector<ecs::ReplicatedEntitySnapshot>& entities,
+    std::uint32_t network_id) {
+    const auto iter = std::lower_bound(
+        entities.begin(),
+        entities.end(),
+        network_id,
+        [](const ecs::ReplicatedEntitySnapshot& entity, std::uint32_t id) {
+            return entity.network_id < id;
+        });
+    if (iter == entities.end() || iter->network_id != network_id) {
+        return nullptr;
+    }
+    return &*iter;
+}
+
 }  // namespace
 
+void ReserveSimulationState(SimulationStateSnapshot& state, std::size_t arena_bytes, std::size_t chunk_count) {
+    wire::ByteBuffer storage = state.arena.TakeBuffer();
+    storage.reserve(arena_bytes);
+    state.arena = wire::ByteWriter(std::move(storage));
+    state.world.chunks.reserve(chunk_count);
+}
+
 SimulationKernel::SimulationKernel(
     world::IWorldService& world_service,
     net::INetService& net_service,
@@ -111,17 +129,17 @@ bool SimulationKernel::Initialize(std::string& out_error) {
     const wire::ByteBuffer validate_request_bytes =
         script::simrpc::EncodeValidateRequest();
     wire::ByteBuffer validate_response;
-    if (!script_host_.TryCallModuleFunction(
-            "core",
-            "novaria_on_sim_command",
-            wire::ByteSpan(validate_request_bytes.data(), validate_request_bytes.size()),
-            validate_response,
-            dependency_error)) {
+    const core::Status validate_status = script_host_.TryCallModuleFunction(
+        "core",
+        "novaria_on_sim_command",
+        wire::ByteSpan(validate_request_bytes.data(), validate_request_bytes.size()),
+        validate_response);
+    if (!validate_status) {
         ecs_runtime_.Shutdown();
         script_host_.Shutdown();
         net_service_.Shutdown();
         world_service_.Shutdown();
-        out_error = "Core script validation failed: " + dependency_error;
+        out_error = "Core script validation failed: " + validate_status.Message();
         return false;
     }
 
@@ -148,6 +166,7 @@ bool SimulationKernel::Initialize(std::string& out_error) {
     pending_pickup_events_.clear();
     dropped_local_command_count_ = 0;
     pending_initial_sync_chunks_.clear();
+    ResetReplicationState();
     gameplay_ruleset_.Reset();
     ecs_runtime_.EnsurePlayer(local_player_id_);
     initialized_ = true;
@@ -160,6 +179,8 @@ void SimulationKernel::Shutdown() {
         return;
     }
 
+    StopInputRecording();
+    CompleteChunkSnapshotEncode(false);
     ecs_runtime_.Shutdown();
     script_host_.Shutdown();
     net_service_.Shutdown();
@@ -171,6 +192,7 @@ void SimulationKernel::Shutdown() {
     next_net_session_event_dispatch_tick_ = 0;
     pending_net_session_event_ = {};
     pending_initial_sync_chunks_.clear();
+    ResetReplicationState();
     gameplay_ruleset_.Reset();
     initialized_ = false;
 }
@@ -198,7 +220,7 @@ SimulationAuthorityMode SimulationKernel::AuthorityMode() const {
     return authority_mode_;
 }
 
-void SimulationKernel::SubmitLocalCommand(const net::PlayerCommand& command) {
+void SimulationKernel::SubmitLocalCommand(net::PlayerCommand command) {
     if (!initialized_) {
         return;
     }
@@ -208,23 +230,20 @@ void SimulationKernel::SubmitLocalCommand(const net::PlayerCommand& command) {
         return;
     }
 
-    pending_local_commands_.push_back(command);
+    pending_local_commands_.push_back(std::move(command));
 }
 
-bool SimulationKernel::ApplyRemoteChunkPayload(
-    wire::ByteSpan encoded_payload,
-    std::string& out_error) {
+core::Status SimulationKernel::ApplyRemoteChunkPayload(wire::ByteSpan encoded_payload) {
     if (!initialized_) {
-        out_error = "Simulation kernel is not initialized.";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "Simulation kernel is not initialized.");
     }
 
-    world::ChunkSnapshot snapshot{};
-    if (!world::WorldSnapshotCodec::DecodeChunkSnapshot(encoded_payload, snapshot, out_error)) {
-        return false;
+    world::ChunkSnapshot& snapshot = chunk_snapshot_scratch_;
+    const core::Status status = world::WorldSnapshotCodec::DecodeChunkSnapshot(encoded_payload, snapshot);
+    if (!status) {
+        return status;
     }
-
-    return world_service_.ApplyChunkSnapshot(snapshot, out_error);
+    return world_service_.ApplyChunkSnapshot(snapshot);
 }
 
 std::uint64_t SimulationKernel::CurrentTick() const {
@@ -242,8 +261,16 @@ std::size_t SimulationKernel::DroppedLocalCommandCount() const {
 std::vector<GameplayPickupEvent> SimulationKernel::ConsumePickupEventsForPlayer(
     std::uint32_t player_id) {
     std::vector<GameplayPickupEvent> events;
+    ConsumePickupEventsForPlayer(player_id, events);
+    return events;
+}
+
+void SimulationKernel::ConsumePickupEventsForPlayer(
+    std::uint32_t player_id,
+    std::vector<GameplayPickupEvent>& out_events) {
+    out_events.clear();
     if (pending_pickup_events_.empty()) {
-        return events;
+        return;
     }
 
     auto write_iter = pending_pickup_events_.begin();
@@ -251,7 +278,7 @@ std::vector<GameplayPickupEvent> SimulationKernel::ConsumePickupEventsForPlayer(
          read_iter != pending_pickup_events_.end();
          ++read_iter) {
         if (read_iter->player_id == player_id) {
-            events.push_back(*read_iter);
+            out_events.push_back(*read_iter);
             continue;
         }
 
@@ -262,7 +289,6 @@ std::vector<GameplayPickupEvent> SimulationKernel::ConsumePickupEventsForPlayer(
     }
 
     pending_pickup_events_.erase(write_iter, pending_pickup_events_.end());
-    return events;
 }
 
 GameplayProgressSnapshot SimulationKernel::GameplayProgress() const {
@@ -285,6 +311,404 @@ PlayerMotionSnapshot SimulationKernel::LocalPlayerMotion() const {
     return ecs_runtime_.MotionSnapshot(local_player_id_);
 }
 
+PlayerMotionPredictionDiagnostics SimulationKernel::LocalMotionPredictionDiagnostics() const {
+    return local_motion_predictor_.DiagnosticsSnapshot();
+}
+
+void SimulationKernel::SetRemoteInterpolationSettings(const EntityInterpolationSettings& settings) {
+    remote_entity_interpolation_.SetSettings(settings);
+    replicated_entity_interpolation_.SetSettings(settings);
+}
+
+std::vector<InterpolatedEntityState> SimulationKernel::SampleRemotePlayers(float interpolation_alpha) {
+    if (!initialized_) {
+        return {};
+    }
+
+    if (authority_mode_ == SimulationAuthorityMode::Replica) {
+        std::vector<InterpolatedEntityState> remote_players = remote_entity_interpolation_.Sample(
+            tick_index_ == 0 ? 0 : tick_index_ - 1,
+            interpolation_alpha,
+            last_fixed_delta_seconds_);
+        // A player that left this client's interest set stops being sampled rather than drifting on.
+        std::erase_if(remote_players, [this](const InterpolatedEntityState& remote_player) {
+            return FindReplicatedEntity(
+                       received_entities_,
+                       kReplicatedPlayerNetworkIdFlag | remote_player.entity_id) == nullptr;
+        });
+        return remote_players;
+    }
+
+    std::vector<InterpolatedEntityState> remote_players;
+    for (const std::uint32_t player_id : ecs_runtime_.PlayerIds()) {
+        if (player_id == local_player_id_) {
+            continue;
+        }
+
+        const PlayerMotionState state = ecs_runtime_.MotionState(player_id);
+        remote_players.push_back(InterpolatedEntityState{
+            .entity_id = player_id,
+            .position_x = state.position_x,
+            .position_y = state.position_y,
+            .velocity_x = state.velocity_x,
+            .velocity_y = state.velocity_y,
+        });
+    }
+    return remote_players;
+}
+
+EntityInterpolationDiagnostics SimulationKernel::RemoteInterpolationDiagnostics() const {
+    return remote_entity_interpolation_.DiagnosticsSnapshot();
+}
+
+void SimulationKernel::SetEntityReplicationSettings(const EntityReplicationSettings& settings) {
+    entity_replication_sender_.SetSettings(settings);
+}
+
+std::vector<ecs::ReplicatedEntitySnapshot> SimulationKernel::ReplicatedEntities() const {
+    if (!initialized_) {
+        return {};
+    }
+
+    if (authority_mode_ == SimulationAuthorityMode::Replica) {
+        return entity_replication_receiver_.Entities();
+    }
+    return ecs_runtime_.ReplicatedEntities();
+}
+
+std::vector<ecs::ReplicatedEntitySnapshot> SimulationKernel::SampleReplicatedEntities(float interpolation_alpha) {
+    if (!initialized_) {
+        return {};
+    }
+
+    if (authority_mode_ != SimulationAuthorityMode::Replica) {
+        return ecs_runtime_.ReplicatedEntities();
+    }
+
+    std::vector<ecs::ReplicatedEntitySnapshot> entities;
+    for (const InterpolatedEntityState& sample : replicated_entity_interpolation_.Sample(
+             tick_index_ == 0 ? 0 : tick_index_ - 1,
+             interpolation_alpha,
+             last_fixed_delta_seconds_)) {
+        const ecs::ReplicatedEntitySnapshot* received = FindReplicatedEntity(received_entities_, sample.entity_id);
+        if (received == nullptr) {
+            continue;
+        }
+
+        ecs::ReplicatedEntitySnapshot entity = *received;
+        entity.position_x = sample.position_x;
+        entity.position_y = sample.position_y;
+        entity.velocity_x = sample.velocity_x;
+        entity.velocity_y = sample.velocity_y;
+        entities.push_back(entity);
+    }
+    return entities;
+}
+
+EntityReplicationSenderDiagnostics SimulationKernel::EntityReplicationSenderDiagnosticsSnapshot() const {
+    return entity_replication_sender_.DiagnosticsSnapshot();
+}
+
+EntityReplicationReceiverDiagnostics SimulationKernel::EntityReplicationReceiverDiagnosticsSnapshot() const {
+    return entity_replication_receiver_.DiagnosticsSnapshot();
+}
+
+void SimulationKernel::SetInputJitterBufferSettings(const InputJitterBufferSettings& settings) {
+    remote_input_jitter_buffer_.SetSettings(settings);
+}
+
+InputJitterBufferDiagnostics SimulationKernel::InputJitterBufferDiagnosticsSnapshot() const {
+    return remote_input_jitter_buffer_.DiagnosticsSnapshot();
+}
+
+void SimulationKernel::SetCommandRateLimiterSettings(const CommandRateLimiterSettings& settings) {
+    command_rate_limiter_.SetSettings(settings);
+}
+
+CommandRateLimiterDiagnostics SimulationKernel::CommandRateLimiterDiagnosticsSnapshot() const {
+    return command_rate_limiter_.DiagnosticsSnapshot();
+}
+
+void SimulationKernel::SetTickProfilerSettings(const TickProfilerSettings& settings) {
+    tick_profiler_.SetSettings(settings);
+    tick_profiler_.Reset();
+}
+
+TickProfilerDiagnostics SimulationKernel::TickProfilerDiagnosticsSnapshot() const {
+    return tick_profiler_.DiagnosticsSnapshot();
+}
+
+bool SimulationKernel::SetSnapshotEncodeWorkerCount(std::size_t worker_count, std::string& out_error) {
+    CompleteChunkSnapshotEncode(initialized_);
+    snapshot_encode_workers_.Stop();
+    if (worker_count == 0) {
+        out_error.clear();
+        return true;
+    }
+
+    return snapshot_encode_workers_.Start(worker_count, out_error);
+}
+
+std::size_t SimulationKernel::SnapshotEncodeWorkerCount() const {
+    return snapshot_encode_workers_.WorkerCount();
+}
+
+void SimulationKernel::StartInputRecording(std::uint64_t checkpoint_interval_ticks) {
+    input_recorder_.Begin(InputLogHeader{
+        .start_tick = tick_index_,
+        .local_player_id = local_player_id_,
+        .authority = authority_mode_ == SimulationAuthorityMode::Authority,
+    });
+    input_checkpoint_interval_ticks_ = checkpoint_interval_ticks;
+    input_recorded_fixed_delta_seconds_ = 0.0;
+}
+
+void SimulationKernel::StopInputRecording() {
+    if (!input_recorder_.Active()) {
+        return;
+    }
+
+    input_recorder_.End(tick_index_, ComputeStateHash());
+}
+
+bool SimulationKernel::InputRecordingActive() const {
+    return input_recorder_.Active();
+}
+
+void SimulationKernel::ConsumeInputRecording(wire::ByteBuffer& out_bytes) {
+    input_recorder_.ConsumeBytes(out_bytes);
+}
+
+std::uint64_t SimulationKernel::ComputeStateHash() const {
+    wire::ByteWriter writer;
+    writer.WriteVarUInt(tick_index_);
+
+    std::vector<std::uint32_t> player_ids;
+    ecs_runtime_.CollectPlayerIds(player_ids);
+    std::sort(player_ids.begin(), player_ids.end());
+    for (const std::uint32_t player_id : player_ids) {
+        const PlayerMotionState motion = ecs_runtime_.MotionState(player_id);
+        const PlayerInventorySnapshot inventory = ecs_runtime_.InventorySnapshot(player_id);
+        const sim::ActionPrimaryProgressSnapshot action = ecs_runtime_.ActionPrimaryProgressSnapshot(player_id);
+        writer.WriteVarUInt(player_id);
+        writer.WriteF32(motion.position_x);
+        writer.WriteF32(motion.position_y);
+        writer.WriteF32(motion.velocity_x);
+        writer.WriteF32(motion.velocity_y);
+        writer.WriteU8(motion.on_ground ? 1 : 0);
+        const std::uint32_t inventory_counts[] = {
+            inventory.dirt_count,
+            inventory.stone_count,
+            inventory.wood_count,
+            inventory.coal_count,
+            inventory.torch_count,
+            inventory.workbench_count,
+            inventory.wood_sword_count,
+        };
+        writer.WriteU32Array(inventory_counts);
+        writer.WriteU8(action.active ? 1 : 0);
+        writer.WriteVarInt(action.target_tile_x);
+        writer.WriteVarInt(action.target_tile_y);
+        writer.WriteVarInt(action.elapsed_ticks);
+    }
+
+    std::vector<ecs::ReplicatedEntitySnapshot> entities;
+    ecs_runtime_.CollectReplicatedEntities(entities);
+    std::sort(
+        entities.begin(),
+        entities.end(),
+        [](const ecs::ReplicatedEntitySnapshot& lhs, const ecs::ReplicatedEntitySnapshot& rhs) {
+            return lhs.network_id < rhs.network_id;
+        });
+    for (const ecs::ReplicatedEntitySnapshot& entity : entities) {
+        writer.WriteVarUInt(entity.network_id);
+        writer.WriteU8(static_cast<wire::Byte>(entity.kind));
+        writer.WriteF32(entity.position_x);
+        writer.WriteF32(entity.position_y);
+        writer.WriteF32(entity.velocity_x);
+        writer.WriteF32(entity.velocity_y);
+        writer.WriteVarInt(entity.health);
+        writer.WriteVarUInt(entity.material_id);
+        writer.WriteVarUInt(entity.amount);
+        writer.WriteVarUInt(entity.owner_player_id);
+    }
+
+    const GameplayProgressSnapshot progress = gameplay_ruleset_.Snapshot();
+    const std::uint32_t progress_fields[] = {
+        progress.wood_collected,
+        progress.stone_collected,
+        progress.workbench_built ? 1U : 0U,
+        progress.sword_crafted ? 1U : 0U,
+        progress.enemy_kill_count,
+        progress.boss_health,
+        progress.boss_defeated ? 1U : 0U,
+        progress.playable_loop_complete ? 1U : 0U,
+    };
+    writer.WriteU32Array(progress_fields);
+
+    std::vector<world::ChunkCoord> chunk_coords;
+    world_service_.LoadedChunkCoords(chunk_coords);
+    std::sort(
+        chunk_coords.begin(),
+        chunk_coords.end(),
+        [](const world::ChunkCoord& lhs, const world::ChunkCoord& rhs) {
+            if (lhs.x != rhs.x) {
+                return lhs.x < rhs.x;
+            }
+            return lhs.y < rhs.y;
+        });
+    world::ChunkSnapshot chunk_snapshot{};
+    for (const world::ChunkCoord& chunk_coord : chunk_coords) {
+        if (!world_service_.BuildChunkSnapshot(chunk_coord, chunk_snapshot)) {
+            continue;
+        }
+        writer.WriteVarInt(chunk_coord.x);
+        writer.WriteVarInt(chunk_coord.y);
+        writer.WriteU16Array(chunk_snapshot.tiles);
+    }
+
+    // FNV-1a over the canonical encoding; stable across runs and platforms with IEEE floats.
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (const wire::Byte byte : writer.Buffer()) {
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void SimulationKernel::SaveState(SimulationStateSnapshot& out_state) const {
+    out_state.tick_index = tick_index_;
+    out_state.gameplay_progress = gameplay_ruleset_.Snapshot();
+    world_service_.CaptureState(out_state.world);
+
+    wire::ByteWriter& arena = out_state.arena;
+    arena.Clear();
+    ecs_runtime_.SaveState(arena);
+    arena.WriteVarUInt(pending_local_commands_.size());
+    for (const net::PlayerCommand& command : pending_local_commands_) {
+        arena.WriteVarUInt(command.player_id);
+        arena.WriteVarUInt(command.command_id);
+        arena.WriteVarUInt(command.sequence);
+        arena.WriteVarUInt(command.target_tick);
+        arena.WriteBytes(command.payload.View());
+    }
+    arena.WriteVarUInt(pending_pickup_events_.size());
+    for (const GameplayPickupEvent& event : pending_pickup_events_) {
+        arena.WriteVarUInt(event.player_id);
+        arena.WriteVarInt(event.tile_x);
+        arena.WriteVarInt(event.tile_y);
+        arena.WriteVarUInt(event.material_id);
+        arena.WriteVarUInt(event.resource_id);
+        arena.WriteVarUInt(event.amount);
+    }
+    arena.WriteVarUInt(last_applied_command_sequences_.size());
+    for (const auto& [player_id, sequence] : last_applied_command_sequences_) {
+        arena.WriteVarUInt(player_id);
+        arena.WriteVarUInt(sequence);
+    }
+}
+
+core::Status SimulationKernel::LoadState(const SimulationStateSnapshot& state) {
+    if (!initialized_) {
+        return core::Status::Error(core::StatusCode::NotInitialized, "Simulation kernel is not initialized.");
+    }
+    if (input_recorder_.Active()) {
+        return core::Status::Error(
+            core::StatusCode::Unavailable,
+            "Simulation state cannot be loaded while input recording is active.");
+    }
+
+    // Everything is parsed into staging first; live state is only touched once the whole snapshot has
+    // validated, so a rejected load leaves the kernel exactly as it was.
+    wire::ByteReader reader(wire::ByteSpan(state.arena.Buffer().data(), state.arena.Buffer().size()));
+    core::Status status = ecs_runtime_.StageState(reader);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    const core::Status malformed =
+        core::Status::Error(core::StatusCode::MalformedPayload, "Simulation state arena is truncated or malformed.");
+    std::uint64_t count = 0;
+    if (!reader.ReadVarUInt(count) || count > kMaxPendingLocalCommands) {
+        return malformed;
+    }
+    staged_local_commands_.resize(static_cast<std::size_t>(count));
+    for (net::PlayerCommand& command : staged_local_commands_) {
+        std::uint64_t fields[4] = {};
+        wire::ByteSpan payload;
+        if (!reader.ReadVarUInts(fields) || !reader.ReadBytes(payload)) {
+            return malformed;
+        }
+        command.player_id = static_cast<std::uint32_t>(fields[0]);
+        command.command_id = static_cast<std::uint32_t>(fields[1]);
+        command.sequence = static_cast<std::uint32_t>(fields[2]);
+        command.target_tick = fields[3];
+        command.payload.Assign(payload);
+    }
+
+    if (!reader.ReadVarUInt(count) || count > reader.Remaining()) {
+        return malformed;
+    }
+    staged_pickup_events_.resize(static_cast<std::size_t>(count));
+    for (GameplayPickupEvent& event : staged_pickup_events_) {
+        std::uint64_t ids[1] = {};
+        std::int64_t tiles[2] = {};
+        std::uint64_t fields[3] = {};
+        if (!reader.ReadVarUInts(ids) || !reader.ReadVarInts(tiles) || !reader.ReadVarUInts(fields)) {
+            return malformed;
+        }
+        event.player_id = static_cast<std::uint32_t>(ids[0]);
+        event.tile_x = static_cast<int>(tiles[0]);
+        event.tile_y = static_cast<int>(tiles[1]);
+        event.material_id = static_cast<std::uint16_t>(fields[0]);
+        event.resource_id = static_cast<std::uint16_t>(fields[1]);
+        event.amount = static_cast<std::uint32_t>(fields[2]);
+    }
+
+    if (!reader.ReadVarUInt(count) || count > reader.Remaining()) {
+        return malformed;
+    }
+    staged_command_sequences_.resize(static_cast<std::size_t>(count));
+    for (auto& [player_id, sequence] : staged_command_sequences_) {
+        std::uint64_t entry[2] = {};
+        if (!reader.ReadVarUInts(entry)) {
+            return malformed;
+        }
+        player_id = static_cast<std::uint32_t>(entry[0]);
+        sequence = static_cast<std::uint32_t>(entry[1]);
+    }
+    if (!reader.IsFullyConsumed()) {
+        return malformed;
+    }
+
+    // RestoreState validates every chunk before mutating anything, so it is the last step that can fail.
+    status = world_service_.RestoreState(state.world);
+    if (!status.IsOk()) {
+        return status;
+    }
+
+    // A worker encode still in flight holds pre-load tiles; publishing it next Update would hand replicas the
+    // world being rolled back. Drop it and re-queue its chunks, because chunks whose tiles the restore left
+    // untouched are not marked dirty and would otherwise never be re-sent.
+    if (snapshot_encode_pending_) {
+        for (std::size_t index = 0; index < snapshot_encode_count_; ++index) {
+            QueueChunkForInitialSync(snapshot_encode_inputs_[index].chunk_coord);
+        }
+        CompleteChunkSnapshotEncode(false);
+    }
+    ecs_runtime_.CommitStagedState();
+    // Also drops buffered remote input and rate-limit buckets: they were admitted against the pre-load
+    // timeline and are not part of the snapshot.
+    ResetReplicationState();
+    pending_local_commands_.swap(staged_local_commands_);
+    pending_pickup_events_.swap(staged_pickup_events_);
+    last_applied_command_sequences_.clear();
+    last_applied_command_sequences_.insert(staged_command_sequences_.begin(), staged_command_sequences_.end());
+    gameplay_ruleset_.Restore(state.gameplay_progress);
+    tick_index_ = state.tick_index;
+    return core::Status::Ok();
+}
+
 void SimulationKernel::RestoreGameplayProgress(const GameplayProgressSnapshot& snapshot) {
     gameplay_ruleset_.Restore(snapshot);
 }
@@ -304,12 +728,14 @@ void SimulationKernel::TryDispatchPendingNetSessionEvent() {
         return;
     }
 
+    script::NetSessionStateChangedEventPayload payload{
+        .session_state = SessionStateName(pending_net_session_event_.session_state),
+    };
+    script::AssignScriptEventText(pending_net_session_event_.transition_reason, payload.reason);
     script_host_.DispatchEvent(script::ScriptEvent{
-        .event_name = "net.session_state_changed",
-        .payload = BuildSessionStateChangedPayload(
-            pending_net_session_event_.session_state,
-            pending_net_session_event_.transition_tick,
-            pending_net_session_event_.transition_reason),
+        .id = script::ScriptEventId::NetSessionStateChanged,
+        .tick_index = pending_net_session_event_.transition_tick,
+        .payload = payload,
     });
 
     pending_net_session_event_ = {};
@@ -342,313 +768,575 @@ void SimulationKernel::RemoveChunkFromInitialSync(const world::ChunkCoord& chunk
 }
 
 void SimulationKernel::QueueLoadedChunksForInitialSync() {
-    for (const world::ChunkCoord& chunk_coord : world_service_.LoadedChunkCoords()) {
+    world_service_.LoadedChunkCoords(chunk_coord_scratch_);
+    for (const world::ChunkCoord& chunk_coord : chunk_coord_scratch_) {
         QueueChunkForInitialSync(chunk_coord);
     }
 }
 
-void SimulationKernel::ExecuteWorldCommandIfMatched(const TypedPlayerCommand& command) {
-    if (command.type == TypedPlayerCommandType::WorldSetTile) {
-        const world::TileMutation mutation{
-            .tile_x = command.world_set_tile.tile_x,
-            .tile_y = command.world_set_tile.tile_y,
-            .material_id = command.world_set_tile.material_id,
-        };
-        std::string apply_error;
-        (void)world_service_.ApplyTileMutation(mutation, apply_error);
-        return;
-    }
+void SimulationKernel::ApplyRemoteEntityStates(double fixed_delta_seconds) {
+    bool has_new_replication_ack = false;
+    net_service_.ConsumeRemoteEntityStates(remote_entity_state_scratch_);
+    for (const net::EntityStateBatch& batch : remote_entity_state_scratch_) {
+        remote_entity_interpolation_.ObserveServerTick(batch.tick_index, tick_index_);
+        replicated_entity_interpolation_.ObserveServerTick(batch.tick_index, tick_index_);
+        for (const auto& encoded_state : batch.entity_states) {
+            const wire::ByteSpan encoded_span(encoded_state.data(), encoded_state.size());
+            EntityStateType state_type = EntityStateType::PlayerState;
+            if (!TryPeekEntityStateType(encoded_span, state_type)) {
+                continue;
+            }
+            if (state_type == EntityStateType::EntityDelta) {
+                if (ApplyRemoteEntityDelta(batch.tick_index, encoded_span)) {
+                    PushReceivedEntitySamples(batch.tick_index);
+                    has_new_replication_ack = true;
+                }
+                continue;
+            }
 
-    if (command.type == TypedPlayerCommandType::WorldLoadChunk) {
-        const world::ChunkCoord chunk_coord{
-            .x = command.world_chunk.chunk_x,
-            .y = command.world_chunk.chunk_y,
-        };
-        world_service_.LoadChunk(chunk_coord);
-        QueueChunkForInitialSync(chunk_coord);
-        return;
+            // Remote players arrive through the entity delta; a player state is only the local acked one.
+            PlayerEntityState entity_state{};
+            if (!TryDecodePlayerEntityState(encoded_span, entity_state) ||
+                entity_state.player_id != local_player_id_) {
+                continue;
+            }
+
+            PlayerMotionState reconciled_state{};
+            if (local_motion_predictor_.Reconcile(
+                    entity_state.acked_command_sequence,
+                    entity_state.motion,
+                    DefaultPlayerMotionSettings(),
+                    world_service_,
+                    fixed_delta_seconds,
+                    reconciled_state)) {
+                ecs_runtime_.SetPlayerMotionState(local_player_id_, reconciled_state);
+            }
+        }
     }
 
-    if (command.type == TypedPlayerCommandType::WorldUnloadChunk) {
-        const world::ChunkCoord chunk_coord{
-            .x = command.world_chunk.chunk_x,
-            .y = command.world_chunk.chunk_y,
-        };
-        world_service_.UnloadChunk(chunk_coord);
-        RemoveChunkFromInitialSync(chunk_coord);
+    if (has_new_replication_ack) {
+        command_payload_writer_.Clear();
+        command::EncodeReplicationEntityAckPayload(
+            {.acked_tick = entity_replication_receiver_.LastAppliedTick()},
+            command_payload_writer_);
+        SubmitLocalCommand(net::PlayerCommand{
+            .player_id = local_player_id_,
+            .command_id = command::kReplicationEntityAck,
+            .payload = wire::SmallByteBuffer(command_payload_writer_.Buffer()),
+        });
     }
 }
 
-void SimulationKernel::ExecuteControlCommandIfMatched(
-    const TypedPlayerCommand& command,
-    std::uint32_t player_id) {
-    if (command.type != TypedPlayerCommandType::PlayerMotionInput) {
-        return;
+bool SimulationKernel::ApplyRemoteEntityDelta(std::uint64_t tick_index, wire::ByteSpan encoded_delta) {
+    EntityDelta delta{};
+    if (!TryDecodeEntityDelta(encoded_delta, delta) || delta.recipient_player_id != local_player_id_) {
+        return false;
     }
 
-    PlayerMotionInput input{};
-    input.move_axis = static_cast<float>(command.player_motion_input.move_axis_milli) / 1000.0F;
-    input.jump_pressed = (command.player_motion_input.input_flags & command::kMotionInputFlagJumpPressed) != 0;
-    ecs_runtime_.SetPlayerMotionInput(player_id, input);
+    return entity_replication_receiver_.ApplyDelta(tick_index, delta);
 }
 
-void SimulationKernel::ExecuteGameplayCommandIfMatched(
-    const TypedPlayerCommand& command,
-    std::uint32_t player_id) {
-    if (command.type == TypedPlayerCommandType::GameplayCollectResource) {
-        ecs_runtime_.AddResourceToInventory(
-            player_id,
-            command.collect_resource.resource_id,
-            command.collect_resource.amount);
-
-        gameplay_ruleset_.CollectResource(
-            command.collect_resource.resource_id,
-            command.collect_resource.amount,
-            tick_index_,
-            script_host_);
-        return;
-    }
+void SimulationKernel::PushReceivedEntitySamples(std::uint64_t server_tick) {
+    entity_replication_receiver_.CollectEntities(received_entities_);
+    for (const ecs::ReplicatedEntitySnapshot& entity : received_entities_) {
+        if (entity.kind != ecs::ReplicatedEntityKind::Player) {
+            replicated_entity_interpolation_.PushSample(
+                entity.network_id,
+                server_tick,
+                PlayerMotionState{
+                    .position_x = entity.position_x,
+                    .position_y = entity.position_y,
+                    .velocity_x = entity.velocity_x,
+                    .velocity_y = entity.velocity_y,
+                });
+            continue;
+        }
+        if (entity.owner_player_id == local_player_id_) {
+            continue;
+        }
 
-    if (command.type == TypedPlayerCommandType::GameplaySpawnDrop) {
-        ecs_runtime_.QueueSpawnWorldDrop(command.spawn_drop);
-        return;
+        PlayerMotionState motion = ecs_runtime_.MotionState(entity.owner_player_id);
+        motion.position_x = entity.position_x;
+        motion.position_y = entity.position_y;
+        motion.velocity_x = entity.velocity_x;
+        motion.velocity_y = entity.velocity_y;
+        ecs_runtime_.SetPlayerMotionState(entity.owner_player_id, motion);
+        remote_entity_interpolation_.PushSample(entity.owner_player_id, server_tick, motion);
     }
+}
 
-    if (command.type == TypedPlayerCommandType::GameplayPickupProbe) {
-        ecs_runtime_.QueuePickupProbe(player_id, command.pickup_probe);
-        return;
+void SimulationKernel::PublishEntityStates() {
+    entity_state_buffer_pool_.Recycle();
+    entity_state_recipient_ids_.clear();
+    ecs_runtime_.CollectReplicatedEntities(replicated_entity_scratch_);
+    ecs_runtime_.CollectPlayerIds(player_id_scratch_);
+    for (const std::uint32_t player_id : player_id_scratch_) {
+        const PlayerMotionState motion = ecs_runtime_.MotionState(player_id);
+        if ((player_id & kReplicatedPlayerNetworkIdFlag) == 0) {
+            replicated_entity_scratch_.push_back(ReplicatedPlayerEntity(player_id, motion));
+        }
+        if (player_id == local_player_id_) {
+            continue;
+        }
+
+        // Only the owning client hears its acked state; everyone else sees the player through its delta.
+        const auto sequence_it = last_applied_command_sequences_.find(player_id);
+        wire::ByteWriter writer = entity_state_buffer_pool_.AcquireWriter();
+        EncodePlayerEntityState(
+            PlayerEntityState{
+                .player_id = player_id,
+                .acked_command_sequence =
+                    sequence_it == last_applied_command_sequences_.end() ? 0 : sequence_it->second,
+                .motion = motion,
+            },
+            writer);
+        entity_state_buffer_pool_.Commit(writer);
+        entity_state_recipient_ids_.push_back(player_id);
     }
 
-    if (command.type == TypedPlayerCommandType::GameplayInteraction) {
-        gameplay_ruleset_.ExecuteInteraction(
-            player_id,
-            command.interaction,
-            tick_index_,
-            script_host_);
-        return;
+    player_id_scratch_.clear();
+    for (const auto& [player_id, sequence] : last_applied_command_sequences_) {
+        (void)sequence;
+        if (player_id != local_player_id_) {
+            player_id_scratch_.push_back(player_id);
+        }
     }
 
-    if (command.type == TypedPlayerCommandType::GameplayActionPrimary) {
-        ecs::ActionPrimaryPlan plan{};
-        std::uint16_t target_material_id = 0;
-        if (!world_service_.TryReadTile(
-                command.action_primary.target_tile_x,
-                command.action_primary.target_tile_y,
-                target_material_id)) {
-            ecs_runtime_.ApplyActionPrimary(
-                player_id,
-                command.action_primary,
-                plan,
-                0,
-                world_service_);
-            return;
-        }
-
-        const PlayerMotionSnapshot motion_snapshot = ecs_runtime_.MotionSnapshot(player_id);
-        const int player_tile_x = static_cast<int>(std::floor(motion_snapshot.position_x));
-        const int player_tile_y = static_cast<int>(std::floor(motion_snapshot.position_y));
-        const PlayerInventorySnapshot inventory = ecs_runtime_.InventorySnapshot(player_id);
+    for (const std::uint32_t client_player_id : player_id_scratch_) {
+        const PlayerMotionState interest_center = ecs_runtime_.MotionState(client_player_id);
+        wire::ByteWriter writer = entity_state_buffer_pool_.AcquireWriter();
+        if (entity_replication_sender_.BuildClientDelta(
+                client_player_id,
+                tick_index_,
+                interest_center.position_x,
+                interest_center.position_y,
+                replicated_entity_scratch_,
+                writer)) {
+            entity_state_buffer_pool_.Commit(writer);
+            entity_state_recipient_ids_.push_back(client_player_id);
+        } else {
+            entity_state_buffer_pool_.Release(writer);
+        }
+    }
 
-        const script::simrpc::ActionPrimaryRequest request_data{
-            .player_id = player_id,
-            .player_tile_x = player_tile_x,
-            .player_tile_y = player_tile_y,
-            .target_tile_x = command.action_primary.target_tile_x,
-            .target_tile_y = command.action_primary.target_tile_y,
-            .hotbar_row = command.action_primary.hotbar_row,
-            .hotbar_slot = command.action_primary.hotbar_slot,
-            .dirt_count = inventory.dirt_count,
-            .stone_count = inventory.stone_count,
-            .wood_count = inventory.wood_count,
-            .coal_count = inventory.coal_count,
-            .torch_count = inventory.torch_count,
-            .workbench_count = inventory.workbench_count,
-            .wood_sword_count = inventory.wood_sword_count,
-            .has_pickaxe_tool = inventory.has_pickaxe_tool,
-            .has_axe_tool = inventory.has_axe_tool,
-            .target_is_air = target_material_id == world::material::kAir,
-            .harvest_ticks = static_cast<std::uint32_t>(world::material::HarvestTicks(target_material_id)),
-            .harvestable_by_pickaxe = world::material::IsHarvestableByPickaxe(target_material_id),
-            .harvestable_by_axe = world::material::IsHarvestableByAxe(target_material_id),
-            .harvestable_by_sword = world::material::IsHarvestableBySword(target_material_id),
-        };
+    net_service_.PublishEntityStates(
+        tick_index_,
+        entity_state_buffer_pool_.Buffers(),
+        entity_state_recipient_ids_);
+}
 
-        const wire::ByteBuffer request_bytes =
-            script::simrpc::EncodeActionPrimaryRequest(request_data);
-
-        wire::ByteBuffer response;
-        std::string call_error;
-        if (!script_host_.TryCallModuleFunction(
-                "core",
-                "novaria_on_sim_command",
-                wire::ByteSpan(request_bytes.data(), request_bytes.size()),
-                response,
-                call_error)) {
-            core::Logger::Error("sim", "Core script call failed: " + call_error);
-            std::abort();
+void SimulationKernel::DispatchChunkSnapshotEncode(const std::vector<world::ChunkCoord>& chunk_coords) {
+    // Snapshots are copied out of the world on the tick thread; workers only see these immutable copies.
+    std::size_t snapshot_count = 0;
+    for (const world::ChunkCoord& chunk_coord : chunk_coords) {
+        if (snapshot_encode_inputs_.size() <= snapshot_count) {
+            snapshot_encode_inputs_.emplace_back();
         }
-
-        script::simrpc::ActionPrimaryResponse response_data{};
-        if (!script::simrpc::TryDecodeActionPrimaryResponse(
-                wire::ByteSpan(response.data(), response.size()),
-                response_data)) {
-            core::Logger::Error("sim", "Invalid core script action_primary response payload.");
-            std::abort();
+        if (!world_service_.BuildChunkSnapshot(chunk_coord, snapshot_encode_inputs_[snapshot_count])) {
+            continue;
         }
+        ++snapshot_count;
+    }
 
-        if (response_data.result == script::simrpc::ActionPrimaryResult::Harvest) {
-            if (response_data.required_ticks == 0) {
-                core::Logger::Error("sim", "Core script returned invalid harvest ticks.");
-                std::abort();
-            }
-            plan.is_harvest = true;
-            plan.required_ticks = static_cast<int>(response_data.required_ticks);
-        } else if (response_data.result == script::simrpc::ActionPrimaryResult::Place) {
-            if (response_data.required_ticks == 0) {
-                core::Logger::Error("sim", "Core script returned invalid place ticks.");
-                std::abort();
-            }
+    if (snapshot_encode_writers_.size() < snapshot_count) {
+        snapshot_encode_writers_.resize(snapshot_count);
+    }
+    for (std::size_t index = 0; index < snapshot_count; ++index) {
+        snapshot_encode_writers_[index] = chunk_snapshot_buffer_pool_.AcquireWriter();
+    }
+    snapshot_encode_results_.assign(snapshot_count, 0);
+    snapshot_encode_count_ = snapshot_count;
+    snapshot_encode_tick_ = tick_index_;
+    snapshot_encode_pending_ = true;
+    snapshot_encode_workers_.Dispatch(snapshot_count, [this](std::size_t index) {
+        snapshot_encode_results_[index] = world::WorldSnapshotCodec::EncodeChunkSnapshot(
+            snapshot_encode_inputs_[index],
+            snapshot_encode_writers_[index]).IsOk() ? 1 : 0;
+    });
+}
 
-            std::uint16_t place_material_id = 0;
-            switch (response_data.place_kind) {
-                case script::simrpc::PlaceKind::Dirt:
-                    place_material_id = world::material::kDirt;
-                    break;
-                case script::simrpc::PlaceKind::Stone:
-                    place_material_id = world::material::kStone;
-                    break;
-                case script::simrpc::PlaceKind::Torch:
-                    place_material_id = world::material::kTorch;
-                    break;
-                case script::simrpc::PlaceKind::Workbench:
-                    place_material_id = world::material::kWorkbench;
-                    break;
-                default:
-                    break;
-            }
-            if (place_material_id == 0) {
-                core::Logger::Error("sim", "Core script returned invalid place kind.");
-                std::abort();
-            }
+void SimulationKernel::CompleteChunkSnapshotEncode(bool publish) {
+    if (!snapshot_encode_pending_) {
+        return;
+    }
 
-            plan.is_place = true;
-            plan.place_material_id = place_material_id;
-            plan.required_ticks = static_cast<int>(response_data.required_ticks);
+    snapshot_encode_workers_.Wait();
+    snapshot_encode_pending_ = false;
+    // Committing in dispatch order keeps the published payload list identical to the serial path.
+    for (std::size_t index = 0; index < snapshot_encode_count_; ++index) {
+        if (snapshot_encode_results_[index] != 0) {
+            chunk_snapshot_buffer_pool_.Commit(snapshot_encode_writers_[index]);
         } else {
-            plan = {};
+            chunk_snapshot_buffer_pool_.Release(snapshot_encode_writers_[index]);
         }
+    }
+    snapshot_encode_count_ = 0;
 
+    if (publish) {
+        net_service_.PublishWorldSnapshot(snapshot_encode_tick_, chunk_snapshot_buffer_pool_.Buffers());
+    }
+}
+
+void SimulationKernel::ResetReplicationState() {
+    local_motion_predictor_.Reset();
+    remote_entity_interpolation_.Reset();
+    replicated_entity_interpolation_.Reset();
+    entity_replication_sender_.Reset();
+    entity_replication_receiver_.Reset();
+    received_entities_.clear();
+    command_rate_limiter_.Reset();
+    remote_input_jitter_buffer_.Reset();
+    last_applied_command_sequences_.clear();
+}
+
+constexpr SimulationKernel::CommandHandlerTable SimulationKernel::BuildCommandHandlers() {
+    CommandHandlerTable handlers{};
+    const auto add = [&handlers](TypedPlayerCommandType type, TypedPlayerCommandHandler<SimulationKernel> handler) {
+        handlers[static_cast<std::size_t>(type)] = handler;
+    };
+    add(TypedPlayerCommandType::PlayerMotionInput, &SimulationKernel::ExecutePlayerMotionInput);
+    add(TypedPlayerCommandType::WorldSetTile, &SimulationKernel::ExecuteWorldSetTile);
+    add(TypedPlayerCommandType::WorldLoadChunk, &SimulationKernel::ExecuteWorldLoadChunk);
+    add(TypedPlayerCommandType::WorldUnloadChunk, &SimulationKernel::ExecuteWorldUnloadChunk);
+    add(TypedPlayerCommandType::GameplayCollectResource, &SimulationKernel::ExecuteCollectResource);
+    add(TypedPlayerCommandType::GameplaySpawnDrop, &SimulationKernel::ExecuteSpawnDrop);
+    add(TypedPlayerCommandType::GameplayPickupProbe, &SimulationKernel::ExecutePickupProbe);
+    add(TypedPlayerCommandType::GameplayInteraction, &SimulationKernel::ExecuteInteraction);
+    add(TypedPlayerCommandType::GameplayActionPrimary, &SimulationKernel::ExecuteActionPrimary);
+    add(TypedPlayerCommandType::GameplayCraftRecipe, &SimulationKernel::ExecuteCraftRecipe);
+    add(TypedPlayerCommandType::GameplayAttackEnemy, &SimulationKernel::ExecuteAttackEnemy);
+    add(TypedPlayerCommandType::GameplayAttackBoss, &SimulationKernel::ExecuteAttackBoss);
+    add(TypedPlayerCommandType::CombatFireProjectile, &SimulationKernel::ExecuteFireProjectile);
+    add(TypedPlayerCommandType::ReplicationEntityAck, &SimulationKernel::ExecuteReplicationEntityAck);
+    return handlers;
+}
+
+constinit const SimulationKernel::CommandHandlerTable SimulationKernel::kCommandHandlers = BuildCommandHandlers();
+
+void SimulationKernel::ExecuteWorldSetTile(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    (void)player_id;
+    const command::WorldSetTilePayload& payload = typed_command.As<command::WorldSetTilePayload>();
+    const world::TileMutation mutation{
+        .tile_x = payload.tile_x,
+        .tile_y = payload.tile_y,
+        .material_id = payload.material_id,
+    };
+    (void)world_service_.ApplyTileMutation(mutation);
+}
+
+void SimulationKernel::ExecuteWorldLoadChunk(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    (void)player_id;
+    const command::WorldChunkPayload& payload = typed_command.As<command::WorldChunkPayload>();
+    const world::ChunkCoord chunk_coord{
+        .x = payload.chunk_x,
+        .y = payload.chunk_y,
+    };
+    world_service_.LoadChunk(chunk_coord);
+    QueueChunkForInitialSync(chunk_coord);
+}
+
+void SimulationKernel::ExecuteWorldUnloadChunk(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    (void)player_id;
+    const command::WorldChunkPayload& payload = typed_command.As<command::WorldChunkPayload>();
+    const world::ChunkCoord chunk_coord{
+        .x = payload.chunk_x,
+        .y = payload.chunk_y,
+    };
+    world_service_.UnloadChunk(chunk_coord);
+    RemoveChunkFromInitialSync(chunk_coord);
+}
+
+void SimulationKernel::ExecutePlayerMotionInput(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    ecs_runtime_.SetPlayerMotionInput(
+        player_id,
+        ToPlayerMotionInput(typed_command.As<command::PlayerMotionInputPayload>()));
+}
+
+void SimulationKernel::ExecuteCollectResource(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    const command::CollectResourcePayload& payload = typed_command.As<command::CollectResourcePayload>();
+    ecs_runtime_.AddResourceToInventory(
+        player_id,
+        payload.resource_id,
+        payload.amount);
+
+    gameplay_ruleset_.CollectResource(
+        payload.resource_id,
+        payload.amount,
+        tick_index_,
+        script_host_);
+}
+
+void SimulationKernel::ExecuteSpawnDrop(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    (void)player_id;
+    const command::SpawnDropPayload& payload = typed_command.As<command::SpawnDropPayload>();
+    ecs_runtime_.QueueSpawnWorldDrop(payload);
+}
+
+void SimulationKernel::ExecutePickupProbe(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    const command::PickupProbePayload& payload = typed_command.As<command::PickupProbePayload>();
+    ecs_runtime_.QueuePickupProbe(player_id, payload);
+}
+
+void SimulationKernel::ExecuteInteraction(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    const command::InteractionPayload& payload = typed_command.As<command::InteractionPayload>();
+    gameplay_ruleset_.ExecuteInteraction(
+        player_id,
+        payload,
+        tick_index_,
+        script_host_);
+}
+
+void SimulationKernel::ExecuteActionPrimary(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    const command::ActionPrimaryPayload& payload = typed_command.As<command::ActionPrimaryPayload>();
+    ecs::ActionPrimaryPlan plan{};
+    std::uint16_t target_material_id = 0;
+    if (!world_service_.TryReadTile(
+            payload.target_tile_x,
+            payload.target_tile_y,
+            target_material_id)) {
         ecs_runtime_.ApplyActionPrimary(
             player_id,
-            command.action_primary,
+            payload,
             plan,
-            target_material_id,
+            0,
             world_service_);
         return;
     }
 
-    if (command.type == TypedPlayerCommandType::GameplayCraftRecipe) {
-        const PlayerMotionSnapshot motion_snapshot = ecs_runtime_.MotionSnapshot(player_id);
-        const int player_tile_x = static_cast<int>(std::floor(motion_snapshot.position_x));
-        const int player_tile_y = static_cast<int>(std::floor(motion_snapshot.position_y));
-        const PlayerInventorySnapshot inventory = ecs_runtime_.InventorySnapshot(player_id);
+    const PlayerMotionSnapshot motion_snapshot = ecs_runtime_.MotionSnapshot(player_id);
+    const int player_tile_x = static_cast<int>(std::floor(motion_snapshot.position_x));
+    const int player_tile_y = static_cast<int>(std::floor(motion_snapshot.position_y));
+    const PlayerInventorySnapshot inventory = ecs_runtime_.InventorySnapshot(player_id);
+
+    const script::simrpc::ActionPrimaryRequest request_data{
+        .player_id = player_id,
+        .player_tile_x = player_tile_x,
+        .player_tile_y = player_tile_y,
+        .target_tile_x = payload.target_tile_x,
+        .target_tile_y = payload.target_tile_y,
+        .hotbar_row = payload.hotbar_row,
+        .hotbar_slot = payload.hotbar_slot,
+        .dirt_count = inventory.dirt_count,
+        .stone_count = inventory.stone_count,
+        .wood_count = inventory.wood_count,
+        .coal_count = inventory.coal_count,
+        .torch_count = inventory.torch_count,
+        .workbench_count = inventory.workbench_count,
+        .wood_sword_count = inventory.wood_sword_count,
+        .has_pickaxe_tool = inventory.has_pickaxe_tool,
+        .has_axe_tool = inventory.has_axe_tool,
+        .target_is_air = target_material_id == world::material::kAir,
+        .harvest_ticks = static_cast<std::uint32_t>(world::material::HarvestTicks(target_material_id)),
+        .harvestable_by_pickaxe = world::material::IsHarvestableByPickaxe(target_material_id),
+        .harvestable_by_axe = world::material::IsHarvestableByAxe(target_material_id),
+        .harvestable_by_sword = world::material::IsHarvestableBySword(target_material_id),
+    };
 
-        constexpr int kWorkbenchReach = 4;
-        const bool workbench_reachable =
-            IsWorkbenchReachable(world_service_, player_tile_x, player_tile_y, kWorkbenchReach);
-
-        const script::simrpc::CraftRecipeRequest request_data{
-            .player_id = player_id,
-            .player_tile_x = player_tile_x,
-            .player_tile_y = player_tile_y,
-            .recipe_index = command.craft_recipe.recipe_index,
-            .workbench_reachable = workbench_reachable,
-            .dirt_count = inventory.dirt_count,
-            .stone_count = inventory.stone_count,
-            .wood_count = inventory.wood_count,
-            .coal_count = inventory.coal_count,
-            .torch_count = inventory.torch_count,
-            .workbench_count = inventory.workbench_count,
-            .wood_sword_count = inventory.wood_sword_count,
-        };
+    script_request_writer_.Clear();
+    script::simrpc::EncodeActionPrimaryRequest(request_data, script_request_writer_);
+    const wire::ByteBuffer& request_bytes = script_request_writer_.Buffer();
+
+    wire::ByteBuffer& response = script_response_buffer_;
+    const core::Status call_status = script_host_.TryCallModuleFunction(
+        "core",
+        "novaria_on_sim_command",
+        wire::ByteSpan(request_bytes.data(), request_bytes.size()),
+        response);
+    if (!call_status) {
+        core::Logger::Error("sim", "Core script call failed: " + call_status.Message());
+        std::abort();
+    }
+
+    script::simrpc::ActionPrimaryResponse response_data{};
+    if (!script::simrpc::TryDecodeActionPrimaryResponse(
+            wire::ByteSpan(response.data(), response.size()),
+            response_data)) {
+        core::Logger::Error("sim", "Invalid core script action_primary response payload.");
+        std::abort();
+    }
 
-        const wire::ByteBuffer request_bytes =
-            script::simrpc::EncodeCraftRecipeRequest(request_data);
-
-        wire::ByteBuffer response;
-        std::string call_error;
-        if (!script_host_.TryCallModuleFunction(
-                "core",
-                "novaria_on_sim_command",
-                wire::ByteSpan(request_bytes.data(), request_bytes.size()),
-                response,
-                call_error)) {
-            core::Logger::Error("sim", "Core script call failed: " + call_error);
+    if (response_data.result == script::simrpc::ActionPrimaryResult::Harvest) {
+        if (response_data.required_ticks == 0) {
+            core::Logger::Error("sim", "Core script returned invalid harvest ticks.");
             std::abort();
         }
-
-        script::simrpc::CraftRecipeResponse response_data{};
-        if (!script::simrpc::TryDecodeCraftRecipeResponse(
-                wire::ByteSpan(response.data(), response.size()),
-                response_data)) {
-            core::Logger::Error("sim", "Invalid core script craft_recipe response payload.");
+        plan.is_harvest = true;
+        plan.required_ticks = static_cast<int>(response_data.required_ticks);
+    } else if (response_data.result == script::simrpc::ActionPrimaryResult::Place) {
+        if (response_data.required_ticks == 0) {
+            core::Logger::Error("sim", "Core script returned invalid place ticks.");
             std::abort();
         }
 
-        if (response_data.result != script::simrpc::CraftRecipeResult::Craft) {
-            return;
-        }
-
-        ecs::CraftRecipePlan plan{};
-        plan.dirt_delta = response_data.dirt_delta;
-        plan.stone_delta = response_data.stone_delta;
-        plan.wood_delta = response_data.wood_delta;
-        plan.coal_delta = response_data.coal_delta;
-        plan.torch_delta = response_data.torch_delta;
-        plan.workbench_delta = response_data.workbench_delta;
-        plan.wood_sword_delta = response_data.wood_sword_delta;
-        plan.mark_workbench_built = response_data.mark_workbench_built;
-        plan.mark_sword_crafted = response_data.mark_sword_crafted;
-        if (response_data.crafted_kind == script::simrpc::CraftedKind::Workbench) {
-            plan.crafted_material_id = world::material::kWorkbench;
-        } else if (response_data.crafted_kind == script::simrpc::CraftedKind::Torch) {
-            plan.crafted_material_id = world::material::kTorch;
-        } else {
-            plan.crafted_material_id = 0;
+        std::uint16_t place_material_id = 0;
+        switch (response_data.place_kind) {
+            case script::simrpc::PlaceKind::Dirt:
+                place_material_id = world::material::kDirt;
+                break;
+            case script::simrpc::PlaceKind::Stone:
+                place_material_id = world::material::kStone;
+                break;
+            case script::simrpc::PlaceKind::Torch:
+                place_material_id = world::material::kTorch;
+                break;
+            case script::simrpc::PlaceKind::Workbench:
+                place_material_id = world::material::kWorkbench;
+                break;
+            default:
+                break;
         }
-
-        std::uint16_t out_crafted_material_id = 0;
-        const bool crafted = ecs_runtime_.TryCraftRecipePlan(player_id, plan, out_crafted_material_id);
-        (void)out_crafted_material_id;
-        if (crafted) {
-            if (plan.mark_workbench_built) {
-                gameplay_ruleset_.MarkWorkbenchBuilt(tick_index_, script_host_);
-            }
-            if (plan.mark_sword_crafted) {
-                gameplay_ruleset_.MarkSwordCrafted(tick_index_, script_host_);
-            }
+        if (place_material_id == 0) {
+            core::Logger::Error("sim", "Core script returned invalid place kind.");
+            std::abort();
         }
-        return;
+
+        plan.is_place = true;
+        plan.place_material_id = place_material_id;
+        plan.required_ticks = static_cast<int>(response_data.required_ticks);
+    } else {
+        plan = {};
+    }
+
+    ecs_runtime_.ApplyActionPrimary(
+        player_id,
+        payload,
+        plan,
+        target_material_id,
+        world_service_);
+}
+
+void SimulationKernel::ExecuteCraftRecipe(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    const command::CraftRecipePayload& payload = typed_command.As<command::CraftRecipePayload>();
+    const PlayerMotionSnapshot motion_snapshot = ecs_runtime_.MotionSnapshot(player_id);
+    const int player_tile_x = static_cast<int>(std::floor(motion_snapshot.position_x));
+    const int player_tile_y = static_cast<int>(std::floor(motion_snapshot.position_y));
+    const PlayerInventorySnapshot inventory = ecs_runtime_.InventorySnapshot(player_id);
+
+    constexpr int kWorkbenchReach = 4;
+    const bool workbench_reachable =
+        IsWorkbenchReachable(world_service_, player_tile_x, player_tile_y, kWorkbenchReach);
+
+    const script::simrpc::CraftRecipeRequest request_data{
+        .player_id = player_id,
+        .player_tile_x = player_tile_x,
+        .player_tile_y = player_tile_y,
+        .recipe_index = payload.recipe_index,
+        .workbench_reachable = workbench_reachable,
+        .dirt_count = inventory.dirt_count,
+        .stone_count = inventory.stone_count,
+        .wood_count = inventory.wood_count,
+        .coal_count = inventory.coal_count,
+        .torch_count = inventory.torch_count,
+        .workbench_count = inventory.workbench_count,
+        .wood_sword_count = inventory.wood_sword_count,
+    };
+
+    script_request_writer_.Clear();
+    script::simrpc::EncodeCraftRecipeRequest(request_data, script_request_writer_);
+    const wire::ByteBuffer& request_bytes = script_request_writer_.Buffer();
+
+    wire::ByteBuffer& response = script_response_buffer_;
+    const core::Status call_status = script_host_.TryCallModuleFunction(
+        "core",
+        "novaria_on_sim_command",
+        wire::ByteSpan(request_bytes.data(), request_bytes.size()),
+        response);
+    if (!call_status) {
+        core::Logger::Error("sim", "Core script call failed: " + call_status.Message());
+        std::abort();
+    }
+
+    script::simrpc::CraftRecipeResponse response_data{};
+    if (!script::simrpc::TryDecodeCraftRecipeResponse(
+            wire::ByteSpan(response.data(), response.size()),
+            response_data)) {
+        core::Logger::Error("sim", "Invalid core script craft_recipe response payload.");
+        std::abort();
     }
 
-    if (command.type == TypedPlayerCommandType::GameplayAttackEnemy) {
-        gameplay_ruleset_.ExecuteAttackEnemy(tick_index_, script_host_);
+    if (response_data.result != script::simrpc::CraftRecipeResult::Craft) {
         return;
     }
 
-    if (command.type == TypedPlayerCommandType::GameplayAttackBoss) {
-        gameplay_ruleset_.ExecuteAttackBoss(tick_index_, script_host_);
+    ecs::CraftRecipePlan plan{};
+    plan.dirt_delta = response_data.dirt_delta;
+    plan.stone_delta = response_data.stone_delta;
+    plan.wood_delta = response_data.wood_delta;
+    plan.coal_delta = response_data.coal_delta;
+    plan.torch_delta = response_data.torch_delta;
+    plan.workbench_delta = response_data.workbench_delta;
+    plan.wood_sword_delta = response_data.wood_sword_delta;
+    plan.mark_workbench_built = response_data.mark_workbench_built;
+    plan.mark_sword_crafted = response_data.mark_sword_crafted;
+    if (response_data.crafted_kind == script::simrpc::CraftedKind::Workbench) {
+        plan.crafted_material_id = world::material::kWorkbench;
+    } else if (response_data.crafted_kind == script::simrpc::CraftedKind::Torch) {
+        plan.crafted_material_id = world::material::kTorch;
+    } else {
+        plan.crafted_material_id = 0;
+    }
+
+    std::uint16_t out_crafted_material_id = 0;
+    const bool crafted = ecs_runtime_.TryCraftRecipePlan(player_id, plan, out_crafted_material_id);
+    (void)out_crafted_material_id;
+    if (crafted) {
+        if (plan.mark_workbench_built) {
+            gameplay_ruleset_.MarkWorkbenchBuilt(tick_index_, script_host_);
+        }
+        if (plan.mark_sword_crafted) {
+            gameplay_ruleset_.MarkSwordCrafted(tick_index_, script_host_);
+        }
     }
 }
 
-void SimulationKernel::ExecuteCombatCommandIfMatched(
-    const TypedPlayerCommand& command,
+void SimulationKernel::ExecuteAttackEnemy(
+    const TypedPlayerCommand& typed_command,
     std::uint32_t player_id) {
-    if (command.type != TypedPlayerCommandType::CombatFireProjectile) {
-        return;
-    }
+    (void)typed_command;
+    (void)player_id;
+    gameplay_ruleset_.ExecuteAttackEnemy(tick_index_, script_host_);
+}
+
+void SimulationKernel::ExecuteAttackBoss(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    (void)typed_command;
+    (void)player_id;
+    gameplay_ruleset_.ExecuteAttackBoss(tick_index_, script_host_);
+}
 
-    ecs_runtime_.QueueSpawnProjectile(player_id, command.fire_projectile);
+void SimulationKernel::ExecuteFireProjectile(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    ecs_runtime_.QueueSpawnProjectile(player_id, typed_command.As<command::FireProjectilePayload>());
+}
+
+void SimulationKernel::ExecuteReplicationEntityAck(
+    const TypedPlayerCommand& typed_command,
+    std::uint32_t player_id) {
+    entity_replication_sender_.Acknowledge(
+        player_id,
+        typed_command.As<command::ReplicationEntityAckPayload>().acked_tick);
 }
 
 void SimulationKernel::Update(double fixed_delta_seconds) {
@@ -656,6 +1344,7 @@ void SimulationKernel::Update(double fixed_delta_seconds) {
         return;
     }
 
+    tick_profiler_.BeginTick();
     if (net_service_.SessionState() == net::NetSessionState::Disconnected &&
         tick_index_ >= next_auto_reconnect_tick_) {
         net_service_.RequestConnect();
@@ -667,34 +1356,73 @@ void SimulationKernel::Update(double fixed_delta_seconds) {
         .fixed_delta_seconds = fixed_delta_seconds,
     };
     const bool authority_mode = authority_mode_ == SimulationAuthorityMode::Authority;
+    last_fixed_delta_seconds_ = fixed_delta_seconds;
+    const bool recording_input = input_recorder_.Active();
+    if (recording_input && fixed_delta_seconds != input_recorded_fixed_delta_seconds_) {
+        input_recorder_.RecordFixedDelta(tick_index_, fixed_delta_seconds);
+        input_recorded_fixed_delta_seconds_ = fixed_delta_seconds;
+    }
+
+    bool has_predicted_input = false;
+    PlayerMotionInput predicted_input{};
+    std::uint32_t predicted_input_sequence = 0;
+    for (net::PlayerCommand& command : pending_local_commands_) {
+        command::PlayerMotionInputPayload motion_payload{};
+        const bool is_predicted_motion =
+            !authority_mode &&
+            command.player_id == local_player_id_ &&
+            command.command_id == command::kPlayerMotionInput &&
+            command::TryDecodePlayerMotionInputPayload(command.payload.View(), motion_payload);
+        if (recording_input) {
+            input_recorder_.RecordCommand(tick_index_, command, true);
+        }
+        const std::uint32_t sequence = net_service_.SubmitLocalCommand(std::move(command));
+        if (!is_predicted_motion) {
+            continue;
+        }
 
-    for (const auto& command : pending_local_commands_) {
-        net_service_.SubmitLocalCommand(command);
+        has_predicted_input = true;
+        predicted_input = ToPlayerMotionInput(motion_payload);
+        predicted_input_sequence = sequence;
     }
     pending_local_commands_.clear();
+    tick_profiler_.EndPhase(TickPhase::LocalCommandSubmit);
+
+    CompleteChunkSnapshotEncode(true);
+    tick_profiler_.EndPhase(TickPhase::SnapshotPublish);
 
     net_service_.Tick(tick_context);
-    const std::vector<net::PlayerCommand> remote_commands = net_service_.ConsumeRemoteCommands();
+    tick_profiler_.EndPhase(TickPhase::NetTick);
+    net_service_.ConsumeRemoteCommands(remote_command_scratch_);
+    if (recording_input) {
+        for (const net::PlayerCommand& command : remote_command_scratch_) {
+            input_recorder_.RecordCommand(tick_index_, command, false);
+        }
+    }
     if (authority_mode) {
-        for (const net::PlayerCommand& command : remote_commands) {
-            TypedPlayerCommand typed_command{};
-            if (!TryDecodePlayerCommand(command, typed_command)) {
-                continue;
+        for (net::PlayerCommand& command : remote_command_scratch_) {
+            if (command_rate_limiter_.Admit(command, tick_index_, fixed_delta_seconds)) {
+                remote_input_jitter_buffer_.Push(std::move(command), tick_index_);
+            }
+        }
+        remote_input_jitter_buffer_.Release(tick_index_, released_command_scratch_);
+        for (const net::PlayerCommand& command : released_command_scratch_) {
+            if (command.sequence != 0) {
+                last_applied_command_sequences_[command.player_id] = command.sequence;
             }
 
-            ExecuteControlCommandIfMatched(typed_command, command.player_id);
-            ExecuteWorldCommandIfMatched(typed_command);
-            ExecuteGameplayCommandIfMatched(typed_command, command.player_id);
-            ExecuteCombatCommandIfMatched(typed_command, command.player_id);
+            (void)DispatchPlayerCommand(command, kCommandHandlers, *this, typed_command_scratch_);
         }
     }
+    tick_profiler_.EndPhase(TickPhase::CommandDispatch);
 
-    const net::NetDiagnosticsSnapshot net_diagnostics = net_service_.DiagnosticsSnapshot();
-    const net::NetSessionState current_session_state = net_diagnostics.session_state;
+    const net::NetSessionState current_session_state = net_service_.SessionState();
     if (current_session_state != last_observed_net_session_state_) {
-        QueueNetSessionChangedEvent(
-            current_session_state,
-            net_diagnostics.last_session_transition_reason);
+        const std::string transition_reason = net_service_.DiagnosticsSnapshot().last_session_transition_reason;
+        if (recording_input) {
+            input_recorder_.RecordSessionState(tick_index_, current_session_state, transition_reason);
+        }
+        QueueNetSessionChangedEvent(current_session_state, transition_reason);
         if (authority_mode && current_session_state == net::NetSessionState::Connected) {
             QueueLoadedChunksForInitialSync();
         }
@@ -702,6 +1430,7 @@ void SimulationKernel::Update(double fixed_delta_seconds) {
         if (current_session_state == net::NetSessionState::Disconnected) {
             next_auto_reconnect_tick_ = tick_index_ + kAutoReconnectRetryIntervalTicks;
         }
+        ResetReplicationState();
 
         last_observed_net_session_state_ = current_session_state;
     }
@@ -709,23 +1438,36 @@ void SimulationKernel::Update(double fixed_delta_seconds) {
 
     const bool net_connected = current_session_state == net::NetSessionState::Connected;
     if (net_connected && !authority_mode) {
-        for (const auto& encoded_payload : net_service_.ConsumeRemoteChunkPayloads()) {
-            std::string apply_error;
-            (void)ApplyRemoteChunkPayload(
-                wire::ByteSpan(encoded_payload.data(), encoded_payload.size()),
-                apply_error);
+        net_service_.ConsumeRemoteChunkPayloads(remote_chunk_payload_scratch_);
+        for (const auto& encoded_payload : remote_chunk_payload_scratch_) {
+            (void)ApplyRemoteChunkPayload(wire::ByteSpan(encoded_payload.data(), encoded_payload.size()));
         }
+        ApplyRemoteEntityStates(fixed_delta_seconds);
     }
+    if (has_predicted_input) {
+        ecs_runtime_.SetPlayerMotionInput(local_player_id_, predicted_input);
+    }
+    tick_profiler_.EndPhase(TickPhase::ReplicaApply);
 
     world_service_.Tick(tick_context);
+    tick_profiler_.EndPhase(TickPhase::WorldTick);
     ecs_runtime_.Tick(tick_context, world_service_);
+    if (has_predicted_input && predicted_input_sequence != 0) {
+        local_motion_predictor_.RecordInput(
+            predicted_input_sequence,
+            predicted_input,
+            ecs_runtime_.MotionState(local_player_id_));
+    }
+    tick_profiler_.EndPhase(TickPhase::EcsTick);
+    ecs_runtime_.ConsumeCombatEvents(combat_event_scratch_);
     gameplay_ruleset_.ProcessCombatEvents(
-        ecs_runtime_.ConsumeCombatEvents(),
+        combat_event_scratch_,
         tick_index_,
         script_host_);
     const std::size_t pickup_insert_offset = pending_pickup_events_.size();
+    ecs_runtime_.ConsumeGameplayEvents(gameplay_event_scratch_);
     gameplay_ruleset_.ProcessGameplayEvents(
-        ecs_runtime_.ConsumeGameplayEvents(),
+        gameplay_event_scratch_,
         tick_index_,
         script_host_,
         pending_pickup_events_);
@@ -739,11 +1481,13 @@ void SimulationKernel::Update(double fixed_delta_seconds) {
                 script_host_);
         }
     }
+    tick_profiler_.EndPhase(TickPhase::RulesetEvents);
     script_host_.Tick(tick_context);
+    tick_profiler_.EndPhase(TickPhase::ScriptTick);
 
-    std::vector<wire::ByteBuffer> encoded_dirty_chunks;
     if (net_connected && authority_mode) {
-        std::vector<world::ChunkCoord> chunks_to_publish = world_service_.ConsumeDirtyChunks();
+        std::vector<world::ChunkCoord>& chunks_to_publish = chunk_coord_scratch_;
+        world_service_.ConsumeDirtyChunks(chunks_to_publish);
         chunks_to_publish.insert(
             chunks_to_publish.end(),
             pending_initial_sync_chunks_.begin(),
@@ -767,29 +1511,37 @@ void SimulationKernel::Update(double fixed_delta_seconds) {
                 }),
             chunks_to_publish.end());
 
-        encoded_dirty_chunks.reserve(chunks_to_publish.size());
-        for (const world::ChunkCoord& chunk_coord : chunks_to_publish) {
-            world::ChunkSnapshot chunk_snapshot{};
-            std::string snapshot_error;
-            if (!world_service_.BuildChunkSnapshot(chunk_coord, chunk_snapshot, snapshot_error)) {
-                continue;
-            }
+        chunk_snapshot_buffer_pool_.Recycle();
+        if (snapshot_encode_workers_.WorkerCount() > 0) {
+            DispatchChunkSnapshotEncode(chunks_to_publish);
+        } else {
+            for (const world::ChunkCoord& chunk_coord : chunks_to_publish) {
+                if (!world_service_.BuildChunkSnapshot(chunk_coord, chunk_snapshot_scratch_)) {
+                    continue;
+                }
 
-            wire::ByteBuffer encoded_chunk;
-            if (!world::WorldSnapshotCodec::EncodeChunkSnapshot(
-                    chunk_snapshot,
-                    encoded_chunk,
-                    snapshot_error)) {
-                continue;
+                wire::ByteWriter writer = chunk_snapshot_buffer_pool_.AcquireWriter();
+                if (!world::WorldSnapshotCodec::EncodeChunkSnapshot(chunk_snapshot_scratch_, writer)) {
+                    chunk_snapshot_buffer_pool_.Release(writer);
+                    continue;
+                }
+
+                chunk_snapshot_buffer_pool_.Commit(writer);
             }
 
-            encoded_dirty_chunks.push_back(std::move(encoded_chunk));
+            net_service_.PublishWorldSnapshot(tick_index_, chunk_snapshot_buffer_pool_.Buffers());
         }
-
-        net_service_.PublishWorldSnapshot(tick_index_, encoded_dirty_chunks);
+        PublishEntityStates();
     }
+    tick_profiler_.EndPhase(TickPhase::SnapshotPublish);
+    tick_profiler_.EndTick();
 
     ++tick_index_;
+    if (recording_input &&
+        input_checkpoint_interval_ticks_ > 0 &&
+        tick_index_ % input_checkpoint_interval_ticks_ == 0) {
+        input_recorder_.RecordCheckpoint(tick_index_, ComputeStateHash());
+    }
 }
 
 }  // namespace novaria::sim
@@ -0,0 +1,137 @@
+#include "sim/tick_profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace novaria::sim {
+namespace {
+
+std::uint32_t ToMicroseconds(std::chrono::steady_clock::duration duration) {
+    const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+    if (microseconds <= 0) {
+        return 0;
+    }
+    return static_cast<std::uint32_t>(
+        std::min<long long>(microseconds, std::numeric_limits<std::uint32_t>::max()));
+}
+
+double ToMilliseconds(std::uint32_t microseconds) {
+    return static_cast<double>(microseconds) / 1000.0;
+}
+
+std::uint32_t NearestRank(
+    const std::array<std::uint32_t, TickProfiler::kWindowSize>& sorted,
+    std::size_t count,
+    double quantile) {
+    const std::size_t rank = static_cast<std::size_t>(std::ceil(quantile * static_cast<double>(count)));
+    return sorted[std::clamp<std::size_t>(rank, 1, count) - 1];
+}
+
+TickPhaseTiming SummarizeWindow(
+    const std::array<std::uint32_t, TickProfiler::kWindowSize>& window,
+    std::size_t sample_count,
+    std::size_t last_index) {
+    TickPhaseTiming timing{};
+    if (sample_count == 0) {
+        return timing;
+    }
+
+    std::array<std::uint32_t, TickProfiler::kWindowSize> sorted = window;
+    std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(sample_count));
+    timing.last_ms = ToMilliseconds(window[last_index]);
+    timing.p50_ms = ToMilliseconds(NearestRank(sorted, sample_count, 0.50));
+    timing.p99_ms = ToMilliseconds(NearestRank(sorted, sample_count, 0.99));
+    timing.max_ms = ToMilliseconds(sorted[sample_count - 1]);
+    return timing;
+}
+
+}  // namespace
+
+const char* TickPhaseName(TickPhase phase) {
+    switch (phase) {
+        case TickPhase::LocalCommandSubmit:
+            return "local_submit";
+        case TickPhase::NetTick:
+            return "net_tick";
+        case TickPhase::CommandDispatch:
+            return "command_dispatch";
+        case TickPhase::ReplicaApply:
+            return "replica_apply";
+        case TickPhase::WorldTick:
+            return "world_tick";
+        case TickPhase::EcsTick:
+            return "ecs_tick";
+        case TickPhase::RulesetEvents:
+            return "ruleset_events";
+        case TickPhase::ScriptTick:
+            return "script_tick";
+        case TickPhase::SnapshotPublish:
+            return "snapshot_publish";
+    }
+    return "unknown";
+}
+
+void TickProfiler::SetSettings(const TickProfilerSettings& settings) {
+    settings_ = TickProfilerSettings{
+        .enabled = settings.enabled,
+        .tick_budget_ms = settings.tick_budget_ms > 0.0 ? settings.tick_budget_ms : TickProfilerSettings{}.tick_budget_ms,
+    };
+}
+
+const TickProfilerSettings& TickProfiler::Settings() const {
+    return settings_;
+}
+
+void TickProfiler::Reset() {
+    current_phase_us_.fill(0);
+    dominant_overrun_counts_.fill(0);
+    window_cursor_ = 0;
+    window_sample_count_ = 0;
+    profiled_tick_count_ = 0;
+    overrun_count_ = 0;
+}
+
+TickProfilerDiagnostics TickProfiler::DiagnosticsSnapshot() const {
+    TickProfilerDiagnostics diagnostics{
+        .enabled = settings_.enabled,
+        .tick_budget_ms = settings_.tick_budget_ms,
+        .profiled_tick_count = profiled_tick_count_,
+        .overrun_count = overrun_count_,
+        .window_sample_count = window_sample_count_,
+    };
+    const std::size_t last_index = (window_cursor_ + kWindowSize - 1) % kWindowSize;
+    diagnostics.total = SummarizeWindow(total_window_, window_sample_count_, last_index);
+    for (std::size_t phase = 0; phase < kTickPhaseCount; ++phase) {
+        diagnostics.phases[phase] = SummarizeWindow(phase_windows_[phase], window_sample_count_, last_index);
+        diagnostics.phases[phase].dominant_overrun_count = dominant_overrun_counts_[phase];
+    }
+    return diagnostics;
+}
+
+void TickProfiler::RecordPhase(TickPhase phase) {
+    const Clock::time_point now = Clock::now();
+    current_phase_us_[static_cast<std::size_t>(phase)] += ToMicroseconds(now - phase_start_);
+    phase_start_ = now;
+}
+
+void TickProfiler::RecordTick() {
+    const std::uint32_t total_us = ToMicroseconds(Clock::now() - tick_start_);
+    for (std::size_t phase = 0; phase < kTickPhaseCount; ++phase) {
+        phase_windows_[phase][window_cursor_] = current_phase_us_[phase];
+    }
+    total_window_[window_cursor_] = total_us;
+
+    ++profiled_tick_count_;
+    if (ToMilliseconds(total_us) > settings_.tick_budget_ms) {
+        ++overrun_count_;
+        const auto dominant_phase = std::max_element(current_phase_us_.begin(), current_phase_us_.end());
+        ++dominant_overrun_counts_[static_cast<std::size_t>(dominant_phase - current_phase_us_.begin())];
+    }
+
+    current_phase_us_.fill(0);
+    window_cursor_ = (window_cursor_ + 1) % kWindowSize;
+    window_sample_count_ = std::min(window_sample_count_ + 1, kWindowSize);
+}
+
+}  // namespace novaria::sim
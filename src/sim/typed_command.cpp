@@ -1,166 +1,113 @@
 #include "sim/typed_command.h"
 
 namespace novaria::sim {
+namespace {
 
-bool TryDecodePlayerCommand(
-    const net::PlayerCommand& source_command,
-    TypedPlayerCommand& out_typed_command) {
-    out_typed_command = {};
-
-    if (source_command.command_id == command::kJump) {
-        if (!source_command.payload.empty()) {
-            return false;
-        }
-        out_typed_command.type = TypedPlayerCommandType::Jump;
-        return true;
-    }
-
-    if (source_command.command_id == command::kAttack) {
-        if (!source_command.payload.empty()) {
-            return false;
-        }
-        out_typed_command.type = TypedPlayerCommandType::Attack;
-        return true;
-    }
-
-    if (source_command.command_id == command::kPlayerMotionInput) {
-        if (!command::TryDecodePlayerMotionInputPayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.player_motion_input)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::PlayerMotionInput;
-        return true;
-    }
-
-    if (source_command.command_id == command::kWorldSetTile) {
-        if (!command::TryDecodeWorldSetTilePayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.world_set_tile)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::WorldSetTile;
-        return true;
-    }
-
-    if (source_command.command_id == command::kWorldLoadChunk) {
-        if (!command::TryDecodeWorldChunkPayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.world_chunk)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::WorldLoadChunk;
-        return true;
-    }
-
-    if (source_command.command_id == command::kWorldUnloadChunk) {
-        if (!command::TryDecodeWorldChunkPayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.world_chunk)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::WorldUnloadChunk;
-        return true;
-    }
-
-    if (source_command.command_id == command::kGameplayCollectResource) {
-        if (!command::TryDecodeCollectResourcePayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.collect_resource)) {
-            return false;
-        }
+using PayloadDecoder = bool (*)(wire::ByteSpan payload, TypedPlayerCommandPayload& out_payload);
 
-        out_typed_command.type = TypedPlayerCommandType::GameplayCollectResource;
-        return true;
-    }
+struct CommandDecoderEntry final {
+    TypedPlayerCommandType type = TypedPlayerCommandType::Unknown;
+    PayloadDecoder decode = nullptr;
+};
 
-    if (source_command.command_id == command::kGameplaySpawnDrop) {
-        if (!command::TryDecodeSpawnDropPayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.spawn_drop)) {
-            return false;
-        }
+constexpr std::uint32_t kMaxDecodableCommandId = command::kReplicationEntityAck;
 
-        out_typed_command.type = TypedPlayerCommandType::GameplaySpawnDrop;
-        return true;
+bool DecodeEmptyPayload(wire::ByteSpan payload, TypedPlayerCommandPayload& out_payload) {
+    if (!payload.empty()) {
+        return false;
     }
+    out_payload.emplace<std::monostate>();
+    return true;
+}
 
-    if (source_command.command_id == command::kGameplayPickupProbe) {
-        if (!command::TryDecodePickupProbePayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.pickup_probe)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::GameplayPickupProbe;
-        return true;
-    }
-
-    if (source_command.command_id == command::kGameplayInteraction) {
-        if (!command::TryDecodeInteractionPayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.interaction)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::GameplayInteraction;
-        return true;
+template <typename Payload, bool (*Decode)(wire::ByteSpan, Payload&)>
+bool DecodeTypedPayload(wire::ByteSpan payload, TypedPlayerCommandPayload& out_payload) {
+    Payload decoded{};
+    if (!Decode(payload, decoded)) {
+        return false;
     }
+    out_payload.emplace<Payload>(decoded);
+    return true;
+}
 
-    if (source_command.command_id == command::kGameplayActionPrimary) {
-        if (!command::TryDecodeActionPrimaryPayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.action_primary)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::GameplayActionPrimary;
-        return true;
-    }
+constexpr std::array<CommandDecoderEntry, kMaxDecodableCommandId + 1> BuildCommandDecoderTable() {
+    std::array<CommandDecoderEntry, kMaxDecodableCommandId + 1> table{};
+    const auto add = [&table](std::uint32_t command_id, TypedPlayerCommandType type, PayloadDecoder decode) {
+        table[command_id] = CommandDecoderEntry{.type = type, .decode = decode};
+    };
+
+    add(command::kJump, TypedPlayerCommandType::Jump, &DecodeEmptyPayload);
+    add(command::kAttack, TypedPlayerCommandType::Attack, &DecodeEmptyPayload);
+    add(command::kPlayerMotionInput,
+        TypedPlayerCommandType::PlayerMotionInput,
+        &DecodeTypedPayload<command::PlayerMotionInputPayload, &command::TryDecodePlayerMotionInputPayload>);
+    add(command::kWorldSetTile,
+        TypedPlayerCommandType::WorldSetTile,
+        &DecodeTypedPayload<command::WorldSetTilePayload, &command::TryDecodeWorldSetTilePayload>);
+    add(command::kWorldLoadChunk,
+        TypedPlayerCommandType::WorldLoadChunk,
+        &DecodeTypedPayload<command::WorldChunkPayload, &command::TryDecodeWorldChunkPayload>);
+    add(command::kWorldUnloadChunk,
+        TypedPlayerCommandType::WorldUnloadChunk,
+        &DecodeTypedPayload<command::WorldChunkPayload, &command::TryDecodeWorldChunkPayload>);
+    add(command::kGameplayCollectResource,
+        TypedPlayerCommandType::GameplayCollectResource,
+        &DecodeTypedPayload<command::CollectResourcePayload, &command::TryDecodeCollectResourcePayload>);
+    add(command::kGameplaySpawnDrop,
+        TypedPlayerCommandType::GameplaySpawnDrop,
+        &DecodeTypedPayload<command::SpawnDropPayload, &command::TryDecodeSpawnDropPayload>);
+    add(command::kGameplayPickupProbe,
+        TypedPlayerCommandType::GameplayPickupProbe,
+        &DecodeTypedPayload<command::PickupProbePayload, &command::TryDecodePickupProbePayload>);
+    add(command::kGameplayInteraction,
+        TypedPlayerCommandType::GameplayInteraction,
+        &DecodeTypedPayload<command::InteractionPayload, &command::TryDecodeInteractionPayload>);
+    add(command::kGameplayActionPrimary,
+        TypedPlayerCommandType::GameplayActionPrimary,
+        &DecodeTypedPayload<command::ActionPrimaryPayload, &command::TryDecodeActionPrimaryPayload>);
+    add(command::kGameplayCraftRecipe,
+        TypedPlayerCommandType::GameplayCraftRecipe,
+        &DecodeTypedPayload<command::CraftRecipePayload, &command::TryDecodeCraftRecipePayload>);
+    add(command::kGameplayAttackEnemy, TypedPlayerCommandType::GameplayAttackEnemy, &DecodeEmptyPayload);
+    add(command::kGameplayAttackBoss, TypedPlayerCommandType::GameplayAttackBoss, &DecodeEmptyPayload);
+    add(command::kCombatFireProjectile,
+        TypedPlayerCommandType::CombatFireProjectile,
+        &DecodeTypedPayload<command::FireProjectilePayload, &command::TryDecodeFireProjectilePayload>);
+    add(command::kReplicationEntityAck,
+        TypedPlayerCommandType::ReplicationEntityAck,
+        &DecodeTypedPayload<command::ReplicationEntityAckPayload, &command::TryDecodeReplicationEntityAckPayload>);
+    return table;
+}
 
-    if (source_command.command_id == command::kGameplayCraftRecipe) {
-        if (!command::TryDecodeCraftRecipePayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.craft_recipe)) {
-            return false;
-        }
+constexpr std::array<CommandDecoderEntry, kMaxDecodableCommandId + 1> kCommandDecoders = BuildCommandDecoderTable();
 
-        out_typed_command.type = TypedPlayerCommandType::GameplayCraftRecipe;
-        return true;
-    }
+}  // namespace
 
-    if (source_command.command_id == command::kGameplayAttackEnemy) {
-        if (!source_command.payload.empty()) {
-            return false;
-        }
-        out_typed_command.type = TypedPlayerCommandType::GameplayAttackEnemy;
-        return true;
+TypedPlayerCommandType TypedPlayerCommandTypeForId(std::uint32_t command_id) {
+    if (command_id > kMaxDecodableCommandId) {
+        return TypedPlayerCommandType::Unknown;
     }
+    return kCommandDecoders[command_id].type;
+}
 
-    if (source_command.command_id == command::kGameplayAttackBoss) {
-        if (!source_command.payload.empty()) {
-            return false;
-        }
-        out_typed_command.type = TypedPlayerCommandType::GameplayAttackBoss;
-        return true;
+bool TryDecodePlayerCommand(
+    const net::PlayerCommand& source_command,
+    TypedPlayerCommand& out_typed_command) {
+    out_typed_command.type = TypedPlayerCommandType::Unknown;
+    if (source_command.command_id > kMaxDecodableCommandId) {
+        return false;
     }
 
-    if (source_command.command_id == command::kCombatFireProjectile) {
-        if (!command::TryDecodeFireProjectilePayload(
-                wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
-                out_typed_command.fire_projectile)) {
-            return false;
-        }
-
-        out_typed_command.type = TypedPlayerCommandType::CombatFireProjectile;
-        return true;
+    const CommandDecoderEntry& entry = kCommandDecoders[source_command.command_id];
+    if (entry.decode == nullptr ||
+        !entry.decode(
+            wire::ByteSpan(source_command.payload.data(), source_command.payload.size()),
+            out_typed_command.payload)) {
+        return false;
     }
 
-    return false;
+    out_typed_command.type = entry.type;
+    return true;
 }
 
 }  // namespace novaria::sim
@@ -0,0 +1,43 @@
+#include "wire/byte_buffer_pool.h"
+
+#include <utility>
+
+namespace novaria::wire {
+
+void ByteBufferPool::Recycle() {
+    for (ByteBuffer& buffer : buffers_) {
+        buffer.clear();
+        free_buffers_.push_back(std::move(buffer));
+    }
+    buffers_.clear();
+}
+
+ByteWriter ByteBufferPool::AcquireWriter() {
+    if (free_buffers_.empty()) {
+        return ByteWriter();
+    }
+
+    ByteWriter writer(std::move(free_buffers_.back()));
+    free_buffers_.pop_back();
+    return writer;
+}
+
+void ByteBufferPool::Commit(ByteWriter& writer) {
+    buffers_.push_back(writer.TakeBuffer());
+}
+
+void ByteBufferPool::Release(ByteWriter& writer) {
+    ByteBuffer buffer = writer.TakeBuffer();
+    buffer.clear();
+    free_buffers_.push_back(std::move(buffer));
+}
+
+const std::vector<ByteBuffer>& ByteBufferPool::Buffers() const {
+    return buffers_;
+}
+
+std::size_t ByteBufferPool::FreeBufferCount() const {
+    return free_buffers_.size();
+}
+
+}  // namespace novaria::wire
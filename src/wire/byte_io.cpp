@@ -1,6 +1,9 @@
 #include "wire/byte_io.h"
 
+#include <bit>
+#include <cstring>
 #include <limits>
+#include <utility>
 
 namespace novaria::wire {
 namespace {
@@ -14,8 +17,46 @@ constexpr std::int64_t ZigZagDecode(std::uint64_t value) {
     return static_cast<std::int64_t>((value >> 1U) ^ (~(value & 1U) + 1U));
 }
 
+template <typename T>
+void AppendLittleEndianArray(ByteBuffer& buffer, std::span<const T> values) {
+    const std::size_t offset = buffer.size();
+    buffer.resize(offset + values.size_bytes());
+    Byte* out = buffer.data() + offset;
+    if constexpr (std::endian::native == std::endian::little) {
+        if (!values.empty()) {
+            std::memcpy(out, values.data(), values.size_bytes());
+        }
+    } else {
+        for (const T value : values) {
+            for (std::size_t byte_index = 0; byte_index < sizeof(T); ++byte_index) {
+                *out++ = static_cast<Byte>((value >> (byte_index * 8)) & 0xFF);
+            }
+        }
+    }
+}
+
+template <typename T>
+void CopyLittleEndianArray(const Byte* bytes, std::span<T> out_values) {
+    if constexpr (std::endian::native == std::endian::little) {
+        if (!out_values.empty()) {
+            std::memcpy(out_values.data(), bytes, out_values.size_bytes());
+        }
+    } else {
+        for (T& value : out_values) {
+            value = 0;
+            for (std::size_t byte_index = 0; byte_index < sizeof(T); ++byte_index) {
+                value |= static_cast<T>(static_cast<T>(*bytes++) << (byte_index * 8));
+            }
+        }
+    }
+}
+
 }  // namespace
 
+ByteWriter::ByteWriter(ByteBuffer&& storage) : buffer_(std::move(storage)) {
+    buffer_.clear();
+}
+
 void ByteWriter::Clear() {
     buffer_.clear();
 }
@@ -44,6 +85,21 @@ void ByteWriter::WriteVarInt(std::int64_t value) {
     WriteVarUInt(ZigZagEncode(value));
 }
 
+void ByteWriter::WriteF32(float value) {
+    const std::uint32_t bits = std::bit_cast<std::uint32_t>(value);
+    for (int shift = 0; shift < 32; shift += 8) {
+        buffer_.push_back(static_cast<Byte>((bits >> shift) & 0xFF));
+    }
+}
+
+void ByteWriter::WriteU16Array(std::span<const std::uint16_t> values) {
+    AppendLittleEndianArray(buffer_, values);
+}
+
+void ByteWriter::WriteU32Array(std::span<const std::uint32_t> values) {
+    AppendLittleEndianArray(buffer_, values);
+}
+
 void ByteWriter::WriteRawBytes(ByteSpan bytes) {
     buffer_.insert(buffer_.end(), bytes.begin(), bytes.end());
 }
@@ -84,6 +140,34 @@ bool ByteReader::ReadU8(Byte& out_value) {
 }
 
 bool ByteReader::ReadVarUInt(std::uint64_t& out_value) {
+    if (Remaining() < kMaxVarUIntSize) {
+        return ReadVarUIntSlow(out_value);
+    }
+
+    const Byte* bytes = bytes_.data() + offset_;
+    std::uint64_t value = 0;
+    for (std::size_t index = 0; index + 1 < kMaxVarUIntSize; ++index) {
+        const Byte byte = bytes[index];
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << (index * 7);
+        if (byte < 0x80) {
+            offset_ += index + 1;
+            out_value = value;
+            return true;
+        }
+    }
+
+    const Byte last_byte = bytes[kMaxVarUIntSize - 1];
+    offset_ += kMaxVarUIntSize;
+    out_value = value;
+    if (last_byte > 1) {
+        return false;
+    }
+
+    out_value |= static_cast<std::uint64_t>(last_byte) << 63;
+    return true;
+}
+
+bool ByteReader::ReadVarUIntSlow(std::uint64_t& out_value) {
     out_value = 0;
 
     std::uint32_t shift = 0;
@@ -119,6 +203,60 @@ bool ByteReader::ReadVarInt(std::int64_t& out_value) {
     return true;
 }
 
+bool ByteReader::ReadVarUInts(std::span<std::uint64_t> out_values) {
+    for (std::uint64_t& value : out_values) {
+        if (!ReadVarUInt(value)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ByteReader::ReadVarInts(std::span<std::int64_t> out_values) {
+    for (std::int64_t& value : out_values) {
+        std::uint64_t encoded = 0;
+        if (!ReadVarUInt(encoded)) {
+            return false;
+        }
+        value = ZigZagDecode(encoded);
+    }
+    return true;
+}
+
+bool ByteReader::ReadF32(float& out_value) {
+    if (Remaining() < 4) {
+        return false;
+    }
+
+    std::uint32_t bits = 0;
+    for (int shift = 0; shift < 32; shift += 8) {
+        bits |= static_cast<std::uint32_t>(bytes_[offset_++]) << shift;
+    }
+
+    out_value = std::bit_cast<float>(bits);
+    return true;
+}
+
+bool ByteReader::ReadU16Array(std::span<std::uint16_t> out_values) {
+    if (out_values.size() > Remaining() / sizeof(std::uint16_t)) {
+        return false;
+    }
+
+    CopyLittleEndianArray(bytes_.data() + offset_, out_values);
+    offset_ += out_values.size_bytes();
+    return true;
+}
+
+bool ByteReader::ReadU32Array(std::span<std::uint32_t> out_values) {
+    if (out_values.size() > Remaining() / sizeof(std::uint32_t)) {
+        return false;
+    }
+
+    CopyLittleEndianArray(bytes_.data() + offset_, out_values);
+    offset_ += out_values.size_bytes();
+    return true;
+}
+
 bool ByteReader::ReadRawBytes(std::size_t length, ByteSpan& out_bytes) {
     if (length > Remaining()) {
         return false;
@@ -12,29 +12,28 @@ const char* MessageKindName(MessageKind kind) {
             return "chunk_snapshot";
         case MessageKind::ChunkSnapshotBatch:
             return "chunk_snapshot_batch";
+        case MessageKind::EntityStateBatch:
+            return "entity_state_batch";
     }
 
     return "unknown";
 }
 
-bool TryDecodeEnvelopeV1(ByteSpan datagram, EnvelopeView& out_envelope, std::string& out_error) {
+core::Status DecodeEnvelopeV1(ByteSpan datagram, EnvelopeView& out_envelope) {
     out_envelope = {};
 
     ByteReader reader(datagram);
     Byte wire_version = 0;
     if (!reader.ReadU8(wire_version)) {
-        out_error = "datagram missing wire_version";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "datagram missing wire_version");
     }
     if (wire_version != kWireVersionV1) {
-        out_error = "unsupported wire_version";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "unsupported wire_version");
     }
 
     Byte kind_u8 = 0;
     if (!reader.ReadU8(kind_u8)) {
-        out_error = "datagram missing kind";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "datagram missing kind");
     }
 
     const MessageKind kind = static_cast<MessageKind>(kind_u8);
@@ -43,20 +42,20 @@ bool TryDecodeEnvelopeV1(ByteSpan datagram, EnvelopeView& out_envelope, std::str
         case MessageKind::Command:
         case MessageKind::ChunkSnapshot:
         case MessageKind::ChunkSnapshotBatch:
+        case MessageKind::EntityStateBatch:
             break;
         default:
-            out_error = "unknown kind";
-            return false;
+            return core::Status::Error(core::StatusCode::MalformedPayload, "unknown kind");
     }
 
     std::uint64_t payload_len = 0;
     if (!reader.ReadVarUInt(payload_len)) {
-        out_error = "datagram missing payload_len";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "datagram missing payload_len");
     }
     if (payload_len != reader.Remaining()) {
-        out_error = "payload_len does not match datagram size";
-        return false;
+        return core::Status::Error(
+            core::StatusCode::MalformedPayload,
+            "payload_len does not match datagram size");
     }
 
     const std::size_t payload_len_size_t = static_cast<std::size_t>(payload_len);
@@ -64,18 +63,33 @@ bool TryDecodeEnvelopeV1(ByteSpan datagram, EnvelopeView& out_envelope, std::str
 
     out_envelope.kind = kind;
     out_envelope.payload = payload;
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
+}
+
+ByteSpan EnvelopeHeaderV1::Span() const {
+    return ByteSpan(bytes.data(), size);
+}
+
+void EncodeEnvelopeHeaderV1(MessageKind kind, std::size_t payload_size, EnvelopeHeaderV1& out_header) {
+    out_header.size = 0;
+    out_header.bytes[out_header.size++] = kWireVersionV1;
+    out_header.bytes[out_header.size++] = static_cast<Byte>(kind);
+    std::uint64_t remaining = payload_size;
+    while (remaining >= 0x80) {
+        out_header.bytes[out_header.size++] = static_cast<Byte>((remaining & 0x7F) | 0x80);
+        remaining >>= 7;
+    }
+    out_header.bytes[out_header.size++] = static_cast<Byte>(remaining);
 }
 
 void EncodeEnvelopeV1(MessageKind kind, ByteSpan payload, ByteBuffer& out_datagram) {
-    ByteWriter writer;
-    writer.WriteU8(kWireVersionV1);
-    writer.WriteU8(static_cast<Byte>(kind));
-    writer.WriteVarUInt(payload.size());
-    writer.WriteRawBytes(payload);
+    EnvelopeHeaderV1 header{};
+    EncodeEnvelopeHeaderV1(kind, payload.size(), header);
 
-    out_datagram = writer.TakeBuffer();
+    out_datagram.clear();
+    out_datagram.reserve(header.size + payload.size());
+    out_datagram.insert(out_datagram.end(), header.bytes.begin(), header.bytes.begin() + header.size);
+    out_datagram.insert(out_datagram.end(), payload.begin(), payload.end());
 }
 
 }  // namespace novaria::wire
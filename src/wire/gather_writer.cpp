@@ -0,0 +1,68 @@
+#include "wire/gather_writer.h"
+
+namespace novaria::wire {
+
+void GatherWriter::Clear() {
+    inline_writer_.Clear();
+    segments_.clear();
+    spans_.clear();
+    inline_cut_offset_ = 0;
+    external_size_ = 0;
+}
+
+ByteWriter& GatherWriter::InlineWriter() {
+    return inline_writer_;
+}
+
+void GatherWriter::AppendExternal(ByteSpan bytes) {
+    if (bytes.size() <= kInlineCopyThreshold) {
+        inline_writer_.WriteRawBytes(bytes);
+        return;
+    }
+
+    CutInlineSegment();
+    segments_.push_back(Segment{.external = true, .size = bytes.size(), .external_bytes = bytes});
+    external_size_ += bytes.size();
+}
+
+std::size_t GatherWriter::Size() const {
+    return inline_writer_.Buffer().size() + external_size_;
+}
+
+const std::vector<ByteSpan>& GatherWriter::Segments() {
+    CutInlineSegment();
+
+    const ByteBuffer& inline_bytes = inline_writer_.Buffer();
+    spans_.clear();
+    spans_.reserve(segments_.size());
+    for (const Segment& segment : segments_) {
+        spans_.push_back(
+            segment.external
+                ? segment.external_bytes
+                : ByteSpan(inline_bytes.data() + segment.inline_offset, segment.size));
+    }
+    return spans_;
+}
+
+void GatherWriter::Flatten(ByteBuffer& out_bytes) {
+    out_bytes.clear();
+    out_bytes.reserve(Size());
+    for (const ByteSpan segment : Segments()) {
+        out_bytes.insert(out_bytes.end(), segment.begin(), segment.end());
+    }
+}
+
+void GatherWriter::CutInlineSegment() {
+    const std::size_t inline_size = inline_writer_.Buffer().size();
+    if (inline_size == inline_cut_offset_) {
+        return;
+    }
+
+    segments_.push_back(Segment{
+        .inline_offset = inline_cut_offset_,
+        .size = inline_size - inline_cut_offset_,
+    });
+    inline_cut_offset_ = inline_size;
+}
+
+}  // namespace novaria::wire
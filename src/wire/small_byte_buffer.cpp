@@ -0,0 +1,107 @@
+#include "wire/small_byte_buffer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace novaria::wire {
+
+SmallByteBuffer::SmallByteBuffer(std::initializer_list<Byte> bytes) {
+    Assign(ByteSpan(bytes.begin(), bytes.size()));
+}
+
+SmallByteBuffer::SmallByteBuffer(const ByteBuffer& bytes) {
+    Assign(ByteSpan(bytes.data(), bytes.size()));
+}
+
+SmallByteBuffer::SmallByteBuffer(ByteSpan bytes) {
+    Assign(bytes);
+}
+
+SmallByteBuffer::SmallByteBuffer(const SmallByteBuffer& other) {
+    Assign(other.View());
+}
+
+SmallByteBuffer::SmallByteBuffer(SmallByteBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+SmallByteBuffer& SmallByteBuffer::operator=(const SmallByteBuffer& other) {
+    if (this != &other) {
+        Assign(other.View());
+    }
+    return *this;
+}
+
+SmallByteBuffer& SmallByteBuffer::operator=(SmallByteBuffer&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    if (other.IsInline()) {
+        std::memcpy(inline_bytes_.data(), other.inline_bytes_.data(), other.size_);
+        heap_bytes_.clear();
+    } else {
+        heap_bytes_ = std::move(other.heap_bytes_);
+    }
+    size_ = other.size_;
+    other.heap_bytes_.clear();
+    other.size_ = 0;
+    return *this;
+}
+
+void SmallByteBuffer::Assign(ByteSpan bytes) {
+    size_ = bytes.size();
+    if (size_ <= kInlineCapacity) {
+        heap_bytes_.clear();
+        if (size_ != 0) {
+            std::memcpy(inline_bytes_.data(), bytes.data(), size_);
+        }
+        return;
+    }
+
+    heap_bytes_.assign(bytes.begin(), bytes.end());
+}
+
+void SmallByteBuffer::Clear() {
+    heap_bytes_.clear();
+    size_ = 0;
+}
+
+bool SmallByteBuffer::IsInline() const {
+    return size_ <= kInlineCapacity;
+}
+
+ByteSpan SmallByteBuffer::View() const {
+    return ByteSpan(data(), size_);
+}
+
+const Byte* SmallByteBuffer::data() const {
+    return IsInline() ? inline_bytes_.data() : heap_bytes_.data();
+}
+
+std::size_t SmallByteBuffer::size() const {
+    return size_;
+}
+
+bool SmallByteBuffer::empty() const {
+    return size_ == 0;
+}
+
+const Byte* SmallByteBuffer::begin() const {
+    return data();
+}
+
+const Byte* SmallByteBuffer::end() const {
+    return data() + size_;
+}
+
+bool operator==(const SmallByteBuffer& lhs, const SmallByteBuffer& rhs) {
+    return std::ranges::equal(lhs.View(), rhs.View());
+}
+
+bool operator==(const SmallByteBuffer& lhs, const ByteBuffer& rhs) {
+    return std::ranges::equal(lhs.View(), ByteSpan(rhs.data(), rhs.size()));
+}
+
+}  // namespace novaria::wire
@@ -2,8 +2,6 @@
 
 #include <cstdint>
 #include <limits>
-#include <string>
-#include <utility>
 #include <vector>
 
 namespace novaria::world {
@@ -23,47 +21,44 @@ bool TryReadVarInt32(wire::ByteReader& reader, int& out_value) {
 
 }  // namespace
 
-bool WorldSnapshotCodec::EncodeChunkSnapshot(
+core::Status WorldSnapshotCodec::EncodeChunkSnapshot(
     const ChunkSnapshot& snapshot,
-    wire::ByteBuffer& out_payload,
-    std::string& out_error) {
+    wire::ByteBuffer& out_payload) {
+    wire::ByteWriter writer;
+    const core::Status status = EncodeChunkSnapshot(snapshot, writer);
+    if (!status) {
+        return status;
+    }
+
+    out_payload = writer.TakeBuffer();
+    return core::Status::Ok();
+}
+
+core::Status WorldSnapshotCodec::EncodeChunkSnapshot(
+    const ChunkSnapshot& snapshot,
+    wire::ByteWriter& writer) {
     if (snapshot.tiles.empty()) {
-        out_error = "snapshot tiles cannot be empty";
-        return false;
+        return core::Status::Error(core::StatusCode::InvalidArgument, "snapshot tiles cannot be empty");
     }
 
     const std::size_t tile_count = snapshot.tiles.size();
     if (tile_count > (std::numeric_limits<std::size_t>::max() / 2)) {
-        out_error = "snapshot tile count overflow";
-        return false;
-    }
-
-    std::vector<wire::Byte> tiles_bytes;
-    tiles_bytes.resize(tile_count * 2);
-    for (std::size_t index = 0; index < tile_count; ++index) {
-        const std::uint16_t material_id = snapshot.tiles[index];
-        tiles_bytes[index * 2] = static_cast<wire::Byte>(material_id & 0xFF);
-        tiles_bytes[index * 2 + 1] = static_cast<wire::Byte>((material_id >> 8) & 0xFF);
+        return core::Status::Error(core::StatusCode::InvalidArgument, "snapshot tile count overflow");
     }
 
-    wire::ByteWriter writer;
     writer.WriteVarInt(snapshot.chunk_coord.x);
     writer.WriteVarInt(snapshot.chunk_coord.y);
     writer.WriteVarUInt(tile_count);
-    writer.WriteBytes(wire::ByteSpan(tiles_bytes.data(), tiles_bytes.size()));
-
-    out_payload = writer.TakeBuffer();
-    out_error.clear();
-    return true;
+    writer.WriteVarUInt(tile_count * 2);
+    writer.WriteU16Array(snapshot.tiles);
+    return core::Status::Ok();
 }
 
-bool WorldSnapshotCodec::DecodeChunkSnapshot(
+core::Status WorldSnapshotCodec::DecodeChunkSnapshot(
     wire::ByteSpan payload,
-    ChunkSnapshot& out_snapshot,
-    std::string& out_error) {
+    ChunkSnapshot& out_snapshot) {
     if (payload.empty()) {
-        out_error = "payload is empty";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "payload is empty");
     }
 
     wire::ByteReader reader(payload);
@@ -73,50 +68,38 @@ bool WorldSnapshotCodec::DecodeChunkSnapshot(
     if (!TryReadVarInt32(reader, chunk_x) ||
         !TryReadVarInt32(reader, chunk_y) ||
         !reader.ReadVarUInt(tile_count_u64)) {
-        out_error = "invalid chunk header fields";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "invalid chunk header fields");
     }
     if (tile_count_u64 == 0) {
-        out_error = "tile_count cannot be zero";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "tile_count cannot be zero");
     }
     if (tile_count_u64 > std::numeric_limits<std::size_t>::max()) {
-        out_error = "tile_count overflow";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "tile_count overflow");
     }
 
     wire::ByteSpan tiles_bytes{};
     if (!reader.ReadBytes(tiles_bytes) || !reader.IsFullyConsumed()) {
-        out_error = "invalid tiles bytes field";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "invalid tiles bytes field");
     }
 
     const std::size_t tile_count = static_cast<std::size_t>(tile_count_u64);
     if (tile_count > (std::numeric_limits<std::size_t>::max() / 2)) {
-        out_error = "tile_count overflow";
-        return false;
+        return core::Status::Error(core::StatusCode::MalformedPayload, "tile_count overflow");
     }
     if (tiles_bytes.size() != tile_count * 2) {
-        out_error = "tiles bytes length does not match tile_count";
-        return false;
+        return core::Status::Error(
+            core::StatusCode::MalformedPayload,
+            "tiles bytes length does not match tile_count");
     }
 
-    ChunkSnapshot snapshot{};
-    snapshot.chunk_coord = ChunkCoord{
+    out_snapshot.chunk_coord = ChunkCoord{
         .x = chunk_x,
         .y = chunk_y,
     };
-    snapshot.tiles.resize(tile_count);
-    for (std::size_t index = 0; index < tile_count; ++index) {
-        const std::uint16_t low = tiles_bytes[index * 2];
-        const std::uint16_t high = tiles_bytes[index * 2 + 1];
-        snapshot.tiles[index] = static_cast<std::uint16_t>(low | (high << 8));
-    }
-
-    out_snapshot = std::move(snapshot);
-    out_error.clear();
-    return true;
+    out_snapshot.tiles.resize(tile_count);
+    wire::ByteReader tiles_reader(tiles_bytes);
+    (void)tiles_reader.ReadU16Array(out_snapshot.tiles);
+    return core::Status::Ok();
 }
 
 }  // namespace novaria::world
-
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <string>
 
 namespace novaria::world {
@@ -209,10 +210,9 @@ void WorldServiceBasic::UnloadChunk(const ChunkCoord& chunk_coord) {
     dirty_chunk_keys_.erase(chunk_key);
 }
 
-bool WorldServiceBasic::ApplyTileMutation(const TileMutation& mutation, std::string& out_error) {
+core::Status WorldServiceBasic::ApplyTileMutation(const TileMutation& mutation) {
     if (!initialized_) {
-        out_error = "World service is not initialized.";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "World service is not initialized.");
     }
 
     const ChunkCoord chunk_coord = WorldToChunkCoord(mutation.tile_x, mutation.tile_y);
@@ -223,64 +223,62 @@ bool WorldServiceBasic::ApplyTileMutation(const TileMutation& mutation, std::str
     const int local_y = PositiveMod(mutation.tile_y, kChunkSize);
     const std::size_t local_index = LocalIndex(local_x, local_y);
 
-    chunk_data.tiles[local_index] = mutation.material_id;
+    MutableTiles(chunk_data)[local_index] = mutation.material_id;
     if (!chunk_data.dirty) {
         chunk_data.dirty = true;
         dirty_chunk_keys_.insert(chunk_key);
     }
 
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
 }
 
-bool WorldServiceBasic::BuildChunkSnapshot(
+core::Status WorldServiceBasic::BuildChunkSnapshot(
     const ChunkCoord& chunk_coord,
-    ChunkSnapshot& out_snapshot,
-    std::string& out_error) const {
+    ChunkSnapshot& out_snapshot) const {
     if (!initialized_) {
-        out_error = "World service is not initialized.";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "World service is not initialized.");
     }
 
     const ChunkData* chunk_data = FindChunk(chunk_coord);
     if (chunk_data == nullptr) {
-        out_error = "Chunk is not loaded.";
-        return false;
+        return core::Status::Error(core::StatusCode::NotFound, "Chunk is not loaded.");
     }
 
     out_snapshot.chunk_coord = chunk_coord;
-    out_snapshot.tiles = chunk_data->tiles;
-    out_error.clear();
-    return true;
+    out_snapshot.tiles = *chunk_data->tiles;
+    return core::Status::Ok();
 }
 
-bool WorldServiceBasic::ApplyChunkSnapshot(const ChunkSnapshot& snapshot, std::string& out_error) {
+core::Status WorldServiceBasic::ApplyChunkSnapshot(const ChunkSnapshot& snapshot) {
     if (!initialized_) {
-        out_error = "World service is not initialized.";
-        return false;
+        return core::Status::Error(core::StatusCode::NotInitialized, "World service is not initialized.");
     }
 
     const std::size_t expected_tile_count = static_cast<std::size_t>(kChunkSize * kChunkSize);
     if (snapshot.tiles.size() != expected_tile_count) {
-        out_error = "Snapshot tile count does not match chunk size.";
-        return false;
+        return core::Status::Error(
+            core::StatusCode::InvalidArgument,
+            "Snapshot tile count does not match chunk size.");
     }
 
     ChunkData& chunk_data = EnsureChunk(snapshot.chunk_coord);
-    chunk_data.tiles = snapshot.tiles;
+    if (chunk_data.tiles.use_count() == 1) {
+        *chunk_data.tiles = snapshot.tiles;
+    } else {
+        chunk_data.tiles = std::make_shared<std::vector<std::uint16_t>>(snapshot.tiles);
+    }
     chunk_data.dirty = false;
     dirty_chunk_keys_.erase(ToChunkKey(snapshot.chunk_coord));
-    out_error.clear();
-    return true;
+    return core::Status::Ok();
 }
 
-std::vector<ChunkCoord> WorldServiceBasic::ConsumeDirtyChunks() {
-    std::vector<ChunkCoord> dirty_chunks;
+void WorldServiceBasic::ConsumeDirtyChunks(std::vector<ChunkCoord>& out_chunk_coords) {
+    out_chunk_coords.clear();
     if (!initialized_) {
-        return dirty_chunks;
+        return;
     }
 
-    dirty_chunks.reserve(dirty_chunk_keys_.size());
+    out_chunk_coords.reserve(dirty_chunk_keys_.size());
     for (const ChunkKey& chunk_key : dirty_chunk_keys_) {
         auto chunk_iter = chunks_.find(chunk_key);
         if (chunk_iter == chunks_.end()) {
@@ -288,23 +286,74 @@ std::vector<ChunkCoord> WorldServiceBasic::ConsumeDirtyChunks() {
         }
 
         chunk_iter->second.dirty = false;
-        dirty_chunks.push_back(ChunkCoord{
+        out_chunk_coords.push_back(ChunkCoord{
             .x = chunk_key.x,
             .y = chunk_key.y,
         });
     }
     dirty_chunk_keys_.clear();
     std::sort(
-        dirty_chunks.begin(),
-        dirty_chunks.end(),
+        out_chunk_coords.begin(),
+        out_chunk_coords.end(),
         [](const ChunkCoord& lhs, const ChunkCoord& rhs) {
             if (lhs.x != rhs.x) {
                 return lhs.x < rhs.x;
             }
             return lhs.y < rhs.y;
         });
+}
+
+void WorldServiceBasic::CaptureState(WorldState& out_state) const {
+    out_state.chunks.clear();
+    out_state.chunks.reserve(chunks_.size());
+    for (const auto& [chunk_key, chunk_data] : chunks_) {
+        out_state.chunks.push_back(WorldStateChunk{
+            .chunk_coord = ChunkCoord{.x = chunk_key.x, .y = chunk_key.y},
+            .tiles = chunk_data.tiles,
+        });
+    }
+}
 
-    return dirty_chunks;
+core::Status WorldServiceBasic::RestoreState(const WorldState& state) {
+    if (!initialized_) {
+        return core::Status::Error(core::StatusCode::NotInitialized, "World service is not initialized.");
+    }
+
+    const std::size_t expected_tile_count = static_cast<std::size_t>(kChunkSize * kChunkSize);
+    for (const WorldStateChunk& state_chunk : state.chunks) {
+        if (state_chunk.tiles == nullptr || state_chunk.tiles->size() != expected_tile_count) {
+            return core::Status::Error(
+                core::StatusCode::InvalidArgument,
+                "World state tile count does not match chunk size.");
+        }
+    }
+
+    ++restore_generation_;
+    for (const WorldStateChunk& state_chunk : state.chunks) {
+        const ChunkKey chunk_key = ToChunkKey(state_chunk.chunk_coord);
+        ChunkData& chunk_data = chunks_[chunk_key];
+        chunk_data.restore_generation = restore_generation_;
+        if (chunk_data.tiles == state_chunk.tiles) {
+            continue;
+        }
+
+        // Captured tiles are never written in place: MutableTiles clones any buffer that is still shared.
+        chunk_data.tiles = std::const_pointer_cast<std::vector<std::uint16_t>>(state_chunk.tiles);
+        if (!chunk_data.dirty) {
+            chunk_data.dirty = true;
+            dirty_chunk_keys_.insert(chunk_key);
+        }
+    }
+
+    for (auto chunk_iter = chunks_.begin(); chunk_iter != chunks_.end();) {
+        if (chunk_iter->second.restore_generation == restore_generation_) {
+            ++chunk_iter;
+            continue;
+        }
+        dirty_chunk_keys_.erase(chunk_iter->first);
+        chunk_iter = chunks_.erase(chunk_iter);
+    }
+    return core::Status::Ok();
 }
 
 bool WorldServiceBasic::IsChunkLoaded(const ChunkCoord& chunk_coord) const {
@@ -315,27 +364,26 @@ std::size_t WorldServiceBasic::LoadedChunkCount() const {
     return chunks_.size();
 }
 
-std::vector<ChunkCoord> WorldServiceBasic::LoadedChunkCoords() const {
-    std::vector<ChunkCoord> chunk_coords;
-    chunk_coords.reserve(chunks_.size());
+void WorldServiceBasic::LoadedChunkCoords(std::vector<ChunkCoord>& out_chunk_coords) const {
+    out_chunk_coords.clear();
+    out_chunk_coords.reserve(chunks_.size());
     for (const auto& [chunk_key, chunk_data] : chunks_) {
         (void)chunk_data;
-        chunk_coords.push_back(ChunkCoord{
+        out_chunk_coords.push_back(ChunkCoord{
             .x = chunk_key.x,
             .y = chunk_key.y,
         });
     }
 
     std::sort(
-        chunk_coords.begin(),
-        chunk_coords.end(),
+        out_chunk_coords.begin(),
+        out_chunk_coords.end(),
         [](const ChunkCoord& lhs, const ChunkCoord& rhs) {
             if (lhs.x != rhs.x) {
                 return lhs.x < rhs.x;
             }
             return lhs.y < rhs.y;
         });
-    return chunk_coords;
 }
 
 bool WorldServiceBasic::TryReadTile(int tile_x, int tile_y, std::uint16_t& out_material_id) const {
@@ -349,7 +397,7 @@ bool WorldServiceBasic::TryReadTile(int tile_x, int tile_y, std::uint16_t& out_m
     const int local_y = PositiveMod(tile_y, kChunkSize);
     const std::size_t local_index = LocalIndex(local_x, local_y);
 
-    out_material_id = chunk_data->tiles[local_index];
+    out_material_id = (*chunk_data->tiles)[local_index];
     return true;
 }
 
@@ -401,11 +449,18 @@ WorldServiceBasic::ChunkKey WorldServiceBasic::ToChunkKey(const ChunkCoord& chun
     };
 }
 
+std::vector<std::uint16_t>& WorldServiceBasic::MutableTiles(ChunkData& chunk_data) {
+    if (chunk_data.tiles.use_count() != 1) {
+        chunk_data.tiles = std::make_shared<std::vector<std::uint16_t>>(*chunk_data.tiles);
+    }
+    return *chunk_data.tiles;
+}
+
 WorldServiceBasic::ChunkData& WorldServiceBasic::EnsureChunk(const ChunkCoord& chunk_coord) {
     const ChunkKey chunk_key = ToChunkKey(chunk_coord);
     auto [it, inserted] = chunks_.try_emplace(chunk_key);
     if (inserted) {
-        it->second.tiles = BuildInitialChunkTiles(chunk_coord);
+        it->second.tiles = std::make_shared<std::vector<std::uint16_t>>(BuildInitialChunkTiles(chunk_coord));
         it->second.dirty = false;
     }
     return it->second;
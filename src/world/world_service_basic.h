@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -30,17 +31,16 @@ public:
     void Tick(const core::TickContext& tick_context) override;
     void LoadChunk(const ChunkCoord& chunk_coord) override;
     void UnloadChunk(const ChunkCoord& chunk_coord) override;
-    bool ApplyTileMutation(const TileMutation& mutation, std::string& out_error) override;
-    bool BuildChunkSnapshot(
-        const ChunkCoord& chunk_coord,
-        ChunkSnapshot& out_snapshot,
-        std::string& out_error) const override;
-    bool ApplyChunkSnapshot(const ChunkSnapshot& snapshot, std::string& out_error) override;
-    std::vector<ChunkCoord> ConsumeDirtyChunks() override;
+    core::Status ApplyTileMutation(const TileMutation& mutation) override;
+    core::Status BuildChunkSnapshot(const ChunkCoord& chunk_coord, ChunkSnapshot& out_snapshot) const override;
+    core::Status ApplyChunkSnapshot(const ChunkSnapshot& snapshot) override;
+    void ConsumeDirtyChunks(std::vector<ChunkCoord>& out_chunk_coords) override;
+    void CaptureState(WorldState& out_state) const override;
+    core::Status RestoreState(const WorldState& state) override;
 
     bool IsChunkLoaded(const ChunkCoord& chunk_coord) const;
     std::size_t LoadedChunkCount() const;
-    std::vector<ChunkCoord> LoadedChunkCoords() const override;
+    void LoadedChunkCoords(std::vector<ChunkCoord>& out_chunk_coords) const override;
     bool TryReadTile(int tile_x, int tile_y, std::uint16_t& out_material_id) const override;
 
 private:
@@ -58,8 +58,9 @@ private:
     };
 
     struct ChunkData final {
-        std::vector<std::uint16_t> tiles;
+        std::shared_ptr<std::vector<std::uint16_t>> tiles;
         bool dirty = false;
+        std::uint64_t restore_generation = 0;
     };
 
     static int FloorDiv(int value, int divisor);
@@ -68,6 +69,7 @@ private:
     static std::vector<std::uint16_t> BuildInitialChunkTiles(const ChunkCoord& chunk_coord);
     static std::size_t LocalIndex(int local_x, int local_y);
     static ChunkKey ToChunkKey(const ChunkCoord& chunk_coord);
+    static std::vector<std::uint16_t>& MutableTiles(ChunkData& chunk_data);
 
     ChunkData& EnsureChunk(const ChunkCoord& chunk_coord);
     const ChunkData* FindChunk(const ChunkCoord& chunk_coord) const;
@@ -75,6 +77,7 @@ private:
     bool initialized_ = false;
     std::unordered_map<ChunkKey, ChunkData, ChunkKeyHasher> chunks_;
     std::unordered_set<ChunkKey, ChunkKeyHasher> dirty_chunk_keys_;
+    std::uint64_t restore_generation_ = 0;
 };
 
 }  // namespace novaria::world
@@ -35,24 +35,20 @@ public:
     void UnloadChunk(const novaria::world::ChunkCoord& chunk_coord) override {
         (void)chunk_coord;
     }
-    bool ApplyTileMutation(const novaria::world::TileMutation& mutation, std::string& out_error) override {
+    novaria::core::Status ApplyTileMutation(const novaria::world::TileMutation& mutation) override {
         tiles_[{mutation.tile_x, mutation.tile_y}] = mutation.material_id;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
-    bool BuildChunkSnapshot(
+    novaria::core::Status BuildChunkSnapshot(
         const novaria::world::ChunkCoord& chunk_coord,
-        novaria::world::ChunkSnapshot& out_snapshot,
-        std::string& out_error) const override {
+        novaria::world::ChunkSnapshot& out_snapshot) const override {
         (void)chunk_coord;
         (void)out_snapshot;
-        out_error = "not implemented";
-        return false;
+        return novaria::core::Status::Error(novaria::core::StatusCode::Unavailable, "not implemented");
     }
-    bool ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot, std::string& out_error) override {
+    novaria::core::Status ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot) override {
         (void)snapshot;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
     bool TryReadTile(
         int tile_x,
@@ -65,11 +61,20 @@ public:
         out_material_id = it->second;
         return true;
     }
-    std::vector<novaria::world::ChunkCoord> LoadedChunkCoords() const override {
-        return {};
+    void LoadedChunkCoords(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) const override {
+        out_chunk_coords.clear();
     }
-    std::vector<novaria::world::ChunkCoord> ConsumeDirtyChunks() override {
-        return {};
+    void ConsumeDirtyChunks(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) override {
+        out_chunk_coords.clear();
+    }
+
+    void CaptureState(novaria::world::WorldState& out_state) const override {
+        out_state.chunks.clear();
+    }
+
+    novaria::core::Status RestoreState(const novaria::world::WorldState& state) override {
+        (void)state;
+        return novaria::core::Status::Ok();
     }
 
 private:
@@ -208,9 +213,8 @@ bool TestHotbarAndSmartSlotComponents() {
     FakeWorldService world;
     std::string error;
     (void)world.Initialize(error);
-    world.ApplyTileMutation(
-        {.tile_x = 1, .tile_y = 0, .material_id = novaria::world::material::kStone},
-        error);
+    (void)world.ApplyTileMutation(
+        {.tile_x = 1, .tile_y = 0, .material_id = novaria::world::material::kStone});
     const std::uint8_t suggested_slot = novaria::app::controller::ResolveSmartContextSlot(
         state,
         world,
@@ -1,10 +1,15 @@
 #include "app/render_scene_builder.h"
+#include "sim/entity_replication.h"
+#include "sim/player_motion.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -37,26 +42,22 @@ public:
         (void)chunk_coord;
     }
 
-    bool ApplyTileMutation(const novaria::world::TileMutation& mutation, std::string& out_error) override {
+    novaria::core::Status ApplyTileMutation(const novaria::world::TileMutation& mutation) override {
         tiles_[{mutation.tile_x, mutation.tile_y}] = mutation.material_id;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
 
-    bool BuildChunkSnapshot(
+    novaria::core::Status BuildChunkSnapshot(
         const novaria::world::ChunkCoord& chunk_coord,
-        novaria::world::ChunkSnapshot& out_snapshot,
-        std::string& out_error) const override {
+        novaria::world::ChunkSnapshot& out_snapshot) const override {
         (void)chunk_coord;
         (void)out_snapshot;
-        out_error = "not implemented";
-        return false;
+        return novaria::core::Status::Error(novaria::core::StatusCode::Unavailable, "not implemented");
     }
 
-    bool ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot, std::string& out_error) override {
+    novaria::core::Status ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot) override {
         (void)snapshot;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
 
     bool TryReadTile(
@@ -72,12 +73,21 @@ public:
         return true;
     }
 
-    std::vector<novaria::world::ChunkCoord> LoadedChunkCoords() const override {
-        return {};
+    void LoadedChunkCoords(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) const override {
+        out_chunk_coords.clear();
+    }
+
+    void ConsumeDirtyChunks(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) override {
+        out_chunk_coords.clear();
+    }
+
+    void CaptureState(novaria::world::WorldState& out_state) const override {
+        out_state.chunks.clear();
     }
 
-    std::vector<novaria::world::ChunkCoord> ConsumeDirtyChunks() override {
-        return {};
+    novaria::core::Status RestoreState(const novaria::world::WorldState& state) override {
+        (void)state;
+        return novaria::core::Status::Ok();
     }
 
 private:
@@ -104,15 +114,30 @@ int main() {
     FakeWorldService world_service;
     std::string error;
     (void)world_service.Initialize(error);
-    world_service.ApplyTileMutation(
-        {.tile_x = 32, .tile_y = 18, .material_id = 1},
-        error);
+    (void)world_service.ApplyTileMutation(
+        {.tile_x = 32, .tile_y = 18, .material_id = 1});
 
     novaria::app::RenderSceneBuilder builder;
+    const std::vector<novaria::sim::InterpolatedEntityState> remote_players{
+        {.entity_id = 2, .position_x = 34.0F, .position_y = 18.0F},
+    };
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> replicated_entities{
+        {
+            .network_id = 7,
+            .kind = novaria::sim::ecs::ReplicatedEntityKind::Hostile,
+            .position_x = 30.0F,
+            .position_y = 18.0F,
+        },
+        {
+            .network_id = novaria::sim::kReplicatedPlayerNetworkIdFlag | 2U,
+            .kind = novaria::sim::ecs::ReplicatedEntityKind::Player,
+            .position_x = 34.0F,
+        },
+    };
     const novaria::platform::RenderScene scene_640x480 =
-        builder.Build(player_state, 640, 480, world_service, 1.0F);
+        builder.Build(player_state, 640, 480, world_service, 1.0F, remote_players, replicated_entities);
     const novaria::platform::RenderScene scene_960x480 =
-        builder.Build(player_state, 960, 480, world_service, 1.0F);
+        builder.Build(player_state, 960, 480, world_service, 1.0F, {}, {});
 
     passed &= Expect(
         scene_640x480.view_tiles_x == 22 && scene_640x480.view_tiles_y == 17,
@@ -129,6 +154,40 @@ int main() {
             static_cast<std::size_t>(scene_960x480.view_tiles_x * scene_960x480.view_tiles_y),
         "Render tile count should match derived viewport for 960x480.");
 
+    const novaria::sim::PlayerMotionSettings& motion_settings =
+        novaria::sim::DefaultPlayerMotionSettings();
+    const auto remote_player_rect = std::find_if(
+        scene_640x480.overlay_commands.begin(),
+        scene_640x480.overlay_commands.end(),
+        [](const novaria::platform::RenderCommand& command) {
+            return command.layer == novaria::platform::RenderLayer::WorldOverlay &&
+                command.kind == novaria::platform::RenderCommandKind::FilledRect &&
+                command.z == 5;
+        });
+    passed &= Expect(
+        remote_player_rect != scene_640x480.overlay_commands.end(),
+        "Render scene should draw remote players as world overlay rects.");
+    if (remote_player_rect != scene_640x480.overlay_commands.end()) {
+        const float expected_x = 320.0F + (2.0F - motion_settings.half_width) * 32.0F;
+        passed &= Expect(
+            std::fabs(remote_player_rect->filled_rect.x - expected_x) < 0.001F &&
+                std::fabs(remote_player_rect->filled_rect.y - (240.0F - motion_settings.height * 32.0F)) <
+                    0.001F,
+            "Remote player rect should be placed relative to the camera.");
+    }
+
+    const auto entity_rect_count = std::count_if(
+        scene_640x480.overlay_commands.begin(),
+        scene_640x480.overlay_commands.end(),
+        [](const novaria::platform::RenderCommand& command) {
+            return command.layer == novaria::platform::RenderLayer::WorldOverlay &&
+                command.kind == novaria::platform::RenderCommandKind::FilledRect &&
+                command.z == 4;
+        });
+    passed &= Expect(
+        entity_rect_count == 1,
+        "Render scene should draw replicated entities but leave players to the remote player list.");
+
     if (!passed) {
         return 1;
     }
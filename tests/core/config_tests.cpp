@@ -73,6 +73,9 @@ int main() {
         default_config.net_udp_remote_host == "127.0.0.1",
         "Net UDP remote host should default to loopback.");
     passed &= Expect(default_config.net_udp_remote_port == 0, "Net UDP remote port should default to 0.");
+    passed &= Expect(
+        default_config.net_interpolation_delay_ms == 100,
+        "Net interpolation delay should default to 100ms.");
 
     passed &= Expect(
         WriteConfigFile(
@@ -86,7 +89,8 @@ int main() {
             "net_udp_local_host = \"0.0.0.0\"\n"
             "net_udp_local_port = 24000\n"
             "net_udp_remote_host = \"127.0.0.1\"\n"
-            "net_udp_remote_port = 24001\n"),
+            "net_udp_remote_port = 24001\n"
+            "net_interpolation_delay_ms = 50\n"),
         "Strict config file write should succeed.");
 
     novaria::core::GameConfig strict_config{};
@@ -109,6 +113,9 @@ int main() {
     passed &= Expect(
         strict_config.net_udp_remote_host == "127.0.0.1",
         "Net UDP remote host should parse correctly.");
+    passed &= Expect(
+        strict_config.net_interpolation_delay_ms == 50,
+        "Net interpolation delay should parse correctly.");
 
     passed &= Expect(
         WriteConfigFile(
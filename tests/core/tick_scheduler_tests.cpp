@@ -0,0 +1,126 @@
+#include "core/tick_scheduler.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+namespace {
+
+using Clock = novaria::core::TickScheduler::Clock;
+using std::chrono::milliseconds;
+
+bool Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+bool TestTicksFollowAbsoluteDeadlines() {
+    bool passed = true;
+    novaria::core::TickScheduler scheduler;
+    scheduler.SetSettings({.tick_interval_seconds = 0.010, .max_catch_up_ticks = 4});
+    const Clock::time_point start{};
+    scheduler.Start(start);
+
+    passed &= Expect(!scheduler.TryBeginTick(start + milliseconds(9)), "Tick should not be due before its deadline.");
+    passed &= Expect(scheduler.TryBeginTick(start + milliseconds(12)), "Tick should be due after its deadline.");
+    scheduler.EndTick(start + milliseconds(15));
+    passed &= Expect(
+        scheduler.NextTickDeadline() == start + milliseconds(20),
+        "Late start should not shift the next absolute deadline.");
+    passed &= Expect(
+        scheduler.InterpolationAlpha(start + milliseconds(15)) > 0.49F &&
+            scheduler.InterpolationAlpha(start + milliseconds(15)) < 0.51F,
+        "Interpolation alpha should be the fraction of the interval since the last consumed deadline.");
+
+    const novaria::core::TickSchedulerStats stats = scheduler.Stats();
+    passed &= Expect(
+        stats.tick_count == 1 && stats.overrun_count == 0 && stats.catch_up_tick_count == 0,
+        "An on-time tick shorter than the interval should not count as overrun or catch-up.");
+    passed &= Expect(
+        stats.last_lateness_ms > 1.99 && stats.last_lateness_ms < 2.01 &&
+            stats.last_tick_ms > 2.99 && stats.last_tick_ms < 3.01,
+        "Stats should report lateness and tick duration.");
+    return passed;
+}
+
+bool TestCatchUpIsBoundedAndExcessIsSkipped() {
+    bool passed = true;
+    novaria::core::TickScheduler scheduler;
+    scheduler.SetSettings({.tick_interval_seconds = 0.010, .max_catch_up_ticks = 3});
+    const Clock::time_point start{};
+    scheduler.Start(start);
+
+    // A 95 ms stall leaves deadlines 10..90 due: 9 ticks, of which only 1 + 3 catch-up ticks may run.
+    const Clock::time_point stalled = start + milliseconds(95);
+    int ran = 0;
+    while (scheduler.TryBeginTick(stalled)) {
+        scheduler.EndTick(stalled);
+        ++ran;
+    }
+
+    const novaria::core::TickSchedulerStats stats = scheduler.Stats();
+    passed &= Expect(ran == 4, "Backlog should be capped at max_catch_up_ticks plus the due tick.");
+    passed &= Expect(stats.skipped_tick_count == 5, "Dropped backlog should be reported as skipped ticks.");
+    passed &= Expect(stats.catch_up_tick_count == 3, "Ticks run a full interval late should count as catch-up.");
+    passed &= Expect(
+        scheduler.NextTickDeadline() == start + milliseconds(100),
+        "Deadline should land on the interval grid after skipping.");
+    return passed;
+}
+
+bool TestOverrunsAndFastForward() {
+    bool passed = true;
+    novaria::core::TickScheduler scheduler;
+    scheduler.SetSettings({.tick_interval_seconds = 0.010, .max_catch_up_ticks = 2, .fast_forward = true});
+    const Clock::time_point start{};
+    scheduler.Start(start);
+
+    passed &= Expect(scheduler.TryBeginTick(start), "Fast-forward ticks should always be due.");
+    scheduler.EndTick(start + milliseconds(25));
+    passed &= Expect(scheduler.TryBeginTick(start + milliseconds(25)), "Fast-forward should run back to back.");
+    scheduler.EndTick(start + milliseconds(26));
+
+    const novaria::core::TickSchedulerStats stats = scheduler.Stats();
+    passed &= Expect(stats.tick_count == 2 && stats.overrun_count == 1, "Ticks longer than the interval are overruns.");
+    passed &= Expect(
+        stats.skipped_tick_count == 0 && stats.max_lateness_ms == 0.0,
+        "Fast-forward should never accumulate lateness or skip ticks.");
+
+    const auto wait_start = Clock::now();
+    scheduler.WaitForNextTick();
+    passed &= Expect(Clock::now() - wait_start < milliseconds(5), "Fast-forward should not wait.");
+    return passed;
+}
+
+bool TestHybridWaitReachesDeadline() {
+    bool passed = true;
+    novaria::core::TickScheduler scheduler;
+    scheduler.SetSettings({.tick_interval_seconds = 0.005, .spin_wait = std::chrono::microseconds(1000)});
+    scheduler.Start(Clock::now());
+    scheduler.WaitForNextTick();
+    passed &= Expect(
+        Clock::now() >= scheduler.NextTickDeadline(),
+        "WaitForNextTick should not return before the deadline.");
+    passed &= Expect(scheduler.TryBeginTick(Clock::now()), "Tick should be due after waiting.");
+    return passed;
+}
+
+}  // namespace
+
+int main() {
+    bool passed = true;
+    passed &= TestTicksFollowAbsoluteDeadlines();
+    passed &= TestCatchUpIsBoundedAndExcessIsSkipped();
+    passed &= TestOverrunsAndFastForward();
+    passed &= TestHybridWaitReachesDeadline();
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "[PASS] novaria_tick_scheduler_tests\n";
+    return 0;
+}
@@ -50,12 +50,11 @@ public:
         (void)event_data;
     }
 
-    bool TryCallModuleFunction(
+    novaria::core::Status TryCallModuleFunction(
         std::string_view module_name,
         std::string_view function_name,
         novaria::wire::ByteSpan request_payload,
-        novaria::wire::ByteBuffer& out_response_payload,
-        std::string& out_error) override {
+        novaria::wire::ByteBuffer& out_response_payload) override {
         (void)module_name;
         (void)function_name;
         out_response_payload.clear();
@@ -65,8 +64,7 @@ public:
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeValidateResponse(true);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         novaria::script::simrpc::ActionPrimaryRequest action_request{};
@@ -131,8 +129,7 @@ public:
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeActionPrimaryResponse(result, place_kind, required_ticks);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         novaria::script::simrpc::CraftRecipeRequest craft_request{};
@@ -165,13 +162,13 @@ public:
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeCraftRecipeResponse(response);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         out_response_payload.clear();
-        out_error = "issue e2e fake script host received unknown simrpc payload";
-        return false;
+        return novaria::core::Status::Error(
+            novaria::core::StatusCode::InvalidArgument,
+            "issue e2e fake script host received unknown simrpc payload");
     }
 
     novaria::script::ScriptRuntimeDescriptor RuntimeDescriptor() const override {
@@ -344,13 +341,11 @@ bool TestToolGateDropPickupAndReach() {
 
     passed &= Expect(
         world->ApplyTileMutation(
-            {.tile_x = near_tile_x, .tile_y = target_tile_y, .material_id = novaria::world::material::kWood},
-            error),
+            {.tile_x = near_tile_x, .tile_y = target_tile_y, .material_id = novaria::world::material::kWood}).IsOk(),
         "Near wood mutation should succeed.");
     passed &= Expect(
         world->ApplyTileMutation(
-            {.tile_x = far_tile_x, .tile_y = target_tile_y, .material_id = novaria::world::material::kStone},
-            error),
+            {.tile_x = far_tile_x, .tile_y = target_tile_y, .material_id = novaria::world::material::kStone}).IsOk(),
         "Far stone mutation should succeed.");
 
     novaria::app::PlayerInputIntent mine_wood_with_pickaxe{};
@@ -439,8 +434,7 @@ bool TestWorkbenchReachGateForSwordRecipe() {
     const int workbench_y = recipe_state.tile_y;
     passed &= Expect(
         world->ApplyTileMutation(
-            {.tile_x = far_workbench_x, .tile_y = workbench_y, .material_id = novaria::world::material::kWorkbench},
-            error),
+            {.tile_x = far_workbench_x, .tile_y = workbench_y, .material_id = novaria::world::material::kWorkbench}).IsOk(),
         "Far workbench mutation should succeed.");
 
     novaria::app::PlayerInputIntent open_inventory{};
@@ -458,8 +452,7 @@ bool TestWorkbenchReachGateForSwordRecipe() {
 
     passed &= Expect(
         world->ApplyTileMutation(
-            {.tile_x = near_workbench_x, .tile_y = workbench_y, .material_id = novaria::world::material::kWorkbench},
-            error),
+            {.tile_x = near_workbench_x, .tile_y = workbench_y, .material_id = novaria::world::material::kWorkbench}).IsOk(),
         "Near workbench mutation should succeed.");
     novaria::app::PlayerInputIntent craft_sword_near{};
     craft_sword_near.interaction_primary_pressed = true;
@@ -536,8 +529,7 @@ bool TestTorchCraftPlaceAndLighting() {
     target_y = state.tile_y;
     passed &= Expect(
         world->ApplyTileMutation(
-            {.tile_x = target_x, .tile_y = target_y, .material_id = novaria::world::material::kAir},
-            error),
+            {.tile_x = target_x, .tile_y = target_y, .material_id = novaria::world::material::kAir}).IsOk(),
         "Torch placement target should be forced to air.");
     novaria::app::PlayerInputIntent place_torch{};
     place_torch.action_primary_held = true;
@@ -561,7 +553,9 @@ bool TestTorchCraftPlaceAndLighting() {
         config.window_width,
         config.window_height,
         *world,
-        0.0F);
+        0.0F,
+        {},
+        {});
     std::uint8_t torch_light = 0;
     std::uint8_t far_light = 0;
     const bool has_torch_light = TryReadLightLevel(scene, target_x, target_y, torch_light);
@@ -604,8 +598,7 @@ bool TestSmartModeAndHotbarRowCycle() {
     const int target_y = start_state.tile_y;
     passed &= Expect(
         world->ApplyTileMutation(
-            {.tile_x = target_x, .tile_y = target_y, .material_id = novaria::world::material::kStone},
-            error),
+            {.tile_x = target_x, .tile_y = target_y, .material_id = novaria::world::material::kStone}).IsOk(),
         "Stone mutation for smart-mode test should succeed.");
 
     novaria::app::PlayerInputIntent tab_row{};
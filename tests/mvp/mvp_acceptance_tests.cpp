@@ -70,12 +70,11 @@ public:
         received_events_.push_back(event_data);
     }
 
-    bool TryCallModuleFunction(
+    novaria::core::Status TryCallModuleFunction(
         std::string_view module_name,
         std::string_view function_name,
         novaria::wire::ByteSpan request_payload,
-        novaria::wire::ByteBuffer& out_response_payload,
-        std::string& out_error) override {
+        novaria::wire::ByteBuffer& out_response_payload) override {
         (void)module_name;
         (void)function_name;
         out_response_payload.clear();
@@ -85,8 +84,7 @@ public:
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeValidateResponse(true);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         novaria::script::simrpc::CraftRecipeRequest craft_request{};
@@ -119,13 +117,13 @@ public:
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeCraftRecipeResponse(response);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         out_response_payload.clear();
-        out_error = "acceptance fake script host received unknown simrpc payload";
-        return false;
+        return novaria::core::Status::Error(
+            novaria::core::StatusCode::InvalidArgument,
+            "acceptance fake script host received unknown simrpc payload");
     }
 
     novaria::script::ScriptRuntimeDescriptor RuntimeDescriptor() const override {
@@ -45,7 +45,8 @@ int main() {
         .payload = {},
     });
     runtime->Tick({.tick_index = 21, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto commands = runtime->ConsumeRemoteCommands();
+    std::vector<novaria::net::PlayerCommand> commands;
+    runtime->ConsumeRemoteCommands(commands);
     passed &= Expect(
         commands.size() == 1 &&
             commands.front().player_id == 9 &&
@@ -55,7 +56,8 @@ int main() {
 
     runtime->PublishWorldSnapshot(21, {novaria::wire::ByteBuffer{1, 2, 3}});
     runtime->Tick({.tick_index = 22, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto payloads = runtime->ConsumeRemoteChunkPayloads();
+    std::vector<novaria::wire::ByteBuffer> payloads;
+    runtime->ConsumeRemoteChunkPayloads(payloads);
     passed &= Expect(
         payloads.size() == 1 && payloads.front() == novaria::wire::ByteBuffer{1, 2, 3},
         "Runtime should return peer payload.");
@@ -1,14 +1,50 @@
+#include "net/net_congestion_controller.h"
+#include "net/net_link_estimator.h"
 #include "net/net_service_udp_peer.h"
+#include "net/network_impairment.h"
 #include "net/udp_transport.h"
 #include "sim/command_schema.h"
+#include "wire/envelope.h"
 #include "world/snapshot_codec.h"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
 #include <iostream>
+#include <new>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace {
 
+bool g_count_allocations = false;
+std::size_t g_allocation_count = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (g_count_allocations) {
+        ++g_allocation_count;
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size); memory != nullptr) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t size) noexcept {
+    (void)size;
+    std::free(memory);
+}
+
+namespace {
+
 bool Expect(bool condition, const char* message) {
     if (!condition) {
         std::cerr << "[FAIL] " << message << '\n';
@@ -26,13 +62,93 @@ novaria::wire::ByteBuffer EncodeTestChunkPayload(
         .tiles = std::move(tiles),
     };
     novaria::wire::ByteBuffer payload;
-    std::string error;
-    if (!novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload, error)) {
+    if (!novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload).IsOk()) {
         return {};
     }
     return payload;
 }
 
+bool SendRawDatagram(
+    novaria::net::UdpTransport& transport,
+    std::uint16_t port,
+    novaria::wire::MessageKind kind,
+    const novaria::wire::ByteBuffer& payload,
+    std::string& error) {
+    novaria::wire::ByteBuffer datagram;
+    novaria::wire::EncodeEnvelopeV1(
+        kind,
+        novaria::wire::ByteSpan(payload.data(), payload.size()),
+        datagram);
+    const novaria::core::Status status = transport.SendTo(
+        {.host = "127.0.0.1", .port = port},
+        std::string_view(reinterpret_cast<const char*>(datagram.data()), datagram.size()));
+    error = status.Message();
+    return status.IsOk();
+}
+
+bool ReceiveRawPayload(
+    novaria::net::UdpTransport& transport,
+    novaria::wire::MessageKind kind,
+    novaria::wire::ByteBuffer& out_payload) {
+    std::string datagram;
+    novaria::net::UdpEndpoint sender{};
+    for (int attempt = 0; attempt < 200; ++attempt) {
+        while (transport.Receive(datagram, sender).IsOk()) {
+            novaria::wire::EnvelopeView envelope{};
+            if (novaria::wire::DecodeEnvelopeV1(
+                    novaria::wire::ByteSpan(
+                        reinterpret_cast<const novaria::wire::Byte*>(datagram.data()),
+                        datagram.size()),
+                    envelope)
+                    .IsOk() &&
+                envelope.kind == kind) {
+                out_payload.assign(envelope.payload.begin(), envelope.payload.end());
+                return true;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+novaria::wire::ByteBuffer BuildRawCommandBatch(
+    std::uint32_t player_id,
+    std::uint32_t first_sequence,
+    std::uint32_t command_count) {
+    novaria::wire::ByteWriter writer;
+    writer.WriteVarUInt(player_id);
+    writer.WriteVarUInt(first_sequence);
+    writer.WriteVarUInt(command_count);
+    for (std::uint32_t index = 0; index < command_count; ++index) {
+        writer.WriteVarUInt(novaria::sim::command::kJump);
+        writer.WriteVarUInt(0);
+        writer.WriteBytes({});
+    }
+    return writer.TakeBuffer();
+}
+
+novaria::wire::ByteBuffer BuildRawCommandAckBatch(std::uint32_t player_id, std::uint32_t sequence) {
+    novaria::wire::ByteWriter writer;
+    writer.WriteVarUInt(1);
+    writer.WriteVarUInt(player_id);
+    writer.WriteVarUInt(sequence);
+    writer.WriteVarUInt(0);
+    writer.WriteVarUInt(0);
+    return writer.TakeBuffer();
+}
+
+novaria::wire::ByteBuffer BuildRawEntityStateBatch(
+    std::uint64_t tick_index,
+    const std::vector<novaria::wire::ByteBuffer>& entity_states) {
+    novaria::wire::ByteWriter writer;
+    writer.WriteVarUInt(tick_index);
+    writer.WriteVarUInt(entity_states.size());
+    for (const auto& entity_state : entity_states) {
+        writer.WriteBytes(novaria::wire::ByteSpan(entity_state.data(), entity_state.size()));
+    }
+    return writer.TakeBuffer();
+}
+
 }  // namespace
 
 int main() {
@@ -67,7 +183,8 @@ int main() {
         .payload = {},
     });
     net_service.Tick({.tick_index = 2, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto consumed_commands = net_service.ConsumeRemoteCommands();
+    std::vector<novaria::net::PlayerCommand> consumed_commands;
+    net_service.ConsumeRemoteCommands(consumed_commands);
     passed &= Expect(
         consumed_commands.size() == 1 &&
             consumed_commands.front().player_id == 1 &&
@@ -81,7 +198,8 @@ int main() {
     };
     net_service.PublishWorldSnapshot(3, encoded_chunks);
     net_service.Tick({.tick_index = 4, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto consumed_payloads = net_service.ConsumeRemoteChunkPayloads();
+    std::vector<novaria::wire::ByteBuffer> consumed_payloads;
+    net_service.ConsumeRemoteChunkPayloads(consumed_payloads);
     passed &= Expect(
         consumed_payloads.size() == encoded_chunks.size(),
         "Loopback transport should receive published snapshots.");
@@ -140,7 +258,8 @@ int main() {
     });
     host_a.Tick({.tick_index = 2, .fixed_delta_seconds = 1.0 / 60.0});
     host_b.Tick({.tick_index = 2, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto host_b_commands = host_b.ConsumeRemoteCommands();
+    std::vector<novaria::net::PlayerCommand> host_b_commands;
+    host_b.ConsumeRemoteCommands(host_b_commands);
     passed &= Expect(
         host_b_commands.size() == 1 &&
             host_b_commands.front().player_id == 7 &&
@@ -158,7 +277,8 @@ int main() {
     host_a.PublishWorldSnapshot(3, {cross_process_payload});
     host_a.Tick({.tick_index = 3, .fixed_delta_seconds = 1.0 / 60.0});
     host_b.Tick({.tick_index = 3, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto host_b_payloads = host_b.ConsumeRemoteChunkPayloads();
+    std::vector<novaria::wire::ByteBuffer> host_b_payloads;
+    host_b.ConsumeRemoteChunkPayloads(host_b_payloads);
     passed &= Expect(
         host_b_payloads.size() == 1 && host_b_payloads.front() == cross_process_payload,
         "Host B should receive payload published by Host A.");
@@ -168,7 +288,8 @@ int main() {
     host_b.PublishWorldSnapshot(4, {cross_process_payload_back});
     host_b.Tick({.tick_index = 4, .fixed_delta_seconds = 1.0 / 60.0});
     host_a.Tick({.tick_index = 4, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto host_a_payloads = host_a.ConsumeRemoteChunkPayloads();
+    std::vector<novaria::wire::ByteBuffer> host_a_payloads;
+    host_a.ConsumeRemoteChunkPayloads(host_a_payloads);
     passed &= Expect(
         host_a_payloads.size() == 1 && host_a_payloads.front() == cross_process_payload_back,
         "Host A should receive payload published by Host B.");
@@ -178,11 +299,11 @@ int main() {
     passed &= Expect(
         rogue_transport.SendTo(
             {.host = "127.0.0.1", .port = host_b.LocalPort()},
-            "rogue_payload",
-            error),
+            "rogue_payload").IsOk(),
         "Rogue sender datagram send should succeed.");
     host_b.Tick({.tick_index = 4, .fixed_delta_seconds = 1.0 / 60.0});
-    const auto filtered_payloads = host_b.ConsumeRemoteChunkPayloads();
+    std::vector<novaria::wire::ByteBuffer> filtered_payloads;
+    host_b.ConsumeRemoteChunkPayloads(filtered_payloads);
     passed &= Expect(
         filtered_payloads.empty(),
         "Unexpected sender payload should be ignored.");
@@ -293,6 +414,757 @@ int main() {
         "Wildcard bind host with non-loopback remote should not be treated as self endpoint.");
     wildcard_bind_host.Shutdown();
 
+    novaria::net::NetServiceUdpPeer redundancy_host;
+    novaria::net::UdpTransport raw_peer;
+    passed &= Expect(redundancy_host.Initialize(error), "Redundancy host init should succeed.");
+    passed &= Expect(raw_peer.Open(0, error), "Raw peer transport open should succeed.");
+    redundancy_host.SetRemoteEndpoint({.host = "127.0.0.1", .port = raw_peer.LocalPort()});
+    redundancy_host.RequestConnect();
+    redundancy_host.Tick({.tick_index = 1, .fixed_delta_seconds = 1.0 / 60.0});
+    passed &= Expect(
+        SendRawDatagram(
+            raw_peer,
+            redundancy_host.LocalPort(),
+            novaria::wire::MessageKind::Control,
+            {2},
+            error),
+        "Raw peer should send handshake ack.");
+    for (std::uint64_t tick = 2; tick <= 200; ++tick) {
+        redundancy_host.Tick({.tick_index = tick, .fixed_delta_seconds = 1.0 / 60.0});
+        if (redundancy_host.SessionState() == novaria::net::NetSessionState::Connected) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        redundancy_host.SessionState() == novaria::net::NetSessionState::Connected,
+        "Redundancy host should connect to raw peer.");
+
+    for (int index = 0; index < 3; ++index) {
+        redundancy_host.SubmitLocalCommand({
+            .player_id = 5,
+            .command_id = novaria::sim::command::kJump,
+            .payload = {},
+        });
+    }
+    novaria::wire::ByteBuffer outbound_batch;
+    for (int index = 0; index < 3; ++index) {
+        passed &= Expect(
+            ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::Command, outbound_batch),
+            "Raw peer should receive every outbound command datagram.");
+    }
+    passed &= Expect(
+        outbound_batch == BuildRawCommandBatch(5, 1, 3),
+        "Outbound command datagram should redundantly carry all unacked commands.");
+
+    passed &= Expect(
+        SendRawDatagram(
+            raw_peer,
+            redundancy_host.LocalPort(),
+            novaria::wire::MessageKind::ChunkSnapshotBatch,
+            BuildRawCommandAckBatch(5, 2),
+            error),
+        "Raw peer should send command ack batch.");
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    redundancy_host.Tick({.tick_index = 3, .fixed_delta_seconds = 1.0 / 60.0});
+    redundancy_host.SubmitLocalCommand({
+        .player_id = 5,
+        .command_id = novaria::sim::command::kJump,
+        .payload = {},
+    });
+    passed &= Expect(
+        ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::Command, outbound_batch) &&
+            outbound_batch == BuildRawCommandBatch(5, 3, 2),
+        "Acked commands should no longer be carried in outbound datagrams.");
+    std::vector<novaria::net::PlayerCommand> redundancy_local_commands;
+    redundancy_host.ConsumeRemoteCommands(redundancy_local_commands);
+    passed &= Expect(
+        redundancy_local_commands.size() == 4 &&
+            redundancy_local_commands.front().sequence == 1 &&
+            redundancy_local_commands.back().sequence == 4,
+        "Local command copies should carry their assigned sequence.");
+    passed &= Expect(
+        redundancy_host.DiagnosticsSnapshot().redundant_command_send_count == 4,
+        "Redundant command copies should update diagnostics.");
+
+    for (const auto& [first_sequence, command_count] :
+         std::vector<std::pair<std::uint32_t, std::uint32_t>>{{1, 2}, {1, 3}, {5, 1}}) {
+        passed &= Expect(
+            SendRawDatagram(
+                raw_peer,
+                redundancy_host.LocalPort(),
+                novaria::wire::MessageKind::Command,
+                BuildRawCommandBatch(9, first_sequence, command_count),
+                error),
+            "Raw peer should send redundant command batch.");
+    }
+    std::vector<novaria::net::PlayerCommand> deduped_commands;
+    std::vector<novaria::net::PlayerCommand> consumed_batch;
+    for (int attempt = 0; attempt < 200 && deduped_commands.size() < 4; ++attempt) {
+        redundancy_host.Tick({.tick_index = 4, .fixed_delta_seconds = 1.0 / 60.0});
+        redundancy_host.ConsumeRemoteCommands(consumed_batch);
+        for (auto& command : consumed_batch) {
+            deduped_commands.push_back(std::move(command));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        deduped_commands.size() == 4 &&
+            deduped_commands[0].sequence == 1 &&
+            deduped_commands[1].sequence == 2 &&
+            deduped_commands[2].sequence == 3 &&
+            deduped_commands[3].sequence == 5 &&
+            deduped_commands[3].player_id == 9,
+        "Authority should dedupe redundant commands by sequence.");
+    const novaria::net::NetDiagnosticsSnapshot redundancy_diagnostics =
+        redundancy_host.DiagnosticsSnapshot();
+    passed &= Expect(
+        redundancy_diagnostics.duplicate_command_count == 2 &&
+            redundancy_diagnostics.lost_command_count == 1,
+        "Duplicate and lost command sequences should update diagnostics.");
+
+    redundancy_host.Tick({.tick_index = 5, .fixed_delta_seconds = 1.0 / 60.0});
+    novaria::wire::ByteBuffer ack_batch;
+    passed &= Expect(
+        ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::ChunkSnapshotBatch, ack_batch) &&
+            ack_batch == BuildRawCommandAckBatch(9, 5),
+        "Receiver should ack highest accepted command sequence without waiting for world snapshots.");
+
+    const std::vector<novaria::wire::ByteBuffer> entity_states = {{0x01, 0x02}, {0x03}};
+    redundancy_host.PublishEntityStates(
+        20,
+        entity_states,
+        {novaria::net::kBroadcastEntityStateRecipient, novaria::net::kBroadcastEntityStateRecipient});
+    novaria::wire::ByteBuffer entity_state_batch;
+    passed &= Expect(
+        ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::EntityStateBatch, entity_state_batch) &&
+            entity_state_batch == BuildRawEntityStateBatch(20, entity_states),
+        "Authority should publish entity states as one tick-stamped batch.");
+
+    const novaria::wire::ByteBuffer large_player_state(700, 0x11);
+    const novaria::wire::ByteBuffer remote_client_delta(700, 0x22);
+    const novaria::wire::ByteBuffer other_client_delta(8, 0x33);
+    redundancy_host.PublishEntityStates(
+        21,
+        {large_player_state, remote_client_delta, other_client_delta},
+        {novaria::net::kBroadcastEntityStateRecipient, 9, 12});
+    novaria::wire::ByteBuffer first_split_batch;
+    novaria::wire::ByteBuffer second_split_batch;
+    passed &= Expect(
+        ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::EntityStateBatch, first_split_batch) &&
+            ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::EntityStateBatch, second_split_batch) &&
+            first_split_batch == BuildRawEntityStateBatch(21, {large_player_state}) &&
+            second_split_batch == BuildRawEntityStateBatch(21, {remote_client_delta}),
+        "Entity states should split into MTU-sized datagrams carrying only this endpoint's client delta.");
+    novaria::wire::ByteBuffer unexpected_batch;
+    passed &= Expect(
+        !ReceiveRawPayload(raw_peer, novaria::wire::MessageKind::EntityStateBatch, unexpected_batch),
+        "Deltas addressed to players behind other endpoints should not be sent.");
+
+    passed &= Expect(
+        SendRawDatagram(
+            raw_peer,
+            redundancy_host.LocalPort(),
+            novaria::wire::MessageKind::EntityStateBatch,
+            BuildRawEntityStateBatch(30, entity_states),
+            error) &&
+            SendRawDatagram(
+                raw_peer,
+                redundancy_host.LocalPort(),
+                novaria::wire::MessageKind::EntityStateBatch,
+                BuildRawEntityStateBatch(29, {{0x04}}),
+                error),
+        "Raw peer should send entity state batches.");
+    std::vector<novaria::net::EntityStateBatch> received_entity_states;
+    for (int attempt = 0; attempt < 200 && received_entity_states.empty(); ++attempt) {
+        redundancy_host.Tick({.tick_index = 6, .fixed_delta_seconds = 1.0 / 60.0});
+        redundancy_host.ConsumeRemoteEntityStates(received_entity_states);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    redundancy_host.Tick({.tick_index = 7, .fixed_delta_seconds = 1.0 / 60.0});
+    std::vector<novaria::net::EntityStateBatch> repeated_entity_states;
+    redundancy_host.ConsumeRemoteEntityStates(repeated_entity_states);
+    passed &= Expect(
+        received_entity_states.size() == 1 &&
+            received_entity_states[0].tick_index == 30 &&
+            received_entity_states[0].entity_states == entity_states &&
+            repeated_entity_states.empty(),
+        "Replica should accept the newest entity state batch only once.");
+    passed &= Expect(
+        redundancy_host.DiagnosticsSnapshot().dropped_remote_entity_state_count == 1,
+        "Stale entity state batch should be dropped and counted.");
+
+    passed &= Expect(
+        SendRawDatagram(
+            raw_peer,
+            redundancy_host.LocalPort(),
+            novaria::wire::MessageKind::EntityStateBatch,
+            BuildRawEntityStateBatch(30, {{0x05}}),
+            error),
+        "Raw peer should send the second datagram of a split tick.");
+    std::vector<novaria::net::EntityStateBatch> split_entity_states;
+    for (int attempt = 0; attempt < 200 && split_entity_states.empty(); ++attempt) {
+        redundancy_host.Tick({.tick_index = 8, .fixed_delta_seconds = 1.0 / 60.0});
+        redundancy_host.ConsumeRemoteEntityStates(split_entity_states);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        split_entity_states.size() == 1 &&
+            split_entity_states[0].tick_index == 30 &&
+            split_entity_states[0].entity_states == std::vector<novaria::wire::ByteBuffer>({{0x05}}),
+        "Replica should accept every datagram of the newest tick.");
+
+    const auto deliver_commands = [&](std::uint32_t first_player_id, std::uint32_t player_count, std::uint64_t tick) {
+        for (std::uint32_t player_id = first_player_id; player_id < first_player_id + player_count; ++player_id) {
+            passed &= Expect(
+                SendRawDatagram(
+                    raw_peer,
+                    redundancy_host.LocalPort(),
+                    novaria::wire::MessageKind::Command,
+                    BuildRawCommandBatch(player_id, 1, 1),
+                    error),
+                "Raw peer should send a new player's command batch.");
+        }
+        std::size_t delivered = 0;
+        std::vector<novaria::net::PlayerCommand> consumed;
+        for (int attempt = 0; attempt < 200 && delivered < player_count; ++attempt) {
+            redundancy_host.Tick({.tick_index = tick, .fixed_delta_seconds = 1.0 / 60.0});
+            redundancy_host.ConsumeRemoteCommands(consumed);
+            delivered += consumed.size();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return delivered;
+    };
+    const std::uint32_t open_stream_count =
+        static_cast<std::uint32_t>(novaria::net::NetServiceUdpPeer::kMaxCommandStreams) - 1;
+    passed &= Expect(
+        deliver_commands(100, open_stream_count, 9) == open_stream_count,
+        "Inbound command streams should be accepted up to the stream cap.");
+    passed &= Expect(
+        deliver_commands(500, 1, 10) == 0 &&
+            redundancy_host.DiagnosticsSnapshot().evicted_command_stream_count == 0,
+        "A new player should be dropped while every tracked stream is still active.");
+    redundancy_host.NotifyHeartbeatReceived(10 + novaria::net::NetServiceUdpPeer::kIdleCommandStreamTicks);
+    passed &= Expect(
+        deliver_commands(500, 1, 10 + novaria::net::NetServiceUdpPeer::kIdleCommandStreamTicks) == 1 &&
+            redundancy_host.DiagnosticsSnapshot().evicted_command_stream_count == 1,
+        "A new player should take over the slot of an idle command stream.");
+
+    // Player 9's stream has accepted sequence 5; fill its per-player receive share without draining it.
+    const std::uint64_t flood_tick = 10 + novaria::net::NetServiceUdpPeer::kIdleCommandStreamTicks;
+    const std::uint32_t per_player_cap =
+        static_cast<std::uint32_t>(novaria::net::NetServiceUdpPeer::kMaxPendingCommandsPerPlayer);
+    const std::uint32_t redundancy =
+        static_cast<std::uint32_t>(novaria::net::NetServiceUdpPeer::kMaxRedundantCommandsPerDatagram);
+    for (std::uint32_t first_sequence = 6; first_sequence < 6 + per_player_cap; first_sequence += redundancy) {
+        passed &= Expect(
+            SendRawDatagram(
+                raw_peer,
+                redundancy_host.LocalPort(),
+                novaria::wire::MessageKind::Command,
+                BuildRawCommandBatch(9, first_sequence, redundancy),
+                error),
+            "Raw peer should send a batch filling the per-player queue.");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        redundancy_host.Tick({.tick_index = flood_tick, .fixed_delta_seconds = 1.0 / 60.0});
+    }
+    const std::uint32_t overflow_sequence = 6 + per_player_cap;
+    const std::size_t queue_full_before =
+        redundancy_host.DiagnosticsSnapshot().dropped_command_player_queue_full_count;
+    passed &= Expect(
+        SendRawDatagram(
+            raw_peer,
+            redundancy_host.LocalPort(),
+            novaria::wire::MessageKind::Command,
+            BuildRawCommandBatch(9, overflow_sequence, 1),
+            error),
+        "Raw peer should send the command that overflows the per-player queue.");
+    for (int attempt = 0;
+         attempt < 200 &&
+         redundancy_host.DiagnosticsSnapshot().dropped_command_player_queue_full_count == queue_full_before;
+         ++attempt) {
+        redundancy_host.Tick({.tick_index = flood_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::vector<novaria::net::PlayerCommand> flooded_commands;
+    redundancy_host.ConsumeRemoteCommands(flooded_commands);
+    passed &= Expect(
+        flooded_commands.size() == per_player_cap &&
+            flooded_commands.back().sequence == overflow_sequence - 1 &&
+            redundancy_host.DiagnosticsSnapshot().dropped_command_player_queue_full_count == queue_full_before + 1,
+        "A command past the per-player cap should be dropped while the queue is full.");
+    const std::vector<novaria::net::NetPlayerCommandDrops> player_command_drops =
+        redundancy_host.DiagnosticsSnapshot().player_command_drops;
+    passed &= Expect(
+        player_command_drops.size() == 1 &&
+            player_command_drops[0].player_id == 9 &&
+            player_command_drops[0].dropped_queue_full_count == 1,
+        "Per-player queue drops should be attributed to the flooding player.");
+
+    passed &= Expect(
+        SendRawDatagram(
+            raw_peer,
+            redundancy_host.LocalPort(),
+            novaria::wire::MessageKind::Command,
+            BuildRawCommandBatch(9, overflow_sequence - redundancy + 1, redundancy),
+            error),
+        "Raw peer should resend its unacked commands redundantly.");
+    std::vector<novaria::net::PlayerCommand> redelivered_commands;
+    for (int attempt = 0; attempt < 200 && redelivered_commands.empty(); ++attempt) {
+        redundancy_host.Tick({.tick_index = flood_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        redundancy_host.ConsumeRemoteCommands(redelivered_commands);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        redelivered_commands.size() == 1 && redelivered_commands[0].sequence == overflow_sequence,
+        "A command dropped for a full queue should stay unacked and arrive with a later redundant resend.");
+    redundancy_host.Shutdown();
+    raw_peer.Close();
+
+    novaria::net::NetLinkEstimator link_estimator;
+    link_estimator.ObserveRttSample(100000);
+    passed &= Expect(
+        link_estimator.Quality().smoothed_rtt_microseconds == 100000 &&
+            link_estimator.Quality().rtt_variance_microseconds == 50000,
+        "First RTT sample should seed smoothed RTT and half-RTT variance.");
+    link_estimator.ObserveRttSample(60000);
+    passed &= Expect(
+        link_estimator.Quality().smoothed_rtt_microseconds == 95000 &&
+            link_estimator.Quality().rtt_variance_microseconds == 47500 &&
+            link_estimator.Quality().min_rtt_microseconds == 60000,
+        "Later RTT samples should follow RFC 6298 smoothing.");
+    link_estimator.ObserveHeartbeatSequence(1);
+    link_estimator.ObserveHeartbeatSequence(2);
+    link_estimator.ObserveHeartbeatSequence(5);
+    link_estimator.ObserveHeartbeatSequence(4);
+    link_estimator.ObserveHeartbeatSequence(5);
+    passed &= Expect(
+        link_estimator.Quality().heartbeat_received_count == 3 &&
+            link_estimator.Quality().heartbeat_lost_count == 2 &&
+            link_estimator.Quality().estimated_loss_rate > 0.0,
+        "Heartbeat sequence gaps should count as loss while late and duplicate heartbeats are ignored.");
+
+    novaria::net::NetServiceUdpPeer latency_host_a;
+    novaria::net::NetServiceUdpPeer latency_host_b;
+    const novaria::net::NetworkImpairmentSettings latency_impairment{
+        .enabled = true,
+        .seed = 3,
+        .latency_ms = 15,
+    };
+    latency_host_a.SetImpairment(latency_impairment);
+    latency_host_b.SetImpairment(latency_impairment);
+    passed &= Expect(
+        latency_host_a.Initialize(error) && latency_host_b.Initialize(error),
+        "Latency hosts should initialize.");
+    latency_host_a.SetRemoteEndpoint({.host = "127.0.0.1", .port = latency_host_b.LocalPort()});
+    latency_host_b.SetRemoteEndpoint({.host = "127.0.0.1", .port = latency_host_a.LocalPort()});
+    latency_host_a.RequestConnect();
+    latency_host_b.RequestConnect();
+    for (std::uint64_t tick = 1;
+         tick <= 600 && latency_host_a.DiagnosticsSnapshot().rtt_sample_count < 2;
+         ++tick) {
+        latency_host_a.Tick({.tick_index = tick, .fixed_delta_seconds = 1.0 / 60.0});
+        latency_host_b.Tick({.tick_index = tick, .fixed_delta_seconds = 1.0 / 60.0});
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const novaria::net::NetDiagnosticsSnapshot latency_diagnostics = latency_host_a.DiagnosticsSnapshot();
+    passed &= Expect(latency_diagnostics.rtt_sample_count >= 2, "Echoed heartbeats should produce RTT samples.");
+    passed &= Expect(
+        latency_diagnostics.min_rtt_microseconds >= 30000 &&
+            latency_diagnostics.smoothed_rtt_microseconds < 1000000,
+        "RTT estimate should include both one-way delays.");
+    passed &= Expect(
+        latency_diagnostics.heartbeat_received_count >= 2 &&
+            latency_diagnostics.heartbeat_lost_count == 0,
+        "Heartbeats over a lossless link should not be counted as lost.");
+
+    const novaria::net::NetMessageKindTraffic& control_traffic =
+        latency_diagnostics.traffic_by_kind[static_cast<std::size_t>(novaria::wire::MessageKind::Control)];
+    passed &= Expect(
+        control_traffic.sent_packet_count > 0 &&
+            control_traffic.sent_byte_count >= control_traffic.sent_packet_count * 3 &&
+            control_traffic.received_packet_count > 0,
+        "Control datagrams should be counted per message kind.");
+    std::uint64_t sent_packet_total = 0;
+    for (const novaria::net::NetMessageKindTraffic& traffic : latency_diagnostics.traffic_by_kind) {
+        sent_packet_total += traffic.sent_packet_count;
+    }
+    std::uint64_t histogram_total = 0;
+    for (const std::uint64_t bucket_count : latency_diagnostics.sent_datagram_size_histogram) {
+        histogram_total += bucket_count;
+    }
+    passed &= Expect(
+        histogram_total == sent_packet_total && latency_diagnostics.sent_datagram_size_histogram[0] > 0,
+        "Datagram size histogram should cover every sent datagram.");
+    latency_host_a.Shutdown();
+    latency_host_b.Shutdown();
+
+    novaria::net::NetServiceUdpPeer clock_host_a;
+    novaria::net::NetServiceUdpPeer clock_host_b;
+    passed &= Expect(
+        clock_host_a.Initialize(error) && clock_host_b.Initialize(error),
+        "Tick clock hosts should initialize.");
+    clock_host_a.SetRemoteEndpoint({.host = "127.0.0.1", .port = clock_host_b.LocalPort()});
+    clock_host_b.SetRemoteEndpoint({.host = "127.0.0.1", .port = clock_host_a.LocalPort()});
+    clock_host_a.RequestConnect();
+    clock_host_b.RequestConnect();
+    constexpr std::uint64_t kClockHostATickOffset = 1000;
+    std::uint64_t clock_tick = 1;
+    for (; clock_tick <= 300 && !clock_host_b.DiagnosticsSnapshot().tick_clock_synced; ++clock_tick) {
+        clock_host_a.Tick({.tick_index = clock_tick + kClockHostATickOffset, .fixed_delta_seconds = 1.0 / 60.0});
+        clock_host_b.Tick({.tick_index = clock_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const novaria::net::NetDiagnosticsSnapshot clock_diagnostics = clock_host_b.DiagnosticsSnapshot();
+    passed &= Expect(
+        clock_diagnostics.tick_clock_synced && clock_tick < novaria::net::NetServiceUdpPeer::kHeartbeatSendIntervalTicks * 3,
+        "Clock-sync heartbeats should converge well before the regular heartbeat cadence.");
+    passed &= Expect(
+        clock_diagnostics.remote_tick_offset > 997.0 && clock_diagnostics.remote_tick_offset < 1002.0,
+        "Tick clock should estimate the remote tick offset from heartbeat ticks.");
+
+    clock_host_b.SubmitLocalCommand({
+        .player_id = 4,
+        .command_id = novaria::sim::command::kJump,
+        .payload = {},
+    });
+    std::vector<novaria::net::PlayerCommand> clock_commands;
+    for (int attempt = 0; attempt < 200 && clock_commands.empty(); ++attempt) {
+        clock_host_a.Tick({.tick_index = clock_tick + kClockHostATickOffset, .fixed_delta_seconds = 1.0 / 60.0});
+        clock_host_a.ConsumeRemoteCommands(clock_commands);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        clock_commands.size() == 1 &&
+            clock_commands.front().target_tick + 3 >= clock_tick + kClockHostATickOffset &&
+            clock_commands.front().target_tick <= clock_tick + kClockHostATickOffset + 3,
+        "Commands from a synced peer should be stamped with the predicted remote arrival tick.");
+    clock_host_a.Shutdown();
+    clock_host_b.Shutdown();
+
+    novaria::net::NetServiceUdpPeer stream_host_a;
+    novaria::net::NetServiceUdpPeer stream_host_b;
+    novaria::net::NetChannelSettings stream_channels{};
+    stream_channels.channels[static_cast<std::size_t>(novaria::net::NetChannel::ChunkStream)]
+        .send_budget_bytes_per_tick = 4096;
+    stream_channels.max_chunk_stream_datagram_bytes = 2048;
+    stream_host_a.SetChannelSettings(stream_channels);
+    passed &= Expect(
+        stream_host_a.Initialize(error) && stream_host_b.Initialize(error),
+        "Chunk stream hosts should initialize.");
+    stream_host_a.SetRemoteEndpoint({.host = "127.0.0.1", .port = stream_host_b.LocalPort()});
+    stream_host_b.SetRemoteEndpoint({.host = "127.0.0.1", .port = stream_host_a.LocalPort()});
+    stream_host_a.RequestConnect();
+    stream_host_b.RequestConnect();
+    std::uint64_t stream_tick = 1;
+    for (; stream_tick <= 20; ++stream_tick) {
+        stream_host_a.Tick({.tick_index = stream_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        stream_host_b.Tick({.tick_index = stream_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        if (stream_host_a.SessionState() == novaria::net::NetSessionState::Connected &&
+            stream_host_b.SessionState() == novaria::net::NetSessionState::Connected) {
+            break;
+        }
+    }
+
+    std::vector<novaria::wire::ByteBuffer> burst_chunks;
+    for (int chunk_x = 0; chunk_x < 16; ++chunk_x) {
+        burst_chunks.push_back(EncodeTestChunkPayload(chunk_x, 0, std::vector<std::uint16_t>(512, 3)));
+    }
+    stream_host_a.PublishWorldSnapshot(stream_tick, burst_chunks);
+    stream_host_a.SubmitLocalCommand({
+        .player_id = 9,
+        .command_id = novaria::sim::command::kJump,
+        .payload = {},
+    });
+    const novaria::net::NetChannelDiagnostics burst_stream =
+        stream_host_a.DiagnosticsSnapshot().channels[static_cast<std::size_t>(
+            novaria::net::NetChannel::ChunkStream)];
+    passed &= Expect(
+        burst_stream.queued_send_count > 0 && burst_stream.queued_send_count < burst_chunks.size() &&
+            burst_stream.budget_deferred_count >= 1,
+        "Chunk burst beyond the per-tick budget should stay queued on the chunk stream channel.");
+
+    std::vector<novaria::net::PlayerCommand> stream_commands;
+    std::vector<novaria::wire::ByteBuffer> streamed_chunks;
+    std::vector<novaria::wire::ByteBuffer> streamed_chunks_this_tick;
+    for (int attempt = 0; attempt < 200 && stream_commands.empty(); ++attempt) {
+        stream_host_b.Tick({.tick_index = stream_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        stream_host_b.ConsumeRemoteCommands(stream_commands);
+        stream_host_b.ConsumeRemoteChunkPayloads(streamed_chunks_this_tick);
+        streamed_chunks.insert(
+            streamed_chunks.end(),
+            streamed_chunks_this_tick.begin(),
+            streamed_chunks_this_tick.end());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        stream_commands.size() == 1 && stream_commands.front().player_id == 9,
+        "Command submitted behind a chunk burst should not wait for the burst to drain.");
+    passed &= Expect(
+        streamed_chunks.size() < burst_chunks.size(),
+        "Chunk burst should be paced across ticks by the chunk stream budget.");
+
+    for (int attempt = 0; attempt < 400 && streamed_chunks.size() < burst_chunks.size(); ++attempt) {
+        ++stream_tick;
+        stream_host_a.Tick({.tick_index = stream_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        stream_host_b.Tick({.tick_index = stream_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        stream_host_b.ConsumeRemoteChunkPayloads(streamed_chunks_this_tick);
+        streamed_chunks.insert(
+            streamed_chunks.end(),
+            streamed_chunks_this_tick.begin(),
+            streamed_chunks_this_tick.end());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    passed &= Expect(
+        streamed_chunks == burst_chunks,
+        "Paced chunk stream should deliver every chunk in publish order.");
+    const novaria::net::NetChannelDiagnostics drained_stream =
+        stream_host_a.DiagnosticsSnapshot().channels[static_cast<std::size_t>(
+            novaria::net::NetChannel::ChunkStream)];
+    passed &= Expect(
+        drained_stream.queued_send_count == 0 && drained_stream.sent_datagram_count >= 4,
+        "Chunk stream queue should drain and count its datagrams.");
+    stream_host_a.Shutdown();
+    stream_host_b.Shutdown();
+
+    novaria::net::NetCongestionController congestion_controller;
+    congestion_controller.Configure({
+        .initial_window_bytes_per_tick = 8192,
+        .min_window_bytes_per_tick = 1024,
+        .max_window_bytes_per_tick = 9216,
+        .additive_increase_bytes = 512,
+        .loss_recovery_ticks = 8,
+    });
+    congestion_controller.OnDelivered(0);
+    congestion_controller.OnDelivered(3);
+    congestion_controller.OnDelivered(1);
+    congestion_controller.OnDelivered(1);
+    passed &= Expect(
+        congestion_controller.WindowBytesPerTick() == 9216,
+        "Congestion window should grow additively per feedback and stop at the configured maximum.");
+    congestion_controller.OnLoss(10);
+    congestion_controller.OnLoss(17);
+    passed &= Expect(
+        congestion_controller.WindowBytesPerTick() == 4608 && congestion_controller.LossEventCount() == 1,
+        "Losses within one recovery period should halve the congestion window once.");
+    congestion_controller.OnLoss(18);
+    congestion_controller.OnLoss(26);
+    congestion_controller.OnLoss(34);
+    passed &= Expect(
+        congestion_controller.WindowBytesPerTick() == 1024 && congestion_controller.LossEventCount() == 4,
+        "Repeated loss events should not shrink the congestion window below its minimum.");
+
+    novaria::net::NetServiceUdpPeer window_host_a;
+    novaria::net::NetServiceUdpPeer window_host_b;
+    novaria::net::NetChannelSettings window_channels{};
+    window_channels.channels[static_cast<std::size_t>(novaria::net::NetChannel::ChunkStream)]
+        .receive_queue_limit = 4;
+    window_host_a.SetChannelSettings(window_channels);
+    window_host_b.SetChannelSettings(window_channels);
+    passed &= Expect(
+        window_host_a.Initialize(error) && window_host_b.Initialize(error),
+        "Flow-controlled chunk stream hosts should initialize.");
+    window_host_a.SetRemoteEndpoint({.host = "127.0.0.1", .port = window_host_b.LocalPort()});
+    window_host_b.SetRemoteEndpoint({.host = "127.0.0.1", .port = window_host_a.LocalPort()});
+    window_host_a.RequestConnect();
+    window_host_b.RequestConnect();
+    std::uint64_t window_tick = 1;
+    for (; window_tick <= 20; ++window_tick) {
+        window_host_a.Tick({.tick_index = window_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        window_host_b.Tick({.tick_index = window_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        if (window_host_a.SessionState() == novaria::net::NetSessionState::Connected &&
+            window_host_b.SessionState() == novaria::net::NetSessionState::Connected) {
+            break;
+        }
+    }
+
+    std::vector<novaria::wire::ByteBuffer> window_chunks;
+    for (int chunk_x = 0; chunk_x < 10; ++chunk_x) {
+        window_chunks.push_back(EncodeTestChunkPayload(chunk_x, 1, std::vector<std::uint16_t>(64, 2)));
+    }
+    window_host_a.PublishWorldSnapshot(window_tick, window_chunks);
+    for (int attempt = 0; attempt < 20; ++attempt) {
+        ++window_tick;
+        window_host_b.Tick({.tick_index = window_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        window_host_a.Tick({.tick_index = window_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const novaria::net::NetDiagnosticsSnapshot stalled_receiver = window_host_b.DiagnosticsSnapshot();
+    const novaria::net::NetDiagnosticsSnapshot stalled_sender = window_host_a.DiagnosticsSnapshot();
+    passed &= Expect(
+        stalled_receiver.channels[static_cast<std::size_t>(novaria::net::NetChannel::ChunkStream)]
+                    .pending_receive_count == 4 &&
+            stalled_receiver.dropped_remote_chunk_payload_queue_full_count == 0,
+        "Sender should stop at the receiver-advertised window instead of overflowing its queue.");
+    passed &= Expect(
+        stalled_sender.chunk_stream_flow.remote_receive_window_chunks == 0 &&
+            stalled_sender.chunk_stream_flow.receive_window_deferred_count > 0 &&
+            stalled_sender.channels[static_cast<std::size_t>(novaria::net::NetChannel::ChunkStream)]
+                    .queued_send_count == 6,
+        "Closed receive window should hold remaining chunks in the send queue.");
+
+    std::vector<novaria::wire::ByteBuffer> window_received;
+    std::vector<novaria::wire::ByteBuffer> window_received_this_tick;
+    for (int attempt = 0; attempt < 200 && window_received.size() < window_chunks.size(); ++attempt) {
+        ++window_tick;
+        window_host_b.ConsumeRemoteChunkPayloads(window_received_this_tick);
+        window_received.insert(
+            window_received.end(),
+            window_received_this_tick.begin(),
+            window_received_this_tick.end());
+        window_host_b.Tick({.tick_index = window_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        window_host_a.Tick({.tick_index = window_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const novaria::net::NetDiagnosticsSnapshot drained_receiver = window_host_b.DiagnosticsSnapshot();
+    passed &= Expect(
+        window_received == window_chunks &&
+            drained_receiver.dropped_remote_chunk_payload_queue_full_count == 0 &&
+            drained_receiver.chunk_stream_flow.feedback_sent_count >= 3,
+        "Reopened receive window should deliver the rest of the stream in order without drops.");
+    window_host_a.Shutdown();
+    window_host_b.Shutdown();
+
+    novaria::net::NetServiceUdpPeer lossy_host_a;
+    novaria::net::NetServiceUdpPeer lossy_host_b;
+    novaria::net::NetChannelSettings lossy_channels{};
+    lossy_channels.channels[static_cast<std::size_t>(novaria::net::NetChannel::ChunkStream)]
+        .send_budget_bytes_per_tick = 0;
+    lossy_channels.max_chunk_stream_datagram_bytes = 256;
+    lossy_host_a.SetChannelSettings(lossy_channels);
+    passed &= Expect(
+        lossy_host_a.Initialize(error) && lossy_host_b.Initialize(error),
+        "Lossy chunk stream hosts should initialize.");
+    lossy_host_a.SetRemoteEndpoint({.host = "127.0.0.1", .port = lossy_host_b.LocalPort()});
+    lossy_host_b.SetRemoteEndpoint({.host = "127.0.0.1", .port = lossy_host_a.LocalPort()});
+    lossy_host_a.RequestConnect();
+    lossy_host_b.RequestConnect();
+    std::uint64_t lossy_tick = 1;
+    for (; lossy_tick <= 20; ++lossy_tick) {
+        lossy_host_a.Tick({.tick_index = lossy_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        lossy_host_b.Tick({.tick_index = lossy_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        if (lossy_host_a.SessionState() == novaria::net::NetSessionState::Connected &&
+            lossy_host_b.SessionState() == novaria::net::NetSessionState::Connected) {
+            break;
+        }
+    }
+    const std::size_t initial_congestion_window =
+        lossy_host_a.DiagnosticsSnapshot().chunk_stream_flow.congestion_window_bytes_per_tick;
+    lossy_host_a.SetImpairment({.enabled = true, .seed = 11, .loss_rate = 0.5});
+
+    std::vector<novaria::wire::ByteBuffer> lossy_chunks;
+    for (int chunk_x = 0; chunk_x < 64; ++chunk_x) {
+        lossy_chunks.push_back(EncodeTestChunkPayload(chunk_x, 2, std::vector<std::uint16_t>(64, 1)));
+    }
+    std::vector<novaria::wire::ByteBuffer> lossy_received;
+    for (int attempt = 0; attempt < 30; ++attempt) {
+        ++lossy_tick;
+        lossy_host_a.PublishWorldSnapshot(lossy_tick, lossy_chunks);
+        lossy_host_a.Tick({.tick_index = lossy_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        lossy_host_b.Tick({.tick_index = lossy_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        lossy_host_b.ConsumeRemoteChunkPayloads(lossy_received);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const novaria::net::NetChunkStreamFlowDiagnostics lossy_flow =
+        lossy_host_a.DiagnosticsSnapshot().chunk_stream_flow;
+    passed &= Expect(
+        lossy_flow.reported_lost_batch_count > 0 &&
+            lossy_flow.congestion_loss_event_count > 0 &&
+            lossy_flow.congestion_window_bytes_per_tick < initial_congestion_window,
+        "Receiver-reported batch loss should shrink the chunk stream congestion window.");
+    passed &= Expect(
+        lossy_host_b.DiagnosticsSnapshot().dropped_remote_chunk_payload_queue_full_count == 0,
+        "Congestion-controlled stream should not overflow the receiver queue.");
+    lossy_host_a.Shutdown();
+    lossy_host_b.Shutdown();
+
+    novaria::net::NetServiceUdpPeer steady_host;
+    novaria::net::NetServiceUdpPeer steady_client;
+    passed &= Expect(steady_host.Initialize(error), "Steady-state host init should succeed.");
+    passed &= Expect(steady_client.Initialize(error), "Steady-state client init should succeed.");
+    steady_host.SetRemoteEndpoint({.host = "127.0.0.1", .port = steady_client.LocalPort()});
+    steady_client.SetRemoteEndpoint({.host = "127.0.0.1", .port = steady_host.LocalPort()});
+    steady_host.RequestConnect();
+    steady_client.RequestConnect();
+    std::uint64_t steady_tick = 1;
+    for (; steady_tick <= 20; ++steady_tick) {
+        steady_host.Tick({.tick_index = steady_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        steady_client.Tick({.tick_index = steady_tick, .fixed_delta_seconds = 1.0 / 60.0});
+        if (steady_host.SessionState() == novaria::net::NetSessionState::Connected &&
+            steady_client.SessionState() == novaria::net::NetSessionState::Connected) {
+            break;
+        }
+    }
+    passed &= Expect(
+        steady_host.SessionState() == novaria::net::NetSessionState::Connected &&
+            steady_client.SessionState() == novaria::net::NetSessionState::Connected,
+        "Steady-state peers should connect.");
+
+    const std::vector<novaria::wire::ByteBuffer> steady_dirty_chunks = {
+        EncodeTestChunkPayload(1, 2, std::vector<std::uint16_t>(64, 3)),
+    };
+    const std::vector<novaria::wire::ByteBuffer> steady_entity_states = {
+        novaria::wire::ByteBuffer(24, 1),
+        novaria::wire::ByteBuffer(40, 2),
+    };
+    const std::vector<std::uint32_t> steady_recipients = {novaria::net::kBroadcastEntityStateRecipient, 7};
+    const novaria::net::PlayerCommand steady_command{
+        .player_id = 7,
+        .command_id = novaria::sim::command::kPlayerMotionInput,
+        .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+            .move_axis_milli = 1000,
+            .input_flags = 0,
+        }),
+    };
+    std::vector<novaria::wire::ByteBuffer> steady_received_chunks;
+    std::vector<novaria::net::EntityStateBatch> steady_received_entity_states;
+    std::vector<novaria::net::PlayerCommand> steady_received_commands;
+    std::vector<novaria::net::PlayerCommand> steady_local_commands;
+    std::size_t steady_chunk_count = 0;
+    std::size_t steady_entity_state_batch_count = 0;
+    std::size_t steady_command_count = 0;
+    const auto run_steady_ticks = [&](int tick_count) {
+        std::size_t allocations = 0;
+        for (int tick = 0; tick < tick_count; ++tick, ++steady_tick) {
+            novaria::net::PlayerCommand command = steady_command;
+            g_allocation_count = 0;
+            g_count_allocations = true;
+            steady_client.SubmitLocalCommand(std::move(command));
+            steady_host.PublishWorldSnapshot(steady_tick, steady_dirty_chunks);
+            steady_host.PublishEntityStates(steady_tick, steady_entity_states, steady_recipients);
+            steady_host.Tick({.tick_index = steady_tick, .fixed_delta_seconds = 1.0 / 60.0});
+            steady_client.Tick({.tick_index = steady_tick, .fixed_delta_seconds = 1.0 / 60.0});
+            steady_client.ConsumeRemoteChunkPayloads(steady_received_chunks);
+            steady_client.ConsumeRemoteEntityStates(steady_received_entity_states);
+            steady_host.ConsumeRemoteCommands(steady_received_commands);
+            steady_client.ConsumeRemoteCommands(steady_local_commands);
+            g_count_allocations = false;
+            allocations += g_allocation_count;
+            steady_chunk_count += steady_received_chunks.size();
+            steady_entity_state_batch_count += steady_received_entity_states.size();
+            steady_command_count += steady_received_commands.size();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+        return allocations;
+    };
+    (void)run_steady_ticks(240);
+    steady_chunk_count = 0;
+    steady_entity_state_batch_count = 0;
+    steady_command_count = 0;
+    const std::size_t steady_allocations = run_steady_ticks(240);
+    passed &= Expect(
+        steady_chunk_count > 0 && steady_entity_state_batch_count > 0 && steady_command_count > 0,
+        "Steady-state loopback should keep delivering chunks, entity states and commands.");
+    passed &= Expect(
+        steady_allocations == 0,
+        "Peer Tick, publish and consume should not heap-allocate once buffers are warm.");
+    if (steady_allocations != 0) {
+        std::cerr << "[INFO] steady-state peer allocations: " << steady_allocations << '\n';
+    }
+    steady_host.Shutdown();
+    steady_client.Shutdown();
+
     novaria::net::NetServiceUdpPeer invalid_bind_host;
     invalid_bind_host.SetBindHost("not-an-ipv4-host");
     passed &= Expect(
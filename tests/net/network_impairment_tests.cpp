@@ -0,0 +1,241 @@
+#include "net/network_impairment.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+const novaria::net::UdpEndpoint kEndpoint{.host = "127.0.0.1", .port = 27000};
+
+std::vector<std::string> SubmitAndDrain(
+    novaria::net::NetworkImpairment& impairment,
+    std::uint32_t count,
+    std::uint64_t interval_microseconds) {
+    for (std::uint32_t index = 0; index < count; ++index) {
+        impairment.Submit(index * interval_microseconds, kEndpoint, std::to_string(index));
+    }
+
+    std::vector<std::string> delivered;
+    novaria::net::ImpairedDatagram datagram;
+    while (impairment.PopDue(~0ULL, datagram)) {
+        delivered.push_back(datagram.payload);
+    }
+    return delivered;
+}
+
+bool TestLatencyAndJitterBounds() {
+    bool passed = true;
+
+    novaria::net::NetworkImpairment impairment;
+    impairment.Configure({.enabled = true, .seed = 3, .latency_ms = 50, .jitter_ms = 10});
+    impairment.Submit(0, kEndpoint, "probe");
+
+    novaria::net::ImpairedDatagram datagram;
+    passed &= Expect(!impairment.PopDue(39999, datagram), "Datagram should not release before latency - jitter.");
+    passed &= Expect(impairment.PopDue(60000, datagram), "Datagram should release by latency + jitter.");
+    passed &= Expect(
+        datagram.payload == "probe" && datagram.endpoint.port == kEndpoint.port,
+        "Released datagram should keep payload and endpoint.");
+    passed &= Expect(!impairment.HasQueued(), "Queue should be empty after release.");
+    return passed;
+}
+
+bool TestSeedIsReproducible() {
+    bool passed = true;
+
+    const novaria::net::NetworkImpairmentSettings settings{
+        .enabled = true,
+        .seed = 42,
+        .latency_ms = 20,
+        .jitter_ms = 15,
+        .loss_rate = 0.1,
+        .duplicate_rate = 0.05,
+        .reorder_rate = 0.05,
+    };
+    novaria::net::NetworkImpairment first;
+    novaria::net::NetworkImpairment second;
+    first.Configure(settings);
+    second.Configure(settings);
+    const std::vector<std::string> first_delivered = SubmitAndDrain(first, 500, 1000);
+    const std::vector<std::string> second_delivered = SubmitAndDrain(second, 500, 1000);
+    passed &= Expect(first_delivered == second_delivered, "Same seed should reproduce the same delivery.");
+
+    novaria::net::NetworkImpairmentSettings other_settings = settings;
+    other_settings.seed = 43;
+    novaria::net::NetworkImpairment other;
+    other.Configure(other_settings);
+    passed &= Expect(
+        SubmitAndDrain(other, 500, 1000) != first_delivered,
+        "Different seed should produce a different delivery.");
+
+    first.Configure(settings);
+    passed &= Expect(
+        SubmitAndDrain(first, 500, 1000) == first_delivered,
+        "Reconfiguring should restart the random stream.");
+    return passed;
+}
+
+bool TestLossDuplicateAndReorder() {
+    bool passed = true;
+
+    novaria::net::NetworkImpairment impairment;
+    impairment.Configure({
+        .enabled = true,
+        .seed = 9,
+        .latency_ms = 5,
+        .loss_rate = 0.1,
+        .duplicate_rate = 0.05,
+        .reorder_rate = 0.05,
+        .reorder_delay_ms = 30,
+    });
+    const std::vector<std::string> delivered = SubmitAndDrain(impairment, 10000, 1000);
+    const novaria::net::NetworkImpairmentDiagnostics diagnostics = impairment.DiagnosticsSnapshot();
+
+    passed &= Expect(
+        diagnostics.dropped_loss_count > 800 && diagnostics.dropped_loss_count < 1200,
+        "Random loss should track configured rate.");
+    passed &= Expect(
+        diagnostics.duplicated_datagram_count > 300 && diagnostics.duplicated_datagram_count < 650,
+        "Duplication should track configured rate.");
+    passed &= Expect(
+        diagnostics.reordered_datagram_count > 300 && diagnostics.reordered_datagram_count < 650,
+        "Reordering should track configured rate.");
+    passed &= Expect(
+        delivered.size() ==
+            10000 - diagnostics.dropped_loss_count + diagnostics.duplicated_datagram_count,
+        "Delivered count should equal submitted - dropped + duplicated.");
+
+    bool out_of_order = false;
+    for (std::size_t index = 1; index < delivered.size(); ++index) {
+        out_of_order |= std::stoul(delivered[index]) < std::stoul(delivered[index - 1]);
+    }
+    passed &= Expect(out_of_order, "Reordered datagrams should arrive behind later ones.");
+    return passed;
+}
+
+bool TestGilbertElliottBurstLoss() {
+    bool passed = true;
+
+    novaria::net::NetworkImpairment impairment;
+    impairment.Configure({
+        .enabled = true,
+        .seed = 11,
+        .burst_enter_rate = 0.01,
+        .burst_exit_rate = 0.2,
+        .burst_loss_rate = 1.0,
+    });
+
+    std::uint64_t previous_dropped = 0;
+    std::uint32_t run_length = 0;
+    std::uint32_t run_count = 0;
+    std::uint32_t longest_run = 0;
+    for (std::uint32_t index = 0; index < 20000; ++index) {
+        impairment.Submit(index, kEndpoint, "x");
+        const std::uint64_t dropped = impairment.DiagnosticsSnapshot().dropped_burst_loss_count;
+        if (dropped != previous_dropped) {
+            ++run_length;
+        } else if (run_length > 0) {
+            longest_run = std::max(longest_run, run_length);
+            ++run_count;
+            run_length = 0;
+        }
+        previous_dropped = dropped;
+    }
+
+    const novaria::net::NetworkImpairmentDiagnostics diagnostics = impairment.DiagnosticsSnapshot();
+    passed &= Expect(diagnostics.burst_enter_count > 0, "Burst state should be entered.");
+    passed &= Expect(diagnostics.dropped_loss_count == 0, "Good state without loss rate should not drop.");
+    passed &= Expect(run_count > 0, "Burst loss should produce loss runs.");
+    passed &= Expect(
+        diagnostics.dropped_burst_loss_count >= 3ULL * run_count && longest_run >= 10,
+        "Burst losses should be clustered into multi-datagram runs.");
+    return passed;
+}
+
+bool TestBandwidthCapAndQueueLimit() {
+    bool passed = true;
+
+    novaria::net::NetworkImpairment impairment;
+    impairment.Configure({
+        .enabled = true,
+        .seed = 1,
+        .bandwidth_bytes_per_second = 1000,
+        .max_queued_bytes = 1000,
+    });
+    const std::string payload(100, 'b');
+    for (int index = 0; index < 12; ++index) {
+        impairment.Submit(0, kEndpoint, payload);
+    }
+
+    novaria::net::NetworkImpairmentDiagnostics diagnostics = impairment.DiagnosticsSnapshot();
+    passed &= Expect(diagnostics.queued_datagram_count == 10, "Queue byte limit should cap queued datagrams.");
+    passed &= Expect(diagnostics.dropped_queue_full_count == 2, "Datagrams beyond the queue limit should drop.");
+    passed &= Expect(
+        diagnostics.bandwidth_delayed_datagram_count == 9,
+        "Datagrams behind a busy link should be counted as delayed.");
+
+    novaria::net::ImpairedDatagram datagram;
+    std::uint32_t released_by_half_second = 0;
+    while (impairment.PopDue(500000, datagram)) {
+        ++released_by_half_second;
+    }
+    passed &= Expect(released_by_half_second == 5, "Bandwidth cap should serialize datagrams over time.");
+    std::uint32_t released_by_one_second = 0;
+    while (impairment.PopDue(1000000, datagram)) {
+        ++released_by_one_second;
+    }
+    passed &= Expect(released_by_one_second == 5, "Remaining datagrams should drain once the link frees.");
+    return passed;
+}
+
+bool TestDisabledPassThroughAndValidation() {
+    bool passed = true;
+
+    novaria::net::NetworkImpairment impairment;
+    impairment.Configure({.enabled = false, .latency_ms = 100, .loss_rate = 1.0});
+    impairment.Submit(10, kEndpoint, "direct");
+    novaria::net::ImpairedDatagram datagram;
+    passed &= Expect(impairment.PopDue(10, datagram), "Disabled impairment should release immediately.");
+
+    std::string error;
+    passed &= Expect(
+        novaria::net::ValidateNetworkImpairmentSettings({.loss_rate = 0.5}, error) && error.empty(),
+        "Valid settings should pass validation.");
+    passed &= Expect(
+        !novaria::net::ValidateNetworkImpairmentSettings({.loss_rate = 1.5}, error) && !error.empty(),
+        "Out-of-range rate should fail validation.");
+    passed &= Expect(
+        !novaria::net::ValidateNetworkImpairmentSettings({.latency_ms = 60000}, error),
+        "Excessive latency should fail validation.");
+    return passed;
+}
+
+}  // namespace
+
+int main() {
+    bool passed = true;
+    passed &= TestLatencyAndJitterBounds();
+    passed &= TestSeedIsReproducible();
+    passed &= TestLossDuplicateAndReorder();
+    passed &= TestGilbertElliottBurstLoss();
+    passed &= TestBandwidthCapAndQueueLimit();
+    passed &= TestDisabledPassThroughAndValidation();
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "[PASS] novaria_network_impairment_tests\n";
+    return 0;
+}
@@ -1,5 +1,8 @@
 #include "net/udp_transport.h"
 
+#include "net/network_impairment.h"
+
+#include <array>
 #include <chrono>
 #include <iostream>
 #include <string>
@@ -50,33 +53,34 @@ int main() {
         .port = receiver.LocalPort(),
     };
     passed &= Expect(
-        sender.SendTo(receiver_endpoint, "novaria_udp_transport_ping", error),
+        sender.SendTo(receiver_endpoint, "novaria_udp_transport_ping").IsOk(),
         "Sender should transmit datagram to receiver.");
-    passed &= Expect(error.empty(), "Datagram send should not return error.");
 
     bool got_payload = false;
     std::string received_payload;
     novaria::net::UdpEndpoint sender_endpoint{};
 
     passed &= Expect(
-        sender.SendTo({.host = "127.0.0.1", .port = 65534}, "unreachable_probe", error),
+        sender.SendTo({.host = "127.0.0.1", .port = 65534}, "unreachable_probe").IsOk(),
         "Send to unreachable loopback port should still succeed on UDP.");
-    passed &= Expect(error.empty(), "Unreachable probe send should not return error.");
 
     for (int index = 0; index < 8; ++index) {
-        (void)sender.Receive(received_payload, sender_endpoint, error);
+        const novaria::core::Status probe_status = sender.Receive(received_payload, sender_endpoint);
         passed &= Expect(
-            error.empty(),
+            probe_status.Code() == novaria::core::StatusCode::WouldBlock,
             "Unreachable probe should not produce hard receive error.");
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
     for (int index = 0; index < 200; ++index) {
-        if (receiver.Receive(received_payload, sender_endpoint, error)) {
+        const novaria::core::Status receive_status = receiver.Receive(received_payload, sender_endpoint);
+        if (receive_status.IsOk()) {
             got_payload = true;
             break;
         }
-        passed &= Expect(error.empty(), "Receive polling without payload should not produce error.");
+        passed &= Expect(
+            receive_status.Code() == novaria::core::StatusCode::WouldBlock,
+            "Receive polling without payload should report would-block.");
         std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
@@ -89,17 +93,78 @@ int main() {
         "Sender endpoint host should resolve as loopback.");
     passed &= Expect(sender_endpoint.port != 0, "Sender endpoint port should be non-zero.");
 
+    const novaria::core::Status invalid_send_status =
+        sender.SendTo({.host = "not-an-ipv4-host", .port = receiver.LocalPort()}, "bad");
     passed &= Expect(
-        !sender.SendTo({.host = "not-an-ipv4-host", .port = receiver.LocalPort()}, "bad", error),
+        invalid_send_status.Code() == novaria::core::StatusCode::InvalidArgument,
         "Invalid endpoint host should fail datagram send.");
-    passed &= Expect(!error.empty(), "Invalid endpoint failure should return readable error.");
+    passed &= Expect(
+        !invalid_send_status.Message().empty(),
+        "Invalid endpoint failure should return readable error.");
+
+    const std::string gather_head = "novaria_";
+    const std::string gather_body = "udp_transport_";
+    const std::string gather_tail = "gather";
+    const std::array<novaria::wire::ByteSpan, 4> gather_segments{
+        novaria::wire::ByteSpan(reinterpret_cast<const novaria::wire::Byte*>(gather_head.data()), gather_head.size()),
+        novaria::wire::ByteSpan(),
+        novaria::wire::ByteSpan(reinterpret_cast<const novaria::wire::Byte*>(gather_body.data()), gather_body.size()),
+        novaria::wire::ByteSpan(reinterpret_cast<const novaria::wire::Byte*>(gather_tail.data()), gather_tail.size()),
+    };
+    passed &= Expect(
+        sender.SendGatherTo(receiver_endpoint, gather_segments).IsOk(),
+        "Gather send should transmit segments as one datagram.");
+    bool got_gather_payload = false;
+    for (int index = 0; index < 200 && !got_gather_payload; ++index) {
+        got_gather_payload = receiver.Receive(received_payload, sender_endpoint).IsOk();
+        if (!got_gather_payload) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    passed &= Expect(
+        got_gather_payload && received_payload == "novaria_udp_transport_gather",
+        "Gathered datagram should arrive as the concatenation of its segments.");
+
+    novaria::net::UdpTransport impaired_sender;
+    passed &= Expect(impaired_sender.Open(0, error), "Impaired sender should open on ephemeral port.");
+    impaired_sender.SetImpairment({.enabled = true, .seed = 7, .latency_ms = 40});
+    const auto impaired_send_time = std::chrono::steady_clock::now();
+    passed &= Expect(
+        impaired_sender.SendTo(receiver_endpoint, "novaria_udp_transport_delayed").IsOk(),
+        "Impaired sender should accept datagram into its delay queue.");
+    passed &= Expect(
+        impaired_sender.ImpairmentDiagnostics().queued_datagram_count == 1,
+        "Delayed datagram should stay queued until its release time.");
+
+    bool got_delayed_payload = false;
+    for (int index = 0; index < 500 && !got_delayed_payload; ++index) {
+        (void)impaired_sender.FlushImpairedDatagrams();
+        got_delayed_payload = receiver.Receive(received_payload, sender_endpoint).IsOk();
+        if (!got_delayed_payload) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    const auto delayed_elapsed = std::chrono::steady_clock::now() - impaired_send_time;
+    passed &= Expect(
+        got_delayed_payload && received_payload == "novaria_udp_transport_delayed",
+        "Receiver should eventually get the delayed datagram.");
+    passed &= Expect(
+        delayed_elapsed >= std::chrono::milliseconds(40),
+        "Impaired datagram should not arrive before configured latency.");
+    passed &= Expect(
+        impaired_sender.ImpairmentDiagnostics().delivered_datagram_count == 1,
+        "Impairment diagnostics should count delivered datagram.");
+    impaired_sender.Close();
 
     receiver.Close();
     passed &= Expect(!receiver.IsOpen(), "Receiver close should reset open state.");
+    const novaria::core::Status closed_receive_status = receiver.Receive(received_payload, sender_endpoint);
     passed &= Expect(
-        !receiver.Receive(received_payload, sender_endpoint, error),
+        closed_receive_status.Code() == novaria::core::StatusCode::NotInitialized,
         "Receive after close should fail.");
-    passed &= Expect(!error.empty(), "Receive after close should return readable error.");
+    passed &= Expect(
+        !closed_receive_status.Message().empty(),
+        "Receive after close should return readable error.");
 
     sender.Close();
     passed &= Expect(!sender.IsOpen(), "Sender close should reset open state.");
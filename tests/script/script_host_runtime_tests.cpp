@@ -32,6 +32,16 @@ bool TestRejectInvalidScriptModuleMetadata() {
         !error.empty(),
         "Mismatched script API version should return readable error.");
 
+    passed &= Expect(
+        !runtime->SetScriptModules(
+            {{
+                .module_name = "mod_string_payload_api",
+                .api_version = "0.1.0",
+                .source_code = "novaria = novaria or {}",
+            }},
+            error),
+        "Modules written against the string event payload API should be rejected.");
+
     passed &= Expect(
         !runtime->SetScriptModules(
             {{
@@ -64,6 +74,27 @@ bool TestRejectInvalidScriptModuleMetadata() {
         !error.empty(),
         "Unsupported script capability should return readable error.");
 
+    passed &= Expect(
+        !runtime->SetScriptModules(
+            {{
+                .module_name = "mod_bad_event_subscription",
+                .api_version = novaria::script::kScriptApiVersion,
+                .capabilities = {"event.receive:gameplay.unknown"},
+                .source_code = "novaria = novaria or {}",
+            }},
+            error),
+        "Subscription to an unknown script event should be rejected.");
+    passed &= Expect(
+        runtime->SetScriptModules(
+            {{
+                .module_name = "mod_event_subscription",
+                .api_version = novaria::script::kScriptApiVersion,
+                .capabilities = {"event.receive:gameplay.pickup", "tick.receive"},
+                .source_code = "novaria = novaria or {}",
+            }},
+            error),
+        "Subscription to a known script event should be accepted.");
+
     return passed;
 }
 
@@ -120,7 +151,11 @@ int main() {
         passed &= Expect(
             descriptor.active_event_handler_count == 1,
             "Runtime descriptor should expose active event handler count.");
-        runtime->DispatchEvent({.event_name = "runtime.luajit.test", .payload = "payload"});
+        runtime->DispatchEvent({
+            .id = novaria::script::ScriptEventId::GameplayProgress,
+            .tick_index = 2,
+            .payload = novaria::script::GameplayProgressEventPayload{.milestone = "collect_wood"},
+        });
         runtime->Tick({.tick_index = 3, .fixed_delta_seconds = 1.0 / 60.0});
         runtime->Shutdown();
     }
@@ -137,7 +172,7 @@ int main() {
                     "end\n"
                     "function novaria_on_event(event_name, payload)\n"
                     "  novaria = novaria or {}\n"
-                    "  novaria.callback_a = event_name .. payload\n"
+                    "  novaria.callback_a = event_name .. payload.milestone\n"
                     "end\n",
             },
              {
@@ -149,7 +184,7 @@ int main() {
                      "end\n"
                      "function novaria_on_event(event_name, payload)\n"
                      "  novaria = novaria or {}\n"
-                     "  novaria.callback_b = payload .. event_name\n"
+                     "  novaria.callback_b = payload.milestone .. event_name\n"
                      "end\n",
              }},
             error),
@@ -170,11 +205,59 @@ int main() {
         passed &= Expect(
             callback_descriptor.active_event_handler_count == 2,
             "Multi-module runtime should keep both event handlers active.");
-        callback_bus_runtime->DispatchEvent({.event_name = "event", .payload = "payload"});
+        callback_bus_runtime->DispatchEvent({
+            .id = novaria::script::ScriptEventId::GameplayProgress,
+            .tick_index = 4,
+            .payload = novaria::script::GameplayProgressEventPayload{.milestone = "craft_sword"},
+        });
         callback_bus_runtime->Tick({.tick_index = 5, .fixed_delta_seconds = 1.0 / 60.0});
     }
     callback_bus_runtime->Shutdown();
 
+    auto subscription_runtime = novaria::runtime::CreateScriptHost();
+    passed &= Expect(
+        subscription_runtime->SetScriptModules(
+            {{
+                .module_name = "mod_pickup_listener",
+                .api_version = novaria::script::kScriptApiVersion,
+                .capabilities = {"event.receive:gameplay.pickup"},
+                .source_code =
+                    "local seen = \"\"\n"
+                    "function novaria_on_event(event_name, payload)\n"
+                    "  seen = seen .. event_name .. \":\" .. payload.player .. \"/\" .. payload.amount ..\n"
+                    "    \"/\" .. payload.branch .. \"@\" .. payload.tick .. \";\"\n"
+                    "end\n"
+                    "function read_seen(request)\n"
+                    "  return seen\n"
+                    "end\n",
+            }},
+            error),
+        "Event subscription runtime should accept staged modules.");
+    const bool subscription_init_ok = subscription_runtime->Initialize(error);
+    passed &= Expect(subscription_init_ok, "Event subscription runtime should initialize.");
+    if (subscription_init_ok) {
+        subscription_runtime->DispatchEvent({
+            .id = novaria::script::ScriptEventId::GameplayProgress,
+            .tick_index = 6,
+            .payload = novaria::script::GameplayProgressEventPayload{.milestone = "collect_wood"},
+        });
+        subscription_runtime->DispatchEvent({
+            .id = novaria::script::ScriptEventId::GameplayPickup,
+            .tick_index = 6,
+            .payload = novaria::script::GameplayPickupEventPayload{.player_id = 7, .material_id = 2, .amount = 3},
+        });
+        subscription_runtime->Tick({.tick_index = 6, .fixed_delta_seconds = 1.0 / 60.0});
+
+        novaria::wire::ByteBuffer response;
+        passed &= Expect(
+            subscription_runtime->TryCallModuleFunction("mod_pickup_listener", "read_seen", {}, response).IsOk(),
+            "Subscription probe rpc should succeed.");
+        passed &= Expect(
+            std::string(response.begin(), response.end()) == "gameplay.pickup:7/3/stack@6;",
+            "Module should receive only its subscribed event, with a materialized payload table.");
+    }
+    subscription_runtime->Shutdown();
+
     auto bad_module_runtime = novaria::runtime::CreateScriptHost();
     passed &= Expect(
         bad_module_runtime->SetScriptModules(
@@ -29,28 +29,25 @@ public:
         (void)chunk_coord;
     }
 
-    bool ApplyTileMutation(const novaria::world::TileMutation& mutation, std::string& out_error) override {
+    novaria::core::Status ApplyTileMutation(const novaria::world::TileMutation& mutation) override {
         (void)mutation;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
 
-    bool BuildChunkSnapshot(
+    novaria::core::Status BuildChunkSnapshot(
         const novaria::world::ChunkCoord& chunk_coord,
-        novaria::world::ChunkSnapshot& out_snapshot,
-        std::string& out_error) const override {
+        novaria::world::ChunkSnapshot& out_snapshot) const override {
         (void)chunk_coord;
         out_snapshot = {};
-        out_error = "EmptyWorldService does not support snapshots.";
-        return false;
+        return novaria::core::Status::Error(
+            novaria::core::StatusCode::Unavailable,
+            "EmptyWorldService does not support snapshots.");
     }
 
-    bool ApplyChunkSnapshot(
-        const novaria::world::ChunkSnapshot& snapshot,
-        std::string& out_error) override {
+    novaria::core::Status ApplyChunkSnapshot(
+        const novaria::world::ChunkSnapshot& snapshot) override {
         (void)snapshot;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
 
     bool TryReadTile(int tile_x, int tile_y, std::uint16_t& out_material_id) const override {
@@ -60,12 +57,21 @@ public:
         return true;
     }
 
-    std::vector<novaria::world::ChunkCoord> LoadedChunkCoords() const override {
-        return {};
+    void LoadedChunkCoords(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) const override {
+        out_chunk_coords.clear();
     }
 
-    std::vector<novaria::world::ChunkCoord> ConsumeDirtyChunks() override {
-        return {};
+    void ConsumeDirtyChunks(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) override {
+        out_chunk_coords.clear();
+    }
+
+    void CaptureState(novaria::world::WorldState& out_state) const override {
+        out_state.chunks.clear();
+    }
+
+    novaria::core::Status RestoreState(const novaria::world::WorldState& state) override {
+        (void)state;
+        return novaria::core::Status::Ok();
     }
 };
 
@@ -241,6 +247,67 @@ bool TestDropSpawnAndPickupProbeProducesGameplayEvent() {
     return passed;
 }
 
+bool TestReplicatedEntitiesUseStableNetworkIds() {
+    bool passed = true;
+
+    novaria::sim::ecs::Runtime runtime;
+    EmptyWorldService world;
+    std::string error;
+    passed &= Expect(runtime.Initialize(error), "ECS runtime should initialize.");
+
+    const novaria::sim::command::FireProjectilePayload payload{
+        .origin_tile_x = -40,
+        .origin_tile_y = 0,
+        .velocity_milli_x = -1000,
+        .velocity_milli_y = 0,
+        .damage = 1,
+        .lifetime_ticks = 1,
+        .faction = 1,
+    };
+    runtime.QueueSpawnProjectile(7, payload);
+    runtime.QueueSpawnWorldDrop({.tile_x = 3, .tile_y = 4, .material_id = novaria::world::material::kStone, .amount = 2});
+    runtime.Tick({.tick_index = 0, .fixed_delta_seconds = 1.0 / 60.0}, world);
+
+    std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> entities = runtime.ReplicatedEntities();
+    passed &= Expect(entities.size() == 3, "Hostile, projectile and drop should be replicated.");
+    if (entities.size() == 3) {
+        passed &= Expect(
+            entities[0].network_id == 1 &&
+                entities[0].kind == novaria::sim::ecs::ReplicatedEntityKind::Hostile &&
+                entities[0].health == 20,
+            "Training hostile should own the first network id.");
+        passed &= Expect(
+            entities[1].network_id == 2 &&
+                entities[1].kind == novaria::sim::ecs::ReplicatedEntityKind::Projectile &&
+                entities[1].owner_player_id == 7 &&
+                entities[1].velocity_x == -1.0F,
+            "Projectile should expose owner and velocity.");
+        passed &= Expect(
+            entities[2].network_id == 3 &&
+                entities[2].kind == novaria::sim::ecs::ReplicatedEntityKind::Drop &&
+                entities[2].material_id == novaria::world::material::kStone &&
+                entities[2].amount == 2,
+            "Drop should expose material and amount.");
+    }
+
+    for (std::uint64_t tick_index = 1; tick_index < 4; ++tick_index) {
+        runtime.Tick({.tick_index = tick_index, .fixed_delta_seconds = 1.0 / 60.0}, world);
+    }
+    runtime.QueueSpawnProjectile(7, payload);
+    runtime.Tick({.tick_index = 4, .fixed_delta_seconds = 1.0 / 60.0}, world);
+
+    entities = runtime.ReplicatedEntities();
+    passed &= Expect(entities.size() == 3, "Expired projectile should leave the replicated set.");
+    if (entities.size() == 3) {
+        passed &= Expect(
+            entities[2].network_id == 4,
+            "Network ids should not be reused after an entity is destroyed.");
+    }
+
+    runtime.Shutdown();
+    return passed;
+}
+
 }  // namespace
 
 int main() {
@@ -248,6 +315,7 @@ int main() {
     passed &= TestProjectilePipelineCompletesKillFlow();
     passed &= TestProjectileLifetimeRecycleWithoutCollision();
     passed &= TestDropSpawnAndPickupProbeProducesGameplayEvent();
+    passed &= TestReplicatedEntitiesUseStableNetworkIds();
 
     if (!passed) {
         return 1;
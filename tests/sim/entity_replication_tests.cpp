@@ -0,0 +1,374 @@
+#include "sim/entity_replication.h"
+
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace {
+
+bool Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+novaria::sim::ecs::ReplicatedEntitySnapshot MakeDrop(
+    std::uint32_t network_id,
+    float position_x,
+    float position_y) {
+    return novaria::sim::ecs::ReplicatedEntitySnapshot{
+        .network_id = network_id,
+        .kind = novaria::sim::ecs::ReplicatedEntityKind::Drop,
+        .position_x = position_x,
+        .position_y = position_y,
+        .material_id = 3,
+        .amount = 1,
+    };
+}
+
+bool DecodeDelta(const novaria::wire::ByteBuffer& encoded, novaria::sim::EntityDelta& out_delta) {
+    return novaria::sim::TryDecodeEntityDelta(
+        novaria::wire::ByteSpan(encoded.data(), encoded.size()),
+        out_delta);
+}
+
+bool TestEntityDeltaCodecRoundTrip() {
+    bool passed = true;
+
+    novaria::sim::EntityDelta delta{
+        .recipient_player_id = 2,
+        .has_baseline = true,
+        .baseline_tick = 4000,
+        .removed_network_ids = {3, 9, 10},
+        .updates = {},
+    };
+    delta.updates.push_back({
+        .field_mask = novaria::sim::kEntityDeltaFieldAll,
+        .values = {
+            .network_id = 4,
+            .kind = novaria::sim::ecs::ReplicatedEntityKind::Projectile,
+            .position_x = -640,
+            .position_y = 128,
+            .velocity_x = 288,
+            .velocity_y = 0,
+            .health = 0,
+            .owner_player_id = 2,
+        },
+    });
+    delta.updates.push_back({
+        .field_mask = novaria::sim::kEntityDeltaFieldPosition | novaria::sim::kEntityDeltaFieldHealth,
+        .values = {.network_id = 12, .position_x = 5, .position_y = -1, .health = -13},
+    });
+
+    const novaria::wire::ByteBuffer encoded = novaria::sim::EncodeEntityDelta(delta);
+    novaria::sim::EntityStateType state_type = novaria::sim::EntityStateType::PlayerState;
+    passed &= Expect(
+        novaria::sim::TryPeekEntityStateType(
+            novaria::wire::ByteSpan(encoded.data(), encoded.size()),
+            state_type) &&
+            state_type == novaria::sim::EntityStateType::EntityDelta,
+        "Encoded delta should be tagged as an entity delta.");
+
+    novaria::sim::EntityDelta decoded{};
+    passed &= Expect(DecodeDelta(encoded, decoded), "Entity delta should decode.");
+    passed &= Expect(
+        decoded.recipient_player_id == 2 &&
+            decoded.has_baseline &&
+            decoded.baseline_tick == 4000 &&
+            decoded.removed_network_ids == std::vector<std::uint32_t>({3, 9, 10}) &&
+            decoded.updates.size() == 2,
+        "Entity delta header and removals should round-trip.");
+    if (decoded.updates.size() == 2) {
+        const novaria::sim::QuantizedEntityState& created = decoded.updates[0].values;
+        passed &= Expect(
+            created.network_id == 4 &&
+                created.kind == novaria::sim::ecs::ReplicatedEntityKind::Projectile &&
+                created.position_x == -640 &&
+                created.velocity_x == 288 &&
+                created.owner_player_id == 2,
+            "Created entity should round-trip all fields.");
+        const novaria::sim::EntityDeltaUpdate& changed = decoded.updates[1];
+        passed &= Expect(
+            changed.values.network_id == 12 &&
+                changed.field_mask ==
+                    (novaria::sim::kEntityDeltaFieldPosition | novaria::sim::kEntityDeltaFieldHealth) &&
+                changed.values.position_x == 5 &&
+                changed.values.position_y == -1 &&
+                changed.values.health == -13,
+            "Changed entity should carry only masked fields.");
+    }
+
+    novaria::sim::EntityDelta partial_create = delta;
+    partial_create.updates.resize(1);
+    partial_create.updates[0].field_mask = novaria::sim::kEntityDeltaFieldCreated;
+    passed &= Expect(
+        !DecodeDelta(novaria::sim::EncodeEntityDelta(partial_create), decoded),
+        "Created entity without every field should be rejected.");
+
+    novaria::wire::ByteBuffer truncated = encoded;
+    truncated.pop_back();
+    passed &= Expect(!DecodeDelta(truncated, decoded), "Truncated entity delta should be rejected.");
+    return passed;
+}
+
+bool TestSenderDeltasAgainstAckedBaseline() {
+    bool passed = true;
+
+    novaria::sim::EntityReplicationSender sender;
+    novaria::sim::EntityReplicationReceiver receiver;
+    std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> entities{
+        MakeDrop(1, 1.0F, 0.0F),
+        MakeDrop(2, 2.0F, 0.0F),
+        MakeDrop(3, 3.0F, 0.0F),
+    };
+
+    novaria::wire::ByteBuffer encoded;
+    novaria::sim::EntityDelta delta{};
+    passed &= Expect(sender.BuildClientDelta(2, 100, 0.0F, 0.0F, entities, encoded), "Full snapshot should build.");
+    passed &= Expect(DecodeDelta(encoded, delta), "Full snapshot should decode.");
+    passed &= Expect(!delta.has_baseline && delta.updates.size() == 3, "Unacked client should receive every entity.");
+    passed &= Expect(receiver.ApplyDelta(100, delta), "Receiver should apply the full snapshot.");
+    const std::size_t full_bytes = encoded.size();
+
+    entities[1].position_x = 2.5F;
+    passed &= Expect(sender.BuildClientDelta(2, 101, 0.0F, 0.0F, entities, encoded), "Unacked delta should build.");
+    passed &= Expect(DecodeDelta(encoded, delta), "Unacked delta should decode.");
+    passed &= Expect(!delta.has_baseline, "Sender should keep sending full state until an ack arrives.");
+
+    sender.Acknowledge(2, 100);
+    entities.erase(entities.begin());
+    passed &= Expect(sender.BuildClientDelta(2, 102, 0.0F, 0.0F, entities, encoded), "Acked delta should build.");
+    passed &= Expect(DecodeDelta(encoded, delta), "Acked delta should decode.");
+    passed &= Expect(delta.has_baseline && delta.baseline_tick == 100, "Delta should reference the acked baseline.");
+    passed &= Expect(
+        delta.removed_network_ids == std::vector<std::uint32_t>({1}) && delta.updates.size() == 1,
+        "Delta should carry only removed and changed entities.");
+    if (delta.updates.size() == 1) {
+        passed &= Expect(
+            delta.updates[0].values.network_id == 2 &&
+                delta.updates[0].field_mask == novaria::sim::kEntityDeltaFieldPosition &&
+                delta.updates[0].values.position_x == 32,
+            "Changed entity should carry a quantized position offset.");
+    }
+    passed &= Expect(encoded.size() < full_bytes, "Delta should be smaller than the full snapshot.");
+
+    passed &= Expect(receiver.ApplyDelta(102, delta), "Receiver should apply the delta over its baseline.");
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> replicated = receiver.Entities();
+    passed &= Expect(replicated.size() == 2, "Receiver should drop removed entities.");
+    if (replicated.size() == 2) {
+        passed &= Expect(
+            replicated[0].network_id == 2 && std::fabs(replicated[0].position_x - 2.5F) < 1e-6F,
+            "Receiver should reconstruct the moved entity.");
+        passed &= Expect(
+            replicated[1].network_id == 3 && replicated[1].material_id == 3,
+            "Receiver should keep unchanged entities from the baseline.");
+    }
+
+    sender.Acknowledge(2, 102);
+    passed &= Expect(sender.BuildClientDelta(2, 103, 0.0F, 0.0F, entities, encoded), "Idle delta should build.");
+    passed &= Expect(DecodeDelta(encoded, delta), "Idle delta should decode.");
+    passed &= Expect(
+        delta.removed_network_ids.empty() && delta.updates.empty(),
+        "Unchanged entities should not be resent.");
+
+    novaria::sim::EntityDelta orphan_delta = delta;
+    orphan_delta.baseline_tick = 50;
+    passed &= Expect(!receiver.ApplyDelta(104, orphan_delta), "Delta with unknown baseline should be rejected.");
+    passed &= Expect(
+        receiver.DiagnosticsSnapshot().missing_baseline_count == 1,
+        "Missing baseline should be counted.");
+    return passed;
+}
+
+bool TestInterestRadiusKeepsBandwidthFlat() {
+    bool passed = true;
+
+    novaria::sim::EntityReplicationSender sender;
+    sender.SetSettings({.interest_radius_tiles = 16.0F, .max_entities_per_client = 32});
+
+    const auto build_entities = [](std::uint32_t count) {
+        std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> entities;
+        for (std::uint32_t index = 0; index < count; ++index) {
+            entities.push_back(MakeDrop(
+                index + 1,
+                static_cast<float>(index % 64) - 32.0F,
+                static_cast<float>(index / 64) * 0.5F));
+        }
+        return entities;
+    };
+
+    novaria::wire::ByteBuffer small_world_bytes;
+    novaria::wire::ByteBuffer large_world_bytes;
+    passed &= Expect(
+        sender.BuildClientDelta(2, 1, 0.0F, 0.0F, build_entities(256), small_world_bytes),
+        "Small world snapshot should build.");
+    passed &= Expect(
+        sender.BuildClientDelta(3, 1, 0.0F, 0.0F, build_entities(4096), large_world_bytes),
+        "Large world snapshot should build.");
+
+    novaria::sim::EntityDelta large_delta{};
+    passed &= Expect(DecodeDelta(large_world_bytes, large_delta), "Large world snapshot should decode.");
+    passed &= Expect(large_delta.updates.size() == 32, "Per-client budget should cap replicated entities.");
+    bool all_in_radius = true;
+    for (const novaria::sim::EntityDeltaUpdate& update : large_delta.updates) {
+        const float position_x =
+            static_cast<float>(update.values.position_x) / novaria::sim::kReplicatedPositionUnitsPerTile;
+        const float position_y =
+            static_cast<float>(update.values.position_y) / novaria::sim::kReplicatedPositionUnitsPerTile;
+        all_in_radius &= position_x * position_x + position_y * position_y <= 16.0F * 16.0F;
+    }
+    passed &= Expect(all_in_radius, "Only entities inside the interest radius should be replicated.");
+    passed &= Expect(
+        large_world_bytes.size() <= small_world_bytes.size() + 16,
+        "Snapshot size should not grow with total entity count.");
+
+    const novaria::sim::EntityReplicationSenderDiagnostics diagnostics = sender.DiagnosticsSnapshot();
+    passed &= Expect(diagnostics.client_count == 2, "Sender should track one baseline history per client.");
+    passed &= Expect(diagnostics.interest_culled_count > 0, "Out-of-radius entities should be counted.");
+    passed &= Expect(diagnostics.budget_culled_count > 0, "Over-budget entities should be counted.");
+    return passed;
+}
+
+bool TestReceiverRejectsOverflowingDelta() {
+    bool passed = true;
+
+    novaria::sim::EntityReplicationReceiver receiver;
+    novaria::sim::EntityDelta full_snapshot{};
+    full_snapshot.recipient_player_id = 2;
+    full_snapshot.updates.push_back({
+        .field_mask = novaria::sim::kEntityDeltaFieldAll,
+        .values = {
+            .network_id = 7,
+            .kind = novaria::sim::ecs::ReplicatedEntityKind::Hostile,
+            .position_x = std::numeric_limits<std::int32_t>::max() - 4,
+            .position_y = 0,
+            .health = std::numeric_limits<std::int32_t>::min() + 4,
+        },
+    });
+    passed &= Expect(receiver.ApplyDelta(10, full_snapshot), "Full snapshot should apply.");
+
+    const auto make_delta = [](std::uint8_t field_mask, std::int32_t position_x, std::int32_t health) {
+        novaria::sim::EntityDelta delta{};
+        delta.recipient_player_id = 2;
+        delta.has_baseline = true;
+        delta.baseline_tick = 10;
+        delta.updates.push_back({
+            .field_mask = field_mask,
+            .values = {.network_id = 7, .position_x = position_x, .health = health},
+        });
+        return delta;
+    };
+
+    passed &= Expect(
+        !receiver.ApplyDelta(11, make_delta(novaria::sim::kEntityDeltaFieldPosition, 5, 0)),
+        "Position delta past int32 max should be rejected.");
+    passed &= Expect(
+        !receiver.ApplyDelta(11, make_delta(novaria::sim::kEntityDeltaFieldHealth, 0, -5)),
+        "Health delta past int32 min should be rejected.");
+    passed &= Expect(
+        receiver.DiagnosticsSnapshot().rejected_delta_count == 2 && receiver.LastAppliedTick() == 10,
+        "Overflowing deltas should be counted and leave the applied history untouched.");
+
+    passed &= Expect(
+        receiver.ApplyDelta(
+            11,
+            make_delta(novaria::sim::kEntityDeltaFieldPosition | novaria::sim::kEntityDeltaFieldHealth, 4, -4)),
+        "Delta landing exactly on the int32 limits should apply.");
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> entities = receiver.Entities();
+    passed &= Expect(
+        entities.size() == 1 && entities[0].health == std::numeric_limits<std::int32_t>::min(),
+        "In-range delta should accumulate onto the baseline.");
+    return passed;
+}
+
+bool TestSenderFallsBackToFullValueWhenDeltaOverflows() {
+    bool passed = true;
+
+    novaria::sim::EntityReplicationSender sender;
+    novaria::sim::EntityReplicationReceiver receiver;
+    sender.SetSettings({.interest_radius_tiles = std::numeric_limits<float>::max()});
+    std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> entities{
+        {
+            .network_id = 5,
+            .kind = novaria::sim::ecs::ReplicatedEntityKind::Hostile,
+            .position_x = -1.0e9F,
+            .health = std::numeric_limits<std::int32_t>::min() + 1,
+        },
+    };
+
+    novaria::wire::ByteBuffer encoded;
+    novaria::sim::EntityDelta delta{};
+    passed &= Expect(sender.BuildClientDelta(2, 10, 0.0F, 0.0F, entities, encoded), "Full snapshot should build.");
+    passed &= Expect(
+        DecodeDelta(encoded, delta) && receiver.ApplyDelta(10, delta),
+        "Receiver should apply the full snapshot.");
+    sender.Acknowledge(2, 10);
+
+    // Clamped positions span 2^31 and raw health spans the whole int32 range; neither difference fits.
+    entities[0].position_x = 1.0e9F;
+    entities[0].health = std::numeric_limits<std::int32_t>::max();
+    passed &= Expect(sender.BuildClientDelta(2, 11, 0.0F, 0.0F, entities, encoded), "Overflowing delta should build.");
+    passed &= Expect(DecodeDelta(encoded, delta), "Overflowing delta should decode.");
+    passed &= Expect(
+        delta.has_baseline && delta.updates.size() == 1 &&
+            delta.updates[0].field_mask == novaria::sim::kEntityDeltaFieldAll,
+        "Sender should send the full value when a field delta does not fit in int32.");
+    passed &= Expect(receiver.ApplyDelta(11, delta), "Receiver should apply the full value over its baseline.");
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> replicated = receiver.Entities();
+    passed &= Expect(
+        replicated.size() == 1 &&
+            replicated[0].position_x * novaria::sim::kReplicatedPositionUnitsPerTile == 1073741824.0F &&
+            replicated[0].health == std::numeric_limits<std::int32_t>::max(),
+        "Receiver should hold the sender's current values after the full-value update.");
+    return passed;
+}
+
+bool TestSenderLeavesClientsOwnPlayerOutOfDelta() {
+    bool passed = true;
+
+    novaria::sim::EntityReplicationSender sender;
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> entities{
+        MakeDrop(1, 1.0F, 0.0F),
+        novaria::sim::ReplicatedPlayerEntity(2, {.position_x = 0.5F, .position_y = 0.0F}),
+        novaria::sim::ReplicatedPlayerEntity(3, {.position_x = 2.0F, .position_y = 0.0F, .velocity_x = 1.0F}),
+    };
+
+    novaria::wire::ByteBuffer encoded;
+    novaria::sim::EntityDelta delta{};
+    passed &= Expect(sender.BuildClientDelta(2, 1, 0.0F, 0.0F, entities, encoded), "Client delta should build.");
+    passed &= Expect(DecodeDelta(encoded, delta), "Client delta should decode.");
+    passed &= Expect(delta.updates.size() == 2, "Client delta should skip only the recipient's own player.");
+    if (delta.updates.size() == 2) {
+        const novaria::sim::QuantizedEntityState& remote_player = delta.updates[1].values;
+        passed &= Expect(
+            remote_player.network_id == (novaria::sim::kReplicatedPlayerNetworkIdFlag | 3U) &&
+                remote_player.kind == novaria::sim::ecs::ReplicatedEntityKind::Player &&
+                remote_player.owner_player_id == 3 &&
+                remote_player.velocity_x == 64,
+            "Remote players should ride the delta keyed by their flagged player id.");
+    }
+    return passed;
+}
+
+}  // namespace
+
+int main() {
+    bool passed = true;
+    passed &= TestEntityDeltaCodecRoundTrip();
+    passed &= TestSenderDeltasAgainstAckedBaseline();
+    passed &= TestInterestRadiusKeepsBandwidthFlat();
+    passed &= TestReceiverRejectsOverflowingDelta();
+    passed &= TestSenderFallsBackToFullValueWhenDeltaOverflows();
+    passed &= TestSenderLeavesClientsOwnPlayerOutOfDelta();
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "[PASS] novaria_entity_replication_tests\n";
+    return 0;
+}
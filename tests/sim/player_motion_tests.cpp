@@ -1,6 +1,9 @@
+#include "sim/entity_state_codec.h"
 #include "sim/player_motion.h"
+#include "sim/player_motion_prediction.h"
 #include "world/material_catalog.h"
 
+#include <cmath>
 #include <cstdint>
 #include <iostream>
 #include <string>
@@ -39,24 +42,20 @@ public:
     void Tick(const novaria::core::TickContext& tick_context) override { (void)tick_context; }
     void LoadChunk(const novaria::world::ChunkCoord& chunk_coord) override { (void)chunk_coord; }
     void UnloadChunk(const novaria::world::ChunkCoord& chunk_coord) override { (void)chunk_coord; }
-    bool ApplyTileMutation(const novaria::world::TileMutation& mutation, std::string& out_error) override {
+    novaria::core::Status ApplyTileMutation(const novaria::world::TileMutation& mutation) override {
         SetSolidTile(mutation.tile_x, mutation.tile_y, mutation.material_id);
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
-    bool BuildChunkSnapshot(
+    novaria::core::Status BuildChunkSnapshot(
         const novaria::world::ChunkCoord& chunk_coord,
-        novaria::world::ChunkSnapshot& out_snapshot,
-        std::string& out_error) const override {
+        novaria::world::ChunkSnapshot& out_snapshot) const override {
         (void)chunk_coord;
         (void)out_snapshot;
-        out_error = "not implemented";
-        return false;
+        return novaria::core::Status::Error(novaria::core::StatusCode::Unavailable, "not implemented");
     }
-    bool ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot, std::string& out_error) override {
+    novaria::core::Status ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot) override {
         (void)snapshot;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
     bool TryReadTile(int tile_x, int tile_y, std::uint16_t& out_material_id) const override {
         if (bounds_enabled_) {
@@ -73,8 +72,21 @@ public:
         out_material_id = it->second;
         return true;
     }
-    std::vector<novaria::world::ChunkCoord> LoadedChunkCoords() const override { return {}; }
-    std::vector<novaria::world::ChunkCoord> ConsumeDirtyChunks() override { return {}; }
+    void LoadedChunkCoords(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) const override {
+        out_chunk_coords.clear();
+    }
+    void ConsumeDirtyChunks(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) override {
+        out_chunk_coords.clear();
+    }
+
+    void CaptureState(novaria::world::WorldState& out_state) const override {
+        out_state.chunks.clear();
+    }
+
+    novaria::core::Status RestoreState(const novaria::world::WorldState& state) override {
+        (void)state;
+        return novaria::core::Status::Ok();
+    }
 
 private:
     struct PairHash final {
@@ -324,6 +336,149 @@ bool TestResolvePenetrationWhenBlockAppearsInsidePlayer() {
     return passed;
 }
 
+bool TestPredictorReplaysUnackedInputsFromAuthoritativeState() {
+    bool passed = true;
+
+    TestWorldService world;
+    constexpr int kGroundY = 10;
+    for (int x = -32; x <= 32; ++x) {
+        world.SetSolidTile(x, kGroundY, novaria::world::material::kStone);
+    }
+
+    const novaria::sim::PlayerMotionSettings& settings = novaria::sim::DefaultPlayerMotionSettings();
+    constexpr double kDt = 1.0 / 60.0;
+    novaria::sim::PlayerMotionState predicted{};
+    predicted.position_y = static_cast<float>(kGroundY);
+    predicted.on_ground = true;
+    novaria::sim::PlayerMotionState acked_authoritative{};
+
+    novaria::sim::PlayerMotionPredictor predictor;
+    for (std::uint32_t sequence = 1; sequence <= 6; ++sequence) {
+        const novaria::sim::PlayerMotionInput input{
+            .move_axis = sequence <= 3 ? 1.0F : -0.5F,
+            .jump_pressed = sequence == 2,
+        };
+        novaria::sim::UpdatePlayerMotion(input, settings, world, kDt, predicted);
+        predictor.RecordInput(sequence, input, predicted);
+        if (sequence == 3) {
+            acked_authoritative = predicted;
+        }
+    }
+    passed &= Expect(predictor.PendingInputCount() == 6, "Predictor should keep every unacked input.");
+
+    novaria::sim::PlayerMotionState reconciled{};
+    passed &= Expect(
+        predictor.Reconcile(3, acked_authoritative, settings, world, kDt, reconciled),
+        "Reconcile with a newer ack should replay history.");
+    passed &= Expect(
+        std::fabs(reconciled.position_x - predicted.position_x) <= 1e-5F &&
+            std::fabs(reconciled.position_y - predicted.position_y) <= 1e-5F,
+        "Replaying from a matching authoritative state should reproduce the prediction.");
+    passed &= Expect(predictor.PendingInputCount() == 3, "Acked inputs should be dropped from history.");
+
+    novaria::sim::PlayerMotionPredictionDiagnostics diagnostics = predictor.DiagnosticsSnapshot();
+    passed &= Expect(diagnostics.correction_count == 0, "Matching state should not count as a correction.");
+    passed &= Expect(diagnostics.replayed_input_count == 3, "Three unacked inputs should be replayed.");
+
+    novaria::sim::PlayerMotionState diverged = acked_authoritative;
+    diverged.position_x += 2.0F;
+    passed &= Expect(
+        !predictor.Reconcile(2, diverged, settings, world, kDt, reconciled),
+        "Reconcile should ignore a stale ack.");
+    passed &= Expect(
+        !predictor.Reconcile(3, acked_authoritative, settings, world, kDt, reconciled),
+        "Reconcile should skip a repeated ack whose state has not drifted.");
+
+    passed &= Expect(
+        predictor.Reconcile(4, diverged, settings, world, kDt, reconciled),
+        "Reconcile with a newer ack should accept a diverged state.");
+    diagnostics = predictor.DiagnosticsSnapshot();
+    passed &= Expect(diagnostics.correction_count == 1, "Diverged state should count as a correction.");
+    passed &= Expect(
+        diagnostics.last_position_error > 1.0F && diagnostics.max_position_error >= diagnostics.last_position_error,
+        "Prediction error metrics should reflect the divergence.");
+    passed &= Expect(
+        reconciled.position_x > predicted.position_x + 1.0F,
+        "Replayed state should start from the corrected authoritative position.");
+
+    const novaria::sim::PlayerMotionState rebased_from = reconciled;
+    novaria::sim::PlayerMotionState knocked_back = diverged;
+    knocked_back.position_x -= 3.0F;
+    passed &= Expect(
+        predictor.Reconcile(4, knocked_back, settings, world, kDt, reconciled),
+        "Reconcile should re-base on a repeated ack when the authoritative state drifts.");
+    diagnostics = predictor.DiagnosticsSnapshot();
+    passed &= Expect(
+        diagnostics.correction_count == 2 &&
+            diagnostics.reconcile_count == 3 &&
+            std::fabs(diagnostics.last_position_error - 3.0F) <= 1e-5F &&
+            predictor.PendingInputCount() == 2,
+        "Repeated-ack re-base should count a correction without dropping unacked history.");
+    passed &= Expect(
+        std::fabs(reconciled.position_x - (rebased_from.position_x - 3.0F)) <= 1e-3F,
+        "Re-based state should replay the unacked inputs from the drifted authoritative state.");
+    return passed;
+}
+
+bool TestPredictorHistoryIsBounded() {
+    bool passed = true;
+
+    novaria::sim::PlayerMotionPredictor predictor;
+    const std::uint32_t input_count =
+        static_cast<std::uint32_t>(novaria::sim::PlayerMotionPredictor::kHistoryCapacity) + 10;
+    for (std::uint32_t sequence = 1; sequence <= input_count; ++sequence) {
+        predictor.RecordInput(sequence, novaria::sim::PlayerMotionInput{}, novaria::sim::PlayerMotionState{});
+    }
+
+    const novaria::sim::PlayerMotionPredictionDiagnostics diagnostics = predictor.DiagnosticsSnapshot();
+    passed &= Expect(
+        diagnostics.pending_input_count == novaria::sim::PlayerMotionPredictor::kHistoryCapacity,
+        "Prediction history should be capped at its ring capacity.");
+    passed &= Expect(diagnostics.dropped_history_count == 10, "Overflowed inputs should be counted as dropped.");
+    return passed;
+}
+
+bool TestPlayerEntityStateCodecRoundTrip() {
+    bool passed = true;
+
+    const novaria::sim::PlayerEntityState state{
+        .player_id = 7,
+        .acked_command_sequence = 300,
+        .motion = {
+            .position_x = -12.25F,
+            .position_y = 4.5F,
+            .velocity_x = 1.75F,
+            .velocity_y = -9.0F,
+            .on_ground = true,
+        },
+    };
+    const novaria::wire::ByteBuffer encoded = novaria::sim::EncodePlayerEntityState(state);
+    novaria::sim::PlayerEntityState decoded{};
+    passed &= Expect(
+        novaria::sim::TryDecodePlayerEntityState(
+            novaria::wire::ByteSpan(encoded.data(), encoded.size()),
+            decoded),
+        "Player entity state should decode.");
+    passed &= Expect(
+        decoded.player_id == 7 &&
+            decoded.acked_command_sequence == 300 &&
+            decoded.motion.position_x == -12.25F &&
+            decoded.motion.position_y == 4.5F &&
+            decoded.motion.velocity_x == 1.75F &&
+            decoded.motion.velocity_y == -9.0F &&
+            decoded.motion.on_ground,
+        "Player entity state should round-trip exactly.");
+
+    novaria::wire::ByteBuffer truncated = encoded;
+    truncated.pop_back();
+    passed &= Expect(
+        !novaria::sim::TryDecodePlayerEntityState(
+            novaria::wire::ByteSpan(truncated.data(), truncated.size()),
+            decoded),
+        "Truncated player entity state should be rejected.");
+    return passed;
+}
+
 }  // namespace
 
 int main() {
@@ -333,6 +488,9 @@ int main() {
     passed &= TestGroundSnapAcquiresFloorWithoutReachingInTick();
     passed &= TestJumpFromOneTilePitAfterPushing();
     passed &= TestResolvePenetrationWhenBlockAppearsInsidePlayer();
+    passed &= TestPredictorReplaysUnackedInputsFromAuthoritativeState();
+    passed &= TestPredictorHistoryIsBounded();
+    passed &= TestPlayerEntityStateCodecRoundTrip();
 
     if (!passed) {
         return 1;
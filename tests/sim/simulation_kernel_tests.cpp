@@ -1,27 +1,67 @@
 #include "sim/simulation_kernel.h"
+#include "core/thread_affinity.h"
+#include "sim/ecs_runtime.h"
+#include "sim/entity_state_codec.h"
 #include "sim/command_schema.h"
+#include "sim/input_replay.h"
 #include "sim/typed_command.h"
 #include "save/save_repository.h"
 #include "net/net_service_udp_peer.h"
 #include "script/sim_rules_rpc.h"
 #include "world/snapshot_codec.h"
 #include "world/material_catalog.h"
+#include "world/world_service_basic.h"
 
-#include <charconv>
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <new>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace {
 
+bool g_count_allocations = false;
+std::size_t g_allocation_count = 0;
+std::size_t g_ecs_allocation_count = 0;
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    if (g_count_allocations) {
+        // EnTT is third-party: whether its views and storages allocate depends on the vendored version, so
+        // heap use inside the ECS runtime is tallied apart from the repo-owned code around it.
+        ++(novaria::sim::ecs::BackendCallDepth() == 0 ? g_allocation_count : g_ecs_allocation_count);
+    }
+    if (void* memory = std::malloc(size == 0 ? 1 : size); memory != nullptr) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t size) noexcept {
+    (void)size;
+    std::free(memory);
+}
+
+namespace {
+
 bool Expect(bool condition, const char* message) {
     if (!condition) {
         std::cerr << "[FAIL] " << message << '\n';
@@ -41,100 +81,29 @@ struct GameplayProgressPayload {
     std::uint64_t tick_index = 0;
 };
 
-bool TryParseSessionStateChangedPayload(
-    std::string_view payload,
+bool TryGetSessionStateChangedPayload(
+    const novaria::script::ScriptEvent& event_data,
     SessionStateChangedPayload& out_payload) {
-    constexpr std::string_view kStatePrefix = "state=";
-    constexpr std::string_view kTickPrefix = "tick=";
-    constexpr std::string_view kReasonPrefix = "reason=";
-
-    const std::size_t first_separator = payload.find(';');
-    if (first_separator == std::string_view::npos) {
-        return false;
-    }
-
-    const std::size_t second_separator = payload.find(';', first_separator + 1);
-    if (second_separator == std::string_view::npos) {
-        return false;
-    }
-
-    if (payload.find(';', second_separator + 1) != std::string_view::npos) {
-        return false;
-    }
-
-    const std::string_view state_token = payload.substr(0, first_separator);
-    const std::string_view tick_token =
-        payload.substr(first_separator + 1, second_separator - first_separator - 1);
-    const std::string_view reason_token = payload.substr(second_separator + 1);
-    if (state_token.rfind(kStatePrefix, 0) != 0 || tick_token.rfind(kTickPrefix, 0) != 0 ||
-        reason_token.rfind(kReasonPrefix, 0) != 0) {
-        return false;
-    }
-
-    const std::string_view state_value = state_token.substr(kStatePrefix.size());
-    const std::string_view tick_value = tick_token.substr(kTickPrefix.size());
-    const std::string_view reason_value = reason_token.substr(kReasonPrefix.size());
-    if (state_value.empty() || tick_value.empty()) {
-        return false;
-    }
-
-    std::uint64_t parsed_tick_index = 0;
-    const std::from_chars_result parse_result =
-        std::from_chars(
-            tick_value.data(),
-            tick_value.data() + tick_value.size(),
-            parsed_tick_index);
-    if (parse_result.ec != std::errc() ||
-        parse_result.ptr != tick_value.data() + tick_value.size()) {
+    if (event_data.id != novaria::script::ScriptEventId::NetSessionStateChanged) {
         return false;
     }
 
-    out_payload.state.assign(state_value);
-    out_payload.tick_index = parsed_tick_index;
-    out_payload.reason.assign(reason_value);
+    const auto& payload = event_data.As<novaria::script::NetSessionStateChangedEventPayload>();
+    out_payload.state = payload.session_state;
+    out_payload.tick_index = event_data.tick_index;
+    out_payload.reason = payload.reason.data();
     return true;
 }
 
-bool TryParseGameplayProgressPayload(
-    std::string_view payload,
+bool TryGetGameplayProgressPayload(
+    const novaria::script::ScriptEvent& event_data,
     GameplayProgressPayload& out_payload) {
-    constexpr std::string_view kMilestonePrefix = "milestone=";
-    constexpr std::string_view kTickPrefix = "tick=";
-
-    const std::size_t separator = payload.find(';');
-    if (separator == std::string_view::npos) {
-        return false;
-    }
-    if (payload.find(';', separator + 1) != std::string_view::npos) {
+    if (event_data.id != novaria::script::ScriptEventId::GameplayProgress) {
         return false;
     }
 
-    const std::string_view milestone_token = payload.substr(0, separator);
-    const std::string_view tick_token = payload.substr(separator + 1);
-    if (milestone_token.rfind(kMilestonePrefix, 0) != 0 ||
-        tick_token.rfind(kTickPrefix, 0) != 0) {
-        return false;
-    }
-
-    const std::string_view milestone_value = milestone_token.substr(kMilestonePrefix.size());
-    const std::string_view tick_value = tick_token.substr(kTickPrefix.size());
-    if (milestone_value.empty() || tick_value.empty()) {
-        return false;
-    }
-
-    std::uint64_t parsed_tick_index = 0;
-    const std::from_chars_result parse_result =
-        std::from_chars(
-            tick_value.data(),
-            tick_value.data() + tick_value.size(),
-            parsed_tick_index);
-    if (parse_result.ec != std::errc() ||
-        parse_result.ptr != tick_value.data() + tick_value.size()) {
-        return false;
-    }
-
-    out_payload.milestone.assign(milestone_value);
-    out_payload.tick_index = parsed_tick_index;
+    out_payload.milestone = event_data.As<novaria::script::GameplayProgressEventPayload>().milestone;
+    out_payload.tick_index = event_data.tick_index;
     return true;
 }
 
@@ -197,33 +166,28 @@ public:
         unloaded_chunks.push_back(chunk_coord);
     }
 
-    bool ApplyTileMutation(const novaria::world::TileMutation& mutation, std::string& out_error) override {
+    novaria::core::Status ApplyTileMutation(const novaria::world::TileMutation& mutation) override {
         applied_tile_mutations.push_back(mutation);
         tiles[{mutation.tile_x, mutation.tile_y}] = mutation.material_id;
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
 
-    bool BuildChunkSnapshot(
+    novaria::core::Status BuildChunkSnapshot(
         const novaria::world::ChunkCoord& chunk_coord,
-        novaria::world::ChunkSnapshot& out_snapshot,
-        std::string& out_error) const override {
+        novaria::world::ChunkSnapshot& out_snapshot) const override {
         for (const auto& snapshot : available_snapshots) {
             if (snapshot.chunk_coord.x == chunk_coord.x && snapshot.chunk_coord.y == chunk_coord.y) {
                 out_snapshot = snapshot;
-                out_error.clear();
-                return true;
+                return novaria::core::Status::Ok();
             }
         }
 
-        out_error = "snapshot not found";
-        return false;
+        return novaria::core::Status::Error(novaria::core::StatusCode::NotFound, "snapshot not found");
     }
 
-    bool ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot, std::string& out_error) override {
+    novaria::core::Status ApplyChunkSnapshot(const novaria::world::ChunkSnapshot& snapshot) override {
         applied_snapshots.push_back(snapshot);
-        out_error.clear();
-        return true;
+        return novaria::core::Status::Ok();
     }
 
     bool TryReadTile(
@@ -240,16 +204,27 @@ public:
         return true;
     }
 
-    std::vector<novaria::world::ChunkCoord> LoadedChunkCoords() const override {
-        return loaded_chunks;
+    void LoadedChunkCoords(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) const override {
+        out_chunk_coords.assign(loaded_chunks.begin(), loaded_chunks.end());
     }
 
-    std::vector<novaria::world::ChunkCoord> ConsumeDirtyChunks() override {
+    void ConsumeDirtyChunks(std::vector<novaria::world::ChunkCoord>& out_chunk_coords) override {
+        out_chunk_coords.clear();
         if (dirty_batch_cursor >= dirty_batches.size()) {
-            return {};
+            return;
         }
 
-        return dirty_batches[dirty_batch_cursor++];
+        const std::vector<novaria::world::ChunkCoord>& batch = dirty_batches[dirty_batch_cursor++];
+        out_chunk_coords.assign(batch.begin(), batch.end());
+    }
+
+    void CaptureState(novaria::world::WorldState& out_state) const override {
+        out_state.chunks.clear();
+    }
+
+    novaria::core::Status RestoreState(const novaria::world::WorldState& state) override {
+        (void)state;
+        return novaria::core::Status::Ok();
     }
 };
 
@@ -259,6 +234,7 @@ public:
     bool initialize_called = false;
     bool shutdown_called = false;
     bool auto_progress_connection = true;
+    bool record_publications = true;
     int tick_count = 0;
     int connect_request_count = 0;
     int disconnect_request_count = 0;
@@ -268,6 +244,12 @@ public:
     std::vector<std::pair<std::uint64_t, std::size_t>> published_snapshots;
     std::vector<std::vector<novaria::wire::ByteBuffer>> published_snapshot_payloads;
     std::vector<novaria::wire::ByteBuffer> pending_remote_chunk_payloads;
+    std::vector<novaria::net::EntityStateBatch> pending_remote_entity_states;
+    std::vector<std::pair<std::uint64_t, std::vector<novaria::wire::ByteBuffer>>> published_entity_states;
+    std::vector<std::vector<std::uint32_t>> published_entity_state_recipients;
+    std::uint32_t next_command_sequence = 1;
+    std::uint64_t last_entity_state_tick = 0;
+    std::size_t last_entity_state_count = 0;
     novaria::net::NetSessionState session_state = novaria::net::NetSessionState::Disconnected;
 
     bool Initialize(std::string& out_error) override {
@@ -323,29 +305,53 @@ public:
         ++tick_count;
     }
 
-    void SubmitLocalCommand(const novaria::net::PlayerCommand& command) override {
+    std::uint32_t SubmitLocalCommand(novaria::net::PlayerCommand command) override {
+        if (session_state == novaria::net::NetSessionState::Connected) {
+            command.sequence = next_command_sequence++;
+        }
+        const std::uint32_t sequence = command.sequence;
         submitted_commands.push_back(command);
-        pending_remote_commands.push_back(command);
+        pending_remote_commands.push_back(std::move(command));
+        return sequence;
+    }
+
+    void ConsumeRemoteCommands(std::vector<novaria::net::PlayerCommand>& out_commands) override {
+        out_commands.clear();
+        out_commands.swap(pending_remote_commands);
     }
 
-    std::vector<novaria::net::PlayerCommand> ConsumeRemoteCommands() override {
-        std::vector<novaria::net::PlayerCommand> commands = std::move(pending_remote_commands);
-        pending_remote_commands.clear();
-        return commands;
+    void ConsumeRemoteChunkPayloads(std::vector<novaria::wire::ByteBuffer>& out_payloads) override {
+        out_payloads.clear();
+        out_payloads.swap(pending_remote_chunk_payloads);
     }
 
-    std::vector<novaria::wire::ByteBuffer> ConsumeRemoteChunkPayloads() override {
-        std::vector<novaria::wire::ByteBuffer> payloads = std::move(pending_remote_chunk_payloads);
-        pending_remote_chunk_payloads.clear();
-        return payloads;
+    void ConsumeRemoteEntityStates(std::vector<novaria::net::EntityStateBatch>& out_batches) override {
+        out_batches.clear();
+        out_batches.swap(pending_remote_entity_states);
     }
 
     void PublishWorldSnapshot(
         std::uint64_t tick_index,
         const std::vector<novaria::wire::ByteBuffer>& encoded_dirty_chunks) override {
+        if (!record_publications) {
+            return;
+        }
         published_snapshots.emplace_back(tick_index, encoded_dirty_chunks.size());
         published_snapshot_payloads.push_back(encoded_dirty_chunks);
     }
+
+    void PublishEntityStates(
+        std::uint64_t tick_index,
+        const std::vector<novaria::wire::ByteBuffer>& encoded_entity_states,
+        const std::vector<std::uint32_t>& recipient_player_ids) override {
+        last_entity_state_tick = tick_index;
+        last_entity_state_count = encoded_entity_states.size();
+        if (!record_publications) {
+            return;
+        }
+        published_entity_states.emplace_back(tick_index, encoded_entity_states);
+        published_entity_state_recipients.push_back(recipient_player_ids);
+    }
 };
 
 class FakeScriptHost final : public novaria::script::IScriptHost {
@@ -354,6 +360,7 @@ class FakeScriptHost final : public novaria::script::IScriptHost {
     bool initialize_called = false;
     bool shutdown_called = false;
     int tick_count = 0;
+    std::chrono::microseconds tick_delay{0};
     std::vector<novaria::script::ScriptEvent> dispatched_events;
 
     bool SetScriptModules(
@@ -381,18 +388,20 @@ class FakeScriptHost final : public novaria::script::IScriptHost {
     void Tick(const novaria::core::TickContext& tick_context) override {
         (void)tick_context;
         ++tick_count;
+        if (tick_delay.count() > 0) {
+            std::this_thread::sleep_for(tick_delay);
+        }
     }
 
     void DispatchEvent(const novaria::script::ScriptEvent& event_data) override {
         dispatched_events.push_back(event_data);
     }
 
-    bool TryCallModuleFunction(
+    novaria::core::Status TryCallModuleFunction(
         std::string_view module_name,
         std::string_view function_name,
         novaria::wire::ByteSpan request_payload,
-        novaria::wire::ByteBuffer& out_response_payload,
-        std::string& out_error) override {
+        novaria::wire::ByteBuffer& out_response_payload) override {
         (void)module_name;
         (void)function_name;
 
@@ -403,8 +412,7 @@ class FakeScriptHost final : public novaria::script::IScriptHost {
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeValidateResponse(true);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         novaria::script::simrpc::ActionPrimaryRequest action_request{};
@@ -469,8 +477,7 @@ class FakeScriptHost final : public novaria::script::IScriptHost {
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeActionPrimaryResponse(result, place_kind, required_ticks);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         novaria::script::simrpc::CraftRecipeRequest craft_request{};
@@ -503,13 +510,13 @@ class FakeScriptHost final : public novaria::script::IScriptHost {
             const novaria::wire::ByteBuffer response_bytes =
                 novaria::script::simrpc::EncodeCraftRecipeResponse(response);
             out_response_payload = response_bytes;
-            out_error.clear();
-            return true;
+            return novaria::core::Status::Ok();
         }
 
         out_response_payload.clear();
-        out_error = "fake script host received unknown simrpc payload";
-        return false;
+        return novaria::core::Status::Error(
+            novaria::core::StatusCode::InvalidArgument,
+            "fake script host received unknown simrpc payload");
     }
 
     novaria::script::ScriptRuntimeDescriptor RuntimeDescriptor() const override {
@@ -729,36 +736,89 @@ bool TestCommandSchemaPayloadParsing() {
             typed_command) &&
             typed_command.type == novaria::sim::TypedPlayerCommandType::GameplayInteraction,
         "Typed command bridge should decode gameplay interaction command.");
+    passed &= Expect(
+        typed_command.As<novaria::sim::command::InteractionPayload>().interaction_type ==
+            novaria::sim::command::kInteractionTypeOpenCrafting,
+        "Typed command payload should hold the decoded interaction fields.");
+    passed &= Expect(
+        novaria::sim::TypedPlayerCommandTypeForId(novaria::sim::command::kWorldUnloadChunk) ==
+                novaria::sim::TypedPlayerCommandType::WorldUnloadChunk &&
+            novaria::sim::TypedPlayerCommandTypeForId(4) == novaria::sim::TypedPlayerCommandType::Unknown &&
+            novaria::sim::TypedPlayerCommandTypeForId(1u << 20) == novaria::sim::TypedPlayerCommandType::Unknown,
+        "Command id table should map known ids and reject gaps and out-of-range ids.");
+    passed &= Expect(
+        !novaria::sim::TryDecodePlayerCommand(
+            novaria::net::PlayerCommand{.player_id = 1, .command_id = 1u << 20, .payload = {}},
+            typed_command) &&
+            typed_command.type == novaria::sim::TypedPlayerCommandType::Unknown,
+        "Typed command bridge should reject out-of-range command ids.");
+
+    struct DispatchProbe final {
+        std::uint32_t last_player_id = 0;
+        int projectile_count = 0;
+
+        void OnFireProjectile(const novaria::sim::TypedPlayerCommand& command, std::uint32_t player_id) {
+            last_player_id = player_id;
+            projectile_count += command.As<novaria::sim::command::FireProjectilePayload>().damage;
+        }
+    };
+    novaria::sim::TypedPlayerCommandHandlerTable<DispatchProbe> probe_handlers{};
+    probe_handlers[static_cast<std::size_t>(novaria::sim::TypedPlayerCommandType::CombatFireProjectile)] =
+        &DispatchProbe::OnFireProjectile;
+    DispatchProbe probe{};
+    passed &= Expect(
+        novaria::sim::DispatchPlayerCommand(
+            novaria::net::PlayerCommand{
+                .player_id = 7,
+                .command_id = novaria::sim::command::kCombatFireProjectile,
+                .payload = fire_projectile_encoded,
+            },
+            probe_handlers,
+            probe,
+            typed_command) &&
+            probe.last_player_id == 7 && probe.projectile_count == 13,
+        "Dispatch should decode and invoke the handler registered for the command type.");
+    passed &= Expect(
+        !novaria::sim::DispatchPlayerCommand(
+            novaria::net::PlayerCommand{
+                .player_id = 7,
+                .command_id = novaria::sim::command::kGameplayInteraction,
+                .payload = interaction_encoded,
+            },
+            probe_handlers,
+            probe,
+            typed_command) &&
+            probe.projectile_count == 13,
+        "Dispatch should skip command types without a registered handler.");
 
     return passed;
 }
 
-bool TestSessionStateChangedPayloadParser() {
+bool TestScriptEventVocabulary() {
     bool passed = true;
 
-    SessionStateChangedPayload payload{};
-    passed &= Expect(
-        TryParseSessionStateChangedPayload(
-            "state=connected;tick=17;reason=tick_connect_complete",
-            payload),
-        "Session state payload parser should accept valid payload.");
-    passed &= Expect(
-        payload.state == "connected" && payload.tick_index == 17 &&
-            payload.reason == "tick_connect_complete",
-        "Session state payload parser should return structured fields.");
+    for (std::size_t index = 0; index < novaria::script::kScriptEventIdCount; ++index) {
+        const auto event_id = static_cast<novaria::script::ScriptEventId>(index);
+        novaria::script::ScriptEventId parsed_id = novaria::script::ScriptEventId::GameplayProgress;
+        passed &= Expect(
+            novaria::script::TryParseScriptEventName(novaria::script::ScriptEventName(event_id), parsed_id) &&
+                parsed_id == event_id,
+            "Every script event id should round-trip through its name.");
+    }
+    novaria::script::ScriptEventId parsed_id = novaria::script::ScriptEventId::GameplayProgress;
     passed &= Expect(
-        !TryParseSessionStateChangedPayload("connected,17,tick_connect_complete", payload),
-        "Session state payload parser should reject legacy CSV payload.");
+        !novaria::script::TryParseScriptEventName("gameplay.unknown", parsed_id),
+        "Unknown script event names should be rejected.");
+
+    novaria::script::ScriptEventText text{};
+    novaria::script::AssignScriptEventText("tick_connect_complete", text);
     passed &= Expect(
-        !TryParseSessionStateChangedPayload(
-            "state=connected;tick=nan;reason=tick_connect_complete",
-            payload),
-        "Session state payload parser should reject non-numeric tick.");
+        std::string_view(text.data()) == "tick_connect_complete",
+        "Short event text should be copied verbatim.");
+    novaria::script::AssignScriptEventText(std::string(text.size() * 2, 'x'), text);
     passed &= Expect(
-        !TryParseSessionStateChangedPayload(
-            "state=connected;tick=17",
-            payload),
-        "Session state payload parser should reject missing reason token.");
+        std::string_view(text.data()).size() == text.size() - 1,
+        "Long event text should be truncated and stay terminated.");
 
     return passed;
 }
@@ -807,8 +867,7 @@ bool TestUpdatePublishesDirtyChunkCount() {
                 novaria::wire::ByteSpan(
                     net.published_snapshot_payloads[0][0].data(),
                     net.published_snapshot_payloads[0][0].size()),
-                decoded_snapshot,
-                decode_error),
+                decoded_snapshot).IsOk(),
             "Encoded chunk payload should be decodable.");
     }
 
@@ -995,11 +1054,11 @@ bool TestNetSessionStateChangeDispatchesScriptEvent() {
     if (script.dispatched_events.size() == 1) {
         SessionStateChangedPayload payload{};
         passed &= Expect(
-            script.dispatched_events[0].event_name == "net.session_state_changed",
+            script.dispatched_events[0].id == novaria::script::ScriptEventId::NetSessionStateChanged,
             "Session change event name should match contract.");
         passed &= Expect(
-            TryParseSessionStateChangedPayload(script.dispatched_events[0].payload, payload),
-            "Session change event payload should be parseable in KV format.");
+            TryGetSessionStateChangedPayload(script.dispatched_events[0], payload),
+            "Session change event should carry a typed payload.");
         passed &= Expect(
             payload.state == "connected" && payload.tick_index == 1 &&
                 payload.reason == "tick_connect_complete",
@@ -1025,8 +1084,8 @@ bool TestNetSessionStateChangeDispatchesScriptEvent() {
     if (script.dispatched_events.size() == 2) {
         SessionStateChangedPayload payload{};
         passed &= Expect(
-            TryParseSessionStateChangedPayload(script.dispatched_events[1].payload, payload),
-            "Reconnect transition payload should be parseable in KV format.");
+            TryGetSessionStateChangedPayload(script.dispatched_events[1], payload),
+            "Reconnect transition should carry a typed payload.");
         passed &= Expect(
             payload.state == "connecting" && payload.tick_index == 2 &&
                 payload.reason == "request_connect",
@@ -1081,7 +1140,7 @@ bool TestNetSessionStateEventsAreCoalescedWithinCooldown() {
     if (script.dispatched_events.size() == 2) {
         SessionStateChangedPayload payload{};
         passed &= Expect(
-            TryParseSessionStateChangedPayload(script.dispatched_events[1].payload, payload),
+            TryGetSessionStateChangedPayload(script.dispatched_events[1], payload),
             "Coalesced transition payload should be parseable.");
         passed &= Expect(
             payload.state == "connected" && payload.tick_index == 3 &&
@@ -1121,8 +1180,7 @@ bool TestReconnectHeartbeatAndSaveDiagnosticsEndToEnd() {
     SessionStateChangedPayload initial_connect_payload{};
     if (!script.dispatched_events.empty()) {
         passed &= Expect(
-            TryParseSessionStateChangedPayload(
-                script.dispatched_events[0].payload,
+            TryGetSessionStateChangedPayload(script.dispatched_events[0],
                 initial_connect_payload),
             "Initial connect payload should be parseable.");
         passed &= Expect(
@@ -1146,7 +1204,7 @@ bool TestReconnectHeartbeatAndSaveDiagnosticsEndToEnd() {
     SessionStateChangedPayload disconnect_payload{};
     if (script.dispatched_events.size() >= 2) {
         passed &= Expect(
-            TryParseSessionStateChangedPayload(script.dispatched_events[1].payload, disconnect_payload),
+            TryGetSessionStateChangedPayload(script.dispatched_events[1], disconnect_payload),
             "Disconnect payload should be parseable.");
         passed &= Expect(
             disconnect_payload.state == "disconnected" &&
@@ -1173,8 +1231,7 @@ bool TestReconnectHeartbeatAndSaveDiagnosticsEndToEnd() {
     bool found_reconnect_event = false;
     for (std::size_t event_index = 2; event_index < script.dispatched_events.size(); ++event_index) {
         SessionStateChangedPayload reconnect_payload{};
-        if (!TryParseSessionStateChangedPayload(
-                script.dispatched_events[event_index].payload,
+        if (!TryGetSessionStateChangedPayload(script.dispatched_events[event_index],
                 reconnect_payload)) {
             continue;
         }
@@ -1212,6 +1269,7 @@ bool TestReconnectHeartbeatAndSaveDiagnosticsEndToEnd() {
         .local_player_id = 42,
         .gameplay_fingerprint = "mods:v1:e2e",
         .cosmetic_fingerprint = std::string(),
+        .world_chunk_payloads = {},
         .debug_net_session_transitions = diagnostics.session_transition_count,
         .debug_net_timeout_disconnects = diagnostics.timeout_disconnect_count,
         .debug_net_manual_disconnects = diagnostics.manual_disconnect_count,
@@ -1334,12 +1392,14 @@ bool TestApplyRemoteChunkPayload() {
 
     std::string error;
     passed &= Expect(
-        !kernel.ApplyRemoteChunkPayload(novaria::wire::ByteSpan(), error),
+        kernel.ApplyRemoteChunkPayload(novaria::wire::ByteSpan()).Code() ==
+            novaria::core::StatusCode::NotInitialized,
         "ApplyRemoteChunkPayload should fail before initialize.");
 
     passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
     passed &= Expect(
-        !kernel.ApplyRemoteChunkPayload(novaria::wire::ByteSpan(reinterpret_cast<const novaria::wire::Byte*>("\x01"), 1), error),
+        !kernel.ApplyRemoteChunkPayload(
+            novaria::wire::ByteSpan(reinterpret_cast<const novaria::wire::Byte*>("\x01"), 1)),
         "ApplyRemoteChunkPayload should fail for invalid payload.");
 
     novaria::world::ChunkSnapshot snapshot{
@@ -1348,10 +1408,10 @@ bool TestApplyRemoteChunkPayload() {
     };
     novaria::wire::ByteBuffer payload;
     passed &= Expect(
-        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload, error),
+        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload).IsOk(),
         "EncodeChunkSnapshot should succeed.");
     passed &= Expect(
-        kernel.ApplyRemoteChunkPayload(novaria::wire::ByteSpan(payload.data(), payload.size()), error),
+        kernel.ApplyRemoteChunkPayload(novaria::wire::ByteSpan(payload.data(), payload.size())).IsOk(),
         "ApplyRemoteChunkPayload should accept valid payload.");
     passed &= Expect(world.applied_snapshots.size() == 1, "World should receive one applied snapshot.");
     if (world.applied_snapshots.size() == 1) {
@@ -1386,7 +1446,7 @@ bool TestUpdateConsumesRemoteChunkPayloads() {
     };
     novaria::wire::ByteBuffer payload;
     passed &= Expect(
-        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload, error),
+        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload).IsOk(),
         "EncodeChunkSnapshot should succeed.");
     net.pending_remote_chunk_payloads.push_back(payload);
     net.pending_remote_chunk_payloads.push_back({0x01, 0x02});
@@ -1438,7 +1498,7 @@ bool TestUpdateSkipsNetExchangeWhenSessionNotConnected() {
     };
     novaria::wire::ByteBuffer remote_payload;
     passed &= Expect(
-        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(remote_snapshot, remote_payload, error),
+        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(remote_snapshot, remote_payload).IsOk(),
         "EncodeChunkSnapshot should succeed.");
     net.pending_remote_chunk_payloads.push_back(remote_payload);
 
@@ -1707,14 +1767,10 @@ bool TestGameplayLoopCommandsReachBossDefeat() {
 
     bool saw_playable_loop_complete_event = false;
     for (const auto& event : script.dispatched_events) {
-        if (event.event_name != "gameplay.progress") {
+        GameplayProgressPayload payload{};
+        if (!TryGetGameplayProgressPayload(event, payload)) {
             continue;
         }
-
-        GameplayProgressPayload payload{};
-        passed &= Expect(
-            TryParseGameplayProgressPayload(event.payload, payload),
-            "Gameplay progress event payload should be parseable.");
         if (payload.milestone == "playable_loop_complete") {
             saw_playable_loop_complete_event = true;
             passed &= Expect(
@@ -1793,20 +1849,19 @@ bool TestGameplayDropPickupAndInteractionDispatchScriptEvents() {
     bool saw_pickup_event = false;
     bool saw_interaction_event = false;
     for (const auto& event : script.dispatched_events) {
-        if (event.event_name == "gameplay.pickup") {
+        if (event.id == novaria::script::ScriptEventId::GameplayPickup) {
             saw_pickup_event = true;
+            const auto& payload = event.As<novaria::script::GameplayPickupEventPayload>();
             passed &= Expect(
-                event.payload.find("player=7") != std::string::npos &&
-                    event.payload.find("material_id=2") != std::string::npos &&
-                    event.payload.find("amount=1") != std::string::npos,
+                payload.player_id == 7 && payload.material_id == 2 && payload.amount == 1,
                 "Gameplay pickup event payload should include pickup fields.");
         }
-        if (event.event_name == "gameplay.interaction") {
+        if (event.id == novaria::script::ScriptEventId::GameplayInteraction) {
             saw_interaction_event = true;
+            const auto& payload = event.As<novaria::script::GameplayInteractionEventPayload>();
             passed &= Expect(
-                event.payload.find("type=open_crafting") != std::string::npos &&
-                    event.payload.find("result=success") != std::string::npos &&
-                    event.payload.find("branch=open_crafting") != std::string::npos,
+                std::string_view(payload.interaction_type) == "open_crafting" &&
+                    std::string_view(payload.result) == "success",
                 "Gameplay interaction event payload should include branch fields.");
         }
     }
@@ -1910,12 +1965,1329 @@ bool TestPlaceRejectedWhenTileOverlapsPlayerCollider() {
     return passed;
 }
 
+bool TestReplicaPredictsAndReconcilesLocalMotion() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+    kernel.SetAuthorityMode(novaria::sim::SimulationAuthorityMode::Replica);
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    kernel.Update(1.0 / 60.0);
+
+    const auto submit_move_right = [&kernel]() {
+        kernel.SubmitLocalCommand({
+            .player_id = 1,
+            .command_id = novaria::sim::command::kPlayerMotionInput,
+            .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+                .move_axis_milli = 1000,
+                .input_flags = 0,
+            }),
+        });
+    };
+
+    for (int tick = 0; tick < 5; ++tick) {
+        submit_move_right();
+        kernel.Update(1.0 / 60.0);
+    }
+
+    const novaria::sim::PlayerMotionSnapshot predicted_motion = kernel.LocalPlayerMotion();
+    passed &= Expect(
+        predicted_motion.position_x > 0.0F,
+        "Replica should predict local motion before authoritative state arrives.");
+    novaria::sim::PlayerMotionPredictionDiagnostics diagnostics = kernel.LocalMotionPredictionDiagnostics();
+    passed &= Expect(diagnostics.pending_input_count == 5, "Replica should record one prediction per sequenced input.");
+
+    const novaria::sim::PlayerEntityState authoritative_state{
+        .player_id = 1,
+        .acked_command_sequence = 2,
+        .motion = {
+            .position_x = 20.0F,
+            .position_y = -2.0F,
+        },
+    };
+    net.pending_remote_entity_states.push_back({
+        .tick_index = 100,
+        .entity_states = {
+            novaria::sim::EncodePlayerEntityState(authoritative_state),
+            novaria::sim::EncodePlayerEntityState({
+                .player_id = 2,
+                .acked_command_sequence = 0,
+                .motion = {.position_x = -5.0F},
+            }),
+        },
+    });
+    submit_move_right();
+    kernel.Update(1.0 / 60.0);
+
+    diagnostics = kernel.LocalMotionPredictionDiagnostics();
+    passed &= Expect(diagnostics.reconcile_count == 1, "Newer ack should trigger one reconciliation.");
+    passed &= Expect(diagnostics.correction_count == 1, "Diverged authoritative state should count as a correction.");
+    passed &= Expect(diagnostics.replayed_input_count == 3, "Unacked inputs after the ack should be replayed.");
+    passed &= Expect(diagnostics.last_position_error > 10.0F, "Prediction error should be exposed.");
+    passed &= Expect(diagnostics.pending_input_count == 4, "History should keep replayed and new inputs.");
+    passed &= Expect(
+        kernel.LocalPlayerMotion().position_x > 20.0F,
+        "Local player should be rewound to authority and replayed forward.");
+
+    net.pending_remote_entity_states.push_back({
+        .tick_index = 101,
+        .entity_states = {novaria::sim::EncodePlayerEntityState(authoritative_state)},
+    });
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        kernel.LocalMotionPredictionDiagnostics().reconcile_count == 1,
+        "Repeated ack should not trigger another reconciliation.");
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestAuthorityPublishesPlayerStatesWithAckedSequence() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    kernel.Update(1.0 / 60.0);
+
+    net.pending_remote_commands.push_back({
+        .player_id = 2,
+        .command_id = novaria::sim::command::kPlayerMotionInput,
+        .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+            .move_axis_milli = -1000,
+            .input_flags = 0,
+        }),
+        .sequence = 9,
+    });
+    net.published_entity_states.clear();
+    kernel.Update(1.0 / 60.0);
+
+    passed &= Expect(net.published_entity_states.size() == 1, "Authority should publish entity states every tick.");
+    if (net.published_entity_states.size() == 1) {
+        const auto& entity_states = net.published_entity_states[0].second;
+        const std::vector<std::uint32_t>& recipients = net.published_entity_state_recipients.back();
+        passed &= Expect(
+            entity_states.size() == 2 && recipients == std::vector<std::uint32_t>({2, 2}),
+            "Authority should address the remote player its own state and its entity delta only.");
+        bool found_remote_player = false;
+        for (const auto& encoded_state : entity_states) {
+            novaria::sim::PlayerEntityState state{};
+            if (!novaria::sim::TryDecodePlayerEntityState(
+                    novaria::wire::ByteSpan(encoded_state.data(), encoded_state.size()),
+                    state)) {
+                continue;
+            }
+            passed &= Expect(state.player_id != 1, "The host player should not be sent as a player state.");
+            if (state.player_id == 2) {
+                found_remote_player = true;
+                passed &= Expect(state.acked_command_sequence == 9, "Published state should carry the applied sequence.");
+                passed &= Expect(state.motion.position_x < 0.0F, "Published state should reflect the applied input.");
+            }
+        }
+        passed &= Expect(found_remote_player, "Remote player state should be published.");
+    }
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestAuthorityJitterBufferExecutesStampedInputsOnTargetTick() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+    kernel.SetInputJitterBufferSettings({
+        .min_delay_ticks = 0,
+        .initial_delay_ticks = 1,
+        .max_delay_ticks = 4,
+    });
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    kernel.Update(1.0 / 60.0);
+
+    const auto acked_sequence_for_player_2 = [&net]() -> std::uint32_t {
+        if (net.published_entity_states.empty()) {
+            return 0;
+        }
+        for (const auto& encoded_state : net.published_entity_states.back().second) {
+            novaria::sim::PlayerEntityState state{};
+            if (novaria::sim::TryDecodePlayerEntityState(
+                    novaria::wire::ByteSpan(encoded_state.data(), encoded_state.size()),
+                    state) &&
+                state.player_id == 2) {
+                return state.acked_command_sequence;
+            }
+        }
+        return 0;
+    };
+    const auto push_motion_input = [&net](std::uint32_t sequence, std::uint64_t target_tick) {
+        net.pending_remote_commands.push_back({
+            .player_id = 2,
+            .command_id = novaria::sim::command::kPlayerMotionInput,
+            .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+                .move_axis_milli = 1000,
+                .input_flags = 0,
+            }),
+            .sequence = sequence,
+            .target_tick = target_tick,
+        });
+    };
+
+    const std::uint64_t arrival_tick = kernel.CurrentTick();
+    push_motion_input(1, arrival_tick + 2);
+    std::vector<std::uint32_t> acked_by_tick;
+    for (int tick = 0; tick < 5; ++tick) {
+        kernel.Update(1.0 / 60.0);
+        acked_by_tick.push_back(acked_sequence_for_player_2());
+    }
+    passed &= Expect(
+        acked_by_tick.size() == 5 &&
+            acked_by_tick[0] == 0 && acked_by_tick[1] == 0 && acked_by_tick[2] == 0 &&
+            acked_by_tick[3] == 1 && acked_by_tick[4] == 1,
+        "Stamped remote input should execute on its target tick plus the player's buffer delay.");
+
+    push_motion_input(2, kernel.CurrentTick() - 3);
+    kernel.Update(1.0 / 60.0);
+    const novaria::sim::InputJitterBufferDiagnostics jitter = kernel.InputJitterBufferDiagnosticsSnapshot();
+    passed &= Expect(
+        acked_sequence_for_player_2() == 2 &&
+            jitter.late_command_count == 1 &&
+            jitter.on_time_command_count == 1 &&
+            jitter.delay_increase_count == 1 &&
+            jitter.max_player_delay_ticks == 3,
+        "Late remote input should execute on arrival and grow the player's buffer delay.");
+
+    push_motion_input(3, kernel.CurrentTick() + 40);
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        kernel.InputJitterBufferDiagnosticsSnapshot().early_clamped_command_count == 1 &&
+            kernel.InputJitterBufferDiagnosticsSnapshot().buffered_command_count == 1,
+        "Input stamped far ahead should be clamped to the maximum buffer delay.");
+    for (int tick = 0; tick < 4; ++tick) {
+        kernel.Update(1.0 / 60.0);
+    }
+    passed &= Expect(
+        acked_sequence_for_player_2() == 3 &&
+            kernel.InputJitterBufferDiagnosticsSnapshot().buffered_command_count == 0,
+        "Clamped input should still run within the maximum buffer delay.");
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestAuthorityRateLimitsFloodingPlayerWithoutStarvingOthers() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+    novaria::sim::CommandRateLimiterSettings rate_settings{};
+    rate_settings.limits[static_cast<std::size_t>(novaria::sim::CommandRateClass::Motion)] = {
+        .commands_per_second = 60.0,
+        .burst = 4.0,
+    };
+    kernel.SetCommandRateLimiterSettings(rate_settings);
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    kernel.Update(1.0 / 60.0);
+
+    const auto push_motion_inputs = [&net](std::uint32_t player_id, int count) {
+        for (int index = 0; index < count; ++index) {
+            net.pending_remote_commands.push_back({
+                .player_id = player_id,
+                .command_id = novaria::sim::command::kPlayerMotionInput,
+                .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+                    .move_axis_milli = 1000,
+                    .input_flags = 0,
+                }),
+            });
+        }
+    };
+    const auto find_player = [](const novaria::sim::CommandRateLimiterDiagnostics& diagnostics,
+                                std::uint32_t player_id) -> novaria::sim::PlayerCommandRateDiagnostics {
+        for (const novaria::sim::PlayerCommandRateDiagnostics& player : diagnostics.players) {
+            if (player.player_id == player_id) {
+                return player;
+            }
+        }
+        return {};
+    };
+
+    push_motion_inputs(2, 20);
+    push_motion_inputs(3, 1);
+    kernel.Update(1.0 / 60.0);
+    novaria::sim::CommandRateLimiterDiagnostics admission = kernel.CommandRateLimiterDiagnosticsSnapshot();
+    passed &= Expect(
+        find_player(admission, 2).admitted_count == 4 &&
+            find_player(admission, 2).rate_limited_count == 16 &&
+            find_player(admission, 2).rate_limited_by_class[static_cast<std::size_t>(
+                novaria::sim::CommandRateClass::Motion)] == 16,
+        "Flooding player should be cut off at its motion burst.");
+    passed &= Expect(
+        find_player(admission, 3).admitted_count == 1 && find_player(admission, 3).rate_limited_count == 0,
+        "Other players should keep their own untouched budget.");
+
+    push_motion_inputs(2, 3);
+    kernel.Update(1.0 / 60.0);
+    admission = kernel.CommandRateLimiterDiagnosticsSnapshot();
+    passed &= Expect(
+        find_player(admission, 2).admitted_count == 5 && find_player(admission, 2).rate_limited_count == 18,
+        "Bucket should refill by one motion command per tick at 60 commands/sec.");
+    passed &= Expect(
+        kernel.InputJitterBufferDiagnosticsSnapshot().dropped_overflow_count == 0,
+        "Rate-limited commands should never reach the jitter buffer.");
+
+    kernel.Shutdown();
+
+    novaria::sim::CommandRateLimiter limiter;
+    limiter.SetSettings(rate_settings);
+    const auto admit_motion = [&limiter](std::uint32_t player_id, std::uint64_t tick_index) {
+        return limiter.Admit(
+            {
+                .player_id = player_id,
+                .command_id = novaria::sim::command::kPlayerMotionInput,
+                .payload = {},
+            },
+            tick_index,
+            1.0 / 60.0);
+    };
+    for (std::uint32_t player_id = 100; player_id < 100 + novaria::sim::CommandRateLimiter::kMaxPlayers; ++player_id) {
+        for (int burst = 0; burst < 4; ++burst) {
+            (void)admit_motion(player_id, 1);
+        }
+    }
+    (void)admit_motion(100, 1);
+    passed &= Expect(
+        !admit_motion(200, 2) && limiter.DiagnosticsSnapshot().untracked_player_dropped_count == 1,
+        "A full limiter should not evict players whose buckets are still refilling.");
+    passed &= Expect(
+        admit_motion(200, 5),
+        "Players idle long enough for every bucket to refill should make room for new players.");
+    admission = limiter.DiagnosticsSnapshot();
+    passed &= Expect(
+        find_player(admission, 100).admitted_count == 4 && find_player(admission, 100).rate_limited_count == 1,
+        "An evicted player's drop counters should stay in diagnostics.");
+    passed &= Expect(admit_motion(100, 5), "An evicted player should be tracked again when it returns.");
+    admission = limiter.DiagnosticsSnapshot();
+    passed &= Expect(
+        admission.evicted_player_count == 2 &&
+            admission.tracked_player_count == novaria::sim::CommandRateLimiter::kMaxPlayers &&
+            admission.untracked_player_dropped_count == 1,
+        "Idle eviction should be counted and keep the tracked player cap.");
+    passed &= Expect(
+        find_player(admission, 100).admitted_count == 5 && find_player(admission, 100).rate_limited_count == 1 &&
+            find_player(admission, 101).player_id == 0,
+        "A returning player should resume its counters; evicted players without drops are not retained.");
+
+    novaria::sim::InputJitterBuffer buffer;
+    buffer.SetSettings({
+        .min_delay_ticks = 0,
+        .initial_delay_ticks = 0,
+        .max_delay_ticks = 4,
+        .max_buffered_commands_per_player = 8,
+        .max_released_commands_per_player_per_tick = 2,
+    });
+    for (std::uint32_t sequence = 1; sequence <= 10; ++sequence) {
+        buffer.Push({.player_id = 2, .command_id = novaria::sim::command::kJump, .payload = {}, .sequence = sequence}, 5);
+    }
+    buffer.Push({.player_id = 3, .command_id = novaria::sim::command::kJump, .payload = {}, .sequence = 1}, 5);
+    buffer.Push({.player_id = 3, .command_id = novaria::sim::command::kJump, .payload = {}, .sequence = 2}, 5);
+
+    std::vector<novaria::net::PlayerCommand> released;
+    buffer.Release(5, released);
+    passed &= Expect(
+        released.size() == 4 &&
+            released[0].player_id == 2 && released[1].player_id == 3 &&
+            released[2].player_id == 2 && released[3].player_id == 3,
+        "Release should interleave players and cap each at its per-tick share.");
+    buffer.Release(6, released);
+    passed &= Expect(
+        released.size() == 2 &&
+            released[0].player_id == 2 && released[0].sequence == 3 && released[1].sequence == 4,
+        "Deferred commands should drain on the next tick in order.");
+
+    const novaria::sim::InputJitterBufferDiagnostics jitter = buffer.DiagnosticsSnapshot();
+    passed &= Expect(
+        jitter.players.size() == 2 &&
+            jitter.players[0].player_id == 2 &&
+            jitter.players[0].dropped_overflow_count == 2 &&
+            jitter.players[0].released_command_count == 4 &&
+            jitter.players[0].buffered_command_count == 4 &&
+            jitter.players[1].dropped_overflow_count == 0 &&
+            jitter.players[1].released_command_count == 2 &&
+            jitter.dropped_overflow_count == 2,
+        "Overflow and release counters should be attributed per player.");
+
+    novaria::sim::InputJitterBuffer full_buffer;
+    full_buffer.SetSettings({
+        .min_delay_ticks = 0,
+        .initial_delay_ticks = 0,
+        .max_delay_ticks = 4,
+        .idle_eviction_ticks = 10,
+        .max_buffered_commands_per_player = 8,
+        .max_released_commands_per_player_per_tick = 2,
+    });
+    for (std::uint32_t player_id = 100; player_id < 100 + novaria::sim::InputJitterBuffer::kMaxPlayers; ++player_id) {
+        const int count = player_id == 100 ? 9 : 1;
+        for (int index = 0; index < count; ++index) {
+            full_buffer.Push({.player_id = player_id, .command_id = novaria::sim::command::kJump, .payload = {}}, 1);
+        }
+    }
+    for (std::uint64_t tick_index = 1; tick_index <= 5; ++tick_index) {
+        full_buffer.Release(tick_index, released);
+    }
+    const auto find_jitter_player = [](const novaria::sim::InputJitterBufferDiagnostics& diagnostics,
+                                       std::uint32_t player_id) -> novaria::sim::InputJitterPlayerDiagnostics {
+        for (const novaria::sim::InputJitterPlayerDiagnostics& player : diagnostics.players) {
+            if (player.player_id == player_id) {
+                return player;
+            }
+        }
+        return {};
+    };
+
+    full_buffer.Push({.player_id = 300, .command_id = novaria::sim::command::kJump, .payload = {}}, 6);
+    novaria::sim::InputJitterBufferDiagnostics full_jitter = full_buffer.DiagnosticsSnapshot();
+    passed &= Expect(
+        full_jitter.evicted_player_count == 0 &&
+            full_jitter.dropped_overflow_count == 2 &&
+            find_jitter_player(full_jitter, 300).player_id == 0,
+        "A 65th player should wait until a drained queue has been idle past the threshold.");
+
+    full_buffer.Push({.player_id = 300, .command_id = novaria::sim::command::kJump, .payload = {}}, 11);
+    full_buffer.Release(11, released);
+    full_jitter = full_buffer.DiagnosticsSnapshot();
+    passed &= Expect(
+        released.size() == 1 && released[0].player_id == 300 &&
+            full_jitter.evicted_player_count == 1 &&
+            full_jitter.tracked_player_count == novaria::sim::InputJitterBuffer::kMaxPlayers,
+        "An idle drained queue should make room for the 65th player.");
+    passed &= Expect(
+        find_jitter_player(full_jitter, 100).dropped_overflow_count == 1 &&
+            find_jitter_player(full_jitter, 100).released_command_count == 8 &&
+            find_jitter_player(full_jitter, 101).player_id == 101,
+        "The evicted player's overflow counters should stay in diagnostics.");
+    return passed;
+}
+
+bool TestParallelSnapshotEncodeMatchesSerialPublish() {
+    bool passed = true;
+
+    const auto configure_world = [](FakeWorldService& world) {
+        for (int batch = 0; batch < 3; ++batch) {
+            std::vector<novaria::world::ChunkCoord> dirty_batch;
+            for (int index = 47; index >= 0; --index) {
+                dirty_batch.push_back({.x = index % 8 - 4, .y = index / 8 + batch});
+            }
+            world.dirty_batches.push_back(std::move(dirty_batch));
+        }
+        for (int y = 0; y < 8; ++y) {
+            for (int x = -4; x < 4; ++x) {
+                novaria::world::ChunkSnapshot snapshot{.chunk_coord = {.x = x, .y = y}, .tiles = {}};
+                for (int tile = 0; tile < 1024; ++tile) {
+                    snapshot.tiles.push_back(static_cast<std::uint16_t>((x * 31 + y * 17 + tile) & 0xFF));
+                }
+                world.available_snapshots.push_back(std::move(snapshot));
+            }
+        }
+    };
+
+    FakeWorldService serial_world;
+    FakeNetService serial_net;
+    FakeScriptHost serial_script;
+    configure_world(serial_world);
+    novaria::sim::SimulationKernel serial_kernel(serial_world, serial_net, serial_script);
+
+    FakeWorldService parallel_world;
+    FakeNetService parallel_net;
+    FakeScriptHost parallel_script;
+    configure_world(parallel_world);
+    novaria::sim::SimulationKernel parallel_kernel(parallel_world, parallel_net, parallel_script);
+
+    std::string error;
+    passed &= Expect(
+        parallel_kernel.SetSnapshotEncodeWorkerCount(3, error) &&
+            parallel_kernel.SnapshotEncodeWorkerCount() == 3,
+        "Snapshot encode workers should start.");
+    passed &= Expect(
+        !parallel_kernel.SetSnapshotEncodeWorkerCount(novaria::core::WorkerPool::kMaxWorkers + 1, error) &&
+            !error.empty() && parallel_kernel.SnapshotEncodeWorkerCount() == 0,
+        "Out-of-range worker count should be rejected and leave encoding serial.");
+    passed &= Expect(
+        parallel_kernel.SetSnapshotEncodeWorkerCount(3, error),
+        "Snapshot encode workers should restart.");
+    passed &= Expect(serial_kernel.Initialize(error), "Serial kernel initialize should succeed.");
+    passed &= Expect(parallel_kernel.Initialize(error), "Parallel kernel initialize should succeed.");
+
+    serial_kernel.Update(1.0 / 60.0);
+    parallel_kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        serial_net.published_snapshots.size() == 1 && parallel_net.published_snapshots.empty(),
+        "Parallel encode should publish a tick's snapshots at the start of the next Update.");
+
+    for (int tick = 0; tick < 3; ++tick) {
+        serial_kernel.Update(1.0 / 60.0);
+        parallel_kernel.Update(1.0 / 60.0);
+    }
+    parallel_kernel.Update(1.0 / 60.0);
+
+    passed &= Expect(
+        serial_net.published_snapshots.size() == 4 &&
+            parallel_net.published_snapshots == serial_net.published_snapshots,
+        "Parallel encode should publish the same ticks and chunk counts as the serial path.");
+    passed &= Expect(
+        parallel_net.published_snapshot_payloads == serial_net.published_snapshot_payloads,
+        "Parallel encode should publish byte-identical payloads in the serial order.");
+
+    serial_kernel.Shutdown();
+    parallel_kernel.Shutdown();
+    return passed;
+}
+
+bool TestTickProfilerAttributesOverrunsToSlowPhase() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    for (int tick = 0; tick < 4; ++tick) {
+        kernel.Update(1.0 / 60.0);
+    }
+    passed &= Expect(
+        !kernel.TickProfilerDiagnosticsSnapshot().enabled &&
+            kernel.TickProfilerDiagnosticsSnapshot().profiled_tick_count == 0,
+        "Tick profiler should be disabled and record nothing by default.");
+
+    kernel.SetTickProfilerSettings({.enabled = true, .tick_budget_ms = 1.0});
+    script.tick_delay = std::chrono::microseconds(3000);
+    for (int tick = 0; tick < 5; ++tick) {
+        kernel.Update(1.0 / 60.0);
+    }
+
+    const novaria::sim::TickProfilerDiagnostics profile = kernel.TickProfilerDiagnosticsSnapshot();
+    const novaria::sim::TickPhaseTiming& script_phase =
+        profile.phases[static_cast<std::size_t>(novaria::sim::TickPhase::ScriptTick)];
+    passed &= Expect(
+        profile.enabled && profile.profiled_tick_count == 5 && profile.window_sample_count == 5,
+        "Tick profiler should record one sample per profiled Update.");
+    passed &= Expect(
+        profile.overrun_count == 5 && script_phase.dominant_overrun_count == 5,
+        "Every slow tick should count as an overrun attributed to the script phase.");
+    passed &= Expect(
+        script_phase.p50_ms >= 3.0 && script_phase.max_ms >= script_phase.p99_ms &&
+            script_phase.p99_ms >= script_phase.p50_ms,
+        "Script phase percentiles should reflect the injected delay in order.");
+    passed &= Expect(
+        profile.total.max_ms >= script_phase.max_ms && profile.total.last_ms >= script_phase.last_ms,
+        "Whole-tick timing should cover its phases.");
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestInputRecordingReplaysToMatchingStateHashes() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    world.SetTile(0, 0, novaria::world::material::kStone);
+    world.SetTile(1, 0, novaria::world::material::kStone);
+    novaria::sim::SimulationKernel kernel(world, net, script);
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Recording kernel initialize should succeed.");
+    kernel.StartInputRecording(10);
+    passed &= Expect(kernel.InputRecordingActive(), "Input recording should be active after start.");
+
+    for (int tick = 0; tick < 40; ++tick) {
+        kernel.SubmitLocalCommand({
+            .player_id = 1,
+            .command_id = novaria::sim::command::kPlayerMotionInput,
+            .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+                .move_axis_milli = tick < 20 ? 1000 : -600,
+                .input_flags = tick == 5 ? novaria::sim::command::kMotionInputFlagJumpPressed : std::uint8_t{0},
+            }),
+        });
+        if (tick % 7 == 3) {
+            net.pending_remote_commands.push_back({
+                .player_id = 2,
+                .command_id = novaria::sim::command::kGameplayCollectResource,
+                .payload = novaria::sim::command::EncodeCollectResourcePayload({
+                    .resource_id = novaria::sim::command::kResourceWood,
+                    .amount = static_cast<std::uint32_t>(tick + 1),
+                }),
+            });
+        }
+        kernel.Update(tick < 30 ? 1.0 / 60.0 : 1.0 / 30.0);
+    }
+    const std::uint64_t recorded_end_hash = kernel.ComputeStateHash();
+    kernel.StopInputRecording();
+    passed &= Expect(!kernel.InputRecordingActive(), "Input recording should stop.");
+
+    novaria::wire::ByteBuffer log_bytes;
+    kernel.ConsumeInputRecording(log_bytes);
+    kernel.Shutdown();
+
+    novaria::sim::InputLog log;
+    passed &= Expect(
+        novaria::sim::TryDecodeInputLog(
+            novaria::wire::ByteSpan(log_bytes.data(), log_bytes.size()),
+            log,
+            error),
+        "Recorded input log should decode.");
+    passed &= Expect(
+        log.has_end && log.end_tick == 40 && log.end_state_hash == recorded_end_hash,
+        "Input log should end with the final tick and state hash.");
+    passed &= Expect(
+        log.checkpoints.size() == 4 && log.checkpoints.front().tick_index == 10,
+        "Input log should carry a checkpoint every ten ticks.");
+    passed &= Expect(
+        log.fixed_deltas.size() == 2 && log.fixed_deltas[1].tick_index == 30,
+        "Input log should record fixed delta only when it changes.");
+    passed &= Expect(
+        !log.session_changes.empty() &&
+            log.session_changes.back().session_state == novaria::net::NetSessionState::Connected,
+        "Input log should record the session reaching connected.");
+    passed &= Expect(
+        log_bytes.size() < 40 * 64,
+        "Input log should stay compact (tick deltas and varints).");
+
+    const auto replay = [&](const novaria::sim::InputLog& replay_log, novaria::sim::InputReplayResult& out_result) {
+        FakeWorldService replay_world;
+        FakeScriptHost replay_script;
+        replay_world.SetTile(0, 0, novaria::world::material::kStone);
+        replay_world.SetTile(1, 0, novaria::world::material::kStone);
+        novaria::sim::InputReplayNetService replay_net(replay_log);
+        novaria::sim::SimulationKernel replay_kernel(replay_world, replay_net, replay_script);
+        replay_kernel.SetLocalPlayerId(replay_log.header.local_player_id);
+        std::string replay_error;
+        bool replayed = replay_kernel.Initialize(replay_error);
+        replayed = replayed &&
+            novaria::sim::RunInputReplay(replay_log, replay_kernel, replay_net, out_result, replay_error);
+        replay_kernel.Shutdown();
+        return replayed;
+    };
+
+    novaria::sim::InputReplayResult result{};
+    passed &= Expect(replay(log, result), "Replay should run.");
+    passed &= Expect(
+        !result.diverged && result.verified_end_state && result.verified_checkpoint_count == 4,
+        "Replay should reproduce every checkpoint and the end state hash.");
+    passed &= Expect(
+        result.replayed_tick_count == 40 && result.replayed_command_count == 46,
+        "Replay should run every recorded tick and feed every recorded remote command.");
+
+    novaria::sim::InputLog tampered = log;
+    for (novaria::sim::InputLogCommand& recorded : tampered.commands) {
+        if (!recorded.local && recorded.command.player_id == 2 && recorded.tick_index == 17) {
+            recorded.command.payload = novaria::sim::command::EncodeCollectResourcePayload({
+                .resource_id = novaria::sim::command::kResourceWood,
+                .amount = 1,
+            });
+        }
+    }
+    passed &= Expect(replay(tampered, result), "Tampered replay should still run.");
+    passed &= Expect(
+        result.diverged && result.divergent_tick == 20 && !result.verified_end_state,
+        "Replay should report the first checkpoint after a changed input as divergent.");
+
+    novaria::sim::InputLog truncated;
+    passed &= Expect(
+        !novaria::sim::TryDecodeInputLog(
+            novaria::wire::ByteSpan(log_bytes.data(), log_bytes.size() - 1),
+            truncated,
+            error) &&
+            !error.empty(),
+        "Truncated input log should be rejected.");
+    return passed;
+}
+
+bool TestSaveStateRollbackResimulatesIdentically() {
+    bool passed = true;
+
+    novaria::world::WorldServiceBasic world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    for (int chunk_y = -1; chunk_y <= 1; ++chunk_y) {
+        for (int chunk_x = -2; chunk_x <= 2; ++chunk_x) {
+            world.LoadChunk({.x = chunk_x, .y = chunk_y});
+        }
+    }
+
+    const auto run_ticks = [&](int first_tick, int last_tick) {
+        for (int tick = first_tick; tick < last_tick; ++tick) {
+            kernel.SubmitLocalCommand({
+                .player_id = 1,
+                .command_id = novaria::sim::command::kPlayerMotionInput,
+                .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+                    .move_axis_milli = (tick / 10) % 2 == 0 ? 800 : -500,
+                    .input_flags = tick % 13 == 0 ? novaria::sim::command::kMotionInputFlagJumpPressed : std::uint8_t{0},
+                }),
+            });
+            if (tick % 6 == 0) {
+                kernel.SubmitLocalCommand({
+                    .player_id = 1,
+                    .command_id = novaria::sim::command::kCombatFireProjectile,
+                    .payload = novaria::sim::command::EncodeFireProjectilePayload({
+                        .origin_tile_x = tick % 4,
+                        .origin_tile_y = -3,
+                        .velocity_milli_x = 6000,
+                        .velocity_milli_y = 0,
+                        .damage = 3,
+                        .lifetime_ticks = 40,
+                        .faction = 1,
+                    }),
+                });
+            }
+            if (tick % 9 == 0) {
+                kernel.SubmitLocalCommand({
+                    .player_id = 1,
+                    .command_id = novaria::sim::command::kWorldSetTile,
+                    .payload = novaria::sim::command::EncodeWorldSetTilePayload({
+                        .tile_x = tick - 20,
+                        .tile_y = 2,
+                        .material_id = novaria::world::material::kStone,
+                    }),
+                });
+            }
+            if (tick % 11 == 0) {
+                net.pending_remote_commands.push_back({
+                    .player_id = 2,
+                    .command_id = novaria::sim::command::kGameplayCollectResource,
+                    .payload = novaria::sim::command::EncodeCollectResourcePayload({
+                        .resource_id = novaria::sim::command::kResourceWood,
+                        .amount = 2,
+                    }),
+                    .sequence = static_cast<std::uint32_t>(tick + 1),
+                });
+            }
+            if (tick >= 30 && tick % 7 == 0) {
+                // Player 3 only appears after the save point; a rollback must forget its sequence.
+                net.pending_remote_commands.push_back({
+                    .player_id = 3,
+                    .command_id = novaria::sim::command::kGameplayCollectResource,
+                    .payload = novaria::sim::command::EncodeCollectResourcePayload({
+                        .resource_id = novaria::sim::command::kResourceStone,
+                        .amount = 1,
+                    }),
+                    .sequence = static_cast<std::uint32_t>(tick + 1),
+                });
+            }
+            kernel.Update(1.0 / 60.0);
+        }
+    };
+
+    run_ticks(0, 30);
+    novaria::sim::SimulationStateSnapshot state{};
+    novaria::sim::ReserveSimulationState(state, 16 * 1024, 32);
+    kernel.SaveState(state);
+    const std::uint64_t saved_tick = kernel.CurrentTick();
+    const std::uint64_t saved_hash = kernel.ComputeStateHash();
+    passed &= Expect(
+        state.world.chunks.size() == 15 && !state.arena.Buffer().empty(),
+        "Saved state should share every loaded chunk and fill the arena.");
+
+    run_ticks(30, 60);
+    const std::uint64_t end_hash = kernel.ComputeStateHash();
+    passed &= Expect(end_hash != saved_hash, "Simulation should move away from the saved state.");
+
+    passed &= Expect(kernel.LoadState(state).IsOk(), "LoadState should succeed.");
+    passed &= Expect(
+        kernel.CurrentTick() == saved_tick && kernel.ComputeStateHash() == saved_hash,
+        "LoadState should restore the exact saved state.");
+
+    run_ticks(30, 60);
+    passed &= Expect(
+        kernel.ComputeStateHash() == end_hash,
+        "Re-simulating the same inputs after a rollback should reproduce the same state.");
+
+    passed &= Expect(kernel.LoadState(state).IsOk(), "The same saved state should load more than once.");
+    passed &= Expect(kernel.ComputeStateHash() == saved_hash, "Repeated loads should restore the same state.");
+    novaria::sim::SimulationStateSnapshot resaved{};
+    kernel.SaveState(resaved);
+    passed &= Expect(
+        resaved.arena.Buffer() == state.arena.Buffer(),
+        "Saving a loaded state should reproduce the same canonical arena bytes.");
+
+    // A kernel whose ECS has churned through other entities hands out different entt ids; the load must not
+    // depend on reproducing the saved ones.
+    novaria::world::WorldServiceBasic other_world;
+    FakeNetService other_net;
+    FakeScriptHost other_script;
+    novaria::sim::SimulationKernel other_kernel(other_world, other_net, other_script);
+    passed &= Expect(other_kernel.Initialize(error), "Second kernel initialize should succeed.");
+    for (int tick = 0; tick < 12; ++tick) {
+        other_kernel.SubmitLocalCommand({
+            .player_id = 7 + static_cast<std::uint32_t>(tick % 3),
+            .command_id = novaria::sim::command::kCombatFireProjectile,
+            .payload = novaria::sim::command::EncodeFireProjectilePayload({
+                .origin_tile_x = -tick,
+                .origin_tile_y = 5,
+                .velocity_milli_x = -1000,
+                .velocity_milli_y = 0,
+                .damage = 1,
+                .lifetime_ticks = static_cast<std::uint16_t>(tick % 4),
+                .faction = 1,
+            }),
+        });
+        other_kernel.Update(1.0 / 60.0);
+    }
+    passed &= Expect(other_kernel.LoadState(state).IsOk(), "LoadState should succeed on a different kernel.");
+    passed &= Expect(
+        other_kernel.ComputeStateHash() == saved_hash,
+        "LoadState should not depend on the loading registry's entity id history.");
+    other_kernel.SaveState(resaved);
+    passed &= Expect(
+        resaved.arena.Buffer() == state.arena.Buffer(),
+        "A different kernel should re-save the loaded state to the same canonical bytes.");
+    other_kernel.Shutdown();
+
+    // Rejected loads must leave the kernel untouched: move away from the saved state first so that a
+    // partially applied load would show up in the hash.
+    run_ticks(30, 45);
+    const std::uint64_t live_tick = kernel.CurrentTick();
+    const std::uint64_t live_hash = kernel.ComputeStateHash();
+    const novaria::wire::ByteBuffer& arena_bytes = state.arena.Buffer();
+    for (const std::size_t truncated_size : {arena_bytes.size() / 2, arena_bytes.size() - 1}) {
+        novaria::sim::SimulationStateSnapshot truncated{};
+        truncated.tick_index = state.tick_index;
+        truncated.gameplay_progress = state.gameplay_progress;
+        truncated.world = state.world;
+        truncated.arena.WriteRawBytes(novaria::wire::ByteSpan(arena_bytes.data(), truncated_size));
+        passed &= Expect(
+            kernel.LoadState(truncated).Code() == novaria::core::StatusCode::MalformedPayload,
+            "LoadState should reject a truncated arena.");
+        passed &= Expect(
+            kernel.CurrentTick() == live_tick && kernel.ComputeStateHash() == live_hash,
+            "A rejected LoadState should leave tick and state hash unchanged.");
+    }
+    novaria::sim::SimulationStateSnapshot trailing{};
+    trailing.tick_index = state.tick_index;
+    trailing.world = state.world;
+    trailing.arena.WriteRawBytes(novaria::wire::ByteSpan(arena_bytes.data(), arena_bytes.size()));
+    trailing.arena.WriteU8(0);
+    passed &= Expect(
+        kernel.LoadState(trailing).Code() == novaria::core::StatusCode::MalformedPayload &&
+            kernel.ComputeStateHash() == live_hash,
+        "LoadState should reject trailing arena bytes without touching live state.");
+
+    passed &= Expect(kernel.LoadState(state).IsOk(), "A valid state should load after a rejected one.");
+    kernel.SaveState(resaved);
+    passed &= Expect(
+        resaved.arena.Buffer() == state.arena.Buffer(),
+        "LoadState should replace applied command sequences, dropping players first seen after the save.");
+    kernel.StartInputRecording(0);
+    passed &= Expect(
+        kernel.LoadState(state).Code() == novaria::core::StatusCode::Unavailable,
+        "LoadState should be refused while input is being recorded.");
+    kernel.StopInputRecording();
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestLoadStateDropsInFlightNetworkState() {
+    bool passed = true;
+
+    novaria::world::WorldServiceBasic world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+
+    std::string error;
+    passed &= Expect(kernel.SetSnapshotEncodeWorkerCount(1, error), "Snapshot encode worker should start.");
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    world.LoadChunk({.x = 0, .y = 0});
+    for (int tick = 0; tick < 3; ++tick) {
+        kernel.Update(1.0 / 60.0);
+    }
+
+    const auto set_tile = [&kernel](std::uint16_t material_id) {
+        kernel.SubmitLocalCommand({
+            .player_id = 1,
+            .command_id = novaria::sim::command::kWorldSetTile,
+            .payload = novaria::sim::command::EncodeWorldSetTilePayload({
+                .tile_x = 1,
+                .tile_y = 1,
+                .material_id = material_id,
+            }),
+        });
+    };
+    const auto published_tile = [&net](std::size_t first_publication, std::uint16_t& out_material_id) {
+        bool found = false;
+        for (std::size_t index = first_publication; index < net.published_snapshot_payloads.size(); ++index) {
+            for (const novaria::wire::ByteBuffer& payload : net.published_snapshot_payloads[index]) {
+                novaria::world::ChunkSnapshot snapshot{};
+                if (novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot(
+                        novaria::wire::ByteSpan(payload.data(), payload.size()),
+                        snapshot).IsOk() &&
+                    snapshot.chunk_coord.x == 0 && snapshot.chunk_coord.y == 0) {
+                    out_material_id = snapshot.tiles[novaria::world::WorldServiceBasic::kChunkSize + 1];
+                    found = true;
+                }
+            }
+        }
+        return found;
+    };
+
+    // Save and load while the encode of the stone tile is still in flight: the restore leaves that chunk's
+    // tiles untouched, so only re-queueing the discarded encode gets the stone tile to replicas.
+    set_tile(novaria::world::material::kStone);
+    kernel.Update(1.0 / 60.0);
+    novaria::sim::SimulationStateSnapshot state{};
+    kernel.SaveState(state);
+    const std::size_t first_publication = net.published_snapshot_payloads.size();
+    passed &= Expect(kernel.LoadState(state).IsOk(), "LoadState should succeed with an encode in flight.");
+    kernel.Update(1.0 / 60.0);
+    kernel.Update(1.0 / 60.0);
+    std::uint16_t material_id = 0;
+    passed &= Expect(
+        published_tile(first_publication, material_id) && material_id == novaria::world::material::kStone,
+        "Chunks of a discarded encode should be re-sent after the load.");
+
+    set_tile(novaria::world::material::kWood);
+    kernel.Update(1.0 / 60.0);
+    net.pending_remote_commands.push_back({
+        .player_id = 2,
+        .command_id = novaria::sim::command::kGameplayCollectResource,
+        .payload = novaria::sim::command::EncodeCollectResourcePayload({
+            .resource_id = novaria::sim::command::kResourceWood,
+            .amount = 5,
+        }),
+        .sequence = 1,
+        .target_tick = kernel.CurrentTick() + 6,
+    });
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        kernel.InputJitterBufferDiagnosticsSnapshot().buffered_command_count == 1 &&
+            kernel.CommandRateLimiterDiagnosticsSnapshot().tracked_player_count == 2,
+        "Remote input should be buffered and rate-tracked before the load.");
+
+    const std::size_t publications_before_load = net.published_snapshot_payloads.size();
+    passed &= Expect(kernel.LoadState(state).IsOk(), "LoadState should succeed.");
+    passed &= Expect(
+        kernel.InputJitterBufferDiagnosticsSnapshot().buffered_command_count == 0 &&
+            kernel.CommandRateLimiterDiagnosticsSnapshot().tracked_player_count == 0,
+        "LoadState should drop buffered remote input and rate-limit buckets.");
+    passed &= Expect(
+        net.published_snapshot_payloads.size() == publications_before_load,
+        "LoadState should not publish the in-flight encode.");
+
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        net.published_snapshot_payloads.size() == publications_before_load,
+        "The Update after a load should not publish snapshots encoded before it.");
+    for (int tick = 0; tick < 8; ++tick) {
+        kernel.Update(1.0 / 60.0);
+    }
+    material_id = 0;
+    passed &= Expect(
+        published_tile(publications_before_load, material_id) &&
+            material_id == novaria::world::material::kStone,
+        "Replicas should receive the restored tiles, never the rolled-back ones.");
+    passed &= Expect(
+        kernel.InventorySnapshot(2).wood_count == 0,
+        "Remote input buffered before the load should never execute.");
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestIndependentKernelsTickOnPinnedThreads() {
+    bool passed = true;
+
+    struct Shard final {
+        novaria::world::WorldServiceBasic world;
+        FakeNetService net;
+        FakeScriptHost script;
+        novaria::sim::SimulationKernel kernel{world, net, script};
+    };
+
+    constexpr int kTicks = 240;
+    const auto run_shard = [](Shard& shard, int seed) {
+        std::string error;
+        if (!shard.kernel.Initialize(error)) {
+            return std::uint64_t{0};
+        }
+        for (int chunk_x = -2; chunk_x <= 2; ++chunk_x) {
+            shard.world.LoadChunk({.x = chunk_x, .y = 0});
+        }
+        for (int tick = 0; tick < kTicks; ++tick) {
+            shard.kernel.SubmitLocalCommand({
+                .player_id = 1,
+                .command_id = novaria::sim::command::kPlayerMotionInput,
+                .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+                    .move_axis_milli = (tick / (7 + seed)) % 2 == 0 ? 900 : -600,
+                    .input_flags = tick % (11 + seed) == 0 ? novaria::sim::command::kMotionInputFlagJumpPressed
+                                                           : std::uint8_t{0},
+                }),
+            });
+            if (tick % (5 + seed) == 0) {
+                shard.kernel.SubmitLocalCommand({
+                    .player_id = 1,
+                    .command_id = novaria::sim::command::kWorldSetTile,
+                    .payload = novaria::sim::command::EncodeWorldSetTilePayload({
+                        .tile_x = tick % 40 - 20,
+                        .tile_y = 3 + seed,
+                        .material_id = novaria::world::material::kStone,
+                    }),
+                });
+            }
+            shard.kernel.Update(1.0 / 60.0);
+        }
+        const std::uint64_t hash = shard.kernel.ComputeStateHash();
+        shard.kernel.Shutdown();
+        return hash;
+    };
+
+    std::array<std::uint64_t, 2> reference_hashes{};
+    for (int seed = 0; seed < 2; ++seed) {
+        auto shard = std::make_unique<Shard>();
+        reference_hashes[static_cast<std::size_t>(seed)] = run_shard(*shard, seed);
+    }
+    passed &= Expect(
+        reference_hashes[0] != 0 && reference_hashes[0] != reference_hashes[1],
+        "Shards fed different inputs should diverge.");
+
+    constexpr std::size_t kShardCount = 4;
+    std::array<std::unique_ptr<Shard>, kShardCount> shards{};
+    std::array<std::uint64_t, kShardCount> hashes{};
+    std::vector<std::thread> threads;
+    for (std::size_t index = 0; index < kShardCount; ++index) {
+        shards[index] = std::make_unique<Shard>();
+        threads.emplace_back([&, index]() {
+            std::string pin_error;
+            (void)novaria::core::PinCurrentThreadToCore(index % novaria::core::HardwareThreadCount(), pin_error);
+            hashes[index] = run_shard(*shards[index], static_cast<int>(index % 2));
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t index = 0; index < kShardCount; ++index) {
+        passed &= Expect(
+            hashes[index] == reference_hashes[index % 2],
+            "Kernels ticking concurrently on their own threads should match a single-threaded run.");
+    }
+    return passed;
+}
+
+bool TestAuthoritySteadyStateUpdateDoesNotAllocate() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+    kernel.SetTickProfilerSettings({.enabled = true, .tick_budget_ms = 1000.0 / 60.0});
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    for (int x = -16; x <= 16; ++x) {
+        world.SetTile(x, 0, novaria::world::material::kStone);
+    }
+    net.record_publications = false;
+    kernel.Update(1.0 / 60.0);
+    net.pending_remote_commands.push_back({
+        .player_id = 2,
+        .command_id = novaria::sim::command::kPlayerMotionInput,
+        .payload = novaria::sim::command::EncodePlayerMotionInputPayload({
+            .move_axis_milli = 0,
+            .input_flags = 0,
+        }),
+        .sequence = 1,
+    });
+
+    novaria::wire::ByteWriter ack_writer;
+    std::size_t ecs_allocations = 0;
+    const auto run_ticks = [&](int tick_count) {
+        std::size_t allocations = 0;
+        for (int tick = 0; tick < tick_count; ++tick) {
+            g_allocation_count = 0;
+            g_ecs_allocation_count = 0;
+            g_count_allocations = true;
+            kernel.Update(1.0 / 60.0);
+
+            ack_writer.Clear();
+            novaria::sim::command::EncodeReplicationEntityAckPayload(
+                {.acked_tick = net.last_entity_state_tick},
+                ack_writer);
+            net.pending_remote_commands.push_back({
+                .player_id = 2,
+                .command_id = novaria::sim::command::kReplicationEntityAck,
+                .payload = novaria::wire::SmallByteBuffer(ack_writer.Buffer()),
+            });
+            g_count_allocations = false;
+            allocations += g_allocation_count;
+            ecs_allocations += g_ecs_allocation_count;
+        }
+        return allocations;
+    };
+
+    (void)run_ticks(240);
+    ecs_allocations = 0;
+    const std::size_t steady_state_allocations = run_ticks(240);
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        net.pending_remote_commands.empty() && net.pending_remote_commands.capacity() > 0,
+        "Consumed remote command storage should be swapped back to the producer for reuse.");
+    passed &= Expect(
+        net.last_entity_state_count == 2,
+        "Steady state should keep publishing the client's own state and its delta.");
+    passed &= Expect(
+        kernel.EntityReplicationSenderDiagnosticsSnapshot().delta_snapshot_count > 0,
+        "Steady state should encode baseline deltas for the acking client.");
+
+    passed &= Expect(
+        steady_state_allocations == 0,
+        "Authority Update, inline-payload command delivery and tick profiling should not heap-allocate outside the ECS runtime once buffers are warm.");
+    if (steady_state_allocations != 0 || ecs_allocations != 0) {
+        std::cerr << "[INFO] steady-state allocations: " << steady_state_allocations
+                  << " (inside the ECS runtime: " << ecs_allocations << ")\n";
+    }
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestReplicaInterpolatesRemotePlayersWithDelay() {
+    bool passed = true;
+
+    FakeWorldService world;
+    FakeNetService net;
+    FakeScriptHost script;
+    novaria::sim::SimulationKernel kernel(world, net, script);
+    kernel.SetAuthorityMode(novaria::sim::SimulationAuthorityMode::Replica);
+    kernel.SetRemoteInterpolationSettings({
+        .delay_seconds = 4.0 / 60.0,
+        .max_extrapolation_seconds = 2.0 / 60.0,
+    });
+
+    std::string error;
+    passed &= Expect(kernel.Initialize(error), "Kernel initialize should succeed.");
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(kernel.SampleRemotePlayers(0.0F).empty(), "No remote players before entity states arrive.");
+
+    const auto push_remote_state = [&net](std::uint64_t server_tick, float position_x, bool include_player) {
+        novaria::sim::EntityDelta delta{};
+        delta.recipient_player_id = 1;
+        delta.updates.push_back({
+            .field_mask = novaria::sim::kEntityDeltaFieldAll,
+            .values = {
+                .network_id = 5,
+                .kind = novaria::sim::ecs::ReplicatedEntityKind::Hostile,
+                .position_x = 192,
+                .health = 20,
+            },
+        });
+        if (include_player) {
+            delta.updates.push_back({
+                .field_mask = novaria::sim::kEntityDeltaFieldAll,
+                .values = novaria::sim::QuantizeReplicatedEntity(novaria::sim::ReplicatedPlayerEntity(
+                    2,
+                    {.position_x = position_x, .velocity_x = 6.0F})),
+            });
+        }
+        net.pending_remote_entity_states.push_back({
+            .tick_index = server_tick,
+            .entity_states = {novaria::sim::EncodeEntityDelta(delta)},
+        });
+    };
+
+    for (std::uint64_t server_tick = 500; server_tick < 508; ++server_tick) {
+        push_remote_state(server_tick, static_cast<float>(server_tick - 500) * 0.125F, true);
+        kernel.Update(1.0 / 60.0);
+    }
+
+    std::vector<novaria::sim::InterpolatedEntityState> remote_players = kernel.SampleRemotePlayers(0.5F);
+    passed &= Expect(remote_players.size() == 1, "One remote player should be sampled.");
+    if (remote_players.size() == 1) {
+        passed &= Expect(remote_players[0].entity_id == 2, "Sampled remote player id should match.");
+        passed &= Expect(
+            std::fabs(remote_players[0].position_x - 0.4375F) <= 1e-4F,
+            "Remote player should render between buffered states at the configured delay.");
+        passed &= Expect(!remote_players[0].extrapolated, "Buffered remote player should not be extrapolated.");
+    }
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> sampled_entities =
+        kernel.SampleReplicatedEntities(0.5F);
+    passed &= Expect(
+        sampled_entities.size() == 1 &&
+            sampled_entities[0].kind == novaria::sim::ecs::ReplicatedEntityKind::Hostile &&
+            std::fabs(sampled_entities[0].position_x - 3.0F) <= 1e-4F &&
+            sampled_entities[0].health == 20,
+        "Replicated non-player entities should be sampled for rendering.");
+
+    for (int tick = 0; tick < 20; ++tick) {
+        kernel.Update(1.0 / 60.0);
+    }
+    remote_players = kernel.SampleRemotePlayers(0.0F);
+    passed &= Expect(remote_players.size() == 1, "Remote player should remain sampled during loss.");
+    if (remote_players.size() == 1) {
+        passed &= Expect(remote_players[0].extrapolated, "Remote player should extrapolate when states stop.");
+        passed &= Expect(
+            std::fabs(remote_players[0].position_x - (0.875F + 6.0F * (2.0F / 60.0F))) <= 1e-4F,
+            "Extrapolation should be bounded by the configured limit.");
+    }
+
+    const novaria::sim::EntityInterpolationDiagnostics diagnostics = kernel.RemoteInterpolationDiagnostics();
+    passed &= Expect(diagnostics.tracked_entity_count == 1, "Interpolation buffer should track the remote player.");
+    passed &= Expect(diagnostics.extrapolation_clamped_count >= 1, "Clamped extrapolation should be counted.");
+
+    push_remote_state(600, 0.0F, false);
+    kernel.Update(1.0 / 60.0);
+    passed &= Expect(
+        kernel.SampleRemotePlayers(0.0F).empty(),
+        "A player that left the interest set should stop being sampled.");
+
+    kernel.Shutdown();
+    return passed;
+}
+
+bool TestEntityReplicationDeltaFlowsBetweenKernels() {
+    bool passed = true;
+
+    FakeWorldService authority_world;
+    FakeNetService authority_net;
+    FakeScriptHost authority_script;
+    novaria::sim::SimulationKernel authority(authority_world, authority_net, authority_script);
+
+    FakeWorldService replica_world;
+    FakeNetService replica_net;
+    FakeScriptHost replica_script;
+    novaria::sim::SimulationKernel replica(replica_world, replica_net, replica_script);
+    replica.SetAuthorityMode(novaria::sim::SimulationAuthorityMode::Replica);
+    replica.SetLocalPlayerId(2);
+
+    std::string error;
+    passed &= Expect(authority.Initialize(error), "Authority kernel initialize should succeed.");
+    passed &= Expect(replica.Initialize(error), "Replica kernel initialize should succeed.");
+    authority.Update(1.0 / 60.0);
+    replica.Update(1.0 / 60.0);
+
+    authority_net.pending_remote_commands.push_back({
+        .player_id = 2,
+        .command_id = novaria::sim::command::kPlayerMotionInput,
+        .payload = novaria::sim::command::EncodePlayerMotionInputPayload({}),
+        .sequence = 1,
+    });
+    authority_net.published_entity_states.clear();
+    authority.Update(1.0 / 60.0);
+    passed &= Expect(authority_net.published_entity_states.size() == 1, "Authority should publish entity states.");
+    if (authority_net.published_entity_states.size() != 1) {
+        return false;
+    }
+
+    const auto [full_tick, full_states] = authority_net.published_entity_states[0];
+    const std::vector<std::uint32_t>& full_recipients = authority_net.published_entity_state_recipients.back();
+    passed &= Expect(
+        full_states.size() == 2 && full_recipients == std::vector<std::uint32_t>({2, 2}),
+        "Authority should address the client's own state and its interest-filtered delta only to that client.");
+    replica_net.pending_remote_entity_states.push_back({
+        .tick_index = full_tick,
+        .entity_states = full_states,
+    });
+    replica_net.submitted_commands.clear();
+    replica.Update(1.0 / 60.0);
+    replica.Update(1.0 / 60.0);
+
+    const std::vector<novaria::sim::ecs::ReplicatedEntitySnapshot> replicated = replica.ReplicatedEntities();
+    passed &= Expect(replicated.size() == 2, "Replica should mirror the authority hostile and the host player.");
+    if (replicated.size() == 2) {
+        passed &= Expect(
+            replicated[0].kind == novaria::sim::ecs::ReplicatedEntityKind::Hostile &&
+                std::fabs(replicated[0].position_x - 6.5F) < 1e-6F &&
+                replicated[0].health == 20,
+            "Replicated hostile should match the authority state.");
+        passed &= Expect(
+            replicated[1].kind == novaria::sim::ecs::ReplicatedEntityKind::Player &&
+                replicated[1].owner_player_id == 1,
+            "The client's own player should not be replicated back to it.");
+    }
+    const std::vector<novaria::sim::InterpolatedEntityState> remote_players = replica.SampleRemotePlayers(0.0F);
+    passed &= Expect(
+        remote_players.size() == 1 && remote_players[0].entity_id == 1,
+        "Replica should sample the host player from the entity delta.");
+    passed &= Expect(
+        replica.SampleReplicatedEntities(0.0F).size() == 1,
+        "Replica should hand the replicated hostile to the render path.");
+
+    const novaria::net::PlayerCommand* ack_command = nullptr;
+    for (const novaria::net::PlayerCommand& command : replica_net.submitted_commands) {
+        if (command.command_id == novaria::sim::command::kReplicationEntityAck) {
+            ack_command = &command;
+        }
+    }
+    passed &= Expect(ack_command != nullptr, "Replica should acknowledge the applied entity snapshot.");
+    if (ack_command == nullptr) {
+        return false;
+    }
+
+    authority_net.pending_remote_commands.push_back(*ack_command);
+    authority_net.published_entity_states.clear();
+    authority.Update(1.0 / 60.0);
+    bool found_delta = false;
+    for (const auto& encoded_state : authority_net.published_entity_states.back().second) {
+        novaria::sim::EntityDelta delta{};
+        if (!novaria::sim::TryDecodeEntityDelta(
+                novaria::wire::ByteSpan(encoded_state.data(), encoded_state.size()),
+                delta)) {
+            continue;
+        }
+        found_delta = true;
+        passed &= Expect(
+            delta.has_baseline && delta.baseline_tick == full_tick,
+            "Authority should delta against the acknowledged baseline.");
+        passed &= Expect(
+            delta.removed_network_ids.empty() &&
+                std::none_of(
+                    delta.updates.begin(),
+                    delta.updates.end(),
+                    [](const novaria::sim::EntityDeltaUpdate& update) {
+                        return update.values.kind == novaria::sim::ecs::ReplicatedEntityKind::Hostile;
+                    }),
+            "Idle hostile should not be resent once acknowledged.");
+    }
+    passed &= Expect(found_delta, "Authority should publish an entity delta for the remote client.");
+
+    const novaria::sim::EntityReplicationSenderDiagnostics diagnostics =
+        authority.EntityReplicationSenderDiagnosticsSnapshot();
+    passed &= Expect(diagnostics.full_snapshot_count == 1, "Only the first snapshot should be sent in full.");
+    passed &= Expect(diagnostics.delta_snapshot_count == 1, "Acked snapshots should be sent as deltas.");
+
+    authority.Shutdown();
+    replica.Shutdown();
+    return passed;
+}
+
 }  // namespace
 
 int main() {
     bool passed = true;
     passed &= TestCommandSchemaPayloadParsing();
-    passed &= TestSessionStateChangedPayloadParser();
+    passed &= TestScriptEventVocabulary();
     passed &= TestUpdatePublishesDirtyChunkCount();
     passed &= TestInitializeRollbackOnNetFailure();
     passed &= TestInitializeRollbackOnScriptFailure();
@@ -1937,6 +3309,19 @@ int main() {
     passed &= TestUpdateSkipsNetExchangeWhenSessionNotConnected();
     passed &= TestAuthorityPublishesLoadedChunksAfterConnectionEstablished();
     passed &= TestDirtyChunksRetainedUntilConnectionEstablished();
+    passed &= TestReplicaPredictsAndReconcilesLocalMotion();
+    passed &= TestAuthorityPublishesPlayerStatesWithAckedSequence();
+    passed &= TestAuthorityJitterBufferExecutesStampedInputsOnTargetTick();
+    passed &= TestAuthorityRateLimitsFloodingPlayerWithoutStarvingOthers();
+    passed &= TestParallelSnapshotEncodeMatchesSerialPublish();
+    passed &= TestTickProfilerAttributesOverrunsToSlowPhase();
+    passed &= TestInputRecordingReplaysToMatchingStateHashes();
+    passed &= TestSaveStateRollbackResimulatesIdentically();
+    passed &= TestLoadStateDropsInFlightNetworkState();
+    passed &= TestIndependentKernelsTickOnPinnedThreads();
+    passed &= TestAuthoritySteadyStateUpdateDoesNotAllocate();
+    passed &= TestReplicaInterpolatesRemotePlayersWithDelay();
+    passed &= TestEntityReplicationDeltaFlowsBetweenKernels();
 
     if (!passed) {
         return 1;
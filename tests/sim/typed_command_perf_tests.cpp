@@ -0,0 +1,250 @@
+#include "sim/command_schema.h"
+#include "sim/typed_command.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+namespace command = novaria::sim::command;
+
+bool Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+struct ReferenceTypedCommand final {
+    novaria::sim::TypedPlayerCommandType type = novaria::sim::TypedPlayerCommandType::Unknown;
+    command::PlayerMotionInputPayload player_motion_input{};
+    command::WorldSetTilePayload world_set_tile{};
+    command::CollectResourcePayload collect_resource{};
+    command::PickupProbePayload pickup_probe{};
+    command::FireProjectilePayload fire_projectile{};
+    command::ReplicationEntityAckPayload replication_entity_ack{};
+};
+
+bool ReferenceDecode(const novaria::net::PlayerCommand& source, ReferenceTypedCommand& out_command) {
+    using novaria::sim::TypedPlayerCommandType;
+    out_command = {};
+    const novaria::wire::ByteSpan payload(source.payload.data(), source.payload.size());
+    if (source.command_id == command::kPlayerMotionInput) {
+        out_command.type = TypedPlayerCommandType::PlayerMotionInput;
+        return command::TryDecodePlayerMotionInputPayload(payload, out_command.player_motion_input);
+    }
+    if (source.command_id == command::kWorldSetTile) {
+        out_command.type = TypedPlayerCommandType::WorldSetTile;
+        return command::TryDecodeWorldSetTilePayload(payload, out_command.world_set_tile);
+    }
+    if (source.command_id == command::kGameplayCollectResource) {
+        out_command.type = TypedPlayerCommandType::GameplayCollectResource;
+        return command::TryDecodeCollectResourcePayload(payload, out_command.collect_resource);
+    }
+    if (source.command_id == command::kGameplayPickupProbe) {
+        out_command.type = TypedPlayerCommandType::GameplayPickupProbe;
+        return command::TryDecodePickupProbePayload(payload, out_command.pickup_probe);
+    }
+    if (source.command_id == command::kCombatFireProjectile) {
+        out_command.type = TypedPlayerCommandType::CombatFireProjectile;
+        return command::TryDecodeFireProjectilePayload(payload, out_command.fire_projectile);
+    }
+    if (source.command_id == command::kReplicationEntityAck) {
+        out_command.type = TypedPlayerCommandType::ReplicationEntityAck;
+        return command::TryDecodeReplicationEntityAckPayload(payload, out_command.replication_entity_ack);
+    }
+    return false;
+}
+
+struct ChecksumContext final {
+    std::uint64_t checksum = 0;
+
+    void Mix(std::uint64_t value) {
+        checksum = checksum * 1099511628211ULL + value;
+    }
+
+    void OnMotion(const novaria::sim::TypedPlayerCommand& typed_command, std::uint32_t player_id) {
+        Mix(player_id + static_cast<std::uint64_t>(
+            typed_command.As<command::PlayerMotionInputPayload>().move_axis_milli + 1000));
+    }
+    void OnSetTile(const novaria::sim::TypedPlayerCommand& typed_command, std::uint32_t player_id) {
+        Mix(player_id + typed_command.As<command::WorldSetTilePayload>().material_id);
+    }
+    void OnCollect(const novaria::sim::TypedPlayerCommand& typed_command, std::uint32_t player_id) {
+        Mix(player_id + typed_command.As<command::CollectResourcePayload>().amount);
+    }
+    void OnPickup(const novaria::sim::TypedPlayerCommand& typed_command, std::uint32_t player_id) {
+        Mix(player_id + static_cast<std::uint64_t>(typed_command.As<command::PickupProbePayload>().tile_x + 1000));
+    }
+    void OnProjectile(const novaria::sim::TypedPlayerCommand& typed_command, std::uint32_t player_id) {
+        Mix(player_id + typed_command.As<command::FireProjectilePayload>().damage);
+    }
+    void OnAck(const novaria::sim::TypedPlayerCommand& typed_command, std::uint32_t player_id) {
+        Mix(player_id + typed_command.As<command::ReplicationEntityAckPayload>().acked_tick);
+    }
+};
+
+void ReferenceDispatch(ChecksumContext& context, const ReferenceTypedCommand& typed, std::uint32_t player_id) {
+    using novaria::sim::TypedPlayerCommandType;
+    // Mirrors the per-domain "IfMatched" chains the table replaced.
+    if (typed.type == TypedPlayerCommandType::PlayerMotionInput) {
+        context.Mix(player_id + static_cast<std::uint64_t>(typed.player_motion_input.move_axis_milli + 1000));
+    }
+    if (typed.type == TypedPlayerCommandType::WorldSetTile) {
+        context.Mix(player_id + typed.world_set_tile.material_id);
+    }
+    if (typed.type == TypedPlayerCommandType::GameplayCollectResource) {
+        context.Mix(player_id + typed.collect_resource.amount);
+    } else if (typed.type == TypedPlayerCommandType::GameplayPickupProbe) {
+        context.Mix(player_id + static_cast<std::uint64_t>(typed.pickup_probe.tile_x + 1000));
+    }
+    if (typed.type == TypedPlayerCommandType::CombatFireProjectile) {
+        context.Mix(player_id + typed.fire_projectile.damage);
+    }
+    if (typed.type == TypedPlayerCommandType::ReplicationEntityAck) {
+        context.Mix(player_id + typed.replication_entity_ack.acked_tick);
+    }
+}
+
+std::vector<novaria::net::PlayerCommand> BuildTickCommands(std::size_t command_count) {
+    std::vector<novaria::net::PlayerCommand> commands;
+    commands.reserve(command_count);
+    std::uint64_t state = 11;
+    for (std::size_t index = 0; index < command_count; ++index) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const std::uint32_t player_id = static_cast<std::uint32_t>(1 + (state >> 59));
+        const int value = static_cast<int>((state >> 33) % 997);
+        novaria::net::PlayerCommand player_command{.player_id = player_id, .payload = {}};
+        switch ((state >> 40) % 6) {
+            case 0:
+                player_command.command_id = command::kPlayerMotionInput;
+                player_command.payload = command::EncodePlayerMotionInputPayload({
+                    .move_axis_milli = value - 498,
+                    .input_flags = 0,
+                });
+                break;
+            case 1:
+                player_command.command_id = command::kWorldSetTile;
+                player_command.payload = command::EncodeWorldSetTilePayload({
+                    .tile_x = value,
+                    .tile_y = -value,
+                    .material_id = static_cast<std::uint16_t>(value % 8),
+                });
+                break;
+            case 2:
+                player_command.command_id = command::kGameplayCollectResource;
+                player_command.payload = command::EncodeCollectResourcePayload({
+                    .resource_id = command::kResourceWood,
+                    .amount = static_cast<std::uint32_t>(value + 1),
+                });
+                break;
+            case 3:
+                player_command.command_id = command::kGameplayPickupProbe;
+                player_command.payload = command::EncodePickupProbePayload({.tile_x = value, .tile_y = 3});
+                break;
+            case 4:
+                player_command.command_id = command::kCombatFireProjectile;
+                player_command.payload = command::EncodeFireProjectilePayload({
+                    .origin_tile_x = value,
+                    .origin_tile_y = 0,
+                    .velocity_milli_x = 1000,
+                    .velocity_milli_y = 0,
+                    .damage = static_cast<std::uint16_t>(value + 1),
+                    .lifetime_ticks = 60,
+                    .faction = 1,
+                });
+                break;
+            default:
+                player_command.command_id = command::kReplicationEntityAck;
+                player_command.payload = command::EncodeReplicationEntityAckPayload({.acked_tick = state >> 44});
+                break;
+        }
+        commands.push_back(std::move(player_command));
+    }
+    return commands;
+}
+
+template <typename Body>
+double MeasureNanosecondsPerItem(std::size_t item_count, int rounds, Body&& body) {
+    const auto start_time = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        body();
+    }
+    const auto end_time = std::chrono::steady_clock::now();
+    const double elapsed_ns =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+    return elapsed_ns / static_cast<double>(item_count * static_cast<std::size_t>(rounds));
+}
+
+}  // namespace
+
+int main() {
+    bool passed = true;
+    constexpr std::size_t kCommandsPerTick = 10000;
+    constexpr int kTicks = 200;
+
+    const std::vector<novaria::net::PlayerCommand> commands = BuildTickCommands(kCommandsPerTick);
+
+    ChecksumContext reference_context{};
+    std::size_t reference_decoded = 0;
+    const double reference_ns = MeasureNanosecondsPerItem(kCommandsPerTick, kTicks, [&]() {
+        ReferenceTypedCommand typed{};
+        for (const novaria::net::PlayerCommand& source : commands) {
+            if (!ReferenceDecode(source, typed)) {
+                continue;
+            }
+            ++reference_decoded;
+            ReferenceDispatch(reference_context, typed, source.player_id);
+        }
+    });
+
+    novaria::sim::TypedPlayerCommandHandlerTable<ChecksumContext> handlers{};
+    const auto add = [&handlers](
+                         novaria::sim::TypedPlayerCommandType type,
+                         novaria::sim::TypedPlayerCommandHandler<ChecksumContext> handler) {
+        handlers[static_cast<std::size_t>(type)] = handler;
+    };
+    add(novaria::sim::TypedPlayerCommandType::PlayerMotionInput, &ChecksumContext::OnMotion);
+    add(novaria::sim::TypedPlayerCommandType::WorldSetTile, &ChecksumContext::OnSetTile);
+    add(novaria::sim::TypedPlayerCommandType::GameplayCollectResource, &ChecksumContext::OnCollect);
+    add(novaria::sim::TypedPlayerCommandType::GameplayPickupProbe, &ChecksumContext::OnPickup);
+    add(novaria::sim::TypedPlayerCommandType::CombatFireProjectile, &ChecksumContext::OnProjectile);
+    add(novaria::sim::TypedPlayerCommandType::ReplicationEntityAck, &ChecksumContext::OnAck);
+
+    ChecksumContext table_context{};
+    std::size_t table_dispatched = 0;
+    const double table_ns = MeasureNanosecondsPerItem(kCommandsPerTick, kTicks, [&]() {
+        novaria::sim::TypedPlayerCommand scratch{};
+        for (const novaria::net::PlayerCommand& source : commands) {
+            table_dispatched += novaria::sim::DispatchPlayerCommand(source, handlers, table_context, scratch) ? 1 : 0;
+        }
+    });
+
+    passed &= Expect(
+        reference_decoded == kCommandsPerTick * kTicks && table_dispatched == reference_decoded,
+        "Every generated command should decode and dispatch on both paths.");
+    passed &= Expect(
+        table_context.checksum == reference_context.checksum,
+        "Table dispatch should observe the same payloads in the same order as the reference chain.");
+    passed &= Expect(
+        sizeof(novaria::sim::TypedPlayerCommand) < sizeof(ReferenceTypedCommand),
+        "Variant command should be smaller than the fat reference struct.");
+
+    std::cout << "[INFO] decode+dispatch ns/command (" << kCommandsPerTick << " commands/tick): reference="
+              << reference_ns << ", table=" << table_ns
+              << ", tick_us(reference/table)=" << reference_ns * kCommandsPerTick / 1000.0 << "/"
+              << table_ns * kCommandsPerTick / 1000.0 << '\n';
+    std::cout << "[INFO] command size bytes: reference=" << sizeof(ReferenceTypedCommand)
+              << ", variant=" << sizeof(novaria::sim::TypedPlayerCommand) << '\n';
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "[PASS] novaria_typed_command_perf_tests\n";
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include "wire/byte_io.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+bool Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+bool ReferenceReadVarUInt(novaria::wire::ByteReader& reader, std::uint64_t& out_value) {
+    out_value = 0;
+    std::uint32_t shift = 0;
+    for (int i = 0; i < 10; ++i) {
+        novaria::wire::Byte byte = 0;
+        if (!reader.ReadU8(byte)) {
+            return false;
+        }
+        const std::uint64_t chunk = static_cast<std::uint64_t>(byte & 0x7F);
+        if (shift >= 64 || (chunk << shift) >> shift != chunk) {
+            return false;
+        }
+        out_value |= (chunk << shift);
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+        shift += 7;
+    }
+    return false;
+}
+
+template <typename Body>
+double MeasureNanosecondsPerItem(std::size_t item_count, int rounds, Body&& body) {
+    const auto start_time = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        body();
+    }
+    const auto end_time = std::chrono::steady_clock::now();
+    const double elapsed_ns =
+        static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+    return elapsed_ns / static_cast<double>(item_count * static_cast<std::size_t>(rounds));
+}
+
+}  // namespace
+
+int main() {
+    bool passed = true;
+    constexpr std::size_t kValueCount = 1 << 16;
+    constexpr int kRounds = 64;
+
+    novaria::wire::ByteWriter writer;
+    std::uint64_t state = 7;
+    for (std::size_t index = 0; index < kValueCount; ++index) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        writer.WriteVarUInt(state >> (state % 57));
+    }
+    const novaria::wire::ByteBuffer& varints = writer.Buffer();
+    const novaria::wire::ByteSpan varint_span(varints.data(), varints.size());
+
+    std::uint64_t reference_checksum = 0;
+    const double reference_ns = MeasureNanosecondsPerItem(kValueCount, kRounds, [&]() {
+        novaria::wire::ByteReader reader(varint_span);
+        std::uint64_t value = 0;
+        while (ReferenceReadVarUInt(reader, value)) {
+            reference_checksum += value;
+        }
+    });
+
+    std::uint64_t fast_checksum = 0;
+    const double fast_ns = MeasureNanosecondsPerItem(kValueCount, kRounds, [&]() {
+        novaria::wire::ByteReader reader(varint_span);
+        std::uint64_t value = 0;
+        while (reader.ReadVarUInt(value)) {
+            fast_checksum += value;
+        }
+    });
+
+    std::vector<std::uint64_t> bulk_values(kValueCount);
+    std::uint64_t bulk_checksum = 0;
+    const double bulk_ns = MeasureNanosecondsPerItem(kValueCount, kRounds, [&]() {
+        novaria::wire::ByteReader reader(varint_span);
+        if (reader.ReadVarUInts(bulk_values)) {
+            for (const std::uint64_t value : bulk_values) {
+                bulk_checksum += value;
+            }
+        }
+    });
+
+    std::vector<std::uint16_t> tiles(kValueCount);
+    for (std::size_t index = 0; index < tiles.size(); ++index) {
+        tiles[index] = static_cast<std::uint16_t>(index * 2654435761U);
+    }
+    novaria::wire::ByteWriter tile_writer;
+    const double tile_write_ns = MeasureNanosecondsPerItem(kValueCount, kRounds, [&]() {
+        tile_writer.Clear();
+        tile_writer.WriteU16Array(tiles);
+    });
+    std::vector<std::uint16_t> decoded_tiles(kValueCount);
+    const novaria::wire::ByteBuffer& tile_bytes = tile_writer.Buffer();
+    const double tile_read_ns = MeasureNanosecondsPerItem(kValueCount, kRounds, [&]() {
+        novaria::wire::ByteReader reader(novaria::wire::ByteSpan(tile_bytes.data(), tile_bytes.size()));
+        (void)reader.ReadU16Array(decoded_tiles);
+    });
+
+    passed &= Expect(fast_checksum == reference_checksum, "Fast decode should match the reference checksum.");
+    passed &= Expect(bulk_checksum == reference_checksum, "Bulk decode should match the reference checksum.");
+    passed &= Expect(decoded_tiles == tiles, "Tile array should round-trip.");
+
+    std::cout << "[INFO] varint decode ns/value: reference=" << reference_ns
+              << ", fast=" << fast_ns
+              << ", bulk=" << bulk_ns
+              << ", bytes/value=" << static_cast<double>(varints.size()) / kValueCount << '\n';
+    std::cout << "[INFO] u16 array ns/tile: write=" << tile_write_ns << ", read=" << tile_read_ns << '\n';
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "[PASS] novaria_byte_io_perf_tests\n";
+    return 0;
+}
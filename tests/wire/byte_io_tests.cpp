@@ -0,0 +1,259 @@
+#include "wire/byte_io.h"
+#include "wire/small_byte_buffer.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+bool Expect(bool condition, const char* message) {
+    if (!condition) {
+        std::cerr << "[FAIL] " << message << '\n';
+        return false;
+    }
+    return true;
+}
+
+struct ReferenceVarUInt final {
+    bool ok = false;
+    std::uint64_t value = 0;
+    std::size_t consumed = 0;
+};
+
+ReferenceVarUInt ReferenceReadVarUInt(novaria::wire::ByteSpan bytes, std::size_t offset) {
+    ReferenceVarUInt result{};
+    std::uint32_t shift = 0;
+    for (int i = 0; i < 10; ++i) {
+        if (offset + result.consumed >= bytes.size()) {
+            return result;
+        }
+
+        const novaria::wire::Byte byte = bytes[offset + result.consumed];
+        ++result.consumed;
+        const std::uint64_t chunk = static_cast<std::uint64_t>(byte & 0x7F);
+        if (shift >= 64 || (chunk << shift) >> shift != chunk) {
+            return result;
+        }
+
+        result.value |= (chunk << shift);
+        if ((byte & 0x80) == 0) {
+            result.ok = true;
+            return result;
+        }
+
+        shift += 7;
+    }
+    return result;
+}
+
+std::uint64_t NextRandom(std::uint64_t& state) {
+    std::uint64_t value = (state += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+novaria::wire::Byte NextFuzzByte(std::uint64_t& state) {
+    const std::uint64_t random = NextRandom(state);
+    switch (random % 4) {
+        case 0:
+            return static_cast<novaria::wire::Byte>(random >> 8);
+        case 1:
+            return static_cast<novaria::wire::Byte>(0x80 | ((random >> 8) & 0x7F));
+        case 2:
+            return static_cast<novaria::wire::Byte>((random >> 8) & 0x03);
+        default:
+            return static_cast<novaria::wire::Byte>(0xFF);
+    }
+}
+
+bool TestVarUIntMatchesReferenceOnFuzzedInput() {
+    bool passed = true;
+
+    std::uint64_t state = 20260101;
+    std::size_t fast_path_decodes = 0;
+    for (int iteration = 0; iteration < 20000; ++iteration) {
+        std::vector<novaria::wire::Byte> bytes(NextRandom(state) % 40);
+        for (novaria::wire::Byte& byte : bytes) {
+            byte = NextFuzzByte(state);
+        }
+
+        const novaria::wire::ByteSpan span(bytes.data(), bytes.size());
+        novaria::wire::ByteReader reader(span);
+        std::size_t offset = 0;
+        while (true) {
+            if (reader.Remaining() >= novaria::wire::ByteReader::kMaxVarUIntSize) {
+                ++fast_path_decodes;
+            }
+            const ReferenceVarUInt expected = ReferenceReadVarUInt(span, offset);
+            std::uint64_t value = 0;
+            const bool ok = reader.ReadVarUInt(value);
+            if (ok != expected.ok || reader.Offset() != offset + expected.consumed ||
+                (ok && value != expected.value)) {
+                passed &= Expect(false, "Fast varint decode should match the reference decoder.");
+                return passed;
+            }
+            if (!ok) {
+                break;
+            }
+            offset += expected.consumed;
+        }
+    }
+
+    passed &= Expect(fast_path_decodes > 10000, "Fuzz corpus should exercise the fast path.");
+    return passed;
+}
+
+bool TestVarUIntRoundTripsBoundaryValues() {
+    bool passed = true;
+
+    const std::array<std::uint64_t, 12> values{
+        0,
+        1,
+        127,
+        128,
+        16383,
+        16384,
+        (1ULL << 35) - 1,
+        1ULL << 56,
+        (1ULL << 63) - 1,
+        1ULL << 63,
+        std::numeric_limits<std::uint64_t>::max() - 1,
+        std::numeric_limits<std::uint64_t>::max(),
+    };
+    for (const std::uint64_t value : values) {
+        novaria::wire::ByteWriter writer;
+        writer.WriteVarUInt(value);
+        const std::size_t encoded_size = writer.Buffer().size();
+        for (int padding = 0; padding < 12; ++padding) {
+            writer.WriteU8(0);
+        }
+
+        const novaria::wire::ByteBuffer& bytes = writer.Buffer();
+        novaria::wire::ByteReader padded_reader(novaria::wire::ByteSpan(bytes.data(), bytes.size()));
+        std::uint64_t padded_value = 0;
+        passed &= Expect(
+            padded_reader.ReadVarUInt(padded_value) && padded_value == value &&
+                padded_reader.Offset() == encoded_size,
+            "Fast path should round-trip boundary values.");
+
+        novaria::wire::ByteReader exact_reader(novaria::wire::ByteSpan(bytes.data(), encoded_size));
+        std::uint64_t exact_value = 0;
+        passed &= Expect(
+            exact_reader.ReadVarUInt(exact_value) && exact_value == value && exact_reader.IsFullyConsumed(),
+            "Bounded path should round-trip boundary values.");
+    }
+
+    const std::array<novaria::wire::Byte, 12> overlong{
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00,
+    };
+    novaria::wire::ByteReader overlong_reader(novaria::wire::ByteSpan(overlong.data(), overlong.size()));
+    std::uint64_t overlong_value = 0;
+    passed &= Expect(
+        !overlong_reader.ReadVarUInt(overlong_value),
+        "Tenth byte above one should overflow 64 bits.");
+    return passed;
+}
+
+bool TestBulkVarIntsAndFixedWidthArrays() {
+    bool passed = true;
+
+    novaria::wire::ByteWriter writer;
+    const std::array<std::uint64_t, 5> unsigned_values{0, 300, 1ULL << 40, 7, ~0ULL};
+    const std::array<std::int64_t, 4> signed_values{-1, 0, 123456, std::numeric_limits<std::int64_t>::min()};
+    const std::array<std::uint16_t, 4> tiles{0, 1, 0x1234, 0xFFFF};
+    const std::array<std::uint32_t, 3> words{0, 0xDEADBEEF, 42};
+    for (const std::uint64_t value : unsigned_values) {
+        writer.WriteVarUInt(value);
+    }
+    for (const std::int64_t value : signed_values) {
+        writer.WriteVarInt(value);
+    }
+    writer.WriteU16Array(tiles);
+    writer.WriteU32Array(words);
+
+    const novaria::wire::ByteBuffer& bytes = writer.Buffer();
+    const std::size_t tiles_offset = bytes.size() - words.size() * 4 - tiles.size() * 2;
+    passed &= Expect(
+        bytes[tiles_offset + 4] == 0x34 && bytes[tiles_offset + 5] == 0x12,
+        "u16 arrays should be written little-endian.");
+
+    novaria::wire::ByteReader reader(novaria::wire::ByteSpan(bytes.data(), bytes.size()));
+    std::array<std::uint64_t, 5> decoded_unsigned{};
+    std::array<std::int64_t, 4> decoded_signed{};
+    std::array<std::uint16_t, 4> decoded_tiles{};
+    std::array<std::uint32_t, 3> decoded_words{};
+    passed &= Expect(reader.ReadVarUInts(decoded_unsigned), "Bulk VarUInt read should succeed.");
+    passed &= Expect(reader.ReadVarInts(decoded_signed), "Bulk VarInt read should succeed.");
+    passed &= Expect(reader.ReadU16Array(decoded_tiles), "u16 array read should succeed.");
+    passed &= Expect(reader.ReadU32Array(decoded_words), "u32 array read should succeed.");
+    passed &= Expect(reader.IsFullyConsumed(), "Bulk reads should consume the whole buffer.");
+    passed &= Expect(decoded_unsigned == unsigned_values, "Bulk VarUInt values should round-trip.");
+    passed &= Expect(decoded_signed == signed_values, "Bulk VarInt values should round-trip.");
+    passed &= Expect(decoded_tiles == tiles, "u16 array should round-trip.");
+    passed &= Expect(decoded_words == words, "u32 array should round-trip.");
+
+    novaria::wire::ByteReader short_reader(novaria::wire::ByteSpan(bytes.data(), 3));
+    std::array<std::uint16_t, 2> short_tiles{};
+    passed &= Expect(!short_reader.ReadU16Array(short_tiles), "Truncated u16 array should fail.");
+    passed &= Expect(short_reader.Offset() == 0, "Failed fixed-width read should not consume bytes.");
+    return passed;
+}
+
+bool TestSmallByteBufferInlineAndHeapStorage() {
+    bool passed = true;
+
+    const novaria::wire::SmallByteBuffer short_payload{0x01, 0x02, 0x03};
+    passed &= Expect(
+        short_payload.IsInline() && short_payload.size() == 3 &&
+            short_payload == novaria::wire::ByteBuffer{0x01, 0x02, 0x03},
+        "Short payload should be stored inline.");
+
+    novaria::wire::ByteBuffer long_bytes(novaria::wire::SmallByteBuffer::kInlineCapacity + 5);
+    for (std::size_t index = 0; index < long_bytes.size(); ++index) {
+        long_bytes[index] = static_cast<novaria::wire::Byte>(index);
+    }
+    novaria::wire::SmallByteBuffer long_payload(long_bytes);
+    passed &= Expect(
+        !long_payload.IsInline() && long_payload == long_bytes,
+        "Payload above inline capacity should fall back to heap storage.");
+
+    novaria::wire::SmallByteBuffer copied_payload = long_payload;
+    novaria::wire::SmallByteBuffer moved_payload = std::move(long_payload);
+    passed &= Expect(
+        copied_payload == long_bytes && moved_payload == long_bytes && long_payload.empty(),
+        "Copy should duplicate and move should transfer heap payloads.");
+
+    moved_payload = short_payload;
+    passed &= Expect(
+        moved_payload.IsInline() && moved_payload == short_payload,
+        "Assigning a short payload should switch back to inline storage.");
+
+    novaria::wire::SmallByteBuffer moved_inline = std::move(moved_payload);
+    passed &= Expect(
+        moved_inline == short_payload && moved_payload.empty(),
+        "Moving an inline payload should leave the source empty.");
+    return passed;
+}
+
+}  // namespace
+
+int main() {
+    bool passed = true;
+    passed &= TestVarUIntMatchesReferenceOnFuzzedInput();
+    passed &= TestVarUIntRoundTripsBoundaryValues();
+    passed &= TestBulkVarIntsAndFixedWidthArrays();
+    passed &= TestSmallByteBufferInlineAndHeapStorage();
+
+    if (!passed) {
+        return 1;
+    }
+
+    std::cout << "[PASS] novaria_byte_io_tests\n";
+    return 0;
+}
@@ -4,6 +4,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -15,36 +16,39 @@ bool Expect(bool condition, const char* message) {
     return true;
 }
 
-bool ReplicateDirtyChunks(
+novaria::core::Status ReplicateDirtyChunks(
     novaria::world::IWorldService& source_world,
-    novaria::world::IWorldService& target_world,
-    std::string& error) {
-    const auto dirty_chunks = source_world.ConsumeDirtyChunks();
+    novaria::world::IWorldService& target_world) {
+    std::vector<novaria::world::ChunkCoord> dirty_chunks;
+    source_world.ConsumeDirtyChunks(dirty_chunks);
     for (const auto& chunk_coord : dirty_chunks) {
         novaria::world::ChunkSnapshot snapshot{};
-        if (!source_world.BuildChunkSnapshot(chunk_coord, snapshot, error)) {
-            return false;
+        novaria::core::Status status = source_world.BuildChunkSnapshot(chunk_coord, snapshot);
+        if (!status) {
+            return status;
         }
 
         novaria::wire::ByteBuffer payload;
-        if (!novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload, error)) {
-            return false;
+        status = novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, payload);
+        if (!status) {
+            return status;
         }
 
         novaria::world::ChunkSnapshot decoded{};
-        if (!novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot(
-                novaria::wire::ByteSpan(payload.data(), payload.size()),
-                decoded,
-                error)) {
-            return false;
+        status = novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot(
+            novaria::wire::ByteSpan(payload.data(), payload.size()),
+            decoded);
+        if (!status) {
+            return status;
         }
 
-        if (!target_world.ApplyChunkSnapshot(decoded, error)) {
-            return false;
+        status = target_world.ApplyChunkSnapshot(decoded);
+        if (!status) {
+            return status;
         }
     }
 
-    return true;
+    return novaria::core::Status::Ok();
 }
 
 }  // namespace
@@ -65,14 +69,14 @@ int main() {
 
     source_world->LoadChunk({.x = 0, .y = 0});
     passed &= Expect(
-        source_world->ApplyTileMutation({.tile_x = 0, .tile_y = 0, .material_id = 77}, error),
+        source_world->ApplyTileMutation({.tile_x = 0, .tile_y = 0, .material_id = 77}).IsOk(),
         "Source mutation at (0,0) should succeed.");
     passed &= Expect(
-        source_world->ApplyTileMutation({.tile_x = -1, .tile_y = -1, .material_id = 88}, error),
+        source_world->ApplyTileMutation({.tile_x = -1, .tile_y = -1, .material_id = 88}).IsOk(),
         "Source mutation at (-1,-1) should succeed.");
 
     passed &= Expect(
-        ReplicateDirtyChunks(*source_world, *target_world, error),
+        ReplicateDirtyChunks(*source_world, *target_world).IsOk(),
         "Dirty chunk replication should succeed.");
 
     std::uint16_t material_id = 0;
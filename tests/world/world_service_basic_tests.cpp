@@ -36,8 +36,10 @@ int main() {
 
     passed &= Expect(world_service->Initialize(error), "Initialize should succeed.");
     passed &= Expect(error.empty(), "Initialize should not return error message.");
+    std::vector<novaria::world::ChunkCoord> initial_dirty_chunks;
+    world_service->ConsumeDirtyChunks(initial_dirty_chunks);
     passed &= Expect(
-        world_service->ConsumeDirtyChunks().empty(),
+        initial_dirty_chunks.empty(),
         "No chunks should be dirty at start.");
 
     world_service->LoadChunk({.x = 0, .y = 0});
@@ -85,7 +87,7 @@ int main() {
     {
         novaria::world::ChunkSnapshot snapshot{};
         passed &= Expect(
-            world_service->BuildChunkSnapshot({.x = 0, .y = 0}, snapshot, error),
+            world_service->BuildChunkSnapshot({.x = 0, .y = 0}, snapshot).IsOk(),
             "BuildChunkSnapshot should succeed for loaded chunk.");
         passed &= Expect(!snapshot.tiles.empty(), "Chunk snapshot should contain tile data.");
 
@@ -97,7 +99,7 @@ int main() {
                 42),
         };
         passed &= Expect(
-            world_service->ApplyChunkSnapshot(incoming_snapshot, error),
+            world_service->ApplyChunkSnapshot(incoming_snapshot).IsOk(),
             "ApplyChunkSnapshot should succeed for valid snapshot.");
         passed &= Expect(
             world_service->TryReadTile(0, 0, material_id) && material_id == 42,
@@ -105,32 +107,33 @@ int main() {
 
         incoming_snapshot.tiles = {1, 2, 3};
         passed &= Expect(
-            !world_service->ApplyChunkSnapshot(incoming_snapshot, error),
+            !world_service->ApplyChunkSnapshot(incoming_snapshot).IsOk(),
             "ApplyChunkSnapshot should fail for invalid tile count.");
     }
 
     passed &= Expect(
-        world_service->ApplyTileMutation({.tile_x = 0, .tile_y = 0, .material_id = 99}, error),
+        world_service->ApplyTileMutation({.tile_x = 0, .tile_y = 0, .material_id = 99}).IsOk(),
         "Tile mutation at (0,0) should succeed.");
     passed &= Expect(
-        world_service->ApplyTileMutation({.tile_x = 1, .tile_y = 1, .material_id = 100}, error),
+        world_service->ApplyTileMutation({.tile_x = 1, .tile_y = 1, .material_id = 100}).IsOk(),
         "Second mutation in same chunk should also succeed.");
-    passed &= Expect(error.empty(), "Mutation at (0,0) should not report error.");
     passed &= Expect(world_service->TryReadTile(0, 0, material_id), "Tile (0,0) should still be readable.");
     passed &= Expect(material_id == 99, "Tile (0,0) should be overwritten by mutation.");
     {
-        const auto dirty_chunks = world_service->ConsumeDirtyChunks();
+        std::vector<novaria::world::ChunkCoord> dirty_chunks;
+        world_service->ConsumeDirtyChunks(dirty_chunks);
         passed &= Expect(
             dirty_chunks.size() == 1,
             "Multiple mutations in same chunk should still report one dirty chunk.");
         passed &= Expect(ContainsChunk(dirty_chunks, {.x = 0, .y = 0}), "Dirty chunk should contain (0,0).");
+        world_service->ConsumeDirtyChunks(dirty_chunks);
         passed &= Expect(
-            world_service->ConsumeDirtyChunks().empty(),
+            dirty_chunks.empty(),
             "Dirty chunks should be cleared after consume.");
     }
 
     passed &= Expect(
-        world_service->ApplyTileMutation({.tile_x = -1, .tile_y = -1, .material_id = 7}, error),
+        world_service->ApplyTileMutation({.tile_x = -1, .tile_y = -1, .material_id = 7}).IsOk(),
         "Tile mutation at negative coordinate should succeed.");
     passed &= Expect(
         world_service->TryReadTile(-1, -1, material_id),
@@ -139,21 +142,23 @@ int main() {
         world_service->TryReadTile(-1, -1, material_id) && material_id == 7,
         "Tile (-1,-1) should match mutation.");
     {
-        const auto dirty_chunks = world_service->ConsumeDirtyChunks();
+        std::vector<novaria::world::ChunkCoord> dirty_chunks;
+        world_service->ConsumeDirtyChunks(dirty_chunks);
         passed &= Expect(ContainsChunk(dirty_chunks, {.x = -1, .y = -1}), "Dirty chunk should contain (-1,-1).");
     }
 
     passed &= Expect(
-        world_service->ApplyTileMutation({.tile_x = 65, .tile_y = 0, .material_id = 3}, error),
+        world_service->ApplyTileMutation({.tile_x = 65, .tile_y = 0, .material_id = 3}).IsOk(),
         "Mutation in chunk (2,0) should succeed.");
     passed &= Expect(
-        world_service->ApplyTileMutation({.tile_x = -33, .tile_y = 0, .material_id = 4}, error),
+        world_service->ApplyTileMutation({.tile_x = -33, .tile_y = 0, .material_id = 4}).IsOk(),
         "Mutation in chunk (-2,0) should succeed.");
     passed &= Expect(
-        world_service->ApplyTileMutation({.tile_x = 0, .tile_y = -33, .material_id = 5}, error),
+        world_service->ApplyTileMutation({.tile_x = 0, .tile_y = -33, .material_id = 5}).IsOk(),
         "Mutation in chunk (0,-2) should succeed.");
     {
-        const auto dirty_chunks = world_service->ConsumeDirtyChunks();
+        std::vector<novaria::world::ChunkCoord> dirty_chunks;
+        world_service->ConsumeDirtyChunks(dirty_chunks);
         passed &= Expect(dirty_chunks.size() == 3, "Three chunks should be reported dirty.");
         if (dirty_chunks.size() == 3) {
             passed &= Expect(
@@ -175,15 +180,69 @@ int main() {
     {
         novaria::world::ChunkSnapshot snapshot{};
         passed &= Expect(
-            !world_service->BuildChunkSnapshot({.x = 0, .y = 0}, snapshot, error),
+            world_service->BuildChunkSnapshot({.x = 0, .y = 0}, snapshot).Code() ==
+                novaria::core::StatusCode::NotFound,
             "BuildChunkSnapshot should fail for unloaded chunk.");
     }
 
+    {
+        std::vector<novaria::world::ChunkCoord> dirty_chunks;
+        world_service->ConsumeDirtyChunks(dirty_chunks);
+        novaria::world::WorldState captured{};
+        world_service->CaptureState(captured);
+        const auto captured_tiles = [&captured](novaria::world::ChunkCoord chunk_coord) {
+            for (const novaria::world::WorldStateChunk& chunk : captured.chunks) {
+                if (chunk.chunk_coord.x == chunk_coord.x && chunk.chunk_coord.y == chunk_coord.y) {
+                    return chunk.tiles;
+                }
+            }
+            return std::shared_ptr<const std::vector<std::uint16_t>>{};
+        };
+        const auto captured_before = captured_tiles({.x = 1, .y = 0});
+        passed &= Expect(captured_before != nullptr, "Captured state should hold loaded chunk (1,0).");
+
+        world_service->TryReadTile(33, 1, material_id);
+        const std::uint16_t original_material_id = material_id;
+        passed &= Expect(
+            world_service->ApplyTileMutation({.tile_x = 33, .tile_y = 1, .material_id = 77}).IsOk(),
+            "Mutation after capture should succeed.");
+        world_service->LoadChunk({.x = 9, .y = 9});
+        world_service->UnloadChunk({.x = 2, .y = 0});
+        passed &= Expect(
+            captured_before != nullptr && (*captured_before)[32 + 1] == original_material_id,
+            "Mutation should copy the chunk instead of writing through the captured tiles.");
+
+        world_service->ConsumeDirtyChunks(dirty_chunks);
+        passed &= Expect(world_service->RestoreState(captured).IsOk(), "RestoreState should succeed.");
+        passed &= Expect(
+            world_service->TryReadTile(33, 1, material_id) && material_id == original_material_id,
+            "RestoreState should roll back mutated tiles.");
+        passed &= Expect(
+            world_service->TryReadTile(64, 0, material_id) && !world_service->TryReadTile(9 * 32, 9 * 32, material_id),
+            "RestoreState should reload unloaded chunks and unload chunks loaded after capture.");
+        world_service->ConsumeDirtyChunks(dirty_chunks);
+        passed &= Expect(
+            dirty_chunks.size() == 2 &&
+                ContainsChunk(dirty_chunks, {.x = 1, .y = 0}) &&
+                ContainsChunk(dirty_chunks, {.x = 2, .y = 0}),
+            "RestoreState should mark only chunks that changed since capture as dirty.");
+
+        novaria::world::WorldState truncated = captured;
+        truncated.chunks.front().tiles = std::make_shared<const std::vector<std::uint16_t>>(3, 0);
+        passed &= Expect(
+            world_service->RestoreState(truncated).Code() == novaria::core::StatusCode::InvalidArgument,
+            "RestoreState should reject chunks with a wrong tile count.");
+    }
+
     world_service->Shutdown();
+    const novaria::core::Status shutdown_status =
+        world_service->ApplyTileMutation({.tile_x = 2, .tile_y = 2, .material_id = 3});
     passed &= Expect(
-        !world_service->ApplyTileMutation({.tile_x = 2, .tile_y = 2, .material_id = 3}, error),
+        shutdown_status.Code() == novaria::core::StatusCode::NotInitialized,
         "Mutation should fail after shutdown.");
-    passed &= Expect(!error.empty(), "Mutation failure after shutdown should provide an error.");
+    passed &= Expect(
+        !shutdown_status.Message().empty(),
+        "Mutation failure after shutdown should provide an error.");
 
     if (!passed) {
         return 1;
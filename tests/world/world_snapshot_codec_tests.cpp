@@ -22,9 +22,8 @@ bool TestRoundTripEncodeDecode() {
     };
 
     novaria::wire::ByteBuffer payload;
-    std::string error;
     passed &= Expect(
-        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(input, payload, error),
+        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(input, payload).IsOk(),
         "Encode should succeed.");
     passed &= Expect(!payload.empty(), "Encoded payload should not be empty.");
 
@@ -32,8 +31,7 @@ bool TestRoundTripEncodeDecode() {
     passed &= Expect(
         novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot(
             novaria::wire::ByteSpan(payload.data(), payload.size()),
-            output,
-            error),
+            output).IsOk(),
         "Decode should succeed.");
     passed &= Expect(output.chunk_coord.x == input.chunk_coord.x, "Decoded chunk x should match.");
     passed &= Expect(output.chunk_coord.y == input.chunk_coord.y, "Decoded chunk y should match.");
@@ -45,18 +43,18 @@ bool TestRoundTripEncodeDecode() {
 bool TestDecodeRejectsInvalidPayload() {
     bool passed = true;
     novaria::world::ChunkSnapshot output{};
-    std::string error;
 
+    const novaria::core::Status empty_status =
+        novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot({}, output);
     passed &= Expect(
-        !novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot({}, output, error),
+        empty_status.Code() == novaria::core::StatusCode::MalformedPayload,
         "Decode should fail when payload is empty.");
-    passed &= Expect(!error.empty(), "Decode failure should provide error message.");
+    passed &= Expect(!empty_status.Message().empty(), "Decode failure should provide error message.");
 
     passed &= Expect(
         !novaria::world::WorldSnapshotCodec::DecodeChunkSnapshot(
             novaria::wire::ByteSpan(reinterpret_cast<const novaria::wire::Byte*>("\x01\x02"), 2),
-            output,
-            error),
+            output).IsOk(),
         "Decode should fail on truncated payload.");
 
     return passed;
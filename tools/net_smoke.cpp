@@ -157,10 +157,15 @@ bool TryBuildProbeChunkPayload(
     novaria::world::ChunkSnapshot snapshot{};
     snapshot.chunk_coord = novaria::world::ChunkCoord{.x = is_host ? 1 : -1, .y = 0};
     snapshot.tiles = {static_cast<std::uint16_t>(tick_index & 0xFFFFu)};
-    return novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(
-        snapshot,
-        out_payload,
-        out_error);
+    const novaria::core::Status status =
+        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, out_payload);
+    if (!status) {
+        out_error = status.Message();
+        return false;
+    }
+
+    out_error.clear();
+    return true;
 }
 
 }  // namespace
@@ -213,11 +218,11 @@ int main(int argc, char** argv) {
             }
         }
 
-        const std::vector<novaria::wire::ByteBuffer> payloads =
-            net_runtime->ConsumeRemoteChunkPayloads();
-        if (!payloads.empty()) {
+        std::vector<novaria::wire::ByteBuffer> received_payloads;
+        net_runtime->ConsumeRemoteChunkPayloads(received_payloads);
+        if (!received_payloads.empty()) {
             payload_received = true;
-            std::cout << "[INFO] received payload count=" << payloads.size() << '\n';
+            std::cout << "[INFO] received payload count=" << received_payloads.size() << '\n';
             break;
         }
 
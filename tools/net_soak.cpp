@@ -1,3 +1,4 @@
+#include "net/network_impairment.h"
 #include "runtime/net_service_factory.h"
 #include "world/snapshot_codec.h"
 
@@ -22,6 +23,7 @@ struct SoakOptions final {
     std::uint64_t allow_timeout_disconnects = 0;
     std::uint64_t inject_pause_tick = 0;
     std::uint64_t inject_pause_ms = 0;
+    novaria::net::NetworkImpairmentSettings impairment{};
 };
 
 bool ParseUInt16(std::string_view text, std::uint16_t& out_value) {
@@ -47,6 +49,67 @@ bool ParseUInt64(std::string_view text, std::uint64_t& out_value) {
     }
 }
 
+bool ParseUInt32(std::string_view text, std::uint32_t& out_value) {
+    std::uint64_t parsed = 0;
+    if (!ParseUInt64(text, parsed) || parsed > 0xFFFFFFFFULL) {
+        return false;
+    }
+
+    out_value = static_cast<std::uint32_t>(parsed);
+    return true;
+}
+
+bool ParseRate(std::string_view text, double& out_value) {
+    try {
+        const double parsed = std::stod(std::string(text));
+        if (!(parsed >= 0.0 && parsed <= 1.0)) {
+            return false;
+        }
+
+        out_value = parsed;
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool TryParseImpairmentOption(
+    std::string_view arg,
+    std::string_view value,
+    novaria::net::NetworkImpairmentSettings& out_settings,
+    bool& out_valid) {
+    std::uint32_t bandwidth_kbps = 0;
+    if (arg == "--impair-seed") {
+        out_valid = ParseUInt64(value, out_settings.seed);
+    } else if (arg == "--impair-latency-ms") {
+        out_valid = ParseUInt32(value, out_settings.latency_ms);
+    } else if (arg == "--impair-jitter-ms") {
+        out_valid = ParseUInt32(value, out_settings.jitter_ms);
+    } else if (arg == "--impair-loss") {
+        out_valid = ParseRate(value, out_settings.loss_rate);
+    } else if (arg == "--impair-burst-enter") {
+        out_valid = ParseRate(value, out_settings.burst_enter_rate);
+    } else if (arg == "--impair-burst-exit") {
+        out_valid = ParseRate(value, out_settings.burst_exit_rate);
+    } else if (arg == "--impair-burst-loss") {
+        out_valid = ParseRate(value, out_settings.burst_loss_rate);
+    } else if (arg == "--impair-duplicate") {
+        out_valid = ParseRate(value, out_settings.duplicate_rate);
+    } else if (arg == "--impair-reorder") {
+        out_valid = ParseRate(value, out_settings.reorder_rate);
+    } else if (arg == "--impair-reorder-delay-ms") {
+        out_valid = ParseUInt32(value, out_settings.reorder_delay_ms);
+    } else if (arg == "--impair-bandwidth-kbps") {
+        out_valid = ParseUInt32(value, bandwidth_kbps);
+        out_settings.bandwidth_bytes_per_second = static_cast<std::uint64_t>(bandwidth_kbps) * 1000 / 8;
+    } else {
+        return false;
+    }
+
+    out_settings.enabled = true;
+    return true;
+}
+
 bool ParseArguments(
     int argc,
     char** argv,
@@ -175,6 +238,21 @@ bool ParseArguments(
             continue;
         }
 
+        if (arg.rfind("--impair-", 0) == 0) {
+            const std::string value = read_value(arg.c_str());
+            if (value.empty()) {
+                return false;
+            }
+            bool valid = false;
+            if (TryParseImpairmentOption(arg, value, out_options.impairment, valid)) {
+                if (!valid) {
+                    out_error = "Invalid " + arg + " value";
+                    return false;
+                }
+                continue;
+            }
+        }
+
         out_error = "Unknown option: " + arg;
         return false;
     }
@@ -195,6 +273,9 @@ bool ParseArguments(
         out_error = "payload_interval must be > 0";
         return false;
     }
+    if (!novaria::net::ValidateNetworkImpairmentSettings(out_options.impairment, out_error)) {
+        return false;
+    }
 
     out_error.clear();
     return true;
@@ -208,7 +289,11 @@ void PrintUsage() {
         << "--remote-host <ip> --remote-port <port> "
         << "[--ticks <count>] [--payload-interval <count>] "
         << "[--allow-timeout-disconnects <count>] "
-        << "[--inject-pause-tick <tick>] [--inject-pause-ms <ms>]\n";
+        << "[--inject-pause-tick <tick>] [--inject-pause-ms <ms>] "
+        << "[--impair-seed <n>] [--impair-latency-ms <ms>] [--impair-jitter-ms <ms>] "
+        << "[--impair-loss <0..1>] [--impair-burst-enter <0..1>] [--impair-burst-exit <0..1>] "
+        << "[--impair-burst-loss <0..1>] [--impair-duplicate <0..1>] [--impair-reorder <0..1>] "
+        << "[--impair-reorder-delay-ms <ms>] [--impair-bandwidth-kbps <kbps>]\n";
 }
 
 bool TryBuildProbeChunkPayload(
@@ -219,10 +304,15 @@ bool TryBuildProbeChunkPayload(
     novaria::world::ChunkSnapshot snapshot{};
     snapshot.chunk_coord = novaria::world::ChunkCoord{.x = is_host ? 1 : -1, .y = 0};
     snapshot.tiles = {static_cast<std::uint16_t>(tick_index & 0xFFFFu)};
-    return novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(
-        snapshot,
-        out_payload,
-        out_error);
+    const novaria::core::Status status =
+        novaria::world::WorldSnapshotCodec::EncodeChunkSnapshot(snapshot, out_payload);
+    if (!status) {
+        out_error = status.Message();
+        return false;
+    }
+
+    out_error.clear();
+    return true;
 }
 
 }  // namespace
@@ -243,6 +333,7 @@ int main(int argc, char** argv) {
             .host = options.remote_host,
             .port = options.remote_port,
         },
+        .impairment = options.impairment,
     });
 
     if (!net_runtime->Initialize(error)) {
@@ -253,6 +344,7 @@ int main(int argc, char** argv) {
     const bool is_host = options.role == "host";
     std::uint64_t sent_payload_count = 0;
     std::uint64_t received_payload_count = 0;
+    std::vector<novaria::wire::ByteBuffer> received_payloads;
     std::uint64_t disconnected_tick_count = 0;
     std::uint64_t reconnect_request_count = 0;
     bool connected_once = false;
@@ -288,9 +380,8 @@ int main(int argc, char** argv) {
             ++reconnect_request_count;
         }
 
-        const std::vector<novaria::wire::ByteBuffer> payloads =
-            net_runtime->ConsumeRemoteChunkPayloads();
-        received_payload_count += payloads.size();
+        net_runtime->ConsumeRemoteChunkPayloads(received_payloads);
+        received_payload_count += received_payloads.size();
         std::this_thread::sleep_for(std::chrono::milliseconds(16));
     }
 
@@ -304,6 +395,12 @@ int main(int argc, char** argv) {
         << ", session_transitions=" << diagnostics.session_transition_count
         << ", timeout_disconnects=" << diagnostics.timeout_disconnect_count
         << ", ignored_senders=" << diagnostics.ignored_unexpected_sender_count
+        << ", impairment_dropped=" << diagnostics.impairment_dropped_datagram_count
+        << ", impairment_duplicated=" << diagnostics.impairment_duplicated_datagram_count
+        << ", impairment_reordered=" << diagnostics.impairment_reordered_datagram_count
+        << ", rtt_smoothed_us=" << diagnostics.smoothed_rtt_microseconds
+        << ", rtt_variance_us=" << diagnostics.rtt_variance_microseconds
+        << ", heartbeat_loss_estimate=" << diagnostics.estimated_loss_rate
         << '\n';
 
     net_runtime->Shutdown();
@@ -0,0 +1,59 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+BINARY_PATH="${1:-./build/novaria_net_soak}"
+TICKS="${2:-6000}"
+
+if [[ ! -x "$BINARY_PATH" ]]; then
+    echo "Soak binary not found: $BINARY_PATH" >&2
+    exit 1
+fi
+
+LOG_ROOT="${TMPDIR:-/tmp}/novaria-net-soak-impairment"
+rm -rf "$LOG_ROOT"
+mkdir -p "$LOG_ROOT"
+
+echo "[INFO] Starting impairment soak (latency/jitter/burst loss/duplication/reorder/bandwidth cap)."
+
+IMPAIR_ARGS=(
+    --impair-seed 20260101
+    --impair-latency-ms 80
+    --impair-jitter-ms 20
+    --impair-loss 0.02
+    --impair-burst-enter 0.01
+    --impair-burst-exit 0.25
+    --impair-burst-loss 0.8
+    --impair-duplicate 0.01
+    --impair-reorder 0.02
+    --impair-bandwidth-kbps 1024
+)
+
+"$BINARY_PATH" \
+    --role host \
+    --local-host 127.0.0.1 --local-port 27200 \
+    --remote-host 127.0.0.1 --remote-port 27201 \
+    --ticks "$TICKS" --payload-interval 30 \
+    --allow-timeout-disconnects 1 \
+    "${IMPAIR_ARGS[@]}" >"$LOG_ROOT/host.out.log" 2>"$LOG_ROOT/host.err.log" &
+HOST_PID=$!
+
+"$BINARY_PATH" \
+    --role client \
+    --local-host 127.0.0.1 --local-port 27201 \
+    --remote-host 127.0.0.1 --remote-port 27200 \
+    --ticks "$TICKS" --payload-interval 30 \
+    --allow-timeout-disconnects 1 \
+    "${IMPAIR_ARGS[@]}" >"$LOG_ROOT/client.out.log" 2>"$LOG_ROOT/client.err.log" &
+CLIENT_PID=$!
+
+wait "$HOST_PID" || true
+wait "$CLIENT_PID" || true
+
+if ! grep -q "\[PASS\] novaria_net_soak" "$LOG_ROOT/host.out.log" ||
+    ! grep -q "\[PASS\] novaria_net_soak" "$LOG_ROOT/client.out.log"; then
+    echo "[FAIL] Impairment soak failed. Logs: $LOG_ROOT"
+    exit 1
+fi
+
+grep -h "summary" "$LOG_ROOT/host.out.log" "$LOG_ROOT/client.out.log"
+echo "[PASS] Impairment soak passed. Logs: $LOG_ROOT"
@@ -87,6 +87,7 @@ $runtimeBin = Join-Path $BuildDirPath $Config
 $executables = @(
     "novaria.exe",
     "novaria_server.exe",
+    "novaria_replay.exe",
     "novaria_net_smoke.exe",
     "novaria_net_soak.exe"
 )
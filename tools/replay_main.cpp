@@ -0,0 +1,255 @@
+#include "core/config.h"
+#include "core/executable_path.h"
+#include "core/logger.h"
+#include "runtime/input_log_file.h"
+#include "runtime/mod_pipeline.h"
+#include "runtime/runtime_paths.h"
+#include "runtime/script_host_factory.h"
+#include "runtime/world_service_factory.h"
+#include "sim/input_replay.h"
+#include "sim/simulation_kernel.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+struct ReplayOptions final {
+    std::filesystem::path log_path;
+    std::filesystem::path config_path;
+    std::filesystem::path mod_root;
+    bool mods_overridden = false;
+    std::uint64_t snapshot_workers = 2;
+};
+
+bool ParseUInt64(std::string_view text, std::uint64_t& out_value) {
+    try {
+        out_value = static_cast<std::uint64_t>(std::stoull(std::string(text)));
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+bool ParseArguments(
+    int argc,
+    char** argv,
+    ReplayOptions& out_options,
+    std::string& out_error) {
+    for (int index = 1; index < argc; ++index) {
+        const std::string arg = argv[index];
+        auto read_value = [&](const char* key) -> std::string {
+            if (index + 1 >= argc) {
+                out_error = std::string("Missing value for option: ") + key;
+                return {};
+            }
+            ++index;
+            return argv[index];
+        };
+
+        if (arg == "--log") {
+            const std::string value = read_value("--log");
+            if (value.empty()) {
+                return false;
+            }
+            out_options.log_path = value;
+            continue;
+        }
+
+        if (arg == "--config") {
+            const std::string value = read_value("--config");
+            if (value.empty()) {
+                return false;
+            }
+            out_options.config_path = value;
+            continue;
+        }
+
+        if (arg == "--mods") {
+            const std::string value = read_value("--mods");
+            if (value.empty()) {
+                return false;
+            }
+            out_options.mod_root = value;
+            out_options.mods_overridden = true;
+            continue;
+        }
+
+        if (arg == "--snapshot-workers") {
+            const std::string value = read_value("--snapshot-workers");
+            if (value.empty()) {
+                return false;
+            }
+            if (!ParseUInt64(value, out_options.snapshot_workers)) {
+                out_error = "Invalid --snapshot-workers value";
+                return false;
+            }
+            continue;
+        }
+
+        out_error = "Unknown option: " + arg;
+        return false;
+    }
+
+    if (out_options.log_path.empty()) {
+        out_error = "--log is required";
+        return false;
+    }
+
+    out_error.clear();
+    return true;
+}
+
+void PrintUsage() {
+    std::cout
+        << "Usage:\n"
+        << "  novaria_replay --log <path> [--config <path>] [--mods <path>] [--snapshot-workers <count>]\n"
+        << "\n"
+        << "Replays an input log recorded by `novaria_server --record-input` through a fresh\n"
+        << "authority kernel without sleeping, verifies state hashes and reports ticks/sec.\n"
+        << "Exit codes: 0 = verified, 1 = error, 2 = state diverged.\n";
+}
+
+std::string FormatHash(std::uint64_t hash) {
+    char text[24];
+    std::snprintf(text, sizeof(text), "%016llx", static_cast<unsigned long long>(hash));
+    return std::string(text);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::filesystem::path executable_path = novaria::core::GetExecutablePath();
+    const std::filesystem::path exe_dir = executable_path.parent_path();
+
+    ReplayOptions options{};
+    std::string error;
+    if (!ParseArguments(argc, argv, options, error)) {
+        std::cerr << "[ERROR] " << error << '\n';
+        PrintUsage();
+        return 1;
+    }
+
+    novaria::sim::InputLog input_log;
+    if (!novaria::runtime::ReadInputLogFile(options.log_path, input_log, error) ||
+        !novaria::sim::ValidateInputLogForReplay(input_log, error)) {
+        std::cerr << "[ERROR] " << error << '\n';
+        return 1;
+    }
+    if (!input_log.has_end) {
+        novaria::core::Logger::Warn(
+            "replay",
+            "Input log has no end marker (recording was cut short); only checkpoints are verified.");
+    }
+
+    novaria::core::GameConfig config{};
+    if (!novaria::core::ConfigLoader::LoadEmbeddedDefaults(config, error)) {
+        novaria::core::Logger::Warn("replay", "Embedded default config load failed: " + error);
+    }
+
+    std::filesystem::path resolved_config_path = options.config_path;
+    if (resolved_config_path.empty()) {
+        resolved_config_path = exe_dir / "novaria_server.cfg";
+    } else if (resolved_config_path.is_relative()) {
+        resolved_config_path = exe_dir / resolved_config_path;
+    }
+    resolved_config_path = resolved_config_path.lexically_normal();
+    if (std::filesystem::exists(resolved_config_path) &&
+        !novaria::core::ConfigLoader::Load(resolved_config_path, config, error)) {
+        novaria::core::Logger::Warn("replay", "Config override load failed, ignoring: " + error);
+    }
+
+    std::filesystem::path mod_root = options.mod_root;
+    if (!options.mods_overridden) {
+        mod_root = novaria::runtime::ResolveRuntimePaths(exe_dir, config).mod_root;
+    } else if (!mod_root.empty() && mod_root.is_relative()) {
+        mod_root = exe_dir / mod_root;
+    }
+    mod_root = mod_root.lexically_normal();
+
+    std::unique_ptr<novaria::world::IWorldService> world_service =
+        novaria::runtime::CreateWorldService();
+    if (!world_service) {
+        std::cerr << "[ERROR] world service factory returned null\n";
+        return 1;
+    }
+    novaria::sim::InputReplayNetService net_service(input_log);
+    auto script_host = novaria::runtime::CreateScriptHost();
+
+    novaria::mod::ModLoader mod_loader;
+    std::vector<novaria::mod::ModManifest> loaded_mods;
+    std::string gameplay_fingerprint;
+    std::vector<novaria::script::ScriptModuleSource> script_modules;
+    if (!novaria::runtime::LoadModsAndScripts(
+            mod_root,
+            mod_loader,
+            loaded_mods,
+            gameplay_fingerprint,
+            script_modules,
+            error)) {
+        std::cerr << "[ERROR] load mods and scripts failed: " << error << '\n';
+        mod_loader.Shutdown();
+        return 1;
+    }
+
+    if (!script_host->SetScriptModules(std::move(script_modules), error)) {
+        std::cerr << "[ERROR] load mod script modules failed: " << error << '\n';
+        mod_loader.Shutdown();
+        return 1;
+    }
+
+    novaria::sim::SimulationKernel simulation_kernel(*world_service, net_service, *script_host);
+    simulation_kernel.SetAuthorityMode(novaria::sim::SimulationAuthorityMode::Authority);
+    simulation_kernel.SetLocalPlayerId(input_log.header.local_player_id);
+    if (!simulation_kernel.SetSnapshotEncodeWorkerCount(
+            static_cast<std::size_t>(options.snapshot_workers),
+            error)) {
+        std::cerr << "[ERROR] snapshot encode workers start failed: " << error << '\n';
+        mod_loader.Shutdown();
+        return 1;
+    }
+    if (!simulation_kernel.Initialize(error)) {
+        std::cerr << "[ERROR] replay initialize failed: " << error << '\n';
+        mod_loader.Shutdown();
+        return 1;
+    }
+
+    novaria::sim::InputReplayResult result{};
+    const bool replayed = novaria::sim::RunInputReplay(input_log, simulation_kernel, net_service, result, error);
+    simulation_kernel.Shutdown();
+    mod_loader.Shutdown();
+    if (!replayed) {
+        std::cerr << "[ERROR] replay failed: " << error << '\n';
+        return 1;
+    }
+
+    const double ticks_per_second =
+        result.elapsed_seconds > 0.0 ? static_cast<double>(result.replayed_tick_count) / result.elapsed_seconds : 0.0;
+    char rate_text[64];
+    std::snprintf(rate_text, sizeof(rate_text), "%.3fs, %.1f ticks/sec", result.elapsed_seconds, ticks_per_second);
+    novaria::core::Logger::Info(
+        "replay",
+        "Replayed ticks=" + std::to_string(result.replayed_tick_count) +
+            " (" + std::to_string(result.start_tick) + ".." + std::to_string(result.end_tick) + ")" +
+            ", commands=" + std::to_string(result.replayed_command_count) +
+            ", checkpoints_verified=" + std::to_string(result.verified_checkpoint_count) + "/" +
+            std::to_string(input_log.checkpoints.size()) +
+            ", end_state=" + (input_log.has_end ? (result.verified_end_state ? "verified" : "mismatch") : "absent") +
+            ", elapsed=" + rate_text);
+
+    if (result.diverged) {
+        std::cerr << "[ERROR] state diverged at tick " << result.divergent_tick
+                  << ": expected=" << FormatHash(result.expected_state_hash)
+                  << ", actual=" << FormatHash(result.actual_state_hash) << '\n';
+        return 2;
+    }
+
+    std::cout << "[PASS] replay verified\n";
+    return 0;
+}
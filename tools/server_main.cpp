@@ -1,6 +1,9 @@
 #include "core/config.h"
 #include "core/executable_path.h"
 #include "core/logger.h"
+#include "core/thread_affinity.h"
+#include "core/tick_scheduler.h"
+#include "runtime/input_log_file.h"
 #include "runtime/mod_pipeline.h"
 #include "runtime/net_service_factory.h"
 #include "runtime/script_host_factory.h"
@@ -8,13 +11,17 @@
 #include "runtime/world_service_factory.h"
 #include "sim/command_schema.h"
 #include "sim/simulation_kernel.h"
+#include "wire/envelope.h"
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <csignal>
+#include <cstdio>
 #include <cstdint>
 #include <filesystem>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -30,8 +37,18 @@ struct ServerOptions final {
     std::uint64_t ticks = 0;
     double fixed_delta_seconds = 1.0 / 60.0;
     std::uint64_t log_interval_ticks = 300;
+    bool tick_profile = true;
+    std::uint64_t snapshot_workers = 2;
+    std::filesystem::path record_input_path;
+    std::uint64_t record_checkpoint_interval_ticks = 600;
+    bool fast_forward = false;
+    std::uint64_t max_catch_up_ticks = 15;
+    std::uint64_t shard_count = 1;
+    bool pin_threads = true;
 };
 
+constexpr std::uint64_t kMaxShardCount = 64;
+
 std::atomic_bool g_keep_running{true};
 
 void OnSignal(int signal_code) {
@@ -116,6 +133,78 @@ bool ParseArguments(
             continue;
         }
 
+        if (arg == "--snapshot-workers") {
+            const std::string value = read_value("--snapshot-workers");
+            if (value.empty()) {
+                return false;
+            }
+            if (!ParseUInt64(value, out_options.snapshot_workers)) {
+                out_error = "Invalid --snapshot-workers value";
+                return false;
+            }
+            continue;
+        }
+
+        if (arg == "--record-input") {
+            const std::string value = read_value("--record-input");
+            if (value.empty()) {
+                return false;
+            }
+            out_options.record_input_path = value;
+            continue;
+        }
+
+        if (arg == "--record-checkpoint-interval") {
+            const std::string value = read_value("--record-checkpoint-interval");
+            if (value.empty()) {
+                return false;
+            }
+            if (!ParseUInt64(value, out_options.record_checkpoint_interval_ticks)) {
+                out_error = "Invalid --record-checkpoint-interval value";
+                return false;
+            }
+            continue;
+        }
+
+        if (arg == "--fast-forward") {
+            out_options.fast_forward = true;
+            continue;
+        }
+
+        if (arg == "--max-catch-up-ticks") {
+            const std::string value = read_value("--max-catch-up-ticks");
+            if (value.empty()) {
+                return false;
+            }
+            if (!ParseUInt64(value, out_options.max_catch_up_ticks)) {
+                out_error = "Invalid --max-catch-up-ticks value";
+                return false;
+            }
+            continue;
+        }
+
+        if (arg == "--shards") {
+            const std::string value = read_value("--shards");
+            if (value.empty()) {
+                return false;
+            }
+            if (!ParseUInt64(value, out_options.shard_count)) {
+                out_error = "Invalid --shards value";
+                return false;
+            }
+            continue;
+        }
+
+        if (arg == "--no-pin-threads") {
+            out_options.pin_threads = false;
+            continue;
+        }
+
+        if (arg == "--no-tick-profile") {
+            out_options.tick_profile = false;
+            continue;
+        }
+
         if (arg == "--log-interval") {
             const std::string value = read_value("--log-interval");
             if (value.empty()) {
@@ -136,6 +225,10 @@ bool ParseArguments(
         out_error = "--fixed-delta must be > 0";
         return false;
     }
+    if (out_options.shard_count == 0 || out_options.shard_count > kMaxShardCount) {
+        out_error = "--shards must be within [1," + std::to_string(kMaxShardCount) + "]";
+        return false;
+    }
 
     out_error.clear();
     return true;
@@ -146,10 +239,384 @@ void PrintUsage() {
         << "Usage:\n"
         << "  novaria_server [--config <path>] [--ticks <count>] "
         << "[--mods <path>] [--fixed-delta <seconds>] [--log-interval <ticks>]\n"
+        << "                 [--snapshot-workers <count>] [--no-tick-profile]\n"
+        << "                 [--record-input <path>] [--record-checkpoint-interval <ticks>]\n"
+        << "                 [--fast-forward] [--max-catch-up-ticks <count>]\n"
+        << "                 [--shards <count>] [--no-pin-threads]\n"
         << "\n"
         << "Examples:\n"
         << "  novaria_server --config novaria_server.cfg --mods mods --ticks 7200\n"
-        << "  novaria_server --config novaria_server.cfg --fixed-delta 0.0166667\n";
+        << "  novaria_server --config novaria_server.cfg --fixed-delta 0.0166667\n"
+        << "  novaria_server --record-input server.nvil --ticks 36000\n"
+        << "  novaria_server --fast-forward --ticks 216000\n"
+        << "  novaria_server --config novaria_server.cfg --shards 4\n";
+}
+
+struct ServerShard final {
+    std::size_t index = 0;
+    std::string log_module = "server";
+    std::uint16_t local_port = 0;
+    std::uint16_t remote_port = 0;
+    std::unique_ptr<novaria::world::IWorldService> world_service;
+    std::unique_ptr<novaria::net::INetService> net_service;
+    std::unique_ptr<novaria::script::IScriptHost> script_host;
+    std::unique_ptr<novaria::sim::SimulationKernel> simulation_kernel;
+    novaria::runtime::InputLogFileWriter input_log_writer;
+    novaria::wire::ByteBuffer input_log_bytes;
+    novaria::core::TickScheduler tick_scheduler;
+    novaria::core::TickScheduler::Clock::time_point loop_start_time{};
+    std::uint64_t loop_start_tick = 0;
+};
+
+bool OffsetPort(int base_port, std::size_t shard_index, std::uint16_t& out_port, std::string& out_error) {
+    if (base_port == 0) {
+        out_port = 0;
+        out_error.clear();
+        return true;
+    }
+    const std::uint64_t port = static_cast<std::uint64_t>(base_port) + shard_index;
+    if (port > std::numeric_limits<std::uint16_t>::max()) {
+        out_error = "shard " + std::to_string(shard_index) + " port out of range: " + std::to_string(port);
+        return false;
+    }
+    out_port = static_cast<std::uint16_t>(port);
+    out_error.clear();
+    return true;
+}
+
+std::filesystem::path ShardRecordInputPath(
+    const std::filesystem::path& path,
+    std::size_t shard_index,
+    std::size_t shard_count) {
+    if (shard_count <= 1) {
+        return path;
+    }
+    std::filesystem::path shard_path = path;
+    shard_path.replace_filename(
+        path.stem().string() + ".shard" + std::to_string(shard_index) + path.extension().string());
+    return shard_path;
+}
+
+void FlushInputLog(ServerShard& shard) {
+    if (!shard.input_log_writer.IsOpen()) {
+        return;
+    }
+    shard.simulation_kernel->ConsumeInputRecording(shard.input_log_bytes);
+    std::string write_error;
+    if (!shard.input_log_writer.Append(
+            novaria::wire::ByteSpan(shard.input_log_bytes.data(), shard.input_log_bytes.size()),
+            write_error)) {
+        novaria::core::Logger::Warn(shard.log_module, "Input recording stopped: " + write_error);
+        shard.simulation_kernel->StopInputRecording();
+        shard.input_log_writer.Close();
+    }
+}
+
+void ShutdownShard(ServerShard& shard) {
+    if (!shard.simulation_kernel) {
+        return;
+    }
+    shard.simulation_kernel->StopInputRecording();
+    FlushInputLog(shard);
+    shard.input_log_writer.Close();
+    shard.simulation_kernel->Shutdown();
+    shard.simulation_kernel.reset();
+}
+
+bool CreateShard(
+    std::size_t shard_index,
+    const ServerOptions& options,
+    const novaria::core::GameConfig& config,
+    std::vector<novaria::script::ScriptModuleSource> script_modules,
+    ServerShard& out_shard,
+    std::string& out_error) {
+    out_shard.index = shard_index;
+    if (options.shard_count > 1) {
+        out_shard.log_module = "server.shard" + std::to_string(shard_index);
+    }
+    if (!OffsetPort(config.net_udp_local_port, shard_index, out_shard.local_port, out_error) ||
+        !OffsetPort(config.net_udp_remote_port, shard_index, out_shard.remote_port, out_error)) {
+        return false;
+    }
+
+    out_shard.world_service = novaria::runtime::CreateWorldService();
+    if (!out_shard.world_service) {
+        out_error = "world service factory returned null";
+        return false;
+    }
+    out_shard.net_service = novaria::runtime::CreateNetService(novaria::runtime::NetServiceConfig{
+        .local_host = config.net_udp_local_host,
+        .local_port = out_shard.local_port,
+        .remote_endpoint = novaria::net::UdpEndpoint{
+            .host = config.net_udp_remote_host,
+            .port = out_shard.remote_port,
+        },
+    });
+    out_shard.script_host = novaria::runtime::CreateScriptHost();
+    if (!out_shard.script_host->SetScriptModules(std::move(script_modules), out_error)) {
+        out_error = "load mod script modules failed: " + out_error;
+        return false;
+    }
+
+    out_shard.simulation_kernel = std::make_unique<novaria::sim::SimulationKernel>(
+        *out_shard.world_service,
+        *out_shard.net_service,
+        *out_shard.script_host);
+    novaria::sim::SimulationKernel& simulation_kernel = *out_shard.simulation_kernel;
+    simulation_kernel.SetAuthorityMode(novaria::sim::SimulationAuthorityMode::Authority);
+    simulation_kernel.SetTickProfilerSettings({
+        .enabled = options.tick_profile,
+        .tick_budget_ms = options.fixed_delta_seconds * 1000.0,
+    });
+    if (!simulation_kernel.SetSnapshotEncodeWorkerCount(
+            static_cast<std::size_t>(options.snapshot_workers),
+            out_error)) {
+        out_error = "snapshot encode workers start failed: " + out_error;
+        out_shard.simulation_kernel.reset();
+        return false;
+    }
+
+    if (!simulation_kernel.Initialize(out_error)) {
+        out_error = "server initialize failed: " + out_error;
+        out_shard.simulation_kernel.reset();
+        return false;
+    }
+
+    if (!options.record_input_path.empty()) {
+        const std::filesystem::path record_path = ShardRecordInputPath(
+            options.record_input_path,
+            shard_index,
+            static_cast<std::size_t>(options.shard_count));
+        if (!out_shard.input_log_writer.Open(record_path, out_error)) {
+            ShutdownShard(out_shard);
+            return false;
+        }
+        simulation_kernel.StartInputRecording(options.record_checkpoint_interval_ticks);
+        novaria::core::Logger::Info(
+            out_shard.log_module,
+            "Recording input: " + record_path.string() +
+                ", checkpoint_interval_ticks=" + std::to_string(options.record_checkpoint_interval_ticks));
+    }
+
+    const int preload_chunk_radius = 2;
+    for (int chunk_y = -preload_chunk_radius; chunk_y <= preload_chunk_radius; ++chunk_y) {
+        for (int chunk_x = -preload_chunk_radius; chunk_x <= preload_chunk_radius; ++chunk_x) {
+            simulation_kernel.SubmitLocalCommand(novaria::net::PlayerCommand{
+                .player_id = 1,
+                .command_id = novaria::sim::command::kWorldLoadChunk,
+                .payload = novaria::sim::command::EncodeWorldChunkPayload({.chunk_x = chunk_x, .chunk_y = chunk_y}),
+            });
+        }
+    }
+    simulation_kernel.Update(options.fixed_delta_seconds);
+
+    out_shard.tick_scheduler.SetSettings({
+        .tick_interval_seconds = options.fixed_delta_seconds,
+        .max_catch_up_ticks = static_cast<std::uint32_t>(
+            std::min<std::uint64_t>(options.max_catch_up_ticks, std::numeric_limits<std::uint32_t>::max())),
+        .fast_forward = options.fast_forward,
+    });
+
+    novaria::core::Logger::Info(
+        out_shard.log_module,
+        "Server started: local=" + config.net_udp_local_host +
+            ":" + std::to_string(out_shard.local_port) +
+            ", remote=" + config.net_udp_remote_host +
+            ":" + std::to_string(out_shard.remote_port) +
+            ", ticks_limit=" + std::to_string(options.ticks) +
+            ", pacing=" + (options.fast_forward ? "fast_forward" : "realtime") +
+            ", max_catch_up_ticks=" + std::to_string(options.max_catch_up_ticks));
+    out_error.clear();
+    return true;
+}
+
+std::string FormatPacing(const ServerShard& shard, const ServerOptions& options) {
+    using ServerClock = novaria::core::TickScheduler::Clock;
+    const novaria::core::TickSchedulerStats pacing = shard.tick_scheduler.Stats();
+    const double elapsed_seconds =
+        std::chrono::duration<double>(ServerClock::now() - shard.loop_start_time).count();
+    const double simulated_seconds =
+        static_cast<double>(shard.simulation_kernel->CurrentTick() - shard.loop_start_tick) *
+        options.fixed_delta_seconds;
+    char stats_text[192];
+    std::snprintf(
+        stats_text,
+        sizeof(stats_text),
+        "tick_ms(mean/max)=%.3f/%.3f, lateness_ms(mean/max)=%.3f/%.3f, rate=%.1f ticks/sec (%.2fx realtime)",
+        pacing.mean_tick_ms,
+        pacing.max_tick_ms,
+        pacing.mean_lateness_ms,
+        pacing.max_lateness_ms,
+        elapsed_seconds > 0.0 ? simulated_seconds / options.fixed_delta_seconds / elapsed_seconds : 0.0,
+        elapsed_seconds > 0.0 ? simulated_seconds / elapsed_seconds : 0.0);
+    return std::string("mode=") + (options.fast_forward ? "fast_forward" : "realtime") +
+        ", catch_up_ticks=" + std::to_string(pacing.catch_up_tick_count) +
+        ", skipped_ticks=" + std::to_string(pacing.skipped_tick_count) +
+        ", overruns=" + std::to_string(pacing.overrun_count) + "/" + std::to_string(pacing.tick_count) +
+        ", " + stats_text;
+}
+
+void LogShardDiagnostics(ServerShard& shard, const ServerOptions& options, std::uint64_t current_tick) {
+    const std::string& log_module = shard.log_module;
+    novaria::sim::SimulationKernel& simulation_kernel = *shard.simulation_kernel;
+    const novaria::net::NetDiagnosticsSnapshot diagnostics = shard.net_service->DiagnosticsSnapshot();
+    std::string traffic_text;
+    for (std::size_t kind = 0; kind < diagnostics.traffic_by_kind.size(); ++kind) {
+        const novaria::net::NetMessageKindTraffic& traffic = diagnostics.traffic_by_kind[kind];
+        if (traffic.sent_packet_count == 0 && traffic.received_packet_count == 0) {
+            continue;
+        }
+        const char* kind_name =
+            kind == 0 ? "unknown"
+                      : novaria::wire::MessageKindName(static_cast<novaria::wire::MessageKind>(kind));
+        traffic_text +=
+            std::string(traffic_text.empty() ? "" : " ") + kind_name + "=" +
+            std::to_string(traffic.sent_packet_count) + "p/" +
+            std::to_string(traffic.sent_byte_count) + "B>" +
+            std::to_string(traffic.received_packet_count) + "p/" +
+            std::to_string(traffic.received_byte_count) + "B";
+    }
+    std::string size_histogram_text;
+    for (const std::uint64_t bucket_count : diagnostics.sent_datagram_size_histogram) {
+        size_histogram_text +=
+            (size_histogram_text.empty() ? "" : "/") + std::to_string(bucket_count);
+    }
+    FlushInputLog(shard);
+    novaria::core::Logger::Info(
+        log_module,
+        "Tick=" + std::to_string(current_tick) +
+            ", session_state=" + std::to_string(static_cast<int>(diagnostics.session_state)) +
+            ", transitions=" + std::to_string(diagnostics.session_transition_count) +
+            ", timeout_disconnects=" + std::to_string(diagnostics.timeout_disconnect_count) +
+            ", ignored_senders=" + std::to_string(diagnostics.ignored_unexpected_sender_count) +
+            ", rtt_us(last/smoothed/var/min)=" +
+            std::to_string(diagnostics.last_rtt_microseconds) + "/" +
+            std::to_string(diagnostics.smoothed_rtt_microseconds) + "/" +
+            std::to_string(diagnostics.rtt_variance_microseconds) + "/" +
+            std::to_string(diagnostics.min_rtt_microseconds) +
+            ", heartbeat_loss(lost/received/estimate)=" +
+            std::to_string(diagnostics.heartbeat_lost_count) + "/" +
+            std::to_string(diagnostics.heartbeat_received_count) + "/" +
+            std::to_string(diagnostics.estimated_loss_rate) +
+            ", traffic(sent>received)=[" + traffic_text + "]" +
+            ", sent_sizes(<=64/128/256/512/1024/1200/1472/>1472)=" + size_histogram_text);
+    const novaria::sim::InputJitterBufferDiagnostics jitter =
+        simulation_kernel.InputJitterBufferDiagnosticsSnapshot();
+    novaria::core::Logger::Info(
+        log_module,
+        "Input jitter buffer: players=" + std::to_string(jitter.tracked_player_count) +
+            ", buffered=" + std::to_string(jitter.buffered_command_count) +
+            ", max_delay_ticks=" + std::to_string(jitter.max_player_delay_ticks) +
+            ", inputs(on_time/late/clamped/unstamped/dropped)=" +
+            std::to_string(jitter.on_time_command_count) + "/" +
+            std::to_string(jitter.late_command_count) + "/" +
+            std::to_string(jitter.early_clamped_command_count) + "/" +
+            std::to_string(jitter.unstamped_command_count) + "/" +
+            std::to_string(jitter.dropped_overflow_count) +
+            ", deferred=" + std::to_string(jitter.deferred_command_count) +
+            ", evicted=" + std::to_string(jitter.evicted_player_count));
+    const novaria::sim::CommandRateLimiterDiagnostics admission =
+        simulation_kernel.CommandRateLimiterDiagnosticsSnapshot();
+    std::string player_drop_text;
+    for (const novaria::sim::PlayerCommandRateDiagnostics& player : admission.players) {
+        if (player.rate_limited_count == 0) {
+            continue;
+        }
+        player_drop_text += std::string(player_drop_text.empty() ? "" : " ") +
+            std::to_string(player.player_id) + ":rate=";
+        for (std::size_t index = 0; index < player.rate_limited_by_class.size(); ++index) {
+            player_drop_text += std::string(index == 0 ? "" : "/") +
+                std::to_string(player.rate_limited_by_class[index]);
+        }
+    }
+    for (const novaria::sim::InputJitterPlayerDiagnostics& player : jitter.players) {
+        if (player.dropped_overflow_count != 0) {
+            player_drop_text += std::string(player_drop_text.empty() ? "" : " ") +
+                std::to_string(player.player_id) + ":overflow=" +
+                std::to_string(player.dropped_overflow_count);
+        }
+    }
+    for (const novaria::net::NetPlayerCommandDrops& player : diagnostics.player_command_drops) {
+        player_drop_text += std::string(player_drop_text.empty() ? "" : " ") +
+            std::to_string(player.player_id) + ":net_queue_full=" +
+            std::to_string(player.dropped_queue_full_count);
+    }
+    novaria::core::Logger::Info(
+        log_module,
+        "Input admission: admitted=" + std::to_string(admission.admitted_count) +
+            ", rate_limited=" + std::to_string(admission.rate_limited_count) +
+            ", untracked_dropped=" + std::to_string(admission.untracked_player_dropped_count) +
+            ", evicted=" + std::to_string(admission.evicted_player_count) +
+            ", net_player_queue_full=" +
+            std::to_string(diagnostics.dropped_command_player_queue_full_count) +
+            ", player_drops=" +
+            (player_drop_text.empty() ? std::string("none") : player_drop_text));
+    const novaria::sim::TickProfilerDiagnostics profile =
+        simulation_kernel.TickProfilerDiagnosticsSnapshot();
+    if (profile.enabled) {
+        const auto format_ms = [](double milliseconds) {
+            char text[32];
+            std::snprintf(text, sizeof(text), "%.3f", milliseconds);
+            return std::string(text);
+        };
+        std::string phase_text;
+        for (std::size_t phase = 0; phase < profile.phases.size(); ++phase) {
+            const novaria::sim::TickPhaseTiming& timing = profile.phases[phase];
+            phase_text +=
+                std::string(phase_text.empty() ? "" : " ") +
+                novaria::sim::TickPhaseName(static_cast<novaria::sim::TickPhase>(phase)) + "=" +
+                format_ms(timing.p50_ms) + "/" + format_ms(timing.p99_ms) + "/" +
+                format_ms(timing.max_ms) + "#" + std::to_string(timing.dominant_overrun_count);
+        }
+        novaria::core::Logger::Info(
+            log_module,
+            "Tick profile: budget_ms=" + format_ms(profile.tick_budget_ms) +
+                ", overruns=" + std::to_string(profile.overrun_count) + "/" +
+                std::to_string(profile.profiled_tick_count) +
+                ", total_ms(p50/p99/max)=" + format_ms(profile.total.p50_ms) + "/" +
+                format_ms(profile.total.p99_ms) + "/" + format_ms(profile.total.max_ms) +
+                ", phases_ms(p50/p99/max#overrun_dominant)=[" + phase_text + "]");
+    }
+    novaria::core::Logger::Info(log_module, "Tick pacing: " + FormatPacing(shard, options));
+}
+
+void RunShard(ServerShard& shard, const ServerOptions& options) {
+    if (options.pin_threads && options.shard_count > 1) {
+        const std::size_t core_index = shard.index % novaria::core::HardwareThreadCount();
+        std::string pin_error;
+        if (novaria::core::PinCurrentThreadToCore(core_index, pin_error)) {
+            novaria::core::Logger::Info(shard.log_module, "Tick thread pinned: core=" + std::to_string(core_index));
+        } else {
+            novaria::core::Logger::Warn(shard.log_module, "Tick thread pinning skipped: " + pin_error);
+        }
+    }
+
+    using ServerClock = novaria::core::TickScheduler::Clock;
+    novaria::sim::SimulationKernel& simulation_kernel = *shard.simulation_kernel;
+    shard.loop_start_time = ServerClock::now();
+    shard.loop_start_tick = simulation_kernel.CurrentTick();
+    shard.tick_scheduler.Start(shard.loop_start_time);
+
+    while (g_keep_running.load()) {
+        const std::uint64_t current_tick = simulation_kernel.CurrentTick();
+        if (options.ticks > 0 && current_tick >= options.ticks) {
+            break;
+        }
+
+        shard.tick_scheduler.WaitForNextTick();
+        if (!shard.tick_scheduler.TryBeginTick(ServerClock::now())) {
+            continue;
+        }
+        simulation_kernel.Update(options.fixed_delta_seconds);
+        shard.tick_scheduler.EndTick(ServerClock::now());
+
+        if (options.log_interval_ticks > 0 &&
+            current_tick > 0 &&
+            current_tick % options.log_interval_ticks == 0) {
+            LogShardDiagnostics(shard, options, current_tick);
+        }
+    }
+    novaria::core::Logger::Info(shard.log_module, "Tick pacing summary: " + FormatPacing(shard, options));
 }
 
 }  // namespace
@@ -208,22 +675,6 @@ int main(int argc, char** argv) {
     }
     mod_root = mod_root.lexically_normal();
 
-    std::unique_ptr<novaria::world::IWorldService> world_service =
-        novaria::runtime::CreateWorldService();
-    if (!world_service) {
-        std::cerr << "[ERROR] world service factory returned null\n";
-        return 1;
-    }
-    auto net_service = novaria::runtime::CreateNetService(novaria::runtime::NetServiceConfig{
-        .local_host = config.net_udp_local_host,
-        .local_port = static_cast<std::uint16_t>(config.net_udp_local_port),
-        .remote_endpoint = novaria::net::UdpEndpoint{
-            .host = config.net_udp_remote_host,
-            .port = static_cast<std::uint16_t>(config.net_udp_remote_port),
-        },
-    });
-    auto script_host = novaria::runtime::CreateScriptHost();
-
     novaria::mod::ModLoader mod_loader;
     std::vector<novaria::mod::ModManifest> loaded_mods;
     std::string gameplay_fingerprint;
@@ -240,75 +691,51 @@ int main(int argc, char** argv) {
         return 1;
     }
 
-    if (!script_host->SetScriptModules(std::move(script_modules), error)) {
-        std::cerr << "[ERROR] load mod script modules failed: " << error << '\n';
-        mod_loader.Shutdown();
-        return 1;
+    const std::size_t shard_count = static_cast<std::size_t>(options.shard_count);
+    std::vector<std::unique_ptr<ServerShard>> shards;
+    shards.reserve(shard_count);
+    for (std::size_t shard_index = 0; shard_index < shard_count; ++shard_index) {
+        auto shard = std::make_unique<ServerShard>();
+        if (!CreateShard(shard_index, options, config, script_modules, *shard, error)) {
+            std::cerr << "[ERROR] " << error << '\n';
+            for (const std::unique_ptr<ServerShard>& created_shard : shards) {
+                ShutdownShard(*created_shard);
+            }
+            mod_loader.Shutdown();
+            return 1;
+        }
+        shards.push_back(std::move(shard));
     }
 
-    novaria::sim::SimulationKernel simulation_kernel(*world_service, *net_service, *script_host);
-    simulation_kernel.SetAuthorityMode(novaria::sim::SimulationAuthorityMode::Authority);
-
-    if (!simulation_kernel.Initialize(error)) {
-        std::cerr << "[ERROR] server initialize failed: " << error << '\n';
-        mod_loader.Shutdown();
-        return 1;
-    }
     const novaria::script::ScriptRuntimeDescriptor script_runtime_descriptor =
-        script_host->RuntimeDescriptor();
+        shards.front()->script_host->RuntimeDescriptor();
     novaria::core::Logger::Info(
         "script",
         "Script runtime active: backend=" + script_runtime_descriptor.backend_name +
             ", api_version=" + script_runtime_descriptor.api_version +
             ", sandbox=" + (script_runtime_descriptor.sandbox_enabled ? "true" : "false"));
 
-    const int preload_chunk_radius = 2;
-    for (int chunk_y = -preload_chunk_radius; chunk_y <= preload_chunk_radius; ++chunk_y) {
-        for (int chunk_x = -preload_chunk_radius; chunk_x <= preload_chunk_radius; ++chunk_x) {
-            simulation_kernel.SubmitLocalCommand(novaria::net::PlayerCommand{
-                .player_id = 1,
-                .command_id = novaria::sim::command::kWorldLoadChunk,
-                .payload = novaria::sim::command::EncodeWorldChunkPayload({.chunk_x = chunk_x, .chunk_y = chunk_y}),
-            });
-        }
-    }
-    simulation_kernel.Update(options.fixed_delta_seconds);
-
-    novaria::core::Logger::Info(
-        "server",
-        "Server started: local=" + config.net_udp_local_host +
-            ":" + std::to_string(config.net_udp_local_port) +
-            ", remote=" + config.net_udp_remote_host +
-            ":" + std::to_string(config.net_udp_remote_port) +
-            ", ticks_limit=" + std::to_string(options.ticks));
-
-    while (g_keep_running.load()) {
-        const std::uint64_t current_tick = simulation_kernel.CurrentTick();
-        if (options.ticks > 0 && current_tick >= options.ticks) {
-            break;
+    if (shard_count == 1) {
+        RunShard(*shards.front(), options);
+    } else {
+        novaria::core::Logger::Info(
+            "server",
+            "Hosting shards: count=" + std::to_string(shard_count) +
+                ", pin_threads=" + (options.pin_threads ? "true" : "false") +
+                ", hardware_threads=" + std::to_string(novaria::core::HardwareThreadCount()));
+        std::vector<std::thread> shard_threads;
+        shard_threads.reserve(shard_count);
+        for (const std::unique_ptr<ServerShard>& shard : shards) {
+            shard_threads.emplace_back([&options, shard = shard.get()]() { RunShard(*shard, options); });
         }
-
-        simulation_kernel.Update(options.fixed_delta_seconds);
-
-        if (options.log_interval_ticks > 0 &&
-            current_tick > 0 &&
-            current_tick % options.log_interval_ticks == 0) {
-            const novaria::net::NetDiagnosticsSnapshot diagnostics =
-                net_service->DiagnosticsSnapshot();
-            novaria::core::Logger::Info(
-                "server",
-                "Tick=" + std::to_string(current_tick) +
-                    ", session_state=" + std::to_string(static_cast<int>(diagnostics.session_state)) +
-                    ", transitions=" + std::to_string(diagnostics.session_transition_count) +
-                    ", timeout_disconnects=" + std::to_string(diagnostics.timeout_disconnect_count) +
-                    ", ignored_senders=" + std::to_string(diagnostics.ignored_unexpected_sender_count));
+        for (std::thread& shard_thread : shard_threads) {
+            shard_thread.join();
         }
-
-        const auto sleep_duration = std::chrono::duration<double>(options.fixed_delta_seconds);
-        std::this_thread::sleep_for(sleep_duration);
     }
 
-    simulation_kernel.Shutdown();
+    for (const std::unique_ptr<ServerShard>& shard : shards) {
+        ShutdownShard(*shard);
+    }
     mod_loader.Shutdown();
     novaria::core::Logger::Info("server", "Server stopped.");
     return 0;